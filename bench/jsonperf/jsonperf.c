@@ -0,0 +1,222 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * jsonperf --
+ *     Measure JSON cursor throughput: read a table through a dump=json cursor, then load the JSON
+ *     keys and values read into a second table through a dump=json cursor. Throughput is reported
+ *     in MB/s of JSON text. Run against builds before and after a change to JSON cursors to compare
+ *     them, the program only uses the public API.
+ */
+#include "test_util.h"
+
+#define MB (1024.0 * 1024.0)
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+static char home[512];   /* Program working dir */
+static uint64_t nrows;   /* Rows in the table */
+static u_int nruns;      /* Runs of each phase */
+static char **json_keys; /* JSON keys and values read from the table */
+static char **json_values;
+
+static void usage(void) WT_GCC_FUNC_DECL_ATTRIBUTE((noreturn));
+
+/*
+ * usage --
+ *     Display a usage message and exit.
+ */
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [-h home] [-n rows] [-r runs]\n", progname);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * elapsed --
+ *     Return the seconds since a start time.
+ */
+static double
+elapsed(struct timespec *start)
+{
+    struct timespec stop;
+
+    __wt_epoch(NULL, &stop);
+    return (WT_TIMEDIFF_US(stop, *start) / 1e6);
+}
+
+/*
+ * populate --
+ *     Fill the source table with rows of a string key, and a value of a string, an integer and a
+ *     string needing escapes, about 300 bytes of JSON per row.
+ */
+static void
+populate(WT_SESSION *session)
+{
+    WT_CURSOR *cursor;
+    uint64_t i;
+    char key[64], desc[256];
+
+    testutil_check(session->create(session, "table:source",
+      "key_format=S,value_format=SiS,columns=(id,name,count,desc)"));
+    testutil_check(session->open_cursor(session, "table:source", NULL, "bulk", &cursor));
+    for (i = 0; i < nrows; ++i) {
+        testutil_check(__wt_snprintf(key, sizeof(key), "key%010" PRIu64, i));
+        testutil_check(__wt_snprintf(desc, sizeof(desc),
+          "row %" PRIu64
+          " of the \"source\" table,\tan ordinary description of moderate length, "
+          "long enough that copying the runs of text between escapes matters\n"
+          "and with a second line, ending with a path C:\\wiredtiger\\%" PRIu64,
+          i, i % 97));
+        cursor->set_key(cursor, key);
+        cursor->set_value(cursor, "a person's name, unescaped", (int)(i % 1000), desc);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+}
+
+/*
+ * dump --
+ *     Read the source table through a JSON cursor, optionally saving the JSON, and return the bytes
+ *     of JSON read.
+ */
+static uint64_t
+dump(WT_SESSION *session, bool save)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    uint64_t bytes, i;
+    const char *key, *value;
+
+    testutil_check(session->open_cursor(session, "table:source", NULL, "dump=json", &cursor));
+    for (bytes = i = 0; (ret = cursor->next(cursor)) == 0; ++i) {
+        testutil_check(cursor->get_key(cursor, &key));
+        testutil_check(cursor->get_value(cursor, &value));
+        bytes += strlen(key) + strlen(value);
+        if (save) {
+            json_keys[i] = dstrdup(key);
+            json_values[i] = dstrdup(value);
+        }
+    }
+    testutil_assert(ret == WT_NOTFOUND && i == nrows);
+    testutil_check(cursor->close(cursor));
+    return (bytes);
+}
+
+/*
+ * load --
+ *     Insert the saved JSON into a new table through a JSON cursor.
+ */
+static void
+load(WT_SESSION *session, u_int run)
+{
+    WT_CURSOR *cursor;
+    uint64_t i;
+    char uri[64];
+
+    testutil_check(__wt_snprintf(uri, sizeof(uri), "table:load%u", run));
+    testutil_check(session->create(
+      session, uri, "key_format=S,value_format=SiS,columns=(id,name,count,desc)"));
+    testutil_check(session->open_cursor(session, uri, NULL, "dump=json", &cursor));
+    for (i = 0; i < nrows; ++i) {
+        cursor->set_key(cursor, json_keys[i]);
+        cursor->set_value(cursor, json_values[i]);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+}
+
+int
+main(int argc, char *argv[])
+{
+    struct timespec start;
+    WT_CONNECTION *conn;
+    WT_SESSION *session;
+    uint64_t bytes, i;
+    u_int run;
+    int ch;
+    const char *working_dir;
+
+    (void)testutil_set_progname(argv);
+
+    nrows = 200000;
+    nruns = 3;
+    working_dir = "WT_TEST.jsonperf";
+
+    while ((ch = __wt_getopt(progname, argc, argv, "h:n:r:")) != EOF)
+        switch (ch) {
+        case 'h':
+            working_dir = __wt_optarg;
+            break;
+        case 'n':
+            nrows = (uint64_t)atoll(__wt_optarg);
+            break;
+        case 'r':
+            nruns = (u_int)atoi(__wt_optarg);
+            break;
+        default:
+            usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0 || nrows == 0 || nruns == 0)
+        usage();
+
+    testutil_work_dir_from_path(home, sizeof(home), working_dir);
+    testutil_make_work_dir(home);
+    testutil_check(wiredtiger_open(home, NULL, "create,cache_size=1GB", &conn));
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+
+    populate(session);
+    json_keys = dcalloc(nrows, sizeof(char *));
+    json_values = dcalloc(nrows, sizeof(char *));
+    bytes = dump(session, true);
+    printf("%" PRIu64 " rows, %.1f MB of JSON\n", nrows, bytes / MB);
+
+    for (run = 0; run < nruns; ++run) {
+        __wt_epoch(NULL, &start);
+        (void)dump(session, false);
+        printf("dump: %.1f MB/s\n", bytes / MB / elapsed(&start));
+    }
+    for (run = 0; run < nruns; ++run) {
+        __wt_epoch(NULL, &start);
+        load(session, run);
+        printf("load: %.1f MB/s\n", bytes / MB / elapsed(&start));
+    }
+
+    for (i = 0; i < nrows; ++i) {
+        free(json_keys[i]);
+        free(json_values[i]);
+    }
+    free(json_keys);
+    free(json_values);
+    testutil_check(conn->close(conn, NULL));
+    testutil_clean_work_dir(home);
+    return (EXIT_SUCCESS);
+}
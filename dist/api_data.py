@@ -217,11 +217,14 @@ file_runtime_config = common_runtime_config + [
 # Per-file configuration
 file_config = format_meta + file_runtime_config + [
     Config('block_allocation', 'best', r'''
-        configure block allocation. Permitted values are \c "first" or
-        \c "best"; the \c "first" configuration uses a first-available
-        algorithm during block allocation, the \c "best" configuration
-        uses a best-fit algorithm''',
-        choices=['first', 'best',]),
+        configure block allocation. Permitted values are \c "first",
+        \c "best" or \c "sequential"; the \c "first" configuration uses a
+        first-available algorithm during block allocation, the \c "best"
+        configuration uses a best-fit algorithm, the \c "sequential"
+        configuration uses a best-fit algorithm except during checkpoints,
+        which lay out the blocks they write contiguously, in the order they
+        are written''',
+        choices=['first', 'best', 'sequential',]),
     Config('allocation_size', '4KB', r'''
         the file unit allocation size, in bytes, must a power-of-two;
         smaller values decrease the file space required by overflow
@@ -413,6 +416,13 @@ index_only_config = [
     Config('immutable', 'false', r'''
         configure the index to be immutable - that is an index is not changed
         by any update to a record in the table''', type='boolean'),
+    Config('include', '', r'''
+        list of table value columns stored in the index alongside the index
+        key.  Index cursors whose projection only names index key columns
+        and included columns are answered from the index without reading
+        the table.  Included columns may not be key columns of the table or
+        the index, and may not be combined with a custom extractor or an
+        immutable index''', type='list'),
 ]
 
 colgroup_meta = common_meta + source_meta
@@ -441,6 +451,18 @@ connection_runtime_config = [
             session_max''',
                 min='1', max='20'), # !!! Must match WT_ASYNC_MAX_WORKERS
             ]),
+    Config('background_compact', '', r'''
+        periodically compact files in the background. Enabling the
+        background compaction server uses a session from the configured
+        session_max''',
+        type='category', subconfig=[
+        Config('wait', '0', r'''
+            seconds to wait between each background compaction pass; setting
+            this value above 0 starts the server. Each pass reviews the open
+            files and compacts those where compaction is likely to recover
+            space''',
+            min='0', max='100000'),
+        ]),
     Config('cache_size', '100MB', r'''
         maximum heap memory to allocate for the cache. A database should
         configure either \c cache_size or \c shared_cache but not both''',
@@ -472,6 +494,12 @@ connection_runtime_config = [
         adjust this value based on allocator choice and behavior in measured
         workloads''',
         min='0', max='30'),
+    Config('cache_page_arena', 'false', r'''
+        allocate the structures that live as long as a page in the cache,
+        such as the arrays anchoring inserts and updates, from memory chunks
+        shared by the page rather than individually. This reduces the number of allocations, at the cost of
+        keeping some unused memory with each page''',
+        type='boolean'),
     Config('checkpoint', '', r'''
         periodically checkpoint the database. Enabling the checkpoint server
         uses a session from the configured session_max''',
@@ -892,6 +920,22 @@ wiredtiger_open_common =\
         flush files to stable storage when closing or writing
         checkpoints''',
         type='boolean'),
+    Config('cursor_pool', '', r'''
+        keep cached cursors for reuse after their session is closed''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            when a session with cached cursors is closed, keep the cursors
+            with the session's slot instead of closing them. The next session
+            opened takes over the cursors, so applications that open a new
+            session per request do not pay the full cost of opening each
+            cursor again''',
+            type='boolean'),
+        Config('prewarm', '', r'''
+            list of URIs for which cursors are opened and cached when the
+            connection is opened, so they are available to the first session
+            the application opens. Requires \c cursor_pool.enabled''',
+            type='list'),
+        ]),
     Config('direct_io', '', r'''
         Use \c O_DIRECT on POSIX systems, and \c FILE_FLAG_NO_BUFFERING on
         Windows to access files.  Options are given as a list, such as
@@ -1491,6 +1535,12 @@ methods = {
         if the record exists, WT_CURSOR::update and WT_CURSOR::remove
         fail with ::WT_NOTFOUND if the record does not exist''',
         type='boolean'),
+    Config('poll', 'false', r'''
+        deliver the result of the operation through
+        WT_CONNECTION::async_poll rather than a callback.  The callback
+        must be NULL; the operation handle is returned to the application
+        when it completes and must be released with WT_ASYNC_OP::release''',
+        type='boolean'),
     Config('raw', 'false', r'''
         ignore the encodings for the key and value, manage data as if
         the formats were \c "u".  See @ref cursor_raw for details''',
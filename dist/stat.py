@@ -8,6 +8,15 @@ from dist import compare_srcfile, format_srcfile
 from stat_data import groups, dsrc_stats, connection_stats, join_stats, \
     session_stats
 
+# The buckets of each latency histogram are updated by index from the first
+# bucket, they must be consecutive statistics.
+for stats in (connection_stats, dsrc_stats):
+    for prev, l in zip(stats, stats[1:]):
+        m = re.search('_hist_([0-9][0-9])$', l.name)
+        if m and m.group(1) != '00' and prev.name != \
+            '%s_hist_%02d' % (l.name[:m.start()], int(m.group(1)) - 1):
+            sys.exit('stat.py: ' + l.name + ' out of order')
+
 def print_struct(title, name, base, stats):
     '''Print the structures for the stat.h file.'''
     f.write('/*\n')
@@ -199,8 +208,7 @@ __wt_stat_''' + name + '_clear_all(WT_' + name.upper() + '''_STATS **stats)
 }
 ''')
 
-    # Single structure aggregation is currently only used by data sources.
-    if name == 'dsrc':
+    if name != 'session':
         f.write('''
 void
 __wt_stat_''' + name + '''_aggregate_single(
@@ -224,27 +232,26 @@ void
 __wt_stat_''' + name + '''_aggregate(
     WT_''' + name.upper() + '_STATS **from, WT_' + name.upper() + '''_STATS *to)
 {
+\tWT_''' + name.upper() + '''_STATS sum;
+
+\t__wt_stats_sum(from, &sum, sizeof(sum));
+\t__wt_stat_''' + name + '''_aggregate_single(&sum, to);
+}
 ''')
-        # Connection level aggregation does not currently have any computation
-        # of a maximum value; I'm leaving in support for it, but don't declare
-        # a temporary variable until it's needed.
-        for l in statlist:
-            if 'max_aggregate' in l.flags:
-                f.write('\tint64_t v;\n\n')
-                break;
-        for l in statlist:
-            if 'max_aggregate' in l.flags:
-                o = '\tif ((v = WT_STAT_READ(from, ' + l.name + ')) > ' +\
-                    'to->' + l.name + ')\n'
-                if len(o) > 72:             # Account for the leading tab.
-                    o = o.replace(' > ', ' >\n\t    ')
-                o +='\t\tto->' + l.name + ' = v;\n'
-            else:
-                o = '\tto->' + l.name + ' += WT_STAT_READ(from, ' + l.name +\
-                    ');\n'
-                if len(o) > 72:             # Account for the leading tab.
-                    o = o.replace(' += ', ' +=\n\t    ')
-            f.write(o)
+
+    # Latency histogram percentiles are calculated from the histogram buckets.
+    percentiles = [l for l in statlist if re.search('_p999?$', l.name)]
+    if percentiles:
+        f.write('''
+void
+__wt_stat_''' + name + '_percentiles(WT_' + name.upper() + '''_STATS *stats)
+{
+''')
+        for l in percentiles:
+            hist, p = l.name.rsplit('_', 1)
+            f.write('\tstats->' + l.name +
+                ' = __wt_stat_lat_hist_percentile(&stats->' + hist +
+                '_hist_00, ' + {'p99' : '990', 'p999' : '999'}[p] + ');\n')
         f.write('}\n')
 
 # Write the stat initialization and refresh routines to the stat.c file.
@@ -76,6 +76,10 @@ class JoinStat(Stat):
     prefix = ''  # prefix is inserted dynamically
     def __init__(self, name, desc, flags=''):
         Stat.__init__(self, name, JoinStat.prefix, desc, flags)
+class LatencyStat(Stat):
+    prefix = 'latency'
+    def __init__(self, name, desc, flags=''):
+        Stat.__init__(self, name, LatencyStat.prefix, desc, flags)
 class LockStat(Stat):
     prefix = 'lock'
     def __init__(self, name, desc, flags=''):
@@ -141,11 +145,45 @@ groups['system'] = [
     CapacityStat.prefix,
     ConnStat.prefix,
     DhandleStat.prefix,
+    LatencyStat.prefix,
     PerfHistStat.prefix,
     SessionOpStat.prefix,
     ThreadStat.prefix
 ]
 
+##########################################
+# Latency histograms
+##########################################
+# Latency histograms are log-linear, see WT_LAT_HIST_BUCKETS in stat.h: the
+# first bucket counts values less than 8, each following power of two up to
+# 2^17 is split into two buckets of equal width, and the last bucket counts
+# values of 2^17 and larger. The buckets of a histogram are updated by index
+# from the first bucket, the bucket numbers are zero-padded so the buckets
+# sort into consecutive statistics. The percentiles are calculated from the
+# buckets when the statistics are read.
+def latency_hist(name, desc, unit):
+    units = {'ms' : 'msecs', 'us' : 'usecs'}[unit]
+    hist = [
+        LatencyStat(name + '_p99',
+            desc + ' 99th percentile (' + units + ')', 'no_clear,no_scale'),
+        LatencyStat(name + '_p999',
+            desc + ' 99.9th percentile (' + units + ')', 'no_clear,no_scale'),
+        LatencyStat(name + '_hist_00',
+            desc + ' histogram (bucket 00) - 0-7' + unit),
+    ]
+    bucket = 1
+    for bit in range(3, 17):
+        for half in range(2):
+            low = (1 << bit) + half * (1 << (bit - 1))
+            high = low + (1 << (bit - 1)) - 1
+            hist.append(LatencyStat('%s_hist_%02d' % (name, bucket),
+                '%s histogram (bucket %02d) - %d-%d%s' %
+                (desc, bucket, low, high, unit)))
+            bucket += 1
+    hist.append(LatencyStat('%s_hist_%02d' % (name, bucket),
+        '%s histogram (bucket %02d) - %d%s+' % (desc, bucket, 1 << 17, unit)))
+    return hist
+
 ##########################################
 # CONNECTION statistics
 ##########################################
@@ -206,6 +244,7 @@ connection_stats = [
     CacheStat('cache_bytes_inuse', 'bytes currently in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_leaf', 'tracked bytes belonging to leaf pages in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_lookaside', 'bytes belonging to the cache overflow table in the cache', 'no_clear,no_scale,size'),
+    CacheStat('cache_bytes_lookaside_history', 'bytes of cache overflow history kept in memory', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_max', 'maximum bytes configured', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_other', 'bytes not belonging to page images in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_read', 'bytes read into cache', 'size'),
@@ -229,6 +268,7 @@ connection_stats = [
     CacheStat('cache_eviction_force_fail', 'forced eviction - pages selected unable to be evicted count'),
     CacheStat('cache_eviction_force_fail_time', 'forced eviction - pages selected unable to be evicted time'),
     CacheStat('cache_eviction_force_retune', 'force re-tuning of eviction workers once in a while'),
+    CacheStat('cache_eviction_force_shrink', 'forced eviction - pages shrunk in memory instead of evicted'),
     CacheStat('cache_eviction_get_ref', 'eviction calls to get a page'),
     CacheStat('cache_eviction_get_ref_empty', 'eviction calls to get a page found queue empty'),
     CacheStat('cache_eviction_get_ref_empty2', 'eviction calls to get a page found queue empty after locking'),
@@ -272,12 +312,14 @@ connection_stats = [
     CacheStat('cache_eviction_worker_evicting', 'eviction worker thread evicting pages'),
     CacheStat('cache_eviction_worker_removed', 'eviction worker thread removed'),
     CacheStat('cache_hazard_checks', 'hazard pointer check calls'),
+    CacheStat('cache_hazard_filtered', 'hazard pointer check calls resolved by the hazard filter'),
     CacheStat('cache_hazard_max', 'hazard pointer maximum array length', 'max_aggregate,no_scale'),
     CacheStat('cache_hazard_walks', 'hazard pointer check entries walked'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
     CacheStat('cache_inmem_splittable', 'in-memory page passed criteria to be split'),
     CacheStat('cache_lookaside_cursor_wait_application', 'cache overflow cursor application thread wait time (usecs)'),
     CacheStat('cache_lookaside_cursor_wait_internal', 'cache overflow cursor internal thread wait time (usecs)'),
+    CacheStat('cache_lookaside_history_inmem', 'cache overflow history blocks kept in memory'),
     CacheStat('cache_lookaside_entries', 'cache overflow table entries', 'no_clear,no_scale'),
     CacheStat('cache_lookaside_insert', 'cache overflow table insert calls'),
     CacheStat('cache_lookaside_ondisk', 'cache overflow table on-disk size', 'no_clear,no_scale,size'),
@@ -331,6 +373,7 @@ connection_stats = [
     CursorStat('cursor_cached_count', 'cached cursor count', 'no_clear,no_scale'),
     CursorStat('cursor_cache', 'cursor close calls that result in cache'),
     CursorStat('cursor_create', 'cursor create calls'),
+    CursorStat('cursor_index_only', 'cursor index positions read without the table'),
     CursorStat('cursor_insert', 'cursor insert calls'),
     CursorStat('cursor_insert_bulk', 'cursor bulk loaded cursor insert calls'),
     CursorStat('cursor_insert_bytes', 'cursor insert key and value bytes', 'size'),
@@ -351,6 +394,7 @@ connection_stats = [
     CursorStat('cursor_update', 'cursor update calls'),
     CursorStat('cursor_update_bytes', 'cursor update key and value bytes', 'size'),
     CursorStat('cursor_update_bytes_changed', 'cursor update value size change', 'size'),
+    CursorStat('cursor_update_index_unchanged', 'cursor update index keys left unchanged'),
 
     ##########################################
     # Cursor sweep
@@ -379,9 +423,19 @@ connection_stats = [
     LockStat('lock_checkpoint_count', 'checkpoint lock acquisitions'),
     LockStat('lock_checkpoint_wait_application', 'checkpoint lock application thread wait time (usecs)'),
     LockStat('lock_checkpoint_wait_internal', 'checkpoint lock internal thread wait time (usecs)'),
+    LockStat('lock_checkpoint_hist_lt10', 'checkpoint lock wait time histogram (bucket 1) - 0-9us'),
+    LockStat('lock_checkpoint_hist_lt100', 'checkpoint lock wait time histogram (bucket 2) - 10-99us'),
+    LockStat('lock_checkpoint_hist_lt1000', 'checkpoint lock wait time histogram (bucket 3) - 100-999us'),
+    LockStat('lock_checkpoint_hist_lt10000', 'checkpoint lock wait time histogram (bucket 4) - 1000-9999us'),
+    LockStat('lock_checkpoint_hist_gt10000', 'checkpoint lock wait time histogram (bucket 5) - 10000us+'),
     LockStat('lock_dhandle_read_count', 'dhandle read lock acquisitions'),
     LockStat('lock_dhandle_wait_application', 'dhandle lock application thread time waiting (usecs)'),
     LockStat('lock_dhandle_wait_internal', 'dhandle lock internal thread time waiting (usecs)'),
+    LockStat('lock_dhandle_hist_lt10', 'dhandle lock wait time histogram (bucket 1) - 0-9us'),
+    LockStat('lock_dhandle_hist_lt100', 'dhandle lock wait time histogram (bucket 2) - 10-99us'),
+    LockStat('lock_dhandle_hist_lt1000', 'dhandle lock wait time histogram (bucket 3) - 100-999us'),
+    LockStat('lock_dhandle_hist_lt10000', 'dhandle lock wait time histogram (bucket 4) - 1000-9999us'),
+    LockStat('lock_dhandle_hist_gt10000', 'dhandle lock wait time histogram (bucket 5) - 10000us+'),
     LockStat('lock_dhandle_write_count', 'dhandle write lock acquisitions'),
     LockStat('lock_durable_timestamp_read_count', 'durable timestamp queue read lock acquisitions'),
     LockStat('lock_durable_timestamp_wait_application', 'durable timestamp queue lock application thread time waiting (usecs)'),
@@ -390,6 +444,11 @@ connection_stats = [
     LockStat('lock_metadata_count', 'metadata lock acquisitions'),
     LockStat('lock_metadata_wait_application', 'metadata lock application thread wait time (usecs)'),
     LockStat('lock_metadata_wait_internal', 'metadata lock internal thread wait time (usecs)'),
+    LockStat('lock_metadata_hist_lt10', 'metadata lock wait time histogram (bucket 1) - 0-9us'),
+    LockStat('lock_metadata_hist_lt100', 'metadata lock wait time histogram (bucket 2) - 10-99us'),
+    LockStat('lock_metadata_hist_lt1000', 'metadata lock wait time histogram (bucket 3) - 100-999us'),
+    LockStat('lock_metadata_hist_lt10000', 'metadata lock wait time histogram (bucket 4) - 1000-9999us'),
+    LockStat('lock_metadata_hist_gt10000', 'metadata lock wait time histogram (bucket 5) - 10000us+'),
     LockStat('lock_read_timestamp_read_count', 'read timestamp queue read lock acquisitions'),
     LockStat('lock_read_timestamp_wait_application', 'read timestamp queue lock application thread time waiting (usecs)'),
     LockStat('lock_read_timestamp_wait_internal', 'read timestamp queue lock internal thread time waiting (usecs)'),
@@ -397,9 +456,19 @@ connection_stats = [
     LockStat('lock_schema_count', 'schema lock acquisitions'),
     LockStat('lock_schema_wait_application', 'schema lock application thread wait time (usecs)'),
     LockStat('lock_schema_wait_internal', 'schema lock internal thread wait time (usecs)'),
+    LockStat('lock_schema_hist_lt10', 'schema lock wait time histogram (bucket 1) - 0-9us'),
+    LockStat('lock_schema_hist_lt100', 'schema lock wait time histogram (bucket 2) - 10-99us'),
+    LockStat('lock_schema_hist_lt1000', 'schema lock wait time histogram (bucket 3) - 100-999us'),
+    LockStat('lock_schema_hist_lt10000', 'schema lock wait time histogram (bucket 4) - 1000-9999us'),
+    LockStat('lock_schema_hist_gt10000', 'schema lock wait time histogram (bucket 5) - 10000us+'),
     LockStat('lock_table_read_count', 'table read lock acquisitions'),
     LockStat('lock_table_wait_application', 'table lock application thread time waiting for the table lock (usecs)'),
     LockStat('lock_table_wait_internal', 'table lock internal thread time waiting for the table lock (usecs)'),
+    LockStat('lock_table_hist_lt10', 'table lock wait time histogram (bucket 1) - 0-9us'),
+    LockStat('lock_table_hist_lt100', 'table lock wait time histogram (bucket 2) - 10-99us'),
+    LockStat('lock_table_hist_lt1000', 'table lock wait time histogram (bucket 3) - 100-999us'),
+    LockStat('lock_table_hist_lt10000', 'table lock wait time histogram (bucket 4) - 1000-9999us'),
+    LockStat('lock_table_hist_gt10000', 'table lock wait time histogram (bucket 5) - 10000us+'),
     LockStat('lock_table_write_count', 'table write lock acquisitions'),
     LockStat('lock_txn_global_read_count', 'txn global read lock acquisitions'),
     LockStat('lock_txn_global_wait_application', 'txn global lock application thread time waiting (usecs)'),
@@ -594,6 +663,8 @@ connection_stats = [
     TxnStat('txn_set_ts_oldest_upd', 'set timestamp oldest updates'),
     TxnStat('txn_set_ts_stable', 'set timestamp stable calls'),
     TxnStat('txn_set_ts_stable_upd', 'set timestamp stable updates'),
+    TxnStat('txn_snapshot_cache_hit', 'transaction snapshots shared from the snapshot cache'),
+    TxnStat('txn_snapshot_cache_set', 'transaction snapshots added to the snapshot cache'),
     TxnStat('txn_snapshots_created', 'number of named snapshots created'),
     TxnStat('txn_snapshots_dropped', 'number of named snapshots dropped'),
     TxnStat('txn_sync', 'transaction sync calls'),
@@ -620,6 +691,19 @@ connection_stats = [
     YieldStat('txn_release_blocked', 'connection close blocked waiting for transaction state stabilization'),
 ]
 
+connection_stats += \
+    latency_hist('lat_checkpoint_metadata', 'checkpoint metadata', 'ms') + \
+    latency_hist('lat_checkpoint_prepare', 'checkpoint prepare', 'ms') + \
+    latency_hist('lat_checkpoint_scrub', 'checkpoint scrub', 'ms') + \
+    latency_hist('lat_checkpoint_sync', 'checkpoint sync', 'ms') + \
+    latency_hist('lat_checkpoint_tree', 'checkpoint tree write', 'ms') + \
+    latency_hist('lat_cursor_insert', 'cursor insert', 'us') + \
+    latency_hist('lat_cursor_remove', 'cursor remove', 'us') + \
+    latency_hist('lat_cursor_search', 'cursor search', 'us') + \
+    latency_hist('lat_cursor_update', 'cursor update', 'us') + \
+    latency_hist('lat_page_read', 'application thread page read', 'us') + \
+    latency_hist('lat_txn_commit', 'transaction commit', 'us')
+
 connection_stats = sorted(connection_stats, key=attrgetter('desc'))
 
 ##########################################
@@ -821,6 +905,7 @@ dsrc_stats = sorted(dsrc_stats, key=attrgetter('desc'))
 join_stats = [
     JoinStat('bloom_false_positive', 'bloom filter false positives'),
     JoinStat('bloom_insert', 'items inserted into a bloom filter'),
+    JoinStat('hash_insert', 'items inserted into a hash set'),
     JoinStat('iterated', 'items iterated'),
     JoinStat('main_access', 'accesses to the main table'),
     JoinStat('membership_check', 'checks that conditions of membership are satisfied'),
@@ -31,6 +31,7 @@ COPYDOC(__wt_async_op, WT_ASYNC_OP, remove)
 COPYDOC(__wt_async_op, WT_ASYNC_OP, compact)
 COPYDOC(__wt_async_op, WT_ASYNC_OP, get_id)
 COPYDOC(__wt_async_op, WT_ASYNC_OP, get_type)
+COPYDOC(__wt_async_op, WT_ASYNC_OP, release)
 COPYDOC(__wt_session, WT_SESSION, close)
 COPYDOC(__wt_session, WT_SESSION, reconfigure)
 COPYDOC(__wt_session, WT_SESSION, open_cursor)
@@ -62,6 +63,7 @@ COPYDOC(__wt_session, WT_SESSION, transaction_sync)
 COPYDOC(__wt_session, WT_SESSION, breakpoint)
 COPYDOC(__wt_connection, WT_CONNECTION, async_flush)
 COPYDOC(__wt_connection, WT_CONNECTION, async_new_op)
+COPYDOC(__wt_connection, WT_CONNECTION, async_poll)
 COPYDOC(__wt_connection, WT_CONNECTION, close)
 COPYDOC(__wt_connection, WT_CONNECTION, debug_info)
 COPYDOC(__wt_connection, WT_CONNECTION, reconfigure)
@@ -2096,6 +2096,7 @@ static void modify_impl_release(WT_MODIFY_IMPL *impl) {
 %ignore __wt_event_handler;
 %ignore __wt_extractor;
 %ignore __wt_connection::add_extractor;
+%ignore __wt_connection::async_poll;
 %ignore __wt_file_system;
 %ignore __wt_file_handle;
 %ignore __wt_connection::set_file_system;
@@ -1131,6 +1131,7 @@ int diagnostic_build();
 %ignore __wt_connection::add_data_source;
 %ignore __wt_connection::add_encryptor;
 %ignore __wt_connection::add_extractor;
+%ignore __wt_connection::async_poll;
 %ignore __wt_connection::get_extension_api;
 %ignore __wt_session::log_printf;
 
@@ -23,6 +23,7 @@ __async_get_format(
     WT_SESSION *wt_session;
     WT_SESSION_IMPL *session;
     uint64_t cfg_hash, uri_hash;
+    const char *cfg[] = {NULL, NULL};
 
     async = conn->async;
     c = NULL;
@@ -54,7 +55,16 @@ __async_get_format(
     __wt_spin_lock(session, &async->ops_lock);
     WT_ERR(__wt_calloc_one(session, &af));
     WT_ERR(__wt_strdup(session, uri, &af->uri));
-    WT_ERR(__wt_strdup(session, config, &af->config));
+    /*
+     * The configuration is used to open the worker cursors, discard the setting that only applies
+     * to the async op itself.
+     */
+    if (config == NULL)
+        af->config = NULL;
+    else {
+        cfg[0] = config;
+        WT_ERR(__wt_config_merge(session, cfg, "poll=", &af->config));
+    }
     af->uri_hash = uri_hash;
     af->cfg_hash = cfg_hash;
     /*
@@ -232,7 +242,9 @@ __async_start(WT_SESSION_IMPL *session)
     async = conn->async;
     TAILQ_INIT(&async->formatqh);
     WT_RET(__wt_spin_init(session, &async->ops_lock, "ops"));
+    WT_RET(__wt_spin_init(session, &async->cq_lock, "async completion queue"));
     WT_RET(__wt_cond_alloc(session, "async flush", &async->flush_cond));
+    WT_RET(__wt_cond_alloc(session, "async worker", &async->worker_cond));
     WT_RET(__wt_async_op_init(session));
 
     /*
@@ -385,6 +397,7 @@ __wt_async_reconfig(WT_SESSION_IMPL *session, const char *cfg[])
             WT_ASSERT(session, async->worker_tids[i].created);
             WT_ASSERT(session, async->worker_sessions[i] != NULL);
             F_CLR(async->worker_sessions[i], WT_SESSION_SERVER_ASYNC);
+            __wt_cond_signal(session, async->worker_cond);
             WT_TRET(__wt_thread_join(session, &async->worker_tids[i]));
             wt_session = &async->worker_sessions[i]->iface;
             WT_TRET(wt_session->close(wt_session, NULL));
@@ -418,9 +431,11 @@ __wt_async_destroy(WT_SESSION_IMPL *session)
         return (0);
 
     F_CLR(conn, WT_CONN_SERVER_ASYNC);
+    __wt_cond_signal(session, async->worker_cond);
     for (i = 0; i < conn->async_workers; i++)
         WT_TRET(__wt_thread_join(session, &async->worker_tids[i]));
     __wt_cond_destroy(session, &async->flush_cond);
+    __wt_cond_destroy(session, &async->worker_cond);
 
     /* Close the server threads' sessions. */
     for (i = 0; i < conn->async_workers; i++)
@@ -447,8 +462,10 @@ __wt_async_destroy(WT_SESSION_IMPL *session)
         __wt_free(session, af->value_format);
         __wt_free(session, af);
     }
+    __wt_free(session, async->async_cq);
     __wt_free(session, async->async_queue);
     __wt_free(session, async->async_ops);
+    __wt_spin_destroy(session, &async->cq_lock);
     __wt_spin_destroy(session, &async->ops_lock);
     __wt_free(session, conn->async);
 
@@ -548,6 +565,8 @@ __async_runtime_config(WT_ASYNC_OP_IMPL *op, const char *cfg[])
         F_SET(&asyncop->c, WT_CURSTD_RAW);
     else
         F_CLR(&asyncop->c, WT_CURSTD_RAW);
+    WT_RET(__wt_config_gets_def(session, cfg, "poll", 0, &cval));
+    op->poll = cval.val != 0;
     return (0);
 }
 
@@ -576,6 +595,8 @@ __wt_async_new_op(WT_SESSION_IMPL *session, const char *uri, const char *config,
     WT_ERR(__async_new_op_alloc(session, uri, config, &op));
     cfg[1] = config;
     WT_ERR(__async_runtime_config(op, cfg));
+    if (op->poll && cb != NULL)
+        WT_ERR_MSG(session, EINVAL, "a callback cannot be specified for a polled operation");
     op->cb = cb;
     *opp = op;
     return (0);
@@ -588,3 +609,47 @@ err:
         op->state = WT_ASYNCOP_FREE;
     return (ret);
 }
+
+/*
+ * __wt_async_poll --
+ *     Implementation of the WT_CONN->async_poll method.
+ */
+int
+__wt_async_poll(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL **opp, int *op_retp)
+{
+    WT_ASYNC *async;
+    WT_ASYNC_OP_IMPL *op;
+    WT_CONNECTION_IMPL *conn;
+    uint64_t cq_head;
+
+    *opp = NULL;
+    *op_retp = 0;
+
+    /* If async isn't running, nothing can have completed. */
+    conn = S2C(session);
+    if (!conn->async_cfg)
+        return (WT_NOTFOUND);
+    async = conn->async;
+
+    /* Check for an empty queue without locking, the common case for an event loop. */
+    WT_ORDERED_READ(cq_head, async->cq_head);
+    if (cq_head == async->cq_tail)
+        return (WT_NOTFOUND);
+
+    __wt_spin_lock(session, &async->cq_lock);
+    if (async->cq_head == async->cq_tail) {
+        __wt_spin_unlock(session, &async->cq_lock);
+        return (WT_NOTFOUND);
+    }
+    op = async->async_cq[async->cq_tail % conn->async_size];
+    async->async_cq[async->cq_tail % conn->async_size] = NULL;
+    ++async->cq_tail;
+    __wt_spin_unlock(session, &async->cq_lock);
+
+    /* The op belongs to the application again, it can be resubmitted or released. */
+    WT_ASSERT(session, op->state == WT_ASYNCOP_COMPLETE);
+    *op_retp = op->op_ret;
+    WT_PUBLISH(op->state, WT_ASYNCOP_READY);
+    *opp = op;
+    return (0);
+}
@@ -205,6 +205,31 @@ __async_get_type(WT_ASYNC_OP *asyncop)
     return (((WT_ASYNC_OP_IMPL *)asyncop)->optype);
 }
 
+/*
+ * __async_release --
+ *     WT_ASYNC_OP->release implementation for op handles.
+ */
+static int
+__async_release(WT_ASYNC_OP *asyncop)
+{
+    WT_ASYNC_OP_IMPL *op;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    op = (WT_ASYNC_OP_IMPL *)asyncop;
+    ASYNCOP_API_CALL(O2C(op), session, release);
+    /*
+     * Only a handle owned by the application can be released: one that is queued, running or
+     * waiting to be polled still belongs to the async subsystem.
+     */
+    if (op->state != WT_ASYNCOP_READY)
+        WT_ERR_MSG(session, EINVAL, "application error: WT_ASYNC_OP not owned by the application");
+    F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+    WT_PUBLISH(op->state, WT_ASYNCOP_FREE);
+err:
+    API_END_RET(session, ret);
+}
+
 /*
  * __async_op_init --
  *     Initialize all the op handle fields.
@@ -229,6 +254,7 @@ __async_op_init(WT_CONNECTION_IMPL *conn, WT_ASYNC_OP_IMPL *op, uint32_t id)
     asyncop->compact = __async_compact;
     asyncop->get_id = __async_get_id;
     asyncop->get_type = __async_get_type;
+    asyncop->release = __async_release;
     /*
      * The cursor needs to have the get/set key/value functions initialized. It also needs the
      * key/value related fields set up.
@@ -307,9 +333,35 @@ __wt_async_op_enqueue(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op)
         WT_ORDERED_READ(cur_head, async->head);
     }
     WT_PUBLISH(async->head, my_alloc);
+
+    /* Wake any worker waiting for work. */
+    __wt_cond_signal(session, async->worker_cond);
     return (0);
 }
 
+/*
+ * __wt_async_op_complete --
+ *     Place a completed op allocated with the poll configuration onto the completion queue.
+ */
+void
+__wt_async_op_complete(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op, int op_ret)
+{
+    WT_ASYNC *async;
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+    async = conn->async;
+
+    op->op_ret = op_ret;
+    op->state = WT_ASYNCOP_COMPLETE;
+
+    __wt_spin_lock(session, &async->cq_lock);
+    WT_ASSERT(session, async->cq_head - async->cq_tail < conn->async_size);
+    async->async_cq[async->cq_head % conn->async_size] = op;
+    WT_PUBLISH(async->cq_head, async->cq_head + 1);
+    __wt_spin_unlock(session, &async->cq_lock);
+}
+
 /*
  * __wt_async_op_init --
  *     Initialize all the op handles.
@@ -337,6 +389,10 @@ __wt_async_op_init(WT_SESSION_IMPL *session)
      */
     async->async_qsize = conn->async_size + 2;
     WT_RET(__wt_calloc_def(session, async->async_qsize, &async->async_queue));
+    /*
+     * Allocate the completion queue, which only ever holds user ops.
+     */
+    WT_ERR(__wt_calloc_def(session, conn->async_size, &async->async_cq));
     /*
      * Allocate and initialize all the user ops.
      */
@@ -349,6 +405,7 @@ __wt_async_op_init(WT_SESSION_IMPL *session)
 
 err:
     __wt_free(session, async->async_ops);
+    __wt_free(session, async->async_cq);
     __wt_free(session, async->async_queue);
     return (ret);
 }
@@ -8,28 +8,44 @@
 
 #include "wt_internal.h"
 
+/*
+ * __async_worker_idle --
+ *     Return if an async worker thread should keep waiting for work.
+ */
+static bool
+__async_worker_idle(WT_SESSION_IMPL *session)
+{
+    WT_ASYNC *async;
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+    async = conn->async;
+    return (async->alloc_tail == async->head && async->flush_state != WT_ASYNC_FLUSHING &&
+      F_ISSET(conn, WT_CONN_SERVER_ASYNC) && F_ISSET(session, WT_SESSION_SERVER_ASYNC));
+}
+
 /*
  * __async_op_dequeue --
- *     Wait for work to be available. Then atomically take it off the work queue.
+ *     Wait for work to be available. Then atomically take a batch of ops off the work queue.
  */
 static int
-__async_op_dequeue(WT_CONNECTION_IMPL *conn, WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL **op)
+__async_op_dequeue(
+  WT_CONNECTION_IMPL *conn, WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL **ops, uint32_t *countp)
 {
     WT_ASYNC *async;
-    uint64_t cur_tail, last_consume, my_consume, my_slot, prev_slot;
-    uint64_t sleep_usec;
-    uint32_t tries;
+    WT_ASYNC_OP_IMPL *op;
+    uint64_t cur_head, cur_tail, last_consume, my_consume, my_slot, prev_slot;
+    uint32_t count, i, tries;
 
-    *op = NULL;
+    *countp = 0;
 
     async = conn->async;
 /*
- * Wait for work to do. Work is available when async->head moves. Then grab the slot containing the
+ * Wait for work to do. Work is available when async->head moves. Then grab the slots containing the
  * work. If we lose, try again.
  */
 retry:
     tries = 0;
-    sleep_usec = 100;
     WT_ORDERED_READ(last_consume, async->alloc_tail);
     /*
      * We stay in this loop until there is work to do.
@@ -41,14 +57,12 @@ retry:
              * Initially when we find no work, allow other threads to run.
              */
             __wt_yield();
-        else {
+        else
             /*
-             * If we haven't found work in a while, start sleeping to wait for work to arrive
-             * instead of spinning.
+             * If we haven't found work in a while, wait to be signalled by the next enqueue instead
+             * of spinning. The timeout is only a backstop, every enqueue signals the condition.
              */
-            __wt_sleep(0, sleep_usec);
-            sleep_usec = WT_MIN(sleep_usec * 2, MAX_ASYNC_SLEEP_USECS);
-        }
+            __wt_cond_wait(session, async->worker_cond, MAX_ASYNC_SLEEP_USECS, __async_worker_idle);
         if (!F_ISSET(session, WT_SESSION_SERVER_ASYNC))
             return (0);
         if (!F_ISSET(conn, WT_CONN_SERVER_ASYNC))
@@ -57,31 +71,55 @@ retry:
     }
     if (async->flush_state == WT_ASYNC_FLUSHING)
         return (0);
+
     /*
-     * Try to increment the tail to claim this slot. If we lose a race, try again.
+     * Claim up to a batch of the visible ops with a single update of the tail. Stop at the flush op
+     * so the ops queued behind it aren't started until the flush completes. We're reading slots we
+     * don't own yet: if another worker consumes them first, we either see a cleared slot or lose
+     * the race to increment the tail, and try again.
      */
-    my_consume = last_consume + 1;
+    WT_ORDERED_READ(cur_head, async->head);
+    for (count = 0; count < MAX_ASYNC_BATCH && last_consume + count < cur_head;) {
+        op = async->async_queue[(last_consume + count + 1) % async->async_qsize];
+        if (op == NULL)
+            break;
+        ++count;
+        if (op == &async->flush_op)
+            break;
+    }
+    if (count == 0)
+        goto retry;
+    my_consume = last_consume + count;
     if (!__wt_atomic_cas64(&async->alloc_tail, last_consume, my_consume))
         goto retry;
+
     /*
-     * This item of work is ours to process. Clear it out of the queue and return.
+     * These items of work are ours to process. Clear them out of the queue and return.
      */
-    my_slot = my_consume % async->async_qsize;
-    prev_slot = last_consume % async->async_qsize;
-    *op = async->async_queue[my_slot];
-    async->async_queue[my_slot] = NULL;
+    for (i = 0; i < count; ++i) {
+        my_slot = (last_consume + i + 1) % async->async_qsize;
+        op = ops[i] = async->async_queue[my_slot];
+        async->async_queue[my_slot] = NULL;
 
-    WT_ASSERT(session, async->cur_queue > 0);
-    WT_ASSERT(session, *op != NULL);
-    WT_ASSERT(session, (*op)->state == WT_ASYNCOP_ENQUEUED);
-    (void)__wt_atomic_sub32(&async->cur_queue, 1);
-    (*op)->state = WT_ASYNCOP_WORKING;
+        WT_ASSERT(session, op != NULL);
+        WT_ASSERT(session, op->state == WT_ASYNCOP_ENQUEUED);
+        op->state = WT_ASYNCOP_WORKING;
 
-    if (*op == &async->flush_op)
-        /*
-         * We're the worker to take the flush op off the queue.
-         */
-        WT_PUBLISH(async->flush_state, WT_ASYNC_FLUSHING);
+        if (op == &async->flush_op) {
+            /*
+             * We're the worker to take the flush op off the queue. Wake any idle workers so they
+             * notice the flush.
+             */
+            WT_PUBLISH(async->flush_state, WT_ASYNC_FLUSHING);
+            __wt_cond_signal(session, async->worker_cond);
+        }
+    }
+    WT_ASSERT(session, async->cur_queue >= count);
+    (void)__wt_atomic_sub32(&async->cur_queue, count);
+    *countp = count;
+
+    my_slot = my_consume % async->async_qsize;
+    prev_slot = last_consume % async->async_qsize;
     WT_ORDERED_READ(cur_tail, async->tail_slot);
     while (cur_tail != prev_slot) {
         __wt_yield();
@@ -131,8 +169,13 @@ __async_worker_cursor(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op, WT_ASYNC_W
     TAILQ_FOREACH (ac, &worker->cursorqh, q) {
         if (op->format->cfg_hash == ac->cfg_hash && op->format->uri_hash == ac->uri_hash) {
             /*
-             * If one of our cached cursors has a matching signature, use it and we're done.
+             * If one of our cached cursors has a matching signature, use it and we're done. Move it
+             * to the head so the ops of a batch on the same table find it immediately.
              */
+            if (ac != TAILQ_FIRST(&worker->cursorqh)) {
+                TAILQ_REMOVE(&worker->cursorqh, ac, q);
+                TAILQ_INSERT_HEAD(&worker->cursorqh, ac, q);
+            }
             *cursorp = ac->c;
             return (0);
         }
@@ -196,10 +239,16 @@ __async_worker_execop(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op, WT_CURSOR
     case WT_AOP_SEARCH:
         WT_RET(cursor->search(cursor));
         /*
-         * Get the value from the cursor and put it into the op for op->get_value.
+         * Get the value from the cursor and put it into the op for op->get_value. A polled op is
+         * read after the worker's cursor has moved on, it needs its own copy of the value.
          */
         WT_RET(__wt_cursor_get_raw_value(cursor, &val));
-        __wt_cursor_set_raw_value(&asyncop->c, &val);
+        if (op->poll) {
+            WT_RET(__wt_buf_set(session, &asyncop->c.value, val.data, val.size));
+            F_CLR(&asyncop->c, WT_CURSTD_VALUE_INT);
+            F_SET(&asyncop->c, WT_CURSTD_VALUE_EXT);
+        } else
+            __wt_cursor_set_raw_value(&asyncop->c, &val);
         break;
     case WT_AOP_NONE:
         WT_RET_MSG(session, EINVAL, "Unknown async optype %d", (int)op->optype);
@@ -226,13 +275,13 @@ __async_worker_op(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op, WT_ASYNC_WORKE
 
     wt_session = &session->iface;
     if (op->optype != WT_AOP_COMPACT)
-        WT_RET(wt_session->begin_transaction(wt_session, NULL));
+        WT_ERR(wt_session->begin_transaction(wt_session, NULL));
     WT_ASSERT(session, op->state == WT_ASYNCOP_WORKING);
-    WT_RET(__async_worker_cursor(session, op, worker, &cursor));
     /*
      * Perform op and invoke the callback.
      */
-    ret = __async_worker_execop(session, op, cursor);
+    if ((ret = __async_worker_cursor(session, op, worker, &cursor)) == 0)
+        ret = __async_worker_execop(session, op, cursor);
     if (op->cb != NULL && op->cb->notify != NULL)
         cb_ret = op->cb->notify(op->cb, asyncop, ret, 0);
 
@@ -245,17 +294,57 @@ __async_worker_op(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op, WT_ASYNC_WORKE
             WT_TRET(wt_session->commit_transaction(wt_session, NULL));
         else
             WT_TRET(wt_session->rollback_transaction(wt_session, NULL));
-        F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
-        WT_TRET(cursor->reset(cursor));
+        /*
+         * A polled op's key and value are read by the application once it's returned from the
+         * completion queue.
+         */
+        if (!op->poll)
+            F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+        if (cursor != NULL)
+            WT_TRET(cursor->reset(cursor));
     }
+
+err:
     /*
      * After the callback returns, and the transaction resolved release the op back to the free
-     * pool. We do this regardless of success or failure.
+     * pool, or queue it for the application to poll. We do this regardless of success or failure.
      */
-    WT_PUBLISH(op->state, WT_ASYNCOP_FREE);
+    if (op->poll)
+        __wt_async_op_complete(session, op, ret);
+    else
+        WT_PUBLISH(op->state, WT_ASYNCOP_FREE);
     return (ret);
 }
 
+/*
+ * __async_worker_batch --
+ *     A worker thread handles a batch of ops, grouped by table.
+ */
+static void
+__async_worker_batch(
+  WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL **ops, uint32_t count, WT_ASYNC_WORKER_STATE *worker)
+{
+    WT_ASYNC_OP_IMPL *op;
+    uint32_t i, j;
+
+    /*
+     * Stable insertion sort of the batch by format, so the ops on each table run back-to-back using
+     * the same cached cursor and the order of ops on any one table is unchanged.
+     */
+    for (i = 1; i < count; ++i) {
+        op = ops[i];
+        for (j = i; j > 0 && (uintptr_t)ops[j - 1]->format > (uintptr_t)op->format; --j)
+            ops[j] = ops[j - 1];
+        ops[j] = op;
+    }
+
+    /*
+     * Operation failure doesn't cause the worker thread to exit.
+     */
+    for (i = 0; i < count; ++i)
+        (void)__async_worker_op(session, ops[i], worker);
+}
+
 /*
  * __wt_async_worker --
  *     The async worker threads.
@@ -265,12 +354,13 @@ __wt_async_worker(void *arg)
 {
     WT_ASYNC *async;
     WT_ASYNC_CURSOR *ac;
-    WT_ASYNC_OP_IMPL *op;
+    WT_ASYNC_OP_IMPL *ops[MAX_ASYNC_BATCH];
     WT_ASYNC_WORKER_STATE worker;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
     uint64_t flush_gen;
+    uint32_t count;
 
     session = arg;
     conn = S2C(session);
@@ -279,13 +369,15 @@ __wt_async_worker(void *arg)
     worker.num_cursors = 0;
     TAILQ_INIT(&worker.cursorqh);
     while (F_ISSET(conn, WT_CONN_SERVER_ASYNC) && F_ISSET(session, WT_SESSION_SERVER_ASYNC)) {
-        WT_ERR(__async_op_dequeue(conn, session, &op));
-        if (op != NULL && op != &async->flush_op) {
-            /*
-             * Operation failure doesn't cause the worker thread to exit.
-             */
-            (void)__async_worker_op(session, op, &worker);
-        } else if (async->flush_state == WT_ASYNC_FLUSHING) {
+        WT_ERR(__async_op_dequeue(conn, session, ops, &count));
+        /*
+         * The flush op can only be the last op of a batch, and has no work of its own.
+         */
+        if (count != 0 && ops[count - 1] == &async->flush_op)
+            --count;
+        if (count != 0)
+            __async_worker_batch(session, ops, count, &worker);
+        else if (async->flush_state == WT_ASYNC_FLUSHING) {
             /*
              * Worker flushing going on. Last worker to the party needs to clear the FLUSHING flag
              * and signal the cond. If FLUSHING is going on, we do not take anything off the queue.
@@ -17,11 +17,12 @@ static int
 __block_buffer_to_addr(
   uint32_t allocsize, const uint8_t **pp, wt_off_t *offsetp, uint32_t *sizep, uint32_t *checksump)
 {
-    uint64_t o, s, c;
+    uint64_t c, o, s, v[3];
 
-    WT_RET(__wt_vunpack_uint(pp, 0, &o));
-    WT_RET(__wt_vunpack_uint(pp, 0, &s));
-    WT_RET(__wt_vunpack_uint(pp, 0, &c));
+    WT_RET(__wt_vunpack_uint_n(pp, 0, v, 3));
+    o = v[0];
+    s = v[1];
+    c = v[2];
 
     /*
      * To avoid storing large offsets, we minimize the value by subtracting
@@ -205,6 +205,9 @@ __wt_block_checkpoint_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
         break;
     case WT_CKPT_NONE:
         block->ckpt_state = WT_CKPT_INPROGRESS;
+
+        /* Each checkpoint starts a new run of sequential allocations. */
+        block->seq_off = WT_BLOCK_INVALID_OFFSET;
         break;
     }
     __wt_spin_unlock(session, &block->live_lock);
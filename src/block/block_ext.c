@@ -24,6 +24,7 @@ static int __block_append(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t,
 static int __block_ext_overlap(
   WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, WT_EXT **, WT_EXTLIST *, WT_EXT **);
 static int __block_extlist_dump(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, const char *);
+static int __block_extlist_merge_walk(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, WT_EXTLIST *);
 static int __block_merge(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t, wt_off_t);
 
 /*
@@ -125,6 +126,29 @@ __block_size_srch(WT_SIZE **head, wt_off_t size, WT_SIZE ***stack)
             stack[i--] = szp--;
 }
 
+/*
+ * __block_size_srch_last --
+ *     Return the last (largest) element in the by-size skiplist.
+ */
+static inline WT_SIZE *
+__block_size_srch_last(WT_SIZE **head)
+{
+    WT_SIZE **szp, *last;
+    int i;
+
+    last = NULL; /* The list may be empty */
+
+    for (i = WT_SKIP_MAXDEPTH - 1, szp = &head[i]; i >= 0;)
+        if (*szp != NULL) {
+            last = *szp;
+            szp = &(*szp)->next[i];
+        } else {
+            --i;
+            --szp;
+        }
+    return (last);
+}
+
 /*
  * __block_off_srch_pair --
  *     Search a by-offset skiplist for before/after records of the specified offset.
@@ -478,6 +502,46 @@ __block_extend(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_off
     return (0);
 }
 
+/*
+ * __block_seq_srch --
+ *     Find where the next sequential checkpoint allocation goes: return true and the available
+ *     extent to allocate from, return false if the configured algorithm should be used instead.
+ */
+static bool
+__block_seq_srch(WT_BLOCK *block, wt_off_t size, WT_EXT **extp)
+{
+    WT_EXT *ext, **estack[WT_SKIP_MAXDEPTH];
+    WT_SIZE *szp;
+
+    *extp = NULL;
+
+    /*
+     * The first allocation of a checkpoint starts a run at the beginning of the largest available
+     * extent, as long as it's large enough to hold a useful run of blocks.
+     */
+    if (block->seq_off == WT_BLOCK_INVALID_OFFSET) {
+        if ((szp = __block_size_srch_last(block->live.avail.sz)) == NULL ||
+          szp->size < WT_MAX(size, WT_BLOCK_SEQ_RUN_MIN))
+            return (false);
+        *extp = szp->off[0];
+        return (true);
+    }
+
+    /*
+     * Later allocations continue from where the last allocation stopped if there's room, or move
+     * forward to the next available extent large enough to hold a useful run of blocks. Never
+     * extend the file or go back to an earlier extent to keep the run going: that grows the file
+     * while there's space available, use the configured algorithm instead.
+     */
+    __block_off_srch(block->live.avail.off, block->seq_off, estack, false);
+    if ((ext = *estack[0]) == NULL)
+        return (false);
+    if (ext->size < (ext->off == block->seq_off ? size : WT_MAX(size, WT_BLOCK_SEQ_RUN_MIN)))
+        return (false);
+    *extp = ext;
+    return (true);
+}
+
 /*
  * __wt_block_alloc --
  *     Alloc a chunk of space from the underlying file.
@@ -487,6 +551,7 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
 {
     WT_EXT *ext, **estack[WT_SKIP_MAXDEPTH];
     WT_SIZE *szp, **sstack[WT_SKIP_MAXDEPTH];
+    bool seq;
 
     /* If a sync is running, no other sessions can allocate blocks. */
     WT_ASSERT(session, WT_SESSION_BTREE_SYNC_SAFE(session, S2BT(session)));
@@ -512,10 +577,17 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
      * offset appearing earlier in the file.
      *
      * If we don't have anything big enough, extend the file.
+     *
+     * Checkpoints configured for sequential allocation continue from the end of their previous
+     * allocation, so the blocks they write are contiguous and in the order the tree is walked.
+     * First-fit allocation (compaction) takes precedence.
      */
+    seq = block->allocseq && !block->allocfirst && WT_SESSION_BTREE_SYNC(session);
     if (block->live.avail.bytes < (uint64_t)size)
         goto append;
-    if (block->allocfirst) {
+    if (seq && __block_seq_srch(block, size, &ext)) {
+        /* Continue the checkpoint's run of blocks in the extent found. */
+    } else if (block->allocfirst) {
         if (!__block_first_srch(block->live.avail.off, size, estack))
             goto append;
         ext = *estack[0];
@@ -525,6 +597,8 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
 append:
             WT_RET(__block_extend(session, block, offp, size));
             WT_RET(__block_append(session, block, &block->live.alloc, *offp, (wt_off_t)size));
+            if (seq)
+                block->seq_off = *offp + size;
             return (0);
         }
 
@@ -556,6 +630,8 @@ append:
 
     /* Add the newly allocated extent to the list of allocations. */
     WT_RET(__block_merge(session, block, &block->live.alloc, *offp, (wt_off_t)size));
+    if (seq)
+        block->seq_off = *offp + size;
     return (0);
 }
 
@@ -885,6 +961,8 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *
         b->bytes = tmp.bytes;
         a->entries = b->entries;
         b->entries = tmp.entries;
+        a->last = b->last;
+        b->last = tmp.last;
         for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
             a->off[i] = b->off[i];
             b->off[i] = tmp.off[i];
@@ -893,12 +971,115 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *
         }
     }
 
+    /*
+     * Merging extents one at a time searches the target list for each extent. If the target list
+     * isn't tracking sizes and the lists are comparable in size, walk both lists in offset order
+     * instead, rebuilding the target list as we go.
+     */
+    if (!b->track_size && (uint64_t)a->entries * __wt_log2_int(a->entries + b->entries) >
+        (uint64_t)a->entries + b->entries)
+        return (__block_extlist_merge_walk(session, block, a, b));
+
     WT_EXT_FOREACH (ext, a->off)
         WT_RET(__block_merge(session, block, b, ext->off, ext->size));
 
     return (0);
 }
 
+/*
+ * __block_extlist_merge_walk --
+ *     Merge one extent list into another that isn't tracking sizes, in a single pass over both
+ *     lists.
+ */
+static int
+__block_extlist_merge_walk(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *a, WT_EXTLIST *b)
+{
+    WT_DECL_RET;
+    WT_EXT *aext, *bext, *ext, *last, **tail[WT_SKIP_MAXDEPTH];
+    wt_off_t off, size;
+    u_int i;
+
+    WT_ASSERT(session, !b->track_size);
+
+    /*
+     * Unlink the target list's extents, then walk the two lists in offset order, coalescing
+     * adjacent ranges. The target list's structures are re-linked at the end of the rebuilt list,
+     * the merged list's structures are copied.
+     */
+    aext = a->off[0];
+    bext = b->off[0];
+    for (i = 0; i < WT_SKIP_MAXDEPTH; ++i) {
+        b->off[i] = NULL;
+        tail[i] = &b->off[i];
+    }
+    b->bytes = 0;
+    b->entries = 0;
+    last = NULL;
+
+    while (aext != NULL || bext != NULL) {
+        if (bext == NULL || (aext != NULL && aext->off < bext->off)) {
+            off = aext->off;
+            size = aext->size;
+            aext = aext->next[0];
+            ext = NULL;
+        } else {
+            ext = bext;
+            off = ext->off;
+            size = ext->size;
+            bext = bext->next[0];
+        }
+
+        if (last != NULL && last->off + last->size > off) {
+            __wt_err(session, EINVAL, "%s: existing range %" PRIdMAX "-%" PRIdMAX
+                                      " overlaps with merge range %" PRIdMAX "-%" PRIdMAX,
+              b->name, (intmax_t)last->off, (intmax_t)(last->off + last->size), (intmax_t)off,
+              (intmax_t)(off + size));
+            ret = block->verify ? EINVAL : __wt_panic(session);
+            if (ext != NULL)
+                bext = ext;
+            goto err;
+        }
+
+        b->bytes += (uint64_t)size;
+        if (last != NULL && last->off + last->size == off) {
+            last->size += size;
+            if (ext != NULL)
+                __wt_block_ext_free(session, ext);
+            continue;
+        }
+
+        if (ext == NULL) {
+            WT_ERR(__wt_block_ext_alloc(session, &ext));
+            ext->off = off;
+            ext->size = size;
+        }
+        for (i = 0; i < ext->depth; ++i) {
+            *tail[i] = ext;
+            tail[i] = &ext->next[i];
+        }
+        ++b->entries;
+        last = ext;
+    }
+
+err:
+    /* On error, keep the rest of the target list's extents. */
+    for (; bext != NULL; bext = ext) {
+        ext = bext->next[0];
+        for (i = 0; i < bext->depth; ++i) {
+            *tail[i] = bext;
+            tail[i] = &bext->next[i];
+        }
+        b->bytes += (uint64_t)bext->size;
+        ++b->entries;
+        last = bext;
+    }
+    for (i = 0; i < WT_SKIP_MAXDEPTH; ++i)
+        *tail[i] = NULL;
+    b->last = last;
+
+    return (ret);
+}
+
 /*
  * __block_append --
  *     Append a new entry to the allocation list.
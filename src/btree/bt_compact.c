@@ -212,6 +212,13 @@ __wt_compact(WT_SESSION_IMPL *session)
 
         session->compact_state = WT_COMPACT_SUCCESS;
         WT_STAT_DATA_INCR(session, btree_compact_rewrite);
+
+        /*
+         * The background compaction server shouldn't compete with the application for I/O: reserve
+         * checkpoint write capacity for the page, the rewrite happens in the next checkpoint.
+         */
+        if (session == S2C(session)->compact_session)
+            __wt_capacity_throttle(session, ref->page->memory_footprint, WT_THROTTLE_CKPT);
     }
 
 err:
@@ -390,7 +390,8 @@ __wt_delete_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
      * because deletes are instantiated after lookaside table updates.)
      */
     if (page->entries != 0 && page->modify->mod_row_update == NULL)
-        WT_RET(__wt_calloc_def(session, page->entries, &page->modify->mod_row_update));
+        WT_RET(__wt_page_arena_alloc(
+          session, page, page->entries * sizeof(WT_UPDATE *), &page->modify->mod_row_update));
 
     /*
      * Allocate the per-reference update array; in the case of instantiating a page deleted in a
@@ -8,13 +8,14 @@
 
 #include "wt_internal.h"
 
-static void __free_page_modify(WT_SESSION_IMPL *, WT_PAGE *);
+static void __free_page_arena(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_col_var(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_int(WT_SESSION_IMPL *, WT_PAGE *);
+static void __free_page_modify(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_row_leaf(WT_SESSION_IMPL *, WT_PAGE *);
-static void __free_skip_array(WT_SESSION_IMPL *, WT_INSERT_HEAD **, uint32_t, bool);
+static void __free_skip_array(WT_SESSION_IMPL *, WT_PAGE *, WT_INSERT_HEAD **, uint32_t, bool);
 static void __free_skip_list(WT_SESSION_IMPL *, WT_INSERT *, bool);
-static void __free_update(WT_SESSION_IMPL *, WT_UPDATE **, uint32_t, bool);
+static void __free_update(WT_SESSION_IMPL *, WT_PAGE *, WT_UPDATE **, uint32_t, bool);
 
 /*
  * __wt_ref_out --
@@ -122,6 +123,9 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
         break;
     }
 
+    /* Free the page's arena, everything allocated from it goes at once. */
+    __free_page_arena(session, page);
+
     /* Discard any allocated disk image. */
     if (F_ISSET_ATOMIC(page, WT_PAGE_DISK_ALLOC))
         __wt_overwrite_and_free_len(session, dsk, dsk->mem_size);
@@ -160,6 +164,7 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
             __wt_free(session, multi->supd);
             __wt_free(session, multi->disk_image);
             __wt_free(session, multi->addr.addr);
+            __wt_las_history_free(session, &multi->page_las);
         }
         __wt_free(session, mod->mod_multi);
         break;
@@ -169,6 +174,7 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
          * but at the root that can't happen.
          */
         __wt_free(session, mod->mod_replace.addr);
+        __wt_las_history_free(session, &mod->mod_page_las);
         break;
     }
 
@@ -178,13 +184,15 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
         /* Free the append array. */
         if ((append = WT_COL_APPEND(page)) != NULL) {
             __free_skip_list(session, WT_SKIP_FIRST(append), update_ignore);
-            __wt_free(session, append);
-            __wt_free(session, mod->mod_col_append);
+            if (!page->arena_bump) {
+                __wt_free(session, append);
+                __wt_free(session, mod->mod_col_append);
+            }
         }
 
         /* Free the insert/update array. */
         if (mod->mod_col_update != NULL)
-            __free_skip_array(session, mod->mod_col_update,
+            __free_skip_array(session, page, mod->mod_col_update,
               page->type == WT_PAGE_COL_FIX ? 1 : page->entries, update_ignore);
         break;
     case WT_PAGE_ROW_LEAF:
@@ -196,11 +204,12 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
          * before keys found on the original page).
          */
         if (mod->mod_row_insert != NULL)
-            __free_skip_array(session, mod->mod_row_insert, page->entries + 1, update_ignore);
+            __free_skip_array(
+              session, page, mod->mod_row_insert, page->entries + 1, update_ignore);
 
         /* Free the update array. */
         if (mod->mod_row_update != NULL)
-            __free_update(session, mod->mod_row_update, page->entries, update_ignore);
+            __free_update(session, page, mod->mod_row_update, page->entries, update_ignore);
         break;
     }
 
@@ -258,7 +267,10 @@ __wt_free_ref(WT_SESSION_IMPL *session, WT_REF *ref, int page_type, bool free_pa
     __wt_ref_addr_free(session, ref);
 
     /* Free any lookaside or page-deleted information. */
-    __wt_free(session, ref->page_las);
+    if (ref->page_las != NULL) {
+        __wt_las_history_free(session, ref->page_las);
+        __wt_free(session, ref->page_las);
+    }
     if (ref->page_del != NULL) {
         __wt_free(session, ref->page_del->update_list);
         __wt_free(session, ref->page_del);
@@ -317,8 +329,9 @@ __wt_free_ref_index(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_INDEX *pind
 static void
 __free_page_col_var(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
-    /* Free the RLE lookup array. */
-    __wt_free(session, page->u.col_var.repeats);
+    /* Free the RLE lookup array, unless it came from the page's arena. */
+    if (!page->arena_bump)
+        __wt_free(session, page->u.col_var.repeats);
 }
 
 /*
@@ -347,28 +360,46 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
     }
 }
 
+/*
+ * __free_page_arena --
+ *     Discard the page's arena.
+ */
+static void
+__free_page_arena(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_PAGE_ARENA *arena, *next;
+
+    for (arena = page->arena; arena != NULL; arena = next) {
+        next = arena->next;
+        __wt_free(session, arena);
+    }
+    page->arena = NULL;
+}
+
 /*
  * __free_skip_array --
  *     Discard an array of skip list headers.
  */
 static void
-__free_skip_array(
-  WT_SESSION_IMPL *session, WT_INSERT_HEAD **head_arg, uint32_t entries, bool update_ignore)
+__free_skip_array(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD **head_arg,
+  uint32_t entries, bool update_ignore)
 {
     WT_INSERT_HEAD **head;
 
     /*
      * For each non-NULL slot in the page's array of inserts, free the linked list anchored in that
-     * slot.
+     * slot. The headers and the array itself are freed with the page's arena if they came from it.
      */
     for (head = head_arg; entries > 0; --entries, ++head)
         if (*head != NULL) {
             __free_skip_list(session, WT_SKIP_FIRST(*head), update_ignore);
-            __wt_free(session, *head);
+            if (!page->arena_bump)
+                __wt_free(session, *head);
         }
 
     /* Free the header array. */
-    __wt_free(session, head_arg);
+    if (!page->arena_bump)
+        __wt_free(session, head_arg);
 }
 
 /*
@@ -394,8 +425,8 @@ __free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins, bool update_ignore)
  *     Discard the update array.
  */
 static void
-__free_update(
-  WT_SESSION_IMPL *session, WT_UPDATE **update_head, uint32_t entries, bool update_ignore)
+__free_update(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE **update_head, uint32_t entries,
+  bool update_ignore)
 {
     WT_UPDATE **updp;
 
@@ -408,8 +439,9 @@ __free_update(
             if (*updp != NULL)
                 __wt_free_update_list(session, *updp);
 
-    /* Free the update array. */
-    __wt_free(session, update_head);
+    /* Free the update array, unless it came from the page's arena. */
+    if (!page->arena_bump)
+        __wt_free(session, update_head);
 }
 
 /*
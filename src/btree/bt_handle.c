@@ -72,6 +72,8 @@ __btree_clear(WT_SESSION_IMPL *session)
     __wt_spin_destroy(session, &btree->flush_lock);
 
     /* Free allocated memory. */
+    __wt_pack_format_free(session, &btree->key_pack);
+    __wt_pack_format_free(session, &btree->value_pack);
     __wt_free(session, btree->key_format);
     __wt_free(session, btree->value_format);
 
@@ -386,6 +388,10 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
     WT_RET(__wt_struct_confchk(session, &cval));
     WT_RET(__wt_strndup(session, cval.str, cval.len, &btree->value_format));
 
+    /* Compile the formats once, for the handle's cursors. */
+    WT_RET(__wt_pack_format_compile(session, btree->key_format, &btree->key_pack));
+    WT_RET(__wt_pack_format_compile(session, btree->value_format, &btree->value_pack));
+
     /* Row-store key comparison and key gap for prefix compression. */
     if (btree->type == BTREE_ROW) {
         WT_RET(__wt_config_gets_none(session, cfg, "collator", &cval));
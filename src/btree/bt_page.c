@@ -10,11 +10,83 @@
 
 static void __inmem_col_fix(WT_SESSION_IMPL *, WT_PAGE *);
 static void __inmem_col_int(WT_SESSION_IMPL *, WT_PAGE *);
-static int __inmem_col_var(WT_SESSION_IMPL *, WT_PAGE *, uint64_t, size_t *, bool);
+static int __inmem_col_var(WT_SESSION_IMPL *, WT_PAGE *, uint64_t, bool);
 static int __inmem_row_int(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
 static int __inmem_row_leaf(WT_SESSION_IMPL *, WT_PAGE *, bool);
 static int __inmem_row_leaf_entries(WT_SESSION_IMPL *, const WT_PAGE_HEADER *, uint32_t *);
 
+/*
+ * __wt_page_arena_alloc --
+ *     Allocate cleared memory for a structure that lives as long as the page, from the page's arena
+ *     if it's bump-allocating, otherwise individually. The page's memory footprint is updated.
+ */
+int
+__wt_page_arena_alloc(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size, void *retp)
+{
+    WT_PAGE_ARENA *arena, *chunk;
+    size_t chunk_size, used;
+
+    *(void **)retp = NULL;
+
+    if (!page->arena_bump) {
+        WT_RET(__wt_calloc(session, 1, size, retp));
+        __wt_cache_page_inmem_incr(session, page, size);
+        return (0);
+    }
+
+    size = WT_ALIGN(size, 8);
+    for (;;) {
+        /*
+         * Reserve space in the newest chunk. The reservation can push the chunk's used count past
+         * its size, that's harmless, the chunk is full and will be replaced.
+         */
+        WT_ORDERED_READ(arena, page->arena);
+        if (arena != NULL) {
+            used = __wt_atomic_addsize(&arena->used, size);
+            if (used <= arena->size) {
+                __wt_cache_page_inmem_incr(session, page, size);
+                *(void **)retp = (uint8_t *)arena + used - size;
+                return (0);
+            }
+        }
+
+        /*
+         * Allocate a new chunk, twice the size of the previous chunk up to a maximum and big enough
+         * for the request, and reserve our space in it before making it visible. Chunk memory is
+         * cleared on allocation and never reused.
+         */
+        chunk_size = WT_MAX(WT_ALIGN(sizeof(WT_PAGE_ARENA), 8) + size,
+          arena == NULL ? WT_PAGE_ARENA_MIN : WT_MIN(2 * arena->size, WT_PAGE_ARENA_MAX));
+        WT_RET(__wt_calloc(session, 1, chunk_size, &chunk));
+        chunk->next = arena;
+        chunk->size = chunk_size;
+        chunk->used = WT_ALIGN(sizeof(WT_PAGE_ARENA), 8) + size;
+        if (__wt_atomic_cas_ptr(&page->arena, arena, chunk)) {
+            __wt_cache_page_inmem_incr(session, page, chunk->used);
+            *(void **)retp = (uint8_t *)chunk + chunk->used - size;
+            return (0);
+        }
+
+        /* We raced with another thread installing a chunk, try again. */
+        __wt_free(session, chunk);
+    }
+}
+
+/*
+ * __wt_page_arena_free --
+ *     Free a structure allocated by __wt_page_arena_alloc that was never installed in the page.
+ *     Arena memory isn't reclaimed until the page is discarded.
+ */
+void
+__wt_page_arena_free(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size, void *p)
+{
+    if (page->arena_bump)
+        return;
+
+    __wt_cache_page_inmem_decr(session, page, size);
+    __wt_free(session, *(void **)p);
+}
+
 /*
  * __wt_page_alloc --
  *     Create or read a page into the cache.
@@ -64,6 +136,7 @@ __wt_page_alloc(
 
     page->type = type;
     page->read_gen = WT_READGEN_NOTSET;
+    page->arena_bump = cache->page_arena;
 
     switch (type) {
     case WT_PAGE_COL_FIX:
@@ -210,7 +283,7 @@ __wt_page_inmem(WT_SESSION_IMPL *session, WT_REF *ref, const void *image, uint32
         __inmem_col_int(session, page);
         break;
     case WT_PAGE_COL_VAR:
-        WT_ERR(__inmem_col_var(session, page, dsk->recno, &size, check_unstable));
+        WT_ERR(__inmem_col_var(session, page, dsk->recno, check_unstable));
         break;
     case WT_PAGE_ROW_INT:
         WT_ERR(__inmem_row_int(session, page, &size));
@@ -336,8 +409,7 @@ __unstable_skip(WT_SESSION_IMPL *session, const WT_PAGE_HEADER *dsk, WT_CELL_UNP
  *     Build in-memory index for variable-length, data-only leaf pages in column-store trees.
  */
 static int
-__inmem_col_var(
-  WT_SESSION_IMPL *session, WT_PAGE *page, uint64_t recno, size_t *sizep, bool check_unstable)
+__inmem_col_var(WT_SESSION_IMPL *session, WT_PAGE *page, uint64_t recno, bool check_unstable)
 {
     WT_BTREE *btree;
     WT_CELL_UNPACK unpack;
@@ -380,8 +452,7 @@ __inmem_col_var(
             if (repeats == NULL) {
                 __inmem_col_var_repeats(session, page, &n);
                 size = sizeof(WT_COL_VAR_REPEAT) + (n + 1) * sizeof(WT_COL_RLE);
-                WT_RET(__wt_calloc(session, 1, size, &p));
-                *sizep += size;
+                WT_RET(__wt_page_arena_alloc(session, page, size, &p));
 
                 page->u.col_var.repeats = p;
                 page->pg_var_nrepeats = n;
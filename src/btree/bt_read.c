@@ -109,20 +109,20 @@ __las_page_instantiate_verbose(WT_SESSION_IMPL *session, uint64_t las_pageid)
 static int
 __las_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 {
-    WT_CACHE *cache;
     WT_CURSOR *cursor;
     WT_CURSOR_BTREE cbt;
     WT_DECL_ITEM(current_key);
     WT_DECL_RET;
     WT_ITEM las_key, las_value;
+    WT_LAS_PARTITION *part;
     WT_PAGE *page;
     WT_UPDATE *first_upd, *last_upd, *upd;
     wt_timestamp_t durable_timestamp, las_timestamp;
     size_t incr, total_incr;
     uint64_t current_recno, las_counter, las_pageid, las_txnid, recno;
-    uint32_t las_id, session_flags;
+    uint32_t las_id, partition, session_flags;
     uint8_t prepare_state, upd_type;
-    const uint8_t *p;
+    const uint8_t *history, *history_end, *p;
     bool locked;
 
     cursor = NULL;
@@ -135,7 +135,8 @@ __las_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
     session_flags = 0; /* [-Werror=maybe-uninitialized] */
     WT_CLEAR(las_key);
 
-    cache = S2C(session)->cache;
+    partition = WT_LAS_PARTITION_ID(S2BT(session)->id);
+    part = &S2C(session)->cache->las_part[partition];
     __las_page_instantiate_verbose(session, las_pageid);
     WT_STAT_CONN_INCR(session, cache_read_lookaside);
     WT_STAT_DATA_INCR(session, cache_read_lookaside);
@@ -147,8 +148,21 @@ __las_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 
     WT_ERR(__wt_scr_alloc(session, 0, &current_key));
 
-    /* Open a lookaside table cursor. */
-    __wt_las_cursor(session, &cursor, &session_flags);
+    /*
+     * Small blocks of history are kept in memory with the page's lookaside information, otherwise
+     * open a cursor on the tree's lookaside table partition.
+     */
+    if ((history = ref->page_las->history) != NULL)
+        history_end = history + ref->page_las->history_size;
+    else {
+        history_end = NULL;
+        __wt_las_cursor(session, partition, &cursor, &session_flags);
+
+        WT_PUBLISH(part->reader, true);
+        __wt_readlock(session, &part->sweepwalk_lock);
+        WT_PUBLISH(part->reader, false);
+        locked = true;
+    }
 
     /*
      * The lookaside records are in key and update order, that is, there will be a set of in-order
@@ -156,23 +170,27 @@ __las_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
      * of the updates for a key and then insert those updates into the page, then all the updates
      * for the next key, and so on.
      */
-    WT_PUBLISH(cache->las_reader, true);
-    __wt_readlock(session, &cache->las_sweepwalk_lock);
-    WT_PUBLISH(cache->las_reader, false);
-    locked = true;
-    for (ret = __wt_las_cursor_position(cursor, las_pageid); ret == 0; ret = cursor->next(cursor)) {
-        WT_ERR(cursor->get_key(cursor, &las_pageid, &las_id, &las_counter, &las_key));
+    for (ret = history == NULL ? __wt_las_cursor_position(cursor, las_pageid) : 0; ret == 0;
+         ret = history == NULL ? cursor->next(cursor) : 0) {
+        if (history != NULL) {
+            if ((ret = __wt_las_history_next(&history, history_end, &las_key, &las_txnid,
+                   &las_timestamp, &durable_timestamp, &prepare_state, &upd_type, &las_value)) != 0)
+                break;
+        } else {
+            WT_ERR(cursor->get_key(cursor, &las_pageid, &las_id, &las_counter, &las_key));
 
-        /*
-         * Confirm the search using the unique prefix; if not a match, we're done searching for
-         * records for this page.
-         */
-        if (las_pageid != ref->page_las->las_pageid)
-            break;
+            /*
+             * Confirm the search using the unique prefix; if not a match, we're done searching for
+             * records for this page.
+             */
+            if (las_pageid != ref->page_las->las_pageid)
+                break;
+
+            WT_ERR(cursor->get_value(cursor, &las_txnid, &las_timestamp, &durable_timestamp,
+              &prepare_state, &upd_type, &las_value));
+        }
 
         /* Allocate the WT_UPDATE structure. */
-        WT_ERR(cursor->get_value(cursor, &las_txnid, &las_timestamp, &durable_timestamp,
-          &prepare_state, &upd_type, &las_value));
         WT_ERR(__wt_update_alloc(session, &las_value, &upd, &incr, upd_type));
         total_incr += incr;
         upd->txnid = las_txnid;
@@ -219,8 +237,10 @@ __las_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
         }
         upd = NULL;
     }
-    __wt_readunlock(session, &cache->las_sweepwalk_lock);
-    locked = false;
+    if (locked) {
+        __wt_readunlock(session, &part->sweepwalk_lock);
+        locked = false;
+    }
     WT_ERR_NOTFOUND_OK(ret);
 
     /* Insert the last set of updates, if any. */
@@ -284,7 +304,7 @@ __las_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref)
 
 err:
     if (locked)
-        __wt_readunlock(session, &cache->las_sweepwalk_lock);
+        __wt_readunlock(session, &part->sweepwalk_lock);
     WT_TRET(__wt_las_cursor_close(session, &cursor, session_flags));
     WT_TRET(__wt_btcur_close(&cbt, true));
 
@@ -364,6 +384,20 @@ __evict_force_check(WT_SESSION_IMPL *session, WT_REF *ref)
     if (!__wt_page_evict_retry(session, page))
         return (false);
 
+    /*
+     * Before forcing eviction, try discarding obsolete updates and cold instantiated keys from the
+     * page: if the page is large because of update chains for a few hot keys or keys built by
+     * searches, that may be enough, and the page stays in cache.
+     */
+    __wt_page_shrink(session, ref);
+    footprint = page->memory_footprint;
+    if (page->dsk != NULL)
+        footprint -= page->dsk->mem_size;
+    if (footprint < btree->maxmempage) {
+        WT_STAT_CONN_INCR(session, cache_eviction_force_shrink);
+        return (false);
+    }
+
     /* Trigger eviction on the next page release. */
     __wt_page_evict_soon(session, ref);
 
@@ -485,6 +519,7 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
         WT_STAT_CONN_INCR(session, cache_read_app_count);
         WT_STAT_CONN_INCRV(session, cache_read_app_time, time_diff);
         WT_STAT_SESSION_INCRV(session, read_time, time_diff);
+        WT_STAT_CONN_LAT_HIST_INCR(session, lat_page_read, time_diff);
     }
 
     /*
@@ -540,9 +575,10 @@ skip_read:
      * Prepared updates can not be removed by the lookaside sweep, remove
      * them as we read the page back in memory.
      *
-     * Don't free WT_REF.page_las, there may be concurrent readers.
+     * Don't free WT_REF.page_las, there may be concurrent readers. History kept in memory is never
+     * written to the lookaside table, there's nothing to remove.
      */
-    if (final_state == WT_REF_MEM && ref->page_las != NULL &&
+    if (final_state == WT_REF_MEM && ref->page_las != NULL && ref->page_las->history == NULL &&
       (!ref->page_las->skew_newest || ref->page_las->has_prepares))
         WT_ERR(__wt_las_remove_block(session, ref->page_las->las_pageid));
 
@@ -832,7 +832,10 @@ __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_new, uint32_t
             __wt_free(session, next_ref->page_del->update_list);
             __wt_free(session, next_ref->page_del);
         }
-        __wt_free(session, next_ref->page_las);
+        if (next_ref->page_las != NULL) {
+            __wt_las_history_free(session, next_ref->page_las);
+            __wt_free(session, next_ref->page_las);
+        }
 
         /* Free the backing block and address. */
         WT_TRET(__wt_ref_block_free(session, next_ref));
@@ -1698,6 +1701,7 @@ __wt_multi_to_ref(WT_SESSION_IMPL *session, WT_PAGE *page, WT_MULTI *multi, WT_R
 
         WT_RET(__wt_calloc_one(session, &ref->page_las));
         *ref->page_las = multi->page_las;
+        WT_RET(__wt_las_history_copy(session, ref->page_las, &multi->page_las));
         WT_ASSERT(session, ref->page_las->max_txn != WT_TXN_NONE);
         WT_REF_SET_STATE(ref, WT_REF_LOOKASIDE);
     }
@@ -1825,15 +1829,18 @@ __split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_ERR(__wt_page_modify_init(session, right));
     __wt_page_modify_set(session, right);
 
+    /* Allocate the new page's insert list head, which also accounts for the memory. */
     if (type == WT_PAGE_ROW_LEAF) {
-        WT_ERR(__wt_calloc_one(session, &right->modify->mod_row_insert));
-        WT_ERR(__wt_calloc_one(session, &right->modify->mod_row_insert[0]));
+        WT_ERR(__wt_page_arena_alloc(
+          session, right, sizeof(WT_INSERT_HEAD *), &right->modify->mod_row_insert));
+        WT_ERR(__wt_page_arena_alloc(
+          session, right, sizeof(WT_INSERT_HEAD), &right->modify->mod_row_insert[0]));
     } else {
-        WT_ERR(__wt_calloc_one(session, &right->modify->mod_col_append));
-        WT_ERR(__wt_calloc_one(session, &right->modify->mod_col_append[0]));
+        WT_ERR(__wt_page_arena_alloc(
+          session, right, sizeof(WT_INSERT_HEAD *), &right->modify->mod_col_append));
+        WT_ERR(__wt_page_arena_alloc(
+          session, right, sizeof(WT_INSERT_HEAD), &right->modify->mod_col_append[0]));
     }
-    right_incr += sizeof(WT_INSERT_HEAD);
-    right_incr += sizeof(WT_INSERT_HEAD *);
 
     WT_ERR(__wt_calloc_one(session, &split_ref[1]));
     parent_incr += sizeof(WT_REF);
@@ -70,6 +70,54 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_row_leaf_keys_discard --
+ *     Discard instantiated keys that aren't interesting for random search of a page, they're
+ *     rebuilt from the page's disk image when they're next needed. Our caller has exclusive access
+ *     to the page.
+ */
+int
+__wt_row_leaf_keys_discard(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_BTREE *btree;
+    WT_DECL_ITEM(tmp);
+    WT_IKEY *ikey;
+    WT_ROW *rip;
+    uint32_t gap, i;
+
+    btree = S2BT(session);
+
+    if (page->entries == 0)
+        return (0);
+
+    /*
+     * The interesting keys are the ones a binary search of the page looks at most often, keep them
+     * instantiated (and if the page's keys were built, those are the keys that were built).
+     */
+    WT_RET(__wt_scr_alloc(session, (uint32_t)__bitstr_size(page->entries), &tmp));
+    memset(tmp->mem, 0, tmp->memsize);
+
+    if ((gap = btree->key_gap) == 0)
+        gap = 1;
+    __inmem_row_leaf_slots(tmp->mem, 0, page->entries, gap);
+
+    /* Point the remaining keys back at their cells on the page, and free them. */
+    for (rip = page->pg_row, i = 0; i < page->entries; ++rip, ++i) {
+        if (__bit_test(tmp->mem, i))
+            continue;
+        WT_IGNORE_RET_BOOL(
+          __wt_row_leaf_key_info(page, WT_ROW_KEY_COPY(rip), &ikey, NULL, NULL, NULL));
+        if (ikey == NULL)
+            continue;
+        __wt_row_leaf_key_set_cell(page, rip, WT_PAGE_REF_OFFSET(page, ikey->cell_offset));
+        __wt_cache_page_inmem_decr(session, page, sizeof(WT_IKEY) + ikey->size);
+        __wt_free(session, ikey);
+    }
+
+    __wt_scr_free(session, &tmp);
+    return (0);
+}
+
 /*
  * __inmem_row_leaf_slots --
  *     Figure out the interesting slots of a page for random search, up to the specified depth.
@@ -38,20 +38,35 @@ __las_restore_isolation(WT_SESSION_IMPL *session, WT_TXN_ISOLATION saved_isolati
 }
 
 /*
- * __las_entry_count --
- *     Return when there are entries in the lookaside table.
+ * __las_partition_entry_count --
+ *     Return the number of entries in a lookaside table partition.
  */
 static uint64_t
-__las_entry_count(WT_CACHE *cache)
+__las_partition_entry_count(WT_LAS_PARTITION *part)
 {
     uint64_t insert_cnt, remove_cnt;
 
-    insert_cnt = cache->las_insert_count;
-    WT_ORDERED_READ(remove_cnt, cache->las_remove_count);
+    insert_cnt = part->insert_count;
+    WT_ORDERED_READ(remove_cnt, part->remove_count);
 
     return (insert_cnt > remove_cnt ? insert_cnt - remove_cnt : 0);
 }
 
+/*
+ * __las_entry_count --
+ *     Return the number of entries in the lookaside table.
+ */
+static uint64_t
+__las_entry_count(WT_CACHE *cache)
+{
+    uint64_t count;
+    u_int i;
+
+    for (count = 0, i = 0; i < WT_LAS_PARTITIONS; i++)
+        count += __las_partition_entry_count(&cache->las_part[i]);
+    return (count);
+}
+
 /*
  * __wt_las_config --
  *     Configure the lookaside table.
@@ -62,6 +77,7 @@ __wt_las_config(WT_SESSION_IMPL *session, const char **cfg)
     WT_CONFIG_ITEM cval;
     WT_CURSOR_BTREE *las_cursor;
     WT_SESSION_IMPL *las_session;
+    u_int i;
 
     WT_RET(__wt_config_gets(session, cfg, "cache_overflow.file_max", &cval));
 
@@ -77,12 +93,15 @@ __wt_las_config(WT_SESSION_IMPL *session, const char **cfg)
         return (0);
 
     /*
-     * We need to set file_max on the btree associated with one of the lookaside sessions.
+     * We need to set file_max on the btrees associated with one of the lookaside sessions. The
+     * maximum applies to the total size of the partitions.
      */
-    las_cursor = (WT_CURSOR_BTREE *)las_session->las_cursor;
-    las_cursor->btree->file_max = (uint64_t)cval.val;
+    for (i = 0; i < WT_LAS_PARTITIONS; i++) {
+        las_cursor = (WT_CURSOR_BTREE *)las_session->las_cursor[i];
+        las_cursor->btree->file_max = (uint64_t)cval.val;
+    }
 
-    WT_STAT_CONN_SET(session, cache_lookaside_ondisk_max, las_cursor->btree->file_max);
+    WT_STAT_CONN_SET(session, cache_lookaside_ondisk_max, (uint64_t)cval.val);
 
     return (0);
 }
@@ -108,7 +127,8 @@ __wt_las_stats_update(WT_SESSION_IMPL *session)
     WT_CONNECTION_IMPL *conn;
     WT_CONNECTION_STATS **cstats;
     WT_DSRC_STATS **dstats;
-    int64_t v;
+    int64_t insert_cnt, remove_cnt;
+    u_int i;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -126,25 +146,28 @@ __wt_las_stats_update(WT_SESSION_IMPL *session)
     WT_STAT_SET(session, cstats, cache_lookaside_entries, __las_entry_count(cache));
 
     /*
-     * We have a cursor, and we need the underlying data handle; we can get to it by way of the
-     * underlying btree handle, but it's a little ugly.
+     * We have a cursor for each partition, and we need the underlying data handle; we can get to it
+     * by way of the underlying btree handle, but it's a little ugly.
      */
-    dstats = ((WT_CURSOR_BTREE *)cache->las_session[0]->las_cursor)->btree->dhandle->stats;
+    for (insert_cnt = remove_cnt = 0, i = 0; i < WT_LAS_PARTITIONS; i++) {
+        dstats = ((WT_CURSOR_BTREE *)cache->las_session[0]->las_cursor[i])->btree->dhandle->stats;
 
-    v = WT_STAT_READ(dstats, cursor_update);
-    WT_STAT_SET(session, cstats, cache_lookaside_insert, v);
-    v = WT_STAT_READ(dstats, cursor_remove);
-    WT_STAT_SET(session, cstats, cache_lookaside_remove, v);
+        insert_cnt += WT_STAT_READ(dstats, cursor_update);
+        remove_cnt += WT_STAT_READ(dstats, cursor_remove);
 
-    /*
-     * If we're clearing stats we need to clear the cursor values we just read. This does not clear
-     * the rest of the statistics in the lookaside data source stat cursor, but we own that
-     * namespace so we don't have to worry about users seeing inconsistent data source information.
-     */
-    if (FLD_ISSET(conn->stat_flags, WT_STAT_CLEAR)) {
-        WT_STAT_SET(session, dstats, cursor_insert, 0);
-        WT_STAT_SET(session, dstats, cursor_remove, 0);
+        /*
+         * If we're clearing stats we need to clear the cursor values we just read. This does not
+         * clear the rest of the statistics in the lookaside data source stat cursor, but we own
+         * that namespace so we don't have to worry about users seeing inconsistent data source
+         * information.
+         */
+        if (FLD_ISSET(conn->stat_flags, WT_STAT_CLEAR)) {
+            WT_STAT_SET(session, dstats, cursor_insert, 0);
+            WT_STAT_SET(session, dstats, cursor_remove, 0);
+        }
     }
+    WT_STAT_SET(session, cstats, cache_lookaside_insert, insert_cnt);
+    WT_STAT_SET(session, cstats, cache_lookaside_remove, remove_cnt);
 }
 
 /*
@@ -157,6 +180,8 @@ __wt_las_create(WT_SESSION_IMPL *session, const char **cfg)
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
+    WT_LAS_PARTITION *part;
+    size_t len;
     int i;
     const char *drop_cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_drop), "force=true", NULL};
 
@@ -172,16 +197,25 @@ __wt_las_create(WT_SESSION_IMPL *session, const char **cfg)
      * schema lock to create and drop the table, and it may not always be
      * available.
      *
-     * Discard any previous incarnation of the table.
+     * Discard any previous incarnation of the table partitions, then re-create them.
      */
-    WT_WITH_SCHEMA_LOCK(session, ret = __wt_schema_drop(session, WT_LAS_URI, drop_cfg));
-    WT_RET(ret);
+    for (i = 0; i < WT_LAS_PARTITIONS; i++) {
+        part = &cache->las_part[i];
+        if (i == 0)
+            WT_RET(__wt_strdup(session, WT_LAS_URI, &part->uri));
+        else {
+            len = strlen(WT_LAS_URI_PREFIX) + 20;
+            WT_RET(__wt_calloc_def(session, len, &part->uri));
+            WT_RET(__wt_snprintf(part->uri, len, "%s%d.wt", WT_LAS_URI_PREFIX, i));
+        }
 
-    /* Re-create the table. */
-    WT_RET(__wt_session_create(session, WT_LAS_URI, WT_LAS_CONFIG));
+        WT_WITH_SCHEMA_LOCK(session, ret = __wt_schema_drop(session, part->uri, drop_cfg));
+        WT_RET(ret);
+        WT_RET(__wt_session_create(session, part->uri, WT_LAS_CONFIG));
+    }
 
     /*
-     * Open a shared internal session and cursor used for the lookaside table. This session should
+     * Open shared internal sessions and cursors used for the lookaside table. These sessions should
      * never perform reconciliation.
      */
     for (i = 0; i < WT_LAS_NUM_SESSIONS; i++) {
@@ -209,6 +243,7 @@ __wt_las_destroy(WT_SESSION_IMPL *session)
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
+    WT_LAS_PARTITION *part;
     WT_SESSION *wt_session;
     int i;
 
@@ -228,56 +263,60 @@ __wt_las_destroy(WT_SESSION_IMPL *session)
         cache->las_session[i] = NULL;
     }
 
-    __wt_buf_free(session, &cache->las_sweep_key);
-    __wt_free(session, cache->las_dropped);
-    __wt_free(session, cache->las_sweep_dropmap);
+    for (i = 0; i < WT_LAS_PARTITIONS; i++) {
+        part = &cache->las_part[i];
+        __wt_free(session, part->uri);
+        __wt_buf_free(session, &part->sweep_key);
+        __wt_free(session, part->dropped);
+        __wt_free(session, part->sweep_dropmap);
+    }
 
     return (ret);
 }
 
 /*
  * __wt_las_cursor_open --
- *     Open a new lookaside table cursor.
+ *     Open a new set of lookaside table cursors, one per partition.
  */
 int
 __wt_las_cursor_open(WT_SESSION_IMPL *session)
 {
     WT_BTREE *btree;
+    WT_CACHE *cache;
     WT_CURSOR *cursor;
     WT_DECL_RET;
+    u_int i;
     const char *open_cursor_cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), NULL};
 
-    WT_WITHOUT_DHANDLE(
-      session, ret = __wt_open_cursor(session, WT_LAS_URI, NULL, open_cursor_cfg, &cursor));
-    WT_RET(ret);
+    cache = S2C(session)->cache;
 
-    /*
-     * Retrieve the btree from the cursor, rather than the session because we don't always switch
-     * the LAS handle in to the session before entering this function.
-     */
-    btree = ((WT_CURSOR_BTREE *)cursor)->btree;
+    for (i = 0; i < WT_LAS_PARTITIONS; i++) {
+        WT_WITHOUT_DHANDLE(session,
+          ret = __wt_open_cursor(session, cache->las_part[i].uri, NULL, open_cursor_cfg, &cursor));
+        WT_RET(ret);
 
-    /* Track the lookaside file ID. */
-    if (S2C(session)->cache->las_fileid == 0)
-        S2C(session)->cache->las_fileid = btree->id;
+        /*
+         * Retrieve the btree from the cursor, rather than the session because we don't always
+         * switch the LAS handle in to the session before entering this function.
+         */
+        btree = ((WT_CURSOR_BTREE *)cursor)->btree;
 
-    /*
-     * Set special flags for the lookaside table: the lookaside flag (used,
-     * for example, to avoid writing records during reconciliation), also
-     * turn off checkpoints and logging.
-     *
-     * Test flags before setting them so updates can't race in subsequent
-     * opens (the first update is safe because it's single-threaded from
-     * wiredtiger_open).
-     */
-    if (!F_ISSET(btree, WT_BTREE_LOOKASIDE))
-        F_SET(btree, WT_BTREE_LOOKASIDE);
-    if (!F_ISSET(btree, WT_BTREE_NO_CHECKPOINT))
-        F_SET(btree, WT_BTREE_NO_CHECKPOINT);
-    if (!F_ISSET(btree, WT_BTREE_NO_LOGGING))
-        F_SET(btree, WT_BTREE_NO_LOGGING);
-
-    session->las_cursor = cursor;
+        /*
+         * Set special flags for the lookaside table: the lookaside flag (used, for example, to
+         * avoid writing records during reconciliation), also turn off checkpoints and logging.
+         *
+         * Test flags before setting them so updates can't race in subsequent opens (the first
+         * update is safe because it's single-threaded from wiredtiger_open).
+         */
+        if (!F_ISSET(btree, WT_BTREE_LOOKASIDE))
+            F_SET(btree, WT_BTREE_LOOKASIDE);
+        if (!F_ISSET(btree, WT_BTREE_NO_CHECKPOINT))
+            F_SET(btree, WT_BTREE_NO_CHECKPOINT);
+        if (!F_ISSET(btree, WT_BTREE_NO_LOGGING))
+            F_SET(btree, WT_BTREE_NO_LOGGING);
+
+        session->las_cursor[i] = cursor;
+    }
     F_SET(session, WT_SESSION_LOOKASIDE_CURSOR);
 
     return (0);
@@ -285,10 +324,11 @@ __wt_las_cursor_open(WT_SESSION_IMPL *session)
 
 /*
  * __wt_las_cursor --
- *     Return a lookaside cursor.
+ *     Return a lookaside cursor for a partition.
  */
 void
-__wt_las_cursor(WT_SESSION_IMPL *session, WT_CURSOR **cursorp, uint32_t *session_flags)
+__wt_las_cursor(
+  WT_SESSION_IMPL *session, u_int partition, WT_CURSOR **cursorp, uint32_t *session_flags)
 {
     WT_CACHE *cache;
     int i;
@@ -312,13 +352,13 @@ __wt_las_cursor(WT_SESSION_IMPL *session, WT_CURSOR **cursorp, uint32_t *session
      * Some threads have their own lookaside table cursors, else lock the shared lookaside cursor.
      */
     if (F_ISSET(session, WT_SESSION_LOOKASIDE_CURSOR))
-        *cursorp = session->las_cursor;
+        *cursorp = session->las_cursor[partition];
     else {
         for (;;) {
             __wt_spin_lock(session, &cache->las_lock);
             for (i = 0; i < WT_LAS_NUM_SESSIONS; i++) {
                 if (!cache->las_session_inuse[i]) {
-                    *cursorp = cache->las_session[i]->las_cursor;
+                    *cursorp = cache->las_session[i]->las_cursor[partition];
                     cache->las_session_inuse[i] = true;
                     break;
                 }
@@ -487,12 +527,12 @@ __wt_las_page_skip(WT_SESSION_IMPL *session, WT_REF *ref)
 
 /*
  * __las_remove_block --
- *     Remove all records for a given page from the lookaside store.
+ *     Remove all records for a given page from a lookaside store partition.
  */
 static int
-__las_remove_block(WT_CURSOR *cursor, uint64_t pageid, bool lock_wait, uint64_t *remove_cntp)
+__las_remove_block(
+  WT_CURSOR *cursor, WT_LAS_PARTITION *part, uint64_t pageid, bool lock_wait, uint64_t *remove_cntp)
 {
-    WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_ITEM las_key;
     WT_SESSION_IMPL *session;
@@ -504,14 +544,13 @@ __las_remove_block(WT_CURSOR *cursor, uint64_t pageid, bool lock_wait, uint64_t
     *remove_cntp = 0;
 
     session = (WT_SESSION_IMPL *)cursor->session;
-    conn = S2C(session);
     local_txn = false;
 
     /* Prevent the sweep thread from removing the block. */
     if (lock_wait)
-        __wt_writelock(session, &conn->cache->las_sweepwalk_lock);
+        __wt_writelock(session, &part->sweepwalk_lock);
     else
-        WT_RET(__wt_try_writelock(session, &conn->cache->las_sweepwalk_lock));
+        WT_RET(__wt_try_writelock(session, &part->sweepwalk_lock));
 
     __las_set_isolation(session, &saved_isolation);
     WT_ERR(__wt_txn_begin(session, NULL));
@@ -542,7 +581,7 @@ err:
     }
 
     __las_restore_isolation(session, saved_isolation);
-    __wt_writeunlock(session, &conn->cache->las_sweepwalk_lock);
+    __wt_writeunlock(session, &part->sweepwalk_lock);
     return (ret);
 }
 
@@ -604,6 +643,140 @@ __las_insert_block_verbose(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_MULTI *
         cache->las_verb_gen_write = ckpt_gen_current;
 }
 
+/*
+ * __las_history_pack --
+ *     Append a lookaside record to a block of history kept in memory.
+ */
+static int
+__las_history_pack(WT_SESSION_IMPL *session, WT_ITEM *history, WT_ITEM *key, WT_UPDATE *upd,
+  uint8_t upd_type, WT_ITEM *las_value)
+{
+    uint8_t *p;
+
+    WT_RET(__wt_buf_extend(
+      session, history, history->size + key->size + las_value->size + 6 * WT_INTPACK64_MAXSIZE));
+    p = (uint8_t *)history->mem + history->size;
+
+    WT_RET(__wt_vpack_uint(&p, 0, key->size));
+    if (key->size != 0)
+        memcpy(p, key->data, key->size);
+    p += key->size;
+    WT_RET(__wt_vpack_uint(&p, 0, upd->txnid));
+    WT_RET(__wt_vpack_uint(&p, 0, upd->start_ts));
+    WT_RET(__wt_vpack_uint(&p, 0, upd->durable_ts));
+    *p++ = upd->prepare_state;
+    *p++ = upd_type;
+    WT_RET(__wt_vpack_uint(&p, 0, las_value->size));
+    if (las_value->size != 0)
+        memcpy(p, las_value->data, las_value->size);
+    p += las_value->size;
+
+    history->size = WT_PTRDIFF(p, history->mem);
+    return (0);
+}
+
+/*
+ * __wt_las_history_next --
+ *     Return the next record from a block of lookaside history kept in memory, in the same form as
+ *     a lookaside table cursor returns it.
+ */
+int
+__wt_las_history_next(const uint8_t **pp, const uint8_t *end, WT_ITEM *las_key, uint64_t *txnidp,
+  wt_timestamp_t *start_tsp, wt_timestamp_t *durable_tsp, uint8_t *prepare_statep,
+  uint8_t *upd_typep, WT_ITEM *las_value)
+{
+    uint64_t v, vs[3];
+    const uint8_t *p;
+
+    if ((p = *pp) >= end)
+        return (WT_NOTFOUND);
+
+    WT_RET(__wt_vunpack_uint(&p, 0, &v));
+    las_key->data = p;
+    las_key->size = (size_t)v;
+    p += v;
+    WT_RET(__wt_vunpack_uint_n(&p, 0, vs, 3));
+    *txnidp = vs[0];
+    *start_tsp = vs[1];
+    *durable_tsp = vs[2];
+    *prepare_statep = *p++;
+    *upd_typep = *p++;
+    WT_RET(__wt_vunpack_uint(&p, 0, &v));
+    las_value->data = p;
+    las_value->size = (size_t)v;
+    p += v;
+
+    *pp = p;
+    return (0);
+}
+
+/*
+ * __las_history_spill --
+ *     Copy a block of history kept in memory into the lookaside table.
+ */
+static int
+__las_history_spill(WT_CURSOR *cursor, WT_ITEM *history, uint64_t las_pageid, uint32_t btree_id)
+{
+    WT_DECL_RET;
+    WT_ITEM las_key, las_value;
+    wt_timestamp_t durable_ts, start_ts;
+    uint64_t las_counter, txnid;
+    uint8_t prepare_state, upd_type;
+    const uint8_t *end, *p;
+
+    p = history->data;
+    end = p + history->size;
+    for (las_counter = 0; (ret = __wt_las_history_next(&p, end, &las_key, &txnid, &start_ts,
+                            &durable_ts, &prepare_state, &upd_type, &las_value)) == 0;) {
+        cursor->set_key(cursor, las_pageid, btree_id, ++las_counter, &las_key);
+        cursor->set_value(
+          cursor, txnid, start_ts, durable_ts, prepare_state, upd_type, &las_value);
+        WT_RET(cursor->update(cursor));
+    }
+    WT_RET_NOTFOUND_OK(ret);
+
+    history->size = 0;
+    return (0);
+}
+
+/*
+ * __wt_las_history_free --
+ *     Discard any lookaside history kept in memory with a page's lookaside information.
+ */
+void
+__wt_las_history_free(WT_SESSION_IMPL *session, WT_PAGE_LOOKASIDE *page_las)
+{
+    WT_CACHE *cache;
+
+    if (page_las == NULL || page_las->history == NULL)
+        return;
+
+    cache = S2C(session)->cache;
+    __wt_cache_decr_check_uint64(
+      session, &cache->las_history_bytes, page_las->history_size, "WT_CACHE.las_history_bytes");
+    __wt_free(session, page_las->history);
+    page_las->history_size = 0;
+}
+
+/*
+ * __wt_las_history_copy --
+ *     Copy the lookaside history kept in memory from one page's lookaside information to another.
+ */
+int
+__wt_las_history_copy(
+  WT_SESSION_IMPL *session, WT_PAGE_LOOKASIDE *dst, const WT_PAGE_LOOKASIDE *src)
+{
+    dst->history = NULL;
+    dst->history_size = 0;
+    if (src->history == NULL)
+        return (0);
+
+    WT_RET(__wt_memdup(session, src->history, src->history_size, &dst->history));
+    dst->history_size = src->history_size;
+    (void)__wt_atomic_add64(&S2C(session)->cache->las_history_bytes, dst->history_size);
+    return (0);
+}
+
 /*
  * __wt_las_insert_block --
  *     Copy one set of saved updates into the database's lookaside table.
@@ -612,9 +785,12 @@ int
 __wt_las_insert_block(
   WT_CURSOR *cursor, WT_BTREE *btree, WT_PAGE *page, WT_MULTI *multi, WT_ITEM *key)
 {
+    WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(history);
     WT_DECL_RET;
     WT_ITEM las_value;
+    WT_LAS_PARTITION *part;
     WT_SAVE_UPD *list;
     WT_SESSION_IMPL *session;
     WT_TXN_ISOLATION saved_isolation;
@@ -623,17 +799,21 @@ __wt_las_insert_block(
     uint64_t insert_cnt, las_counter, las_pageid, max_las_size;
     uint64_t prepared_insert_cnt;
     uint32_t btree_id, i, slot;
-    uint8_t *p;
+    uint8_t *history_mem, *p, upd_type;
+    const char *las_file;
     bool local_txn;
 
     session = (WT_SESSION_IMPL *)cursor->session;
     conn = S2C(session);
+    cache = conn->cache;
     WT_CLEAR(las_value);
     insert_cnt = prepared_insert_cnt = 0;
     btree_id = btree->id;
+    part = &cache->las_part[WT_LAS_PARTITION_ID(btree_id)];
+    history_mem = NULL;
     local_txn = false;
 
-    las_pageid = __wt_atomic_add64(&conn->cache->las_pageid, 1);
+    las_pageid = __wt_atomic_add64(&cache->las_pageid, 1);
 
     if (!btree->lookaside_entries)
         btree->lookaside_entries = true;
@@ -644,11 +824,20 @@ __wt_las_insert_block(
         /*
          * There should never be any entries with the page ID we are about to use.
          */
-        WT_RET_BUSY_OK(__las_remove_block(cursor, las_pageid, false, &remove_cnt));
+        WT_RET_BUSY_OK(__las_remove_block(cursor, part, las_pageid, false, &remove_cnt));
         WT_ASSERT(session, remove_cnt == 0);
     }
 #endif
 
+    /*
+     * Small blocks of history are kept in memory with the page's lookaside information instead of
+     * being written to the lookaside table: reading the page back doesn't have to search the
+     * lookaside table, and the sweep server never sees the entries. Bound the total memory used,
+     * and start writing to the lookaside table if the block turns out to be large.
+     */
+    if (cache->las_history_bytes < conn->cache_size / WT_LAS_HISTORY_CACHE_PCT)
+        WT_RET(__wt_scr_alloc(session, WT_LAS_HISTORY_MAX, &history));
+
     /* Wrap all the updates in a transaction. */
     __las_set_isolation(session, &saved_isolation);
     WT_ERR(__wt_txn_begin(session, NULL));
@@ -736,8 +925,6 @@ __wt_las_insert_block(
                 WT_ERR(__wt_illegal_value(session, upd->type));
             }
 
-            cursor->set_key(cursor, las_pageid, btree_id, ++las_counter, key);
-
             /*
              * If saving a non-zero length value on the page, save a birthmark instead of
              * duplicating it in the lookaside table. (We check the length because row-store doesn't
@@ -747,24 +934,47 @@ __wt_las_insert_block(
               (upd->type == WT_UPDATE_STANDARD || upd->type == WT_UPDATE_MODIFY)) {
                 las_value.size = 0;
                 WT_ASSERT(session, upd != first_upd || multi->page_las.skew_newest);
-                cursor->set_value(cursor, upd->txnid, upd->start_ts, upd->durable_ts,
-                  upd->prepare_state, WT_UPDATE_BIRTHMARK, &las_value);
+                upd_type = WT_UPDATE_BIRTHMARK;
             } else
-                cursor->set_value(cursor, upd->txnid, upd->start_ts, upd->durable_ts,
-                  upd->prepare_state, upd->type, &las_value);
+                upd_type = upd->type;
 
-            /*
-             * Using update looks a little strange because the keys are guaranteed to not exist, but
-             * since we're appending, we want the cursor to stay positioned in between inserts.
-             */
-            WT_ERR(cursor->update(cursor));
+            ++las_counter;
             ++insert_cnt;
+            if (history != NULL) {
+                WT_ERR(__las_history_pack(session, history, key, upd, upd_type, &las_value));
+                if (history->size > WT_LAS_HISTORY_MAX) {
+                    WT_ERR(__las_history_spill(cursor, history, las_pageid, btree_id));
+                    __wt_scr_free(session, &history);
+                }
+            } else {
+                cursor->set_key(cursor, las_pageid, btree_id, las_counter, key);
+                cursor->set_value(cursor, upd->txnid, upd->start_ts, upd->durable_ts,
+                  upd->prepare_state, upd_type, &las_value);
+
+                /*
+                 * Using update looks a little strange because the keys are guaranteed to not exist,
+                 * but since we're appending, we want the cursor to stay positioned in between
+                 * inserts.
+                 */
+                WT_ERR(cursor->update(cursor));
+            }
             if (upd->prepare_state == WT_PREPARE_INPROGRESS)
                 ++prepared_insert_cnt;
         } while ((upd = upd->next) != NULL);
     }
 
-    WT_ERR(__wt_block_manager_named_size(session, WT_LAS_FILE, &las_size));
+    if (history != NULL) {
+        if (history->size != 0)
+            WT_ERR(__wt_memdup(session, history->data, history->size, &history_mem));
+        goto err;
+    }
+
+    /* The configured maximum applies to the total size of the partitions. */
+    las_file = part->uri;
+    WT_PREFIX_SKIP_REQUIRED(session, las_file, "file:");
+    WT_ERR(__wt_block_manager_named_size(session, las_file, &part->ondisk));
+    for (las_size = 0, i = 0; i < WT_LAS_PARTITIONS; i++)
+        las_size += cache->las_part[i].ondisk;
     WT_STAT_CONN_SET(session, cache_lookaside_ondisk, las_size);
     max_las_size = ((WT_CURSOR_BTREE *)cursor)->btree->file_max;
     if (max_las_size != 0 && (uint64_t)las_size > max_las_size)
@@ -783,7 +993,8 @@ err:
 
         /* Adjust the entry count. */
         if (ret == 0) {
-            (void)__wt_atomic_add64(&conn->cache->las_insert_count, insert_cnt);
+            if (history == NULL)
+                (void)__wt_atomic_add64(&part->insert_count, insert_cnt);
             WT_STAT_CONN_INCRV(
               session, txn_prepared_updates_lookaside_inserts, prepared_insert_cnt);
         }
@@ -794,9 +1005,18 @@ err:
     if (ret == 0 && insert_cnt > 0) {
         multi->page_las.las_pageid = las_pageid;
         multi->page_las.has_prepares = prepared_insert_cnt > 0;
+        if (history_mem != NULL) {
+            multi->page_las.history = history_mem;
+            multi->page_las.history_size = history->size;
+            history_mem = NULL;
+            (void)__wt_atomic_add64(&cache->las_history_bytes, history->size);
+            WT_STAT_CONN_INCR(session, cache_lookaside_history_inmem);
+        }
         __las_insert_block_verbose(session, btree, multi);
     }
 
+    __wt_free(session, history_mem);
+    __wt_scr_free(session, &history);
     WT_UNUSED(first_upd);
     return (ret);
 }
@@ -852,18 +1072,19 @@ __wt_las_cursor_position(WT_CURSOR *cursor, uint64_t pageid)
 
 /*
  * __wt_las_remove_block --
- *     Remove all records for a given page from the lookaside table.
+ *     Remove all records for a given page of the session's btree from the lookaside table.
  */
 int
 __wt_las_remove_block(WT_SESSION_IMPL *session, uint64_t pageid)
 {
-    WT_CONNECTION_IMPL *conn;
     WT_CURSOR *cursor;
     WT_DECL_RET;
+    WT_LAS_PARTITION *part;
     uint64_t remove_cnt;
-    uint32_t session_flags;
+    uint32_t partition, session_flags;
 
-    conn = S2C(session);
+    partition = WT_LAS_PARTITION_ID(S2BT(session)->id);
+    part = &S2C(session)->cache->las_part[partition];
     session_flags = 0; /* [-Wconditional-uninitialized] */
 
     /*
@@ -871,10 +1092,10 @@ __wt_las_remove_block(WT_SESSION_IMPL *session, uint64_t pageid)
      * lookaside table cursor and enclosing transaction, then calling an underlying function to do
      * the work.
      */
-    __wt_las_cursor(session, &cursor, &session_flags);
+    __wt_las_cursor(session, partition, &cursor, &session_flags);
 
-    if ((ret = __las_remove_block(cursor, pageid, true, &remove_cnt)) == 0)
-        (void)__wt_atomic_add64(&conn->cache->las_remove_count, remove_cnt);
+    if ((ret = __las_remove_block(cursor, part, pageid, true, &remove_cnt)) == 0)
+        (void)__wt_atomic_add64(&part->remove_count, remove_cnt);
 
     WT_TRET(__wt_las_cursor_close(session, &cursor, session_flags));
     return (ret);
@@ -889,19 +1110,21 @@ __wt_las_remove_dropped(WT_SESSION_IMPL *session)
 {
     WT_BTREE *btree;
     WT_CACHE *cache;
+    WT_LAS_PARTITION *part;
     u_int i, j;
 
     btree = S2BT(session);
     cache = S2C(session)->cache;
+    part = &cache->las_part[WT_LAS_PARTITION_ID(btree->id)];
 
     __wt_spin_lock(session, &cache->las_sweep_lock);
-    for (i = 0; i < cache->las_dropped_next && cache->las_dropped[i] != btree->id; i++)
+    for (i = 0; i < part->dropped_next && part->dropped[i] != btree->id; i++)
         ;
 
-    if (i < cache->las_dropped_next) {
-        cache->las_dropped_next--;
-        for (j = i; j < cache->las_dropped_next; j++)
-            cache->las_dropped[j] = cache->las_dropped[j + 1];
+    if (i < part->dropped_next) {
+        part->dropped_next--;
+        for (j = i; j < part->dropped_next; j++)
+            part->dropped[j] = part->dropped[j + 1];
     }
     __wt_spin_unlock(session, &cache->las_sweep_lock);
 }
@@ -916,14 +1139,16 @@ __wt_las_save_dropped(WT_SESSION_IMPL *session)
     WT_BTREE *btree;
     WT_CACHE *cache;
     WT_DECL_RET;
+    WT_LAS_PARTITION *part;
 
     btree = S2BT(session);
     cache = S2C(session)->cache;
+    part = &cache->las_part[WT_LAS_PARTITION_ID(btree->id)];
 
     __wt_spin_lock(session, &cache->las_sweep_lock);
-    WT_ERR(__wt_realloc_def(
-      session, &cache->las_dropped_alloc, cache->las_dropped_next + 1, &cache->las_dropped));
-    cache->las_dropped[cache->las_dropped_next++] = btree->id;
+    WT_ERR(
+      __wt_realloc_def(session, &part->dropped_alloc, part->dropped_next + 1, &part->dropped));
+    part->dropped[part->dropped_next++] = btree->id;
 err:
     __wt_spin_unlock(session, &cache->las_sweep_lock);
     return (ret);
@@ -931,10 +1156,10 @@ err:
 
 /*
  * __las_sweep_count --
- *     Calculate how many records to examine per sweep step.
+ *     Calculate how many records of a partition to examine per sweep step.
  */
 static inline uint64_t
-__las_sweep_count(WT_CACHE *cache)
+__las_sweep_count(WT_LAS_PARTITION *part)
 {
     uint64_t las_entry_count;
 
@@ -954,17 +1179,17 @@ __las_sweep_count(WT_CACHE *cache)
      * with lookaside entries are blocked during sweep, make sure we do
      * some work but don't block reads for too long.
      */
-    las_entry_count = __las_entry_count(cache);
+    las_entry_count = __las_partition_entry_count(part);
     return (
       (uint64_t)WT_MAX(WT_LAS_SWEEP_ENTRIES, las_entry_count / (5 * WT_MINUTE / WT_LAS_SWEEP_SEC)));
 }
 
 /*
  * __las_sweep_init --
- *     Prepare to start a lookaside sweep.
+ *     Prepare to start a lookaside partition sweep.
  */
 static int
-__las_sweep_init(WT_SESSION_IMPL *session)
+__las_sweep_init(WT_SESSION_IMPL *session, WT_LAS_PARTITION *part)
 {
     WT_CACHE *cache;
     WT_DECL_RET;
@@ -975,10 +1200,10 @@ __las_sweep_init(WT_SESSION_IMPL *session)
     __wt_spin_lock(session, &cache->las_sweep_lock);
 
     /*
-     * If no files have been dropped and the lookaside file is empty, there's nothing to do.
+     * If no files have been dropped and the lookaside partition is empty, there's nothing to do.
      */
-    if (cache->las_dropped_next == 0) {
-        if (__wt_las_empty(session))
+    if (part->dropped_next == 0) {
+        if (__las_partition_entry_count(part) == 0)
             ret = WT_NOTFOUND;
         goto err;
     }
@@ -994,25 +1219,25 @@ __las_sweep_init(WT_SESSION_IMPL *session)
      * this sweep completes, it will have a higher page ID and should not
      * be removed.
      */
-    cache->las_sweep_max_pageid = cache->las_pageid;
+    part->sweep_max_pageid = cache->las_pageid;
 
     /* Scan the btree IDs to find min/max. */
-    cache->las_sweep_dropmin = UINT32_MAX;
-    cache->las_sweep_dropmax = 0;
-    for (i = 0; i < cache->las_dropped_next; i++) {
-        cache->las_sweep_dropmin = WT_MIN(cache->las_sweep_dropmin, cache->las_dropped[i]);
-        cache->las_sweep_dropmax = WT_MAX(cache->las_sweep_dropmax, cache->las_dropped[i]);
+    part->sweep_dropmin = UINT32_MAX;
+    part->sweep_dropmax = 0;
+    for (i = 0; i < part->dropped_next; i++) {
+        part->sweep_dropmin = WT_MIN(part->sweep_dropmin, part->dropped[i]);
+        part->sweep_dropmax = WT_MAX(part->sweep_dropmax, part->dropped[i]);
     }
 
     /* Initialize the bitmap. */
-    __wt_free(session, cache->las_sweep_dropmap);
-    WT_ERR(__bit_alloc(
-      session, 1 + cache->las_sweep_dropmax - cache->las_sweep_dropmin, &cache->las_sweep_dropmap));
-    for (i = 0; i < cache->las_dropped_next; i++)
-        __bit_set(cache->las_sweep_dropmap, cache->las_dropped[i] - cache->las_sweep_dropmin);
+    __wt_free(session, part->sweep_dropmap);
+    WT_ERR(
+      __bit_alloc(session, 1 + part->sweep_dropmax - part->sweep_dropmin, &part->sweep_dropmap));
+    for (i = 0; i < part->dropped_next; i++)
+        __bit_set(part->sweep_dropmap, part->dropped[i] - part->sweep_dropmin);
 
     /* Clear the list of btree IDs. */
-    cache->las_dropped_next = 0;
+    part->dropped_next = 0;
 
 err:
     __wt_spin_unlock(session, &cache->las_sweep_lock);
@@ -1020,18 +1245,18 @@ err:
 }
 
 /*
- * __wt_las_sweep --
- *     Sweep the lookaside table.
+ * __las_sweep_partition --
+ *     Sweep a lookaside table partition.
  */
-int
-__wt_las_sweep(WT_SESSION_IMPL *session)
+static int
+__las_sweep_partition(WT_SESSION_IMPL *session, u_int partition)
 {
-    WT_CACHE *cache;
     WT_CURSOR *cursor;
     WT_DECL_ITEM(saved_key);
     WT_DECL_RET;
     WT_ITEM las_key, las_value;
     WT_ITEM *sweep_key;
+    WT_LAS_PARTITION *part;
     WT_TXN_ISOLATION saved_isolation;
     wt_timestamp_t durable_timestamp, las_timestamp;
     uint64_t cnt, remove_cnt, las_pageid, saved_pageid, visit_cnt;
@@ -1041,9 +1266,9 @@ __wt_las_sweep(WT_SESSION_IMPL *session)
     int notused;
     bool local_txn, locked, removing_key_block;
 
-    cache = S2C(session)->cache;
+    part = &S2C(session)->cache->las_part[partition];
     cursor = NULL;
-    sweep_key = &cache->las_sweep_key;
+    sweep_key = &part->sweep_key;
     remove_cnt = 0;
     session_flags = 0; /* [-Werror=maybe-uninitialized] */
     local_txn = locked = removing_key_block = false;
@@ -1054,14 +1279,14 @@ __wt_las_sweep(WT_SESSION_IMPL *session)
     /*
      * Prevent other threads removing entries from underneath the sweep.
      */
-    __wt_writelock(session, &cache->las_sweepwalk_lock);
+    __wt_writelock(session, &part->sweepwalk_lock);
     locked = true;
 
     /*
      * Allocate a cursor and wrap all the updates in a transaction. We should have our own lookaside
      * cursor.
      */
-    __wt_las_cursor(session, &cursor, &session_flags);
+    __wt_las_cursor(session, partition, &cursor, &session_flags);
     WT_ASSERT(session, cursor->session == &session->iface);
     __las_set_isolation(session, &saved_isolation);
     WT_ERR(__wt_txn_begin(session, NULL));
@@ -1090,11 +1315,11 @@ __wt_las_sweep(WT_SESSION_IMPL *session)
          */
         __wt_buf_free(session, sweep_key);
     } else
-        ret = __las_sweep_init(session);
+        ret = __las_sweep_init(session, part);
     if (ret != 0)
         goto srch_notfound;
 
-    cnt = __las_sweep_count(cache);
+    cnt = __las_sweep_count(part);
     visit_cnt = 0;
 
     /* Walk the file. */
@@ -1117,7 +1342,7 @@ __wt_las_sweep(WT_SESSION_IMPL *session)
          * Don't go past the end of lookaside from when sweep started. If a file is reopened, its ID
          * may be reused past this point so the bitmap we're using is not valid.
          */
-        if (las_pageid > cache->las_sweep_max_pageid) {
+        if (las_pageid > part->sweep_max_pageid) {
             __wt_buf_free(session, sweep_key);
             ret = WT_NOTFOUND;
             break;
@@ -1129,7 +1354,7 @@ __wt_las_sweep(WT_SESSION_IMPL *session)
          */
         ++visit_cnt;
         if (!removing_key_block &&
-          (cnt == 0 || (visit_cnt > WT_LAS_SWEEP_ENTRIES && cache->las_reader)))
+          (cnt == 0 || (visit_cnt > WT_LAS_SWEEP_ENTRIES && part->reader)))
             break;
         if (cnt > 0)
             --cnt;
@@ -1142,8 +1367,8 @@ __wt_las_sweep(WT_SESSION_IMPL *session)
          * expected for dropped trees), and the cursor remains
          * positioned in that case.
          */
-        if (las_id >= cache->las_sweep_dropmin && las_id <= cache->las_sweep_dropmax &&
-          __bit_test(cache->las_sweep_dropmap, las_id - cache->las_sweep_dropmin)) {
+        if (las_id >= part->sweep_dropmin && las_id <= part->sweep_dropmax &&
+          __bit_test(part->sweep_dropmap, las_id - part->sweep_dropmin)) {
             WT_ERR(cursor->remove(cursor));
             ++remove_cnt;
             saved_key->size = 0;
@@ -1247,16 +1472,34 @@ err:
         else
             WT_TRET(__wt_txn_rollback(session, NULL));
         if (ret == 0)
-            (void)__wt_atomic_add64(&cache->las_remove_count, remove_cnt);
+            (void)__wt_atomic_add64(&part->remove_count, remove_cnt);
     }
 
     __las_restore_isolation(session, saved_isolation);
     WT_TRET(__wt_las_cursor_close(session, &cursor, session_flags));
 
     if (locked)
-        __wt_writeunlock(session, &cache->las_sweepwalk_lock);
+        __wt_writeunlock(session, &part->sweepwalk_lock);
 
     __wt_scr_free(session, &saved_key);
 
     return (ret);
 }
+
+/*
+ * __wt_las_sweep --
+ *     Sweep the lookaside table. Each partition is swept in turn, holding only that partition's
+ *     lock, so reads and removes in the other partitions are not blocked.
+ */
+int
+__wt_las_sweep(WT_SESSION_IMPL *session)
+{
+    u_int i;
+
+    for (i = 0; i < WT_LAS_PARTITIONS; i++) {
+        if (__wt_cache_stuck(session))
+            break;
+        WT_RET(__las_sweep_partition(session, i));
+    }
+    return (0);
+}
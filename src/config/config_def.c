@@ -4,8 +4,8 @@
 
 static const WT_CONFIG_CHECK confchk_WT_CONNECTION_async_new_op[] = {
   {"append", "boolean", NULL, NULL, NULL, 0}, {"overwrite", "boolean", NULL, NULL, NULL, 0},
-  {"raw", "boolean", NULL, NULL, NULL, 0}, {"timeout", "int", NULL, NULL, NULL, 0},
-  {NULL, NULL, NULL, NULL, NULL, 0}};
+  {"poll", "boolean", NULL, NULL, NULL, 0}, {"raw", "boolean", NULL, NULL, NULL, 0},
+  {"timeout", "int", NULL, NULL, NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
 
 static const WT_CONFIG_CHECK confchk_WT_CONNECTION_close[] = {
   {"leak_memory", "boolean", NULL, NULL, NULL, 0},
@@ -43,6 +43,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_async_subconfigs[] = {
   {"enabled", "boolean", NULL, NULL, NULL, 0}, {"ops_max", "int", NULL, "min=1,max=4096", NULL, 0},
   {"threads", "int", NULL, "min=1,max=20", NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
 
+static const WT_CONFIG_CHECK confchk_wiredtiger_open_background_compact_subconfigs[] = {
+  {"wait", "int", NULL, "min=0,max=100000", NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
+
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_cache_overflow_subconfigs[] = {
   {"file_max", "int", NULL, "min=0", NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
 
@@ -98,9 +101,12 @@ static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure_statistics_log_su
 
 static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure[] = {
   {"async", "category", NULL, NULL, confchk_wiredtiger_open_async_subconfigs, 3},
+  {"background_compact", "category", NULL, NULL,
+    confchk_wiredtiger_open_background_compact_subconfigs, 1},
   {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
   {"cache_overflow", "category", NULL, NULL, confchk_wiredtiger_open_cache_overflow_subconfigs, 1},
   {"cache_overhead", "int", NULL, "min=0,max=30", NULL, 0},
+  {"cache_page_arena", "boolean", NULL, NULL, NULL, 0},
   {"cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0},
   {"checkpoint", "category", NULL, NULL, confchk_wiredtiger_open_checkpoint_subconfigs, 2},
   {"compatibility", "category", NULL, NULL,
@@ -238,7 +244,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
   {"allocation_size", "int", NULL, "min=512B,max=128MB", NULL, 0},
   {"app_metadata", "string", NULL, NULL, NULL, 0},
   {"assert", "category", NULL, NULL, confchk_assert_subconfigs, 3},
-  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\"]", NULL, 0},
+  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\",\"sequential\"]", NULL, 0},
   {"block_compressor", "string", NULL, NULL, NULL, 0},
   {"cache_resident", "boolean", NULL, NULL, NULL, 0},
   {"checksum", "string", NULL, "choices=[\"on\",\"off\",\"uncompressed\"]", NULL, 0},
@@ -249,7 +255,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
   {"format", "string", NULL, "choices=[\"btree\"]", NULL, 0},
   {"huffman_key", "string", NULL, NULL, NULL, 0}, {"huffman_value", "string", NULL, NULL, NULL, 0},
   {"ignore_in_memory_cache_size", "boolean", NULL, NULL, NULL, 0},
-  {"immutable", "boolean", NULL, NULL, NULL, 0},
+  {"immutable", "boolean", NULL, NULL, NULL, 0}, {"include", "list", NULL, NULL, NULL, 0},
   {"internal_item_max", "int", NULL, "min=0", NULL, 0},
   {"internal_key_max", "int", NULL, "min=0", NULL, 0},
   {"internal_key_truncate", "boolean", NULL, NULL, NULL, 0},
@@ -365,7 +371,7 @@ static const WT_CONFIG_CHECK confchk_file_config[] = {
   {"allocation_size", "int", NULL, "min=512B,max=128MB", NULL, 0},
   {"app_metadata", "string", NULL, NULL, NULL, 0},
   {"assert", "category", NULL, NULL, confchk_assert_subconfigs, 3},
-  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\"]", NULL, 0},
+  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\",\"sequential\"]", NULL, 0},
   {"block_compressor", "string", NULL, NULL, NULL, 0},
   {"cache_resident", "boolean", NULL, NULL, NULL, 0},
   {"checksum", "string", NULL, "choices=[\"on\",\"off\",\"uncompressed\"]", NULL, 0},
@@ -402,7 +408,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
   {"allocation_size", "int", NULL, "min=512B,max=128MB", NULL, 0},
   {"app_metadata", "string", NULL, NULL, NULL, 0},
   {"assert", "category", NULL, NULL, confchk_assert_subconfigs, 3},
-  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\"]", NULL, 0},
+  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\",\"sequential\"]", NULL, 0},
   {"block_compressor", "string", NULL, NULL, NULL, 0},
   {"cache_resident", "boolean", NULL, NULL, NULL, 0}, {"checkpoint", "string", NULL, NULL, NULL, 0},
   {"checkpoint_lsn", "string", NULL, NULL, NULL, 0},
@@ -439,7 +445,8 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 static const WT_CONFIG_CHECK confchk_index_meta[] = {
   {"app_metadata", "string", NULL, NULL, NULL, 0}, {"collator", "string", NULL, NULL, NULL, 0},
   {"columns", "list", NULL, NULL, NULL, 0}, {"extractor", "string", NULL, NULL, NULL, 0},
-  {"immutable", "boolean", NULL, NULL, NULL, 0}, {"index_key_columns", "int", NULL, NULL, NULL, 0},
+  {"immutable", "boolean", NULL, NULL, NULL, 0}, {"include", "list", NULL, NULL, NULL, 0},
+  {"index_key_columns", "int", NULL, NULL, NULL, 0},
   {"key_format", "format", __wt_struct_confchk, NULL, NULL, 0},
   {"source", "string", NULL, NULL, NULL, 0}, {"type", "string", NULL, NULL, NULL, 0},
   {"value_format", "format", __wt_struct_confchk, NULL, NULL, 0},
@@ -450,7 +457,7 @@ static const WT_CONFIG_CHECK confchk_lsm_meta[] = {
   {"allocation_size", "int", NULL, "min=512B,max=128MB", NULL, 0},
   {"app_metadata", "string", NULL, NULL, NULL, 0},
   {"assert", "category", NULL, NULL, confchk_assert_subconfigs, 3},
-  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\"]", NULL, 0},
+  {"block_allocation", "string", NULL, "choices=[\"first\",\"best\",\"sequential\"]", NULL, 0},
   {"block_compressor", "string", NULL, NULL, NULL, 0},
   {"cache_resident", "boolean", NULL, NULL, NULL, 0},
   {"checksum", "string", NULL, "choices=[\"on\",\"off\",\"uncompressed\"]", NULL, 0},
@@ -495,6 +502,10 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_compatibility_subconfigs[]
   {"release", "string", NULL, NULL, NULL, 0}, {"require_max", "string", NULL, NULL, NULL, 0},
   {"require_min", "string", NULL, NULL, NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
 
+static const WT_CONFIG_CHECK confchk_wiredtiger_open_cursor_pool_subconfigs[] = {
+  {"enabled", "boolean", NULL, NULL, NULL, 0}, {"prewarm", "list", NULL, NULL, NULL, 0},
+  {NULL, NULL, NULL, NULL, NULL, 0}};
+
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_encryption_subconfigs[] = {
   {"keyid", "string", NULL, NULL, NULL, 0}, {"name", "string", NULL, NULL, NULL, 0},
   {"secretkey", "string", NULL, NULL, NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
@@ -521,17 +532,21 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_transaction_sync_subconfigs
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
   {"async", "category", NULL, NULL, confchk_wiredtiger_open_async_subconfigs, 3},
+  {"background_compact", "category", NULL, NULL,
+    confchk_wiredtiger_open_background_compact_subconfigs, 1},
   {"buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0},
   {"builtin_extension_config", "string", NULL, NULL, NULL, 0},
   {"cache_cursors", "boolean", NULL, NULL, NULL, 0},
   {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
   {"cache_overflow", "category", NULL, NULL, confchk_wiredtiger_open_cache_overflow_subconfigs, 1},
   {"cache_overhead", "int", NULL, "min=0,max=30", NULL, 0},
+  {"cache_page_arena", "boolean", NULL, NULL, NULL, 0},
   {"cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0},
   {"checkpoint", "category", NULL, NULL, confchk_wiredtiger_open_checkpoint_subconfigs, 2},
   {"checkpoint_sync", "boolean", NULL, NULL, NULL, 0},
   {"compatibility", "category", NULL, NULL, confchk_wiredtiger_open_compatibility_subconfigs, 3},
   {"config_base", "boolean", NULL, NULL, NULL, 0}, {"create", "boolean", NULL, NULL, NULL, 0},
+  {"cursor_pool", "category", NULL, NULL, confchk_wiredtiger_open_cursor_pool_subconfigs, 2},
   {"debug_mode", "category", NULL, NULL, confchk_wiredtiger_open_debug_mode_subconfigs, 4},
   {"direct_io", "list", NULL, "choices=[\"checkpoint\",\"data\",\"log\"]", NULL, 0},
   {"encryption", "category", NULL, NULL, confchk_wiredtiger_open_encryption_subconfigs, 3},
@@ -588,17 +603,21 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
   {"async", "category", NULL, NULL, confchk_wiredtiger_open_async_subconfigs, 3},
+  {"background_compact", "category", NULL, NULL,
+    confchk_wiredtiger_open_background_compact_subconfigs, 1},
   {"buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0},
   {"builtin_extension_config", "string", NULL, NULL, NULL, 0},
   {"cache_cursors", "boolean", NULL, NULL, NULL, 0},
   {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
   {"cache_overflow", "category", NULL, NULL, confchk_wiredtiger_open_cache_overflow_subconfigs, 1},
   {"cache_overhead", "int", NULL, "min=0,max=30", NULL, 0},
+  {"cache_page_arena", "boolean", NULL, NULL, NULL, 0},
   {"cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0},
   {"checkpoint", "category", NULL, NULL, confchk_wiredtiger_open_checkpoint_subconfigs, 2},
   {"checkpoint_sync", "boolean", NULL, NULL, NULL, 0},
   {"compatibility", "category", NULL, NULL, confchk_wiredtiger_open_compatibility_subconfigs, 3},
   {"config_base", "boolean", NULL, NULL, NULL, 0}, {"create", "boolean", NULL, NULL, NULL, 0},
+  {"cursor_pool", "category", NULL, NULL, confchk_wiredtiger_open_cursor_pool_subconfigs, 2},
   {"debug_mode", "category", NULL, NULL, confchk_wiredtiger_open_debug_mode_subconfigs, 4},
   {"direct_io", "list", NULL, "choices=[\"checkpoint\",\"data\",\"log\"]", NULL, 0},
   {"encryption", "category", NULL, NULL, confchk_wiredtiger_open_encryption_subconfigs, 3},
@@ -656,16 +675,20 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
   {"async", "category", NULL, NULL, confchk_wiredtiger_open_async_subconfigs, 3},
+  {"background_compact", "category", NULL, NULL,
+    confchk_wiredtiger_open_background_compact_subconfigs, 1},
   {"buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0},
   {"builtin_extension_config", "string", NULL, NULL, NULL, 0},
   {"cache_cursors", "boolean", NULL, NULL, NULL, 0},
   {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
   {"cache_overflow", "category", NULL, NULL, confchk_wiredtiger_open_cache_overflow_subconfigs, 1},
   {"cache_overhead", "int", NULL, "min=0,max=30", NULL, 0},
+  {"cache_page_arena", "boolean", NULL, NULL, NULL, 0},
   {"cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0},
   {"checkpoint", "category", NULL, NULL, confchk_wiredtiger_open_checkpoint_subconfigs, 2},
   {"checkpoint_sync", "boolean", NULL, NULL, NULL, 0},
   {"compatibility", "category", NULL, NULL, confchk_wiredtiger_open_compatibility_subconfigs, 3},
+  {"cursor_pool", "category", NULL, NULL, confchk_wiredtiger_open_cursor_pool_subconfigs, 2},
   {"debug_mode", "category", NULL, NULL, confchk_wiredtiger_open_debug_mode_subconfigs, 4},
   {"direct_io", "list", NULL, "choices=[\"checkpoint\",\"data\",\"log\"]", NULL, 0},
   {"encryption", "category", NULL, NULL, confchk_wiredtiger_open_encryption_subconfigs, 3},
@@ -721,16 +744,20 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
   {"async", "category", NULL, NULL, confchk_wiredtiger_open_async_subconfigs, 3},
+  {"background_compact", "category", NULL, NULL,
+    confchk_wiredtiger_open_background_compact_subconfigs, 1},
   {"buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0},
   {"builtin_extension_config", "string", NULL, NULL, NULL, 0},
   {"cache_cursors", "boolean", NULL, NULL, NULL, 0},
   {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
   {"cache_overflow", "category", NULL, NULL, confchk_wiredtiger_open_cache_overflow_subconfigs, 1},
   {"cache_overhead", "int", NULL, "min=0,max=30", NULL, 0},
+  {"cache_page_arena", "boolean", NULL, NULL, NULL, 0},
   {"cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0},
   {"checkpoint", "category", NULL, NULL, confchk_wiredtiger_open_checkpoint_subconfigs, 2},
   {"checkpoint_sync", "boolean", NULL, NULL, NULL, 0},
   {"compatibility", "category", NULL, NULL, confchk_wiredtiger_open_compatibility_subconfigs, 3},
+  {"cursor_pool", "category", NULL, NULL, confchk_wiredtiger_open_cursor_pool_subconfigs, 2},
   {"debug_mode", "category", NULL, NULL, confchk_wiredtiger_open_debug_mode_subconfigs, 4},
   {"direct_io", "list", NULL, "choices=[\"checkpoint\",\"data\",\"log\"]", NULL, 0},
   {"encryption", "category", NULL, NULL, confchk_wiredtiger_open_encryption_subconfigs, 3},
@@ -786,8 +813,8 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator", "", NULL, 0},
   {"WT_CONNECTION.add_compressor", "", NULL, 0}, {"WT_CONNECTION.add_data_source", "", NULL, 0},
   {"WT_CONNECTION.add_encryptor", "", NULL, 0}, {"WT_CONNECTION.add_extractor", "", NULL, 0},
-  {"WT_CONNECTION.async_new_op", "append=false,overwrite=true,raw=false,timeout=1200",
-    confchk_WT_CONNECTION_async_new_op, 4},
+  {"WT_CONNECTION.async_new_op", "append=false,overwrite=true,poll=false,raw=false,timeout=1200",
+    confchk_WT_CONNECTION_async_new_op, 5},
   {"WT_CONNECTION.close", "leak_memory=false,use_timestamp=true", confchk_WT_CONNECTION_close, 2},
   {"WT_CONNECTION.debug_info",
     "cache=false,cursors=false,handles=false,log=false,sessions=false"
@@ -803,8 +830,10 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     confchk_WT_CONNECTION_open_session, 3},
   {"WT_CONNECTION.query_timestamp", "get=all_durable", confchk_WT_CONNECTION_query_timestamp, 1},
   {"WT_CONNECTION.reconfigure",
-    "async=(enabled=false,ops_max=1024,threads=2),cache_max_wait_ms=0"
-    ",cache_overflow=(file_max=0),cache_overhead=8,cache_size=100MB,"
+    "async=(enabled=false,ops_max=1024,threads=2),"
+    "background_compact=(wait=0),cache_max_wait_ms=0,"
+    "cache_overflow=(file_max=0),cache_overhead=8,"
+    "cache_page_arena=false,cache_size=100MB,"
     "checkpoint=(log_size=0,wait=0),compatibility=(release=),"
     "debug_mode=(checkpoint_retention=0,eviction=false,"
     "rollback_error=0,table_logging=false),error_prefix=,"
@@ -820,7 +849,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "statistics=none,statistics_log=(json=false,on_close=false,"
     "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
     "timing_stress_for_test=,verbose=",
-    confchk_WT_CONNECTION_reconfigure, 26},
+    confchk_WT_CONNECTION_reconfigure, 28},
   {"WT_CONNECTION.rollback_to_stable", "", NULL, 0}, {"WT_CONNECTION.set_file_system", "", NULL, 0},
   {"WT_CONNECTION.set_timestamp",
     "commit_timestamp=,durable_timestamp=,force=false,"
@@ -852,7 +881,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "cache_resident=false,checksum=uncompressed,colgroups=,collator=,"
     "columns=,dictionary=0,encryption=(keyid=,name=),exclusive=false,"
     "extractor=,format=btree,huffman_key=,huffman_value=,"
-    "ignore_in_memory_cache_size=false,immutable=false,"
+    "ignore_in_memory_cache_size=false,immutable=false,include=,"
     "internal_item_max=0,internal_key_max=0,"
     "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
     "key_gap=10,leaf_item_max=0,leaf_key_max=0,leaf_page_max=32KB,"
@@ -865,7 +894,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "prefix_compression=false,prefix_compression_min=4,source=,"
     "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=90,"
     "type=file,value_format=u",
-    confchk_WT_SESSION_create, 44},
+    confchk_WT_SESSION_create, 45},
   {"WT_SESSION.drop",
     "checkpoint_wait=true,force=false,lock_wait=true,"
     "remove_files=true",
@@ -942,8 +971,9 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     confchk_file_meta, 41},
   {"index.meta",
     "app_metadata=,collator=,columns=,extractor=,immutable=false,"
-    "index_key_columns=,key_format=u,source=,type=file,value_format=u",
-    confchk_index_meta, 10},
+    "include=,index_key_columns=,key_format=u,source=,type=file,"
+    "value_format=u",
+    confchk_index_meta, 11},
   {"lsm.meta",
     "access_pattern_hint=none,allocation_size=4KB,app_metadata=,"
     "assert=(commit_timestamp=none,durable_timestamp=none,"
@@ -970,12 +1000,15 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "value_format=u",
     confchk_table_meta, 6},
   {"wiredtiger_open",
-    "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-    ",builtin_extension_config=,cache_cursors=true,"
+    "async=(enabled=false,ops_max=1024,threads=2),"
+    "background_compact=(wait=0),buffer_alignment=-1,"
+    "builtin_extension_config=,cache_cursors=true,"
     "cache_max_wait_ms=0,cache_overflow=(file_max=0),cache_overhead=8"
-    ",cache_size=100MB,checkpoint=(log_size=0,wait=0),"
+    ",cache_page_arena=false,cache_size=100MB,"
+    "checkpoint=(log_size=0,wait=0),"
     "checkpoint_sync=true,compatibility=(release=,require_max=,"
     "require_min=),config_base=true,create=false,"
+    "cursor_pool=(enabled=false,prewarm=),"
     "debug_mode=(checkpoint_retention=0,eviction=false,"
     "rollback_error=0,table_logging=false),direct_io=,"
     "encryption=(keyid=,name=,secretkey=),error_prefix=,"
@@ -998,14 +1031,17 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "timing_stress_for_test=,transaction_sync=(enabled=false,"
     "method=fsync),use_environment=true,use_environment_priv=false,"
     "verbose=,write_through=",
-    confchk_wiredtiger_open, 50},
+    confchk_wiredtiger_open, 53},
   {"wiredtiger_open_all",
-    "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-    ",builtin_extension_config=,cache_cursors=true,"
+    "async=(enabled=false,ops_max=1024,threads=2),"
+    "background_compact=(wait=0),buffer_alignment=-1,"
+    "builtin_extension_config=,cache_cursors=true,"
     "cache_max_wait_ms=0,cache_overflow=(file_max=0),cache_overhead=8"
-    ",cache_size=100MB,checkpoint=(log_size=0,wait=0),"
+    ",cache_page_arena=false,cache_size=100MB,"
+    "checkpoint=(log_size=0,wait=0),"
     "checkpoint_sync=true,compatibility=(release=,require_max=,"
     "require_min=),config_base=true,create=false,"
+    "cursor_pool=(enabled=false,prewarm=),"
     "debug_mode=(checkpoint_retention=0,eviction=false,"
     "rollback_error=0,table_logging=false),direct_io=,"
     "encryption=(keyid=,name=,secretkey=),error_prefix=,"
@@ -1028,14 +1064,17 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "timing_stress_for_test=,transaction_sync=(enabled=false,"
     "method=fsync),use_environment=true,use_environment_priv=false,"
     "verbose=,version=(major=0,minor=0),write_through=",
-    confchk_wiredtiger_open_all, 51},
+    confchk_wiredtiger_open_all, 54},
   {"wiredtiger_open_basecfg",
-    "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-    ",builtin_extension_config=,cache_cursors=true,"
+    "async=(enabled=false,ops_max=1024,threads=2),"
+    "background_compact=(wait=0),buffer_alignment=-1,"
+    "builtin_extension_config=,cache_cursors=true,"
     "cache_max_wait_ms=0,cache_overflow=(file_max=0),cache_overhead=8"
-    ",cache_size=100MB,checkpoint=(log_size=0,wait=0),"
+    ",cache_page_arena=false,cache_size=100MB,"
+    "checkpoint=(log_size=0,wait=0),"
     "checkpoint_sync=true,compatibility=(release=,require_max=,"
-    "require_min=),debug_mode=(checkpoint_retention=0,eviction=false,"
+    "require_min=),cursor_pool=(enabled=false,prewarm=),"
+    "debug_mode=(checkpoint_retention=0,eviction=false,"
     "rollback_error=0,table_logging=false),direct_io=,"
     "encryption=(keyid=,name=,secretkey=),error_prefix=,"
     "eviction=(threads_max=8,threads_min=1),"
@@ -1055,14 +1094,17 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
     "timing_stress_for_test=,transaction_sync=(enabled=false,"
     "method=fsync),verbose=,version=(major=0,minor=0),write_through=",
-    confchk_wiredtiger_open_basecfg, 45},
+    confchk_wiredtiger_open_basecfg, 48},
   {"wiredtiger_open_usercfg",
-    "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-    ",builtin_extension_config=,cache_cursors=true,"
+    "async=(enabled=false,ops_max=1024,threads=2),"
+    "background_compact=(wait=0),buffer_alignment=-1,"
+    "builtin_extension_config=,cache_cursors=true,"
     "cache_max_wait_ms=0,cache_overflow=(file_max=0),cache_overhead=8"
-    ",cache_size=100MB,checkpoint=(log_size=0,wait=0),"
+    ",cache_page_arena=false,cache_size=100MB,"
+    "checkpoint=(log_size=0,wait=0),"
     "checkpoint_sync=true,compatibility=(release=,require_max=,"
-    "require_min=),debug_mode=(checkpoint_retention=0,eviction=false,"
+    "require_min=),cursor_pool=(enabled=false,prewarm=),"
+    "debug_mode=(checkpoint_retention=0,eviction=false,"
     "rollback_error=0,table_logging=false),direct_io=,"
     "encryption=(keyid=,name=,secretkey=),error_prefix=,"
     "eviction=(threads_max=8,threads_min=1),"
@@ -1082,7 +1124,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {{"WT_CONNECTION.add_collator",
     "path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
     "timing_stress_for_test=,transaction_sync=(enabled=false,"
     "method=fsync),verbose=,write_through=",
-    confchk_wiredtiger_open_usercfg, 44},
+    confchk_wiredtiger_open_usercfg, 47},
   {NULL, NULL, NULL, 0}};
 
 int
@@ -708,6 +708,28 @@ err:
     API_END_RET_NOTFOUND_MAP(session, ret);
 }
 
+/*
+ * __conn_async_poll --
+ *     WT_CONNECTION.async_poll method.
+ */
+static int
+__conn_async_poll(WT_CONNECTION *wt_conn, WT_ASYNC_OP **asyncopp, int *op_retp)
+{
+    WT_ASYNC_OP_IMPL *op;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    conn = (WT_CONNECTION_IMPL *)wt_conn;
+    CONNECTION_API_CALL_NOCONF(conn, session, async_poll);
+    WT_ERR(__wt_async_poll(session, &op, op_retp));
+
+    *asyncopp = &op->iface;
+
+err:
+    API_END_RET(session, ret);
+}
+
 /*
  * __conn_get_extension_api --
  *     WT_CONNECTION.get_extension_api method.
@@ -1042,6 +1064,9 @@ err:
     /* Release all named snapshots. */
     __wt_txn_named_snapshot_destroy(session);
 
+    /* Closing sessions no longer leave their cached cursors behind. */
+    F_CLR(conn, WT_CONN_CURSOR_POOL);
+
     /* Close open, external sessions. */
     for (s = conn->sessions, i = 0; i < conn->session_cnt; ++s, ++i)
         if (s->active && !F_ISSET(s, WT_SESSION_INTERNAL)) {
@@ -1055,6 +1080,18 @@ err:
             WT_TRET(wt_session->close(wt_session, config));
         }
 
+    /*
+     * Close cursors closed sessions left behind in their slots: a newly opened session takes them
+     * over, and internal sessions don't leave them behind when closed.
+     */
+    while (conn->session_parked > 0) {
+        WT_TRET(__wt_open_internal_session(conn, "cursor pool", false, 0, &s));
+        if (s == NULL)
+            break;
+        wt_session = &s->iface;
+        WT_TRET(wt_session->close(wt_session, NULL));
+    }
+
     /* Wait for in-flight operations to complete. */
     WT_TRET(__wt_txn_activity_drain(session));
 
@@ -2216,6 +2253,49 @@ __conn_chk_file_system(WT_SESSION_IMPL *session, bool readonly)
     return (0);
 }
 
+/*
+ * __conn_cursor_pool_prewarm --
+ *     Open and cache cursors on the configured objects, leaving them for the first session opened.
+ */
+static int
+__conn_cursor_pool_prewarm(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG objectconf;
+    WT_CONFIG_ITEM cval, k, v;
+    WT_CURSOR *cursor;
+    WT_DECL_ITEM(uri);
+    WT_DECL_RET;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *s;
+
+    WT_RET(__wt_config_gets(session, cfg, "cursor_pool.prewarm", &cval));
+    if (cval.len == 0)
+        return (0);
+    if (!F_ISSET(S2C(session), WT_CONN_CURSOR_POOL))
+        WT_RET_MSG(session, EINVAL, "cursor_pool.prewarm requires cursor_pool.enabled");
+
+    WT_RET(__wt_open_session(S2C(session), NULL, NULL, true, &s));
+    wt_session = &s->iface;
+
+    WT_ERR(__wt_scr_alloc(session, 0, &uri));
+    __wt_config_subinit(session, &objectconf, &cval);
+    while ((ret = __wt_config_next(&objectconf, &k, &v)) == 0) {
+        WT_ERR(__wt_buf_fmt(session, uri, "%.*s", (int)k.len, k.str));
+        WT_ERR(wt_session->open_cursor(wt_session, uri->data, NULL, NULL, &cursor));
+        WT_ERR(cursor->close(cursor));
+    }
+    WT_ERR_NOTFOUND_OK(ret);
+
+err:
+    /* If we're failing the open, don't leave cursors behind. */
+    if (ret != 0)
+        F_SET(s, WT_SESSION_INTERNAL);
+    WT_TRET(wt_session->close(wt_session, NULL));
+
+    __wt_scr_free(session, &uri);
+    return (ret);
+}
+
 /*
  * wiredtiger_dummy_session_init --
  *     Initialize the connection's dummy session.
@@ -2263,8 +2343,8 @@ int
 wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *config,
   WT_CONNECTION **connectionp)
 {
-    static const WT_CONNECTION stdc = {__conn_async_flush, __conn_async_new_op, __conn_close,
-      __conn_debug_info, __conn_reconfigure, __conn_get_home, __conn_configure_method,
+    static const WT_CONNECTION stdc = {__conn_async_flush, __conn_async_new_op, __conn_async_poll,
+      __conn_close, __conn_debug_info, __conn_reconfigure, __conn_get_home, __conn_configure_method,
       __conn_is_new, __conn_open_session, __conn_query_timestamp, __conn_set_timestamp,
       __conn_rollback_to_stable, __conn_load_extension, __conn_add_data_source, __conn_add_collator,
       __conn_add_compressor, __conn_add_encryptor, __conn_add_extractor, __conn_set_file_system,
@@ -2540,6 +2620,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     if (cval.val)
         F_SET(conn, WT_CONN_CKPT_SYNC);
 
+    WT_ERR(__wt_config_gets(session, cfg, "cursor_pool.enabled", &cval));
+    if (cval.val)
+        F_SET(conn, WT_CONN_CURSOR_POOL);
+
     WT_ERR(__wt_config_gets(session, cfg, "file_extend", &cval));
     /*
      * If the log extend length is not set use the default of the configured maximum log file size.
@@ -2671,6 +2755,9 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
      */
     F_SET(session, WT_SESSION_NO_DATA_HANDLES);
 
+    /* Warm the cursor pool, after the worker threads have taken their sessions. */
+    WT_ERR(__conn_cursor_pool_prewarm(session, cfg));
+
     WT_STATIC_ASSERT(offsetof(WT_CONNECTION_IMPL, iface) == 0);
     *connectionp = &conn->iface;
 
@@ -75,6 +75,9 @@ __cache_config_local(WT_SESSION_IMPL *session, bool shared, const char *cfg[])
     WT_RET(__wt_config_gets(session, cfg, "cache_overhead", &cval));
     cache->overhead_pct = (u_int)cval.val;
 
+    WT_RET(__wt_config_gets(session, cfg, "cache_page_arena", &cval));
+    cache->page_arena = cval.val != 0;
+
     WT_RET(__wt_config_gets(session, cfg, "eviction_target", &cval));
     cache->eviction_target = (double)cval.val;
     WT_RET(
@@ -239,7 +242,8 @@ __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
            conn, "evict pass", false, WT_SESSION_NO_DATA_HANDLES, &cache->walk_session)) != 0)
         WT_RET_MSG(NULL, ret, "Failed to create session for eviction walks");
 
-    WT_RET(__wt_rwlock_init(session, &cache->las_sweepwalk_lock));
+    for (i = 0; i < WT_LAS_PARTITIONS; ++i)
+        WT_RET(__wt_rwlock_init(session, &cache->las_part[i].sweepwalk_lock));
     WT_RET(__wt_spin_init(session, &cache->las_lock, "lookaside table"));
     WT_RET(__wt_spin_init(session, &cache->las_sweep_lock, "lookaside sweep"));
 
@@ -299,6 +303,7 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
     if (F_ISSET(conn, WT_CONN_LOOKASIDE_OPEN)) {
         WT_STAT_SET(session, stats, cache_bytes_lookaside,
           __wt_cache_bytes_plus_overhead(cache, cache->bytes_lookaside));
+        WT_STAT_SET(session, stats, cache_bytes_lookaside_history, cache->las_history_bytes);
     }
     WT_STAT_SET(session, stats, cache_bytes_other, __wt_cache_bytes_other(cache));
 
@@ -356,6 +361,10 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
     if (cache->bytes_inmem != 0)
         __wt_errx(
           session, "cache server: exiting with %" PRIu64 " bytes in memory", cache->bytes_inmem);
+    if (cache->las_history_bytes != 0)
+        __wt_errx(session,
+          "cache server: exiting with %" PRIu64 " lookaside history bytes in memory",
+          cache->las_history_bytes);
     if (cache->bytes_dirty_intl + cache->bytes_dirty_leaf != 0 ||
       cache->pages_dirty_intl + cache->pages_dirty_leaf != 0)
         __wt_errx(session,
@@ -369,7 +378,8 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
     __wt_spin_destroy(session, &cache->evict_walk_lock);
     __wt_spin_destroy(session, &cache->las_lock);
     __wt_spin_destroy(session, &cache->las_sweep_lock);
-    __wt_rwlock_destroy(session, &cache->las_sweepwalk_lock);
+    for (i = 0; i < WT_LAS_PARTITIONS; ++i)
+        __wt_rwlock_destroy(session, &cache->las_part[i].sweepwalk_lock);
     wt_session = &cache->walk_session->iface;
     if (wt_session != NULL)
         WT_TRET(wt_session->close(wt_session, NULL));
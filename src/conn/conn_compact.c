@@ -0,0 +1,271 @@
+/*-
+ * Copyright (c) 2014-2019 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __compact_server_config --
+ *     Parse and setup the background compaction server options.
+ */
+static int
+__compact_server_config(WT_SESSION_IMPL *session, const char **cfg, bool *startp)
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+
+    *startp = false;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "background_compact.wait", &cval));
+    conn->compact_usecs = (uint64_t)cval.val * WT_MILLION;
+    if (conn->compact_usecs == 0)
+        return (0);
+
+    /* In-memory and read-only configurations ignore compaction. */
+    if (F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_READONLY))
+        return (0);
+
+    *startp = true;
+    return (0);
+}
+
+/*
+ * __compact_server_run_chk --
+ *     Check to decide if the background compaction server should continue running.
+ */
+static bool
+__compact_server_run_chk(WT_SESSION_IMPL *session)
+{
+    return (F_ISSET(S2C(session), WT_CONN_SERVER_COMPACT));
+}
+
+/*
+ * __compact_server_files --
+ *     Gather the names of the open files, compaction needs its own handles and checkpoints, it
+ *     can't be done while holding the handle list lock.
+ */
+static int
+__compact_server_files(WT_SESSION_IMPL *session, char ***namesp, u_int *countp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    size_t allocated;
+    u_int count;
+    char **names;
+
+    conn = S2C(session);
+    allocated = 0;
+    count = 0;
+    names = NULL;
+
+    TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
+        if (dhandle->type != WT_DHANDLE_TYPE_BTREE || dhandle->checkpoint != NULL ||
+          WT_DHANDLE_INACTIVE(dhandle) || WT_IS_METADATA(dhandle) ||
+          !WT_PREFIX_MATCH(dhandle->name, "file:") ||
+          WT_PREFIX_MATCH(dhandle->name, "file:WiredTiger"))
+            continue;
+
+        WT_RET(__wt_realloc_def(session, &allocated, count + 1, &names));
+        *namesp = names;
+        WT_RET(__wt_strdup(session, dhandle->name, &names[count]));
+        *countp = ++count;
+    }
+    return (0);
+}
+
+/*
+ * __compact_server_file --
+ *     Compact a single file if the block manager thinks compaction will shrink it.
+ */
+static int
+__compact_server_file(WT_SESSION_IMPL *session, const char *name)
+{
+    WT_BM *bm;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION *wt_session;
+    char config[64];
+    bool skip;
+
+    conn = S2C(session);
+    wt_session = (WT_SESSION *)session;
+
+    /*
+     * Compaction checkpoints the database several times, ask the block manager first so files that
+     * won't shrink don't cost anything. The handle may have been dropped or be in exclusive use
+     * since we gathered its name, skip it if so.
+     */
+    if ((ret = __wt_session_get_dhandle(session, name, NULL, NULL, 0)) != 0)
+        return (ret == EBUSY || ret == ENOENT ? 0 : ret);
+    bm = S2BT(session)->bm;
+    ret = bm->compact_skip(bm, session, &skip);
+    WT_TRET(__wt_session_release_dhandle(session));
+    WT_RET(ret);
+    if (skip)
+        return (0);
+
+    /*
+     * Limit each file's compaction to the wait period, a single large file shouldn't starve the
+     * rest.
+     */
+    WT_RET(__wt_snprintf(
+      config, sizeof(config), "timeout=%" PRIu64, conn->compact_usecs / WT_MILLION));
+    ret = wt_session->compact(wt_session, name, config);
+
+    /*
+     * Compaction gives up when it runs out of time, when eviction is struggling and when the server
+     * is shut down; none of these are errors for the server, it will try again on its next pass.
+     */
+    if (ret == EBUSY || ret == ECANCELED || ret == ENOENT || ret == ETIMEDOUT)
+        ret = 0;
+    return (ret);
+}
+
+/*
+ * __compact_server --
+ *     The background compaction server thread.
+ */
+static WT_THREAD_RET
+__compact_server(void *arg)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    u_int count, i;
+    char **names;
+
+    session = arg;
+    conn = S2C(session);
+    count = 0;
+    names = NULL;
+
+    for (;;) {
+        /* Wait until the next pass. */
+        __wt_cond_wait(session, conn->compact_cond, conn->compact_usecs, __compact_server_run_chk);
+
+        /* Check if we're quitting or being reconfigured. */
+        if (!__compact_server_run_chk(session))
+            break;
+
+        /* Compaction reads pages into cache, don't add to the problem if eviction is stuck. */
+        if (__wt_cache_stuck(session))
+            continue;
+
+        WT_WITH_HANDLE_LIST_READ_LOCK(
+          session, ret = __compact_server_files(session, &names, &count));
+        for (i = 0; ret == 0 && i < count && __compact_server_run_chk(session); ++i)
+            ret = __compact_server_file(session, names[i]);
+
+        for (i = 0; i < count; ++i)
+            __wt_free(session, names[i]);
+        __wt_free(session, names);
+        count = 0;
+        WT_ERR(ret);
+    }
+
+    if (0) {
+err:
+        WT_PANIC_MSG(session, ret, "background compaction server error");
+    }
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __compact_server_start --
+ *     Start the background compaction server thread.
+ */
+static int
+__compact_server_start(WT_CONNECTION_IMPL *conn)
+{
+    WT_SESSION_IMPL *session;
+
+    /* Nothing to do if the server is already running. */
+    if (conn->compact_session != NULL)
+        return (0);
+
+    F_SET(conn, WT_CONN_SERVER_COMPACT);
+
+    /*
+     * The background compaction server gets its own session. Compaction checkpoints the database,
+     * it may be called upon to perform slow operations for the block manager.
+     */
+    WT_RET(__wt_open_internal_session(
+      conn, "compact-server", true, WT_SESSION_CAN_WAIT, &conn->compact_session));
+    session = conn->compact_session;
+
+    WT_RET(__wt_cond_alloc(session, "background compaction server", &conn->compact_cond));
+
+    /*
+     * Start the thread.
+     */
+    WT_RET(__wt_thread_create(session, &conn->compact_tid, __compact_server, session));
+    conn->compact_tid_set = true;
+
+    return (0);
+}
+
+/*
+ * __wt_compact_server_create --
+ *     Configure and start the background compaction server.
+ */
+int
+__wt_compact_server_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONNECTION_IMPL *conn;
+    bool start;
+
+    conn = S2C(session);
+    start = false;
+
+    /* Stop any server that is already running, reconfiguration restarts it with a blank slate. */
+    if (conn->compact_session != NULL)
+        WT_RET(__wt_compact_server_destroy(session));
+
+    WT_RET(__compact_server_config(session, cfg, &start));
+    if (start)
+        WT_RET(__compact_server_start(conn));
+
+    return (0);
+}
+
+/*
+ * __wt_compact_server_destroy --
+ *     Destroy the background compaction server thread.
+ */
+int
+__wt_compact_server_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION *wt_session;
+
+    conn = S2C(session);
+
+    F_CLR(conn, WT_CONN_SERVER_COMPACT);
+    if (conn->compact_tid_set) {
+        __wt_cond_signal(session, conn->compact_cond);
+        WT_TRET(__wt_thread_join(session, &conn->compact_tid));
+        conn->compact_tid_set = false;
+    }
+    __wt_cond_destroy(session, &conn->compact_cond);
+
+    /* Close the server thread's session. */
+    if (conn->compact_session != NULL) {
+        wt_session = &conn->compact_session->iface;
+        WT_TRET(wt_session->close(wt_session, NULL));
+    }
+
+    /* Ensure the settings are cleared so reconfigure doesn't get confused. */
+    conn->compact_session = NULL;
+    conn->compact_tid_set = false;
+    conn->compact_cond = NULL;
+    conn->compact_usecs = 0;
+
+    return (ret);
+}
@@ -148,6 +148,7 @@ __wt_conn_dhandle_alloc(WT_SESSION_IMPL *session, const char *uri, const char *c
         F_SET(dhandle, WT_DHANDLE_IS_METADATA);
 
     WT_ERR(__wt_rwlock_init(session, &dhandle->rwlock));
+    __wt_rwlock_read_bias(&dhandle->rwlock);
     dhandle->name_hash = __wt_hash_city64(uri, strlen(uri));
     WT_ERR(__wt_strdup(session, uri, &dhandle->name));
     WT_ERR(__wt_strdup(session, checkpoint, &dhandle->checkpoint));
@@ -744,7 +745,7 @@ __wt_conn_dhandle_discard(WT_SESSION_IMPL *session)
  */
 restart:
     TAILQ_FOREACH (dhandle, &conn->dhqh, q) {
-        if (WT_IS_METADATA(dhandle) || strcmp(dhandle->name, WT_LAS_URI) == 0 ||
+        if (WT_IS_METADATA(dhandle) || WT_IS_LAS_URI(dhandle->name) ||
           WT_PREFIX_MATCH(dhandle->name, WT_SYSTEM_PREFIX))
             continue;
 
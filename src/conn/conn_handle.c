@@ -53,17 +53,24 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
     /* Spinlocks. */
     WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
     WT_SPIN_INIT_TRACKED(session, &conn->checkpoint_lock, checkpoint);
+    WT_LOCK_INIT_HIST(session, &conn->checkpoint_lock, checkpoint);
     WT_RET(__wt_spin_init(session, &conn->encryptor_lock, "encryptor"));
     WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
     WT_SPIN_INIT_TRACKED(session, &conn->metadata_lock, metadata);
+    WT_LOCK_INIT_HIST(session, &conn->metadata_lock, metadata);
     WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
     WT_SPIN_INIT_SESSION_TRACKED(session, &conn->schema_lock, schema);
+    WT_LOCK_INIT_HIST(session, &conn->schema_lock, schema);
     WT_RET(__wt_spin_init(session, &conn->turtle_lock, "turtle file"));
 
     /* Read-write locks */
     WT_RWLOCK_INIT_SESSION_TRACKED(session, &conn->dhandle_lock, dhandle);
+    WT_LOCK_INIT_HIST(session, &conn->dhandle_lock, dhandle);
+    __wt_rwlock_read_bias(&conn->dhandle_lock);
     WT_RET(__wt_rwlock_init(session, &conn->hot_backup_lock));
     WT_RWLOCK_INIT_TRACKED(session, &conn->table_lock, table);
+    WT_LOCK_INIT_HIST(session, &conn->table_lock, table);
+    __wt_rwlock_read_bias(&conn->table_lock);
 
     /* Setup serialization for the LSM manager queues. */
     WT_RET(__wt_spin_init(session, &conn->lsm_manager.app_lock, "LSM application queue lock"));
@@ -135,6 +142,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_free(session, conn->debug_ckpt);
     __wt_free(session, conn->error_prefix);
     __wt_free(session, conn->home);
+    __wt_free(session, conn->rwlock_readers);
     __wt_free(session, conn->sessions);
     __wt_stat_connection_discard(session, conn);
 
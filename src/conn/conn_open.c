@@ -24,6 +24,9 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
     /* WT_SESSION_IMPL array. */
     WT_RET(__wt_calloc(session, conn->session_size, sizeof(WT_SESSION_IMPL), &conn->sessions));
 
+    /* Reader-biased lock slots, for each session. */
+    WT_RET(__wt_calloc_def(session, conn->session_size, &conn->rwlock_readers));
+
     /*
      * Open the default session. We open this before starting service threads because those may
      * allocate and use session resources that need to get cleaned up on close.
@@ -88,6 +91,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
      * make sure they exit before files are closed.
      */
     WT_TRET(__wt_capacity_server_destroy(session));
+    WT_TRET(__wt_compact_server_destroy(session));
     WT_TRET(__wt_checkpoint_server_destroy(session));
     WT_TRET(__wt_statlog_destroy(session, true));
     WT_TRET(__wt_sweep_destroy(session));
@@ -233,5 +237,8 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
     /* Start the optional checkpoint thread. */
     WT_RET(__wt_checkpoint_server_create(session, cfg));
 
+    /* Start the optional background compaction thread. */
+    WT_RET(__wt_compact_server_create(session, cfg));
+
     return (0);
 }
@@ -340,6 +340,13 @@ __sweep_server(void *arg)
         if (conn->sweep_idle_time != 0 && conn->open_btree_count >= conn->sweep_handles_min)
             WT_ERR(__sweep_expire(session, now));
 
+        /*
+         * Cursors closed sessions left in their slots hold references to their handles, close the
+         * ones on dead or closed handles so the handles can be removed.
+         */
+        if (conn->session_parked > 0)
+            WT_ERR(__wt_session_parked_sweep(session));
+
         WT_ERR(__sweep_discard_trees(session, &dead_handles));
 
         if (dead_handles > 0)
@@ -518,7 +518,7 @@ __backup_list_uri_append(WT_SESSION_IMPL *session, const char *name, bool *skip)
         WT_RET_MSG(session, ENOTSUP, "hot backup is not supported for objects of type %s", name);
 
     /* Ignore the lookaside table or system info. */
-    if (strcmp(name, WT_LAS_URI) == 0)
+    if (WT_IS_LAS_URI(name))
         return (0);
 
     /* Add the metadata entry to the backup file. */
@@ -185,7 +185,7 @@ __curfile_search(WT_CURSOR *cursor)
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
-    uint64_t time_start, time_stop;
+    uint64_t time_diff, time_start, time_stop;
 
     cbt = (WT_CURSOR_BTREE *)cursor;
     CURSOR_API_CALL(cursor, session, search, cbt->btree);
@@ -194,7 +194,9 @@ __curfile_search(WT_CURSOR *cursor)
     time_start = __wt_clock(session);
     WT_ERR(__wt_btcur_search(cbt));
     time_stop = __wt_clock(session);
-    __wt_stat_usecs_hist_incr_opread(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
+    __wt_stat_usecs_hist_incr_opread(session, time_diff);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_cursor_search, time_diff);
 
     /* Search maintains a position, key and value. */
     WT_ASSERT(session, F_ISSET(cbt, WT_CBT_ACTIVE) &&
@@ -215,7 +217,7 @@ __curfile_search_near(WT_CURSOR *cursor, int *exact)
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
-    uint64_t time_start, time_stop;
+    uint64_t time_diff, time_start, time_stop;
 
     cbt = (WT_CURSOR_BTREE *)cursor;
     CURSOR_API_CALL(cursor, session, search_near, cbt->btree);
@@ -224,7 +226,9 @@ __curfile_search_near(WT_CURSOR *cursor, int *exact)
     time_start = __wt_clock(session);
     WT_ERR(__wt_btcur_search_near(cbt, exact));
     time_stop = __wt_clock(session);
-    __wt_stat_usecs_hist_incr_opread(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
+    __wt_stat_usecs_hist_incr_opread(session, time_diff);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_cursor_search, time_diff);
 
     /* Search-near maintains a position, key and value. */
     WT_ASSERT(session, F_ISSET(cbt, WT_CBT_ACTIVE) &&
@@ -245,7 +249,7 @@ __curfile_insert(WT_CURSOR *cursor)
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
-    uint64_t time_start, time_stop;
+    uint64_t time_diff, time_start, time_stop;
 
     cbt = (WT_CURSOR_BTREE *)cursor;
     CURSOR_UPDATE_API_CALL_BTREE(cursor, session, insert, cbt->btree);
@@ -257,7 +261,9 @@ __curfile_insert(WT_CURSOR *cursor)
     time_start = __wt_clock(session);
     WT_ERR(__wt_btcur_insert(cbt));
     time_stop = __wt_clock(session);
-    __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
+    __wt_stat_usecs_hist_incr_opwrite(session, time_diff);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_cursor_insert, time_diff);
 
     /*
      * Insert maintains no position, key or value (except for column-store appends, where we are
@@ -345,7 +351,7 @@ __curfile_update(WT_CURSOR *cursor)
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
-    uint64_t time_start, time_stop;
+    uint64_t time_diff, time_start, time_stop;
 
     cbt = (WT_CURSOR_BTREE *)cursor;
     CURSOR_UPDATE_API_CALL_BTREE(cursor, session, update, cbt->btree);
@@ -355,7 +361,9 @@ __curfile_update(WT_CURSOR *cursor)
     time_start = __wt_clock(session);
     WT_ERR(__wt_btcur_update(cbt));
     time_stop = __wt_clock(session);
-    __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
+    __wt_stat_usecs_hist_incr_opwrite(session, time_diff);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_cursor_update, time_diff);
 
     /* Update maintains a position, key and value. */
     WT_ASSERT(session, F_ISSET(cbt, WT_CBT_ACTIVE) &&
@@ -377,7 +385,7 @@ __curfile_remove(WT_CURSOR *cursor)
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
-    uint64_t time_start, time_stop;
+    uint64_t time_diff, time_start, time_stop;
     bool positioned;
 
     /*
@@ -396,7 +404,9 @@ __curfile_remove(WT_CURSOR *cursor)
     time_start = __wt_clock(session);
     WT_ERR(__wt_btcur_remove(cbt, positioned));
     time_stop = __wt_clock(session);
-    __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
+    __wt_stat_usecs_hist_incr_opwrite(session, time_diff);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_cursor_remove, time_diff);
 
     /* If we've lost an initial position, we must fail. */
     if (positioned && !F_ISSET(cursor, WT_CURSTD_KEY_INT))
@@ -593,6 +603,8 @@ __curfile_reopen(WT_CURSOR *cursor, bool check_only)
         cursor->internal_uri = cbt->btree->dhandle->name;
         cursor->key_format = cbt->btree->key_format;
         cursor->value_format = cbt->btree->value_format;
+        cursor->key_pack = cbt->btree->key_pack;
+        cursor->value_pack = cbt->btree->value_pack;
     }
     return (ret);
 }
@@ -649,6 +661,8 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
     cursor->internal_uri = btree->dhandle->name;
     cursor->key_format = btree->key_format;
     cursor->value_format = btree->value_format;
+    cursor->key_pack = btree->key_pack;
+    cursor->value_pack = btree->value_pack;
     cbt->btree = btree;
 
     /*
@@ -93,6 +93,10 @@ __curindex_move(WT_CURSOR_INDEX *cindex)
     __wt_cursor_set_raw_key(&cindex->iface, &cindex->child->key);
     F_CLR(&cindex->iface, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 
+    /* Index-only cursors have no column groups open, the value comes from the child. */
+    if (cindex->index_only)
+        WT_STAT_CONN_INCR(session, cursor_index_only);
+
     for (i = 0, cp = cindex->cg_cursors; i < WT_COLGROUPS(cindex->table); i++, cp++) {
         if (*cp == NULL)
             continue;
@@ -382,6 +386,93 @@ err:
     API_END_RET(session, ret);
 }
 
+/*
+ * __curindex_find_col --
+ *     Find the position of a column in a list of column names.
+ */
+static int
+__curindex_find_col(
+  WT_SESSION_IMPL *session, const char *str, size_t len, WT_CONFIG_ITEM *colname, u_int *colp)
+{
+    WT_CONFIG conf;
+    WT_CONFIG_ITEM k, v;
+    WT_DECL_RET;
+    u_int col;
+
+    __wt_config_initn(session, &conf, str, len);
+    for (col = 0; (ret = __wt_config_next(&conf, &k, &v)) == 0; col++)
+        if (k.len == colname->len && strncmp(colname->str, k.str, k.len) == 0) {
+            *colp = col;
+            return (0);
+        }
+    return (ret);
+}
+
+/*
+ * __curindex_index_only_plan --
+ *     Build a projection plan that reads the requested columns from the index alone: each column
+ *     must be in the index file's key or be one of the included columns stored in its value. The
+ *     plan is applied to the index's child cursor. Returns WT_NOTFOUND if the index doesn't hold
+ *     all of the columns.
+ */
+static int
+__curindex_index_only_plan(WT_SESSION_IMPL *session, WT_CURSOR_INDEX *cindex, const char *columns,
+  size_t len, bool value_only, WT_ITEM *plan)
+{
+    WT_CONFIG conf;
+    WT_CONFIG_ITEM k, v;
+    WT_DECL_RET;
+    WT_INDEX *idx;
+    u_int col, current_col, i;
+    char coltype, current_coltype;
+
+    idx = cindex->index;
+
+    /* The columns produced by a custom extractor are unknown. */
+    if (idx->key_columns == NULL)
+        return (WT_NOTFOUND);
+
+    __wt_config_initn(session, &conf, columns, len);
+    if (value_only)
+        for (i = 0; i < cindex->table->nkey_columns; i++)
+            WT_RET(__wt_config_next(&conf, &k, &v));
+
+    current_col = UINT_MAX;
+    current_coltype = WT_PROJ_KEY;
+    for (i = 0; (ret = __wt_config_next(&conf, &k, &v)) == 0; i++) {
+        coltype = WT_PROJ_KEY;
+        if ((ret = __curindex_find_col(
+               session, idx->key_columns, strlen(idx->key_columns), &k, &col)) == WT_NOTFOUND &&
+          idx->includeconf.len != 0) {
+            coltype = WT_PROJ_VALUE;
+            ret = __curindex_find_col(
+              session, idx->includeconf.str, idx->includeconf.len, &k, &col);
+        }
+        WT_RET(ret);
+
+        /* Rewind if switching between the key and value, or moving backwards. */
+        if (current_col == UINT_MAX || current_coltype != coltype || current_col > col) {
+            WT_RET(__wt_buf_catfmt(session, plan, "0%c", coltype));
+            current_col = 0;
+            current_coltype = coltype;
+        }
+        if (current_col < col) {
+            if (col - current_col > 1)
+                WT_RET(__wt_buf_catfmt(session, plan, "%u", col - current_col));
+            WT_RET(__wt_buf_catfmt(session, plan, "%c", WT_PROJ_SKIP));
+        }
+        WT_RET(__wt_buf_catfmt(session, plan, "%c", WT_PROJ_NEXT));
+        current_col = col + 1;
+    }
+    WT_RET_NOTFOUND_OK(ret);
+
+    /* Special case empty plans. */
+    if (i == 0 && plan->size == 0)
+        WT_RET(__wt_buf_set(session, plan, "", 1));
+
+    return (0);
+}
+
 /*
  * __curindex_open_colgroups --
  *     Open cursors on the column groups required for an index cursor.
@@ -403,6 +494,10 @@ __curindex_open_colgroups(WT_SESSION_IMPL *session, WT_CURSOR_INDEX *cindex, con
     WT_RET(__wt_calloc_def(session, cgcnt, &cp));
     cindex->cg_cursors = cp;
 
+    /* Index-only cursors never read the table. */
+    if (cindex->index_only)
+        return (0);
+
     /* Work out which column groups we need. */
     for (proj = (char *)cindex->value_plan; *proj != '\0'; proj++) {
         arg = strtoul(proj, &proj, 10);
@@ -490,6 +585,7 @@ __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
     cursor->internal_uri = idx->name;
     cursor->key_format = idx->idxkey_format;
     cursor->value_format = table->value_format;
+    cursor->value_pack = table->value_pack;
 
     /*
      * XXX A very odd corner case is an index with a recno key. The only way to get here is by
@@ -512,6 +608,26 @@ __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
         WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &cindex->value_plan));
     }
 
+    /*
+     * If the index holds all of the columns in the cursor's value, read them from the index and
+     * skip the lookups in the table.
+     */
+    if (tmp == NULL)
+        WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_buf_init(session, tmp, 0));
+    if (columns != NULL)
+        ret = __curindex_index_only_plan(session, cindex, columns, strlen(columns), false, tmp);
+    else
+        ret = __curindex_index_only_plan(
+          session, cindex, table->colconf.str, table->colconf.len, true, tmp);
+    if (ret == 0) {
+        if (cindex->value_plan != idx->value_plan)
+            __wt_free(session, cindex->value_plan);
+        WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &cindex->value_plan));
+        cindex->index_only = true;
+    }
+    WT_ERR_NOTFOUND_OK(ret);
+
     WT_ERR(__wt_cursor_init(cursor, cursor->internal_uri, owner, cfg, cursorp));
 
     WT_ERR(__wt_open_cursor(session, idx->source, cursor, cfg, &cindex->child));
@@ -14,6 +14,9 @@ static int __curjoin_entry_in_range(
   WT_SESSION_IMPL *, WT_CURSOR_JOIN_ENTRY *, WT_ITEM *, WT_CURSOR_JOIN_ITER *);
 static int __curjoin_entry_member(
   WT_SESSION_IMPL *, WT_CURSOR_JOIN_ENTRY *, WT_ITEM *, WT_CURSOR_JOIN_ITER *);
+static bool __curjoin_hash_current(WT_SESSION_IMPL *, WT_CURSOR_JOIN_HASH *);
+static void __curjoin_hash_free(WT_SESSION_IMPL *, WT_CURSOR_JOIN_HASH **);
+static bool __curjoin_hash_member(WT_CURSOR_JOIN_HASH *, WT_ITEM *);
 static int __curjoin_insert_endpoint(
   WT_SESSION_IMPL *, WT_CURSOR_JOIN_ENTRY *, u_int, WT_CURSOR_JOIN_ENDPOINT **);
 static int __curjoin_iter_close(WT_CURSOR_JOIN_ITER *);
@@ -26,6 +29,13 @@ static int __curjoin_split_key(
 
 #define WT_CURJOIN_ITER_CONSUMED(iter) ((iter)->entry_pos >= (iter)->entry_count)
 
+/*
+ * Limit the memory used by a single primary key hash set: past this size the entry falls back to
+ * checking membership through the main table.
+ */
+#define WT_CURJOIN_HASH_MAX_BYTES (16 * WT_MEGABYTE)
+#define WT_CURJOIN_HASH_MIN_BUCKETS 64
+
 /*
  * __wt_curjoin_joined --
  *     Produce an error that this cursor is being used in a join call.
@@ -331,6 +341,7 @@ err:
             WT_TRET(entry->main->close(entry->main));
         if (F_ISSET(entry, WT_CURJOIN_ENTRY_OWN_BLOOM))
             WT_TRET(__wt_bloom_close(entry->bloom));
+        __curjoin_hash_free(session, &entry->hash);
         for (end = &entry->ends[0]; end < &entry->ends[entry->ends_next]; end++) {
             F_CLR(end->cursor, WT_CURSTD_JOINED);
             if (F_ISSET(end, WT_CURJOIN_END_OWN_CURSOR))
@@ -588,6 +599,13 @@ __curjoin_entry_member(
     entry->stats.membership_check++;
     bloom_found = false;
 
+    /*
+     * A hash set holds exactly the keys satisfying the entry, nothing more to check. If the
+     * transaction's view of the index has changed since the set was built, check the long way.
+     */
+    if (entry->hash != NULL && __curjoin_hash_current(session, entry->hash))
+        return (__curjoin_hash_member(entry->hash, key) ? 0 : WT_NOTFOUND);
+
     if (entry->bloom != NULL) {
         /*
          * If the item is not in the Bloom filter, we return
@@ -719,13 +737,137 @@ err:
     API_END_RET(session, ret);
 }
 
+/*
+ * __curjoin_hash_free --
+ *     Discard a primary key hash set.
+ */
+static void
+__curjoin_hash_free(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_HASH **hashp)
+{
+    WT_CURSOR_JOIN_HASH *hash;
+    WT_CURSOR_JOIN_HASH_ITEM *hi, *next;
+    uint64_t i;
+
+    if ((hash = *hashp) == NULL)
+        return;
+    *hashp = NULL;
+
+    for (i = 0; i < hash->bucket_count; i++)
+        for (hi = hash->buckets[i]; hi != NULL; hi = next) {
+            next = hi->next;
+            __wt_free(session, hi);
+        }
+    __wt_free(session, hash->buckets);
+    __wt_free(session, hash);
+}
+
+/*
+ * __curjoin_hash_snapshot --
+ *     Remember the transaction snapshot a hash set is built in.
+ */
+static void
+__curjoin_hash_snapshot(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_HASH *hash)
+{
+    WT_TXN *txn;
+
+    txn = &session->txn;
+    hash->snap_min = txn->snap_min;
+    hash->snap_max = txn->snap_max;
+    hash->snapshot_count = txn->snapshot_count;
+    hash->mod_count = txn->mod_count;
+    hash->read_timestamp = txn->read_timestamp;
+}
+
+/*
+ * __curjoin_hash_current --
+ *     Check whether a hash set still matches the session's view of the index: the session must be
+ *     in a snapshot isolation transaction with the snapshot the set was built in, and must not have
+ *     made updates since. A snapshot with the same bounds and number of concurrent transactions is
+ *     the same snapshot: no transaction IDs were allocated in between, so the set of concurrent
+ *     transactions can only have shrunk.
+ */
+static bool
+__curjoin_hash_current(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_HASH *hash)
+{
+    WT_TXN *txn;
+
+    txn = &session->txn;
+    return (F_ISSET(txn, WT_TXN_RUNNING) && txn->isolation == WT_ISO_SNAPSHOT &&
+      hash->snap_min == txn->snap_min && hash->snap_max == txn->snap_max &&
+      hash->snapshot_count == txn->snapshot_count && hash->mod_count == txn->mod_count &&
+      hash->read_timestamp == txn->read_timestamp);
+}
+
+/*
+ * __curjoin_hash_member --
+ *     Check whether a primary key is in a hash set.
+ */
+static bool
+__curjoin_hash_member(WT_CURSOR_JOIN_HASH *hash, WT_ITEM *key)
+{
+    WT_CURSOR_JOIN_HASH_ITEM *hi;
+    uint64_t h;
+
+    if (hash->item_count == 0)
+        return (false);
+
+    h = __wt_hash_city64(key->data, key->size);
+    for (hi = hash->buckets[h & (hash->bucket_count - 1)]; hi != NULL; hi = hi->next)
+        if (hi->hash == h && hi->size == key->size &&
+          (key->size == 0 || memcmp(hi + 1, key->data, key->size) == 0))
+            return (true);
+    return (false);
+}
+
+/*
+ * __curjoin_hash_insert --
+ *     Insert a primary key into a hash set, growing the bucket array as the set fills.
+ */
+static int
+__curjoin_hash_insert(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_HASH *hash, WT_ITEM *key)
+{
+    WT_CURSOR_JOIN_HASH_ITEM **buckets, *hi, *next;
+    uint64_t bucket_count, h, i;
+
+    if (__curjoin_hash_member(hash, key))
+        return (0);
+
+    if (hash->item_count >= hash->bucket_count) {
+        bucket_count = WT_MAX(hash->bucket_count * 2, WT_CURJOIN_HASH_MIN_BUCKETS);
+        WT_RET(__wt_calloc_def(session, bucket_count, &buckets));
+        for (i = 0; i < hash->bucket_count; i++)
+            for (hi = hash->buckets[i]; hi != NULL; hi = next) {
+                next = hi->next;
+                hi->next = buckets[hi->hash & (bucket_count - 1)];
+                buckets[hi->hash & (bucket_count - 1)] = hi;
+            }
+        __wt_free(session, hash->buckets);
+        hash->bytes += (bucket_count - hash->bucket_count) * sizeof(WT_CURSOR_JOIN_HASH_ITEM *);
+        hash->buckets = buckets;
+        hash->bucket_count = bucket_count;
+    }
+
+    h = __wt_hash_city64(key->data, key->size);
+    WT_RET(__wt_malloc(session, sizeof(WT_CURSOR_JOIN_HASH_ITEM) + key->size, &hi));
+    hi->hash = h;
+    hi->size = key->size;
+    if (key->size != 0)
+        memcpy(hi + 1, key->data, key->size);
+    hi->next = hash->buckets[h & (hash->bucket_count - 1)];
+    hash->buckets[h & (hash->bucket_count - 1)] = hi;
+    ++hash->item_count;
+    hash->bytes += sizeof(WT_CURSOR_JOIN_HASH_ITEM) + key->size;
+    return (0);
+}
+
 /*
  * __curjoin_init_bloom --
- *     Populate Bloom filters
+ *     Populate a Bloom filter or, if no filter is given, a primary key hash set with the primary
+ *     keys satisfying a join entry.
  */
 static int
-__curjoin_init_bloom(
-  WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_CURSOR_JOIN_ENTRY *entry, WT_BLOOM *bloom)
+__curjoin_init_bloom(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_CURSOR_JOIN_ENTRY *entry,
+  WT_BLOOM *bloom, WT_CURSOR_JOIN_HASH *hash)
 {
     WT_COLLATOR *collator;
     WT_CURSOR *c;
@@ -842,8 +984,16 @@ insert:
             curvalue.size = c->key.size - curkey.size;
         } else
             WT_ERR(c->get_key(c, &curvalue));
-        __wt_bloom_insert(bloom, &curvalue);
-        entry->stats.bloom_insert++;
+        if (bloom != NULL) {
+            __wt_bloom_insert(bloom, &curvalue);
+            entry->stats.bloom_insert++;
+        } else {
+            WT_ERR(__curjoin_hash_insert(session, hash, &curvalue));
+            entry->stats.hash_insert++;
+            /* Give up once the set is too large, the caller will discard it. */
+            if (hash->bytes > WT_CURJOIN_HASH_MAX_BYTES)
+                goto done;
+        }
 advance:
         if ((ret = c->next(c)) == WT_NOTFOUND)
             break;
@@ -858,6 +1008,107 @@ err:
     return (ret);
 }
 
+/*
+ * __curjoin_entry_hashable --
+ *     Check if a join entry can be checked using a primary key hash set: the entry must compare
+ *     only for equality against an index.
+ */
+static bool
+__curjoin_entry_hashable(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_ENTRY *entry)
+{
+    WT_CURSOR_JOIN_ENDPOINT *end;
+    WT_TXN *txn;
+
+    /*
+     * Unlike a Bloom filter, the set isn't checked against the main table. It can only stand in for
+     * the index while the transaction's snapshot stays the same, that is, with snapshot isolation
+     * inside a running transaction.
+     */
+    txn = &session->txn;
+    if (!F_ISSET(txn, WT_TXN_RUNNING) || txn->isolation != WT_ISO_SNAPSHOT)
+        return (false);
+    if (entry->index == NULL || entry->subjoin != NULL || entry->ends_next == 0 ||
+      F_ISSET(entry, WT_CURJOIN_ENTRY_BLOOM | WT_CURJOIN_ENTRY_DISJUNCTION))
+        return (false);
+    for (end = &entry->ends[0]; end < &entry->ends[entry->ends_next]; end++)
+        if (WT_CURJOIN_END_RANGE(end) != WT_CURJOIN_END_EQ)
+            return (false);
+    return (true);
+}
+
+/*
+ * __curjoin_entry_rank --
+ *     Estimate how cheaply a join entry rejects candidate keys, lower ranks are checked first.
+ */
+static u_int
+__curjoin_entry_rank(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_ENTRY *entry)
+{
+    WT_CURSOR_JOIN_ENDPOINT *end;
+    uint8_t range;
+
+    if (__curjoin_entry_hashable(session, entry))
+        return (0);
+    if (F_ISSET(entry, WT_CURJOIN_ENTRY_BLOOM))
+        return (1);
+    if (entry->subjoin != NULL)
+        return (4);
+
+    /* A range bounded on both sides is more selective than a one-sided range. */
+    range = 0;
+    if (!F_ISSET(entry, WT_CURJOIN_ENTRY_DISJUNCTION))
+        for (end = &entry->ends[0]; end < &entry->ends[entry->ends_next]; end++)
+            range |= WT_CURJOIN_END_RANGE(end);
+    if ((range & WT_CURJOIN_END_GT) != 0 && (range & WT_CURJOIN_END_LT) != 0)
+        return (2);
+    return (3);
+}
+
+/*
+ * __curjoin_entry_before --
+ *     Return if a join entry should be checked before another.
+ */
+static bool
+__curjoin_entry_before(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_ENTRY *a, WT_CURSOR_JOIN_ENTRY *b)
+{
+    uint64_t acount, bcount;
+    u_int arank, brank;
+
+    arank = __curjoin_entry_rank(session, a);
+    brank = __curjoin_entry_rank(session, b);
+    if (arank != brank)
+        return (arank < brank);
+
+    /* Within a rank, prefer the entry the application expects to match fewer rows. */
+    acount = a->count == 0 ? UINT64_MAX : a->count;
+    bcount = b->count == 0 ? UINT64_MAX : b->count;
+    return (acount < bcount);
+}
+
+/*
+ * __curjoin_plan --
+ *     Order the entries of a conjunction so membership checks most likely to reject a candidate
+ *     key, and cheapest to make, are done first. An entry being iterated stays in place.
+ */
+static void
+__curjoin_plan(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterable)
+{
+    WT_CURSOR_JOIN_ENTRY tmp;
+    u_int first, i, j;
+
+    /* The entries of a disjunction are all iterated, their order determines the result order. */
+    if (F_ISSET(cjoin, WT_CURJOIN_DISJUNCTION))
+        return;
+
+    /* A stable insertion sort, there are rarely more than a handful of entries. */
+    first = iterable ? 1 : 0;
+    for (i = first + 1; i < cjoin->entries_next; i++) {
+        tmp = cjoin->entries[i];
+        for (j = i; j > first && __curjoin_entry_before(session, &tmp, &cjoin->entries[j - 1]); j--)
+            cjoin->entries[j] = cjoin->entries[j - 1];
+        cjoin->entries[j] = tmp;
+    }
+}
+
 /*
  * __curjoin_init_next --
  *     Initialize the cursor join when the next function is first called.
@@ -899,6 +1150,8 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
     }
     WT_ERR(__wt_open_cursor(session, urimain, (WT_CURSOR *)cjoin, config, &cjoin->main));
 
+    __curjoin_plan(session, cjoin, iterable);
+
     jeend = &cjoin->entries[cjoin->entries_next];
     for (je = cjoin->entries; je < jeend; je++) {
         if (je->subjoin != NULL) {
@@ -922,6 +1175,19 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
         for (end = &je->ends[0]; end < &je->ends[je->ends_next]; end++)
             WT_ERR(__curjoin_endpoint_init_key(session, je, end));
 
+        /*
+         * Entries that are only compared for equality and aren't iterated are checked using an
+         * in-memory set of the matching primary keys. If the set would be too large, fall back to
+         * checking through the main table.
+         */
+        if (!iterable && __curjoin_entry_hashable(session, je)) {
+            WT_ERR(__wt_calloc_one(session, &je->hash));
+            __curjoin_hash_snapshot(session, je->hash);
+            WT_ERR(__curjoin_init_bloom(session, cjoin, je, NULL, je->hash));
+            if (je->hash->bytes > WT_CURJOIN_HASH_MAX_BYTES)
+                __curjoin_hash_free(session, &je->hash);
+        }
+
         /*
          * Do any needed Bloom filter initialization. Ignore Bloom filters for entries that will be
          * iterated. They won't help since these entries either don't need an inclusion check or are
@@ -948,7 +1214,7 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
                 je->bloom_hash_count = k;
                 WT_ERR(__wt_bloom_create(session, NULL, NULL, je->count, f, k, &je->bloom));
                 F_SET(je, WT_CURJOIN_ENTRY_OWN_BLOOM);
-                WT_ERR(__curjoin_init_bloom(session, cjoin, je, je->bloom));
+                WT_ERR(__curjoin_init_bloom(session, cjoin, je, je->bloom, NULL));
                 /*
                  * Share the Bloom filter, making all config info consistent.
                  */
@@ -966,7 +1232,7 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
                  */
                 WT_ERR(__wt_bloom_create(session, NULL, NULL, je->count, je->bloom_bit_count,
                   je->bloom_hash_count, &bloom));
-                WT_ERR(__curjoin_init_bloom(session, cjoin, je, bloom));
+                WT_ERR(__curjoin_init_bloom(session, cjoin, je, bloom, NULL));
                 WT_ERR(__wt_bloom_intersection(je->bloom, bloom));
                 WT_ERR(__wt_bloom_close(bloom));
             }
@@ -10,16 +10,11 @@
 
 static int __json_unpack_put(
   WT_SESSION_IMPL *, void *, u_char *, size_t, WT_CONFIG_ITEM *, size_t *);
-static inline int __json_struct_size(
-  WT_SESSION_IMPL *, const void *, size_t, const char *, WT_CONFIG_ITEM *, bool, size_t *);
-static inline int __json_struct_unpackv(WT_SESSION_IMPL *, const void *, size_t, const char *,
-  WT_CONFIG_ITEM *, u_char *, size_t, bool, va_list);
+static inline int __json_struct_unpack(WT_SESSION_IMPL *, const void *, size_t, const char *,
+  WT_CONFIG_ITEM *, bool, u_char *, size_t, size_t *);
 static int json_string_arg(WT_SESSION_IMPL *, const char **, WT_ITEM *);
 static int json_int_arg(WT_SESSION_IMPL *, const char **, int64_t *);
 static int json_uint_arg(WT_SESSION_IMPL *, const char **, uint64_t *);
-static int __json_pack_struct(WT_SESSION_IMPL *, void *, size_t, const char *, const char *);
-static int __json_pack_size(
-  WT_SESSION_IMPL *, const char *, WT_CONFIG_ITEM *, bool, const char *, size_t *);
 
 #define WT_PACK_JSON_GET(session, pv, jstr)                          \
     do {                                                             \
@@ -58,6 +53,39 @@ static int __json_pack_size(
         }                                                            \
     } while (0)
 
+/*
+ * __json_unpack_str --
+ *     Format a byte string for JSON, returning the formatted size. Runs of characters that need no
+ *     escaping are copied in one go. Can be called with a null buf for sizing.
+ */
+static inline size_t
+__json_unpack_str(const u_char *p, const u_char *end, u_char *buf, size_t bufsz)
+{
+    size_t n, s;
+    const u_char *run;
+
+    for (s = 0; p < end; s += n) {
+        /* Printable ASCII other than quote and backslash is copied unchanged. */
+        for (run = p; run < end && *run >= 0x20 && *run < 0x7f && *run != '"' && *run != '\\';
+             ++run)
+            ;
+        if (run > p) {
+            n = WT_PTRDIFF(run, p);
+            if (n <= bufsz)
+                memcpy(buf, p, n);
+            p = run;
+        } else
+            n = __wt_json_unpack_char(*p++, buf, bufsz, false);
+        if (n > bufsz)
+            bufsz = 0;
+        else {
+            bufsz -= n;
+            buf += n;
+        }
+    }
+    return (s);
+}
+
 /*
  * __json_unpack_put --
  *     Calculate the size of a packed byte string as formatted for JSON.
@@ -91,29 +119,15 @@ __json_unpack_put(WT_SESSION_IMPL *session, void *voidpv, u_char *buf, size_t bu
             *buf++ = '"';
             bufsz--;
         }
-        if (pv->type == 's' || pv->havesize) {
-            end = p + pv->size;
-            for (; p < end; p++) {
-                n = __wt_json_unpack_char(*p, buf, bufsz, false);
-                if (n > bufsz)
-                    bufsz = 0;
-                else {
-                    bufsz -= n;
-                    buf += n;
-                }
-                s += n;
-            }
-        } else
-            for (; *p; p++) {
-                n = __wt_json_unpack_char(*p, buf, bufsz, false);
-                if (n > bufsz)
-                    bufsz = 0;
-                else {
-                    bufsz -= n;
-                    buf += n;
-                }
-                s += n;
-            }
+        end = p + (pv->type == 's' || pv->havesize ? pv->size : strlen(pv->u.s));
+        n = __json_unpack_str(p, end, buf, bufsz);
+        if (n > bufsz)
+            bufsz = 0;
+        else {
+            bufsz -= n;
+            buf += n;
+        }
+        s += n;
         if (bufsz > 0)
             *buf++ = '"';
         *retsizep += s;
@@ -166,95 +180,55 @@ __json_unpack_put(WT_SESSION_IMPL *session, void *voidpv, u_char *buf, size_t bu
 }
 
 /*
- * __json_struct_size --
- *     Calculate the size of a packed byte string as formatted for JSON.
- */
-static inline int
-__json_struct_size(WT_SESSION_IMPL *session, const void *buffer, size_t size, const char *fmt,
-  WT_CONFIG_ITEM *names, bool iskey, size_t *presult)
-{
-    WT_CONFIG_ITEM name;
-    WT_DECL_PACK_VALUE(pv);
-    WT_DECL_RET;
-    WT_PACK pack;
-    WT_PACK_NAME packname;
-    size_t result;
-    const uint8_t *p, *end;
-    bool needcr;
-
-    p = buffer;
-    end = p + size;
-    result = 0;
-    needcr = false;
-
-    __pack_name_init(session, names, iskey, &packname);
-    WT_RET(__pack_init(session, &pack, fmt));
-    while ((ret = __pack_next(&pack, &pv)) == 0) {
-        if (needcr)
-            result += 2;
-        needcr = true;
-        WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
-        WT_RET(__pack_name_next(&packname, &name));
-        WT_RET(__json_unpack_put(session, &pv, NULL, 0, &name, &result));
-    }
-    WT_RET_NOTFOUND_OK(ret);
-
-    /* Be paranoid - __pack_write should never overflow. */
-    WT_ASSERT(session, p <= end);
-
-    *presult = result;
-    return (0);
-}
-
-/*
- * __json_struct_unpackv --
- *     Unpack a byte string to JSON (va_list version).
+ * __json_struct_unpack --
+ *     Unpack a byte string to JSON. As much as fits is written to the buffer, and the full size
+ *     needed (not including the trailing nul) is returned: the caller retries with a larger buffer
+ *     if it was too small, so usually the byte string is only unpacked once.
  */
 static inline int
-__json_struct_unpackv(WT_SESSION_IMPL *session, const void *buffer, size_t size, const char *fmt,
-  WT_CONFIG_ITEM *names, u_char *jbuf, size_t jbufsize, bool iskey, va_list ap)
+__json_struct_unpack(WT_SESSION_IMPL *session, const void *buffer, size_t size, const char *fmt,
+  WT_CONFIG_ITEM *names, bool iskey, u_char *jbuf, size_t jbufsize, size_t *neededp)
 {
     WT_CONFIG_ITEM name;
     WT_DECL_PACK_VALUE(pv);
     WT_DECL_RET;
     WT_PACK pack;
     WT_PACK_NAME packname;
-    size_t jsize;
+    size_t needed;
     const uint8_t *p, *end;
     bool needcr;
 
     p = buffer;
     end = p + size;
+    needed = 0;
     needcr = false;
 
-    /* Unpacking a cursor marked as json implies a single arg. */
-    *va_arg(ap, const char **) = (char *)jbuf;
-
     __pack_name_init(session, names, iskey, &packname);
     WT_RET(__pack_init(session, &pack, fmt));
     while ((ret = __pack_next(&pack, &pv)) == 0) {
         if (needcr) {
-            WT_ASSERT(session, jbufsize >= 3);
-            strncat((char *)jbuf, ",\n", jbufsize);
-            jbuf += 2;
-            jbufsize -= 2;
+            if (needed + 2 <= jbufsize)
+                memcpy(jbuf + needed, ",\n", 2);
+            needed += 2;
         }
         needcr = true;
         WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
         WT_RET(__pack_name_next(&packname, &name));
-        jsize = 0;
-        WT_RET(__json_unpack_put(session, (u_char *)&pv, jbuf, jbufsize, &name, &jsize));
-        WT_ASSERT(session, jsize <= jbufsize);
-        jbuf += jsize;
-        jbufsize -= jsize;
+        /* Stop writing once the buffer is full, but keep sizing. */
+        if (needed < jbufsize)
+            WT_RET(__json_unpack_put(
+              session, &pv, jbuf + needed, jbufsize - needed, &name, &needed));
+        else
+            WT_RET(__json_unpack_put(session, &pv, NULL, 0, &name, &needed));
     }
     WT_RET_NOTFOUND_OK(ret);
 
     /* Be paranoid - __unpack_read should never overflow. */
     WT_ASSERT(session, p <= end);
 
-    WT_ASSERT(session, jbufsize == 1);
-
+    if (needed < jbufsize)
+        jbuf[needed] = '\0';
+    *neededp = needed;
     return (0);
 }
 
@@ -267,22 +241,33 @@ __wt_json_alloc_unpack(WT_SESSION_IMPL *session, const void *buffer, size_t size
   WT_CURSOR_JSON *json, bool iskey, va_list ap)
 {
     WT_CONFIG_ITEM *names;
-    size_t needed;
+    size_t *json_bufsizep, needed;
     char **json_bufp;
 
     if (iskey) {
         names = &json->key_names;
         json_bufp = &json->key_buf;
+        json_bufsizep = &json->key_bufsize;
     } else {
         names = &json->value_names;
         json_bufp = &json->value_buf;
+        json_bufsizep = &json->value_bufsize;
+    }
+
+    /*
+     * The buffer is kept for the life of the cursor: unpack into it directly, and only if it was
+     * too small, grow it and unpack again.
+     */
+    WT_RET(__json_struct_unpack(
+      session, buffer, size, fmt, names, iskey, (u_char *)*json_bufp, *json_bufsizep, &needed));
+    if (needed + 1 > *json_bufsizep) {
+        WT_RET(__wt_realloc_noclear(session, json_bufsizep, needed + 1, json_bufp));
+        WT_RET(__json_struct_unpack(
+          session, buffer, size, fmt, names, iskey, (u_char *)*json_bufp, needed + 1, &needed));
     }
-    needed = 0;
-    WT_RET(__json_struct_size(session, buffer, size, fmt, names, iskey, &needed));
-    WT_RET(__wt_realloc(session, NULL, needed + 1, json_bufp));
-    WT_RET(__json_struct_unpackv(
-      session, buffer, size, fmt, names, (u_char *)*json_bufp, needed + 1, iskey, ap));
 
+    /* Unpacking a cursor marked as json implies a single arg. */
+    *va_arg(ap, const char **) = *json_bufp;
     return (0);
 }
 
@@ -450,7 +435,7 @@ __wt_json_token(WT_SESSION *wt_session, const char *src, int *toktype, const cha
     int result;
     char ch;
     const char *bad;
-    bool backslash, isalph, isfloat;
+    bool isalph, isfloat;
 
     result = -1;
     session = (WT_SESSION_IMPL *)wt_session;
@@ -467,31 +452,29 @@ __wt_json_token(WT_SESSION *wt_session, const char *src, int *toktype, const cha
     /* JSON is specified in RFC 4627. */
     switch (*src) {
     case '"':
-        backslash = false;
-        src++;
-        while ((ch = *src) != '\0') {
-            if (!backslash) {
-                if (ch == '"') {
-                    src++;
-                    result = 's';
-                    break;
-                }
-                if (ch == '\\')
-                    backslash = true;
-            } else {
-                /* We validate Unicode on this pass. */
-                if (ch == 'u') {
-                    u_char ignored;
-                    const u_char *uc;
-
-                    uc = (const u_char *)src;
-                    if (__wt_hex2byte(&uc[1], &ignored) || __wt_hex2byte(&uc[3], &ignored))
-                        WT_RET_MSG(session, EINVAL, "invalid Unicode within JSON string");
-                    src += 4;
-                }
-                backslash = false;
+        /*
+         * Skip to the next quote or backslash with strcspn, which the C library vectorizes: string
+         * bodies are most of the input when loading data.
+         */
+        for (++src;; ++src) {
+            src += strcspn(src, "\"\\");
+            if (*src == '"') {
+                src++;
+                result = 's';
+                break;
+            }
+            if (*src == '\0' || *++src == '\0')
+                break;
+            /* We validate Unicode on this pass. */
+            if (*src == 'u') {
+                u_char ignored;
+                const u_char *uc;
+
+                uc = (const u_char *)src;
+                if (__wt_hex2byte(&uc[1], &ignored) || __wt_hex2byte(&uc[3], &ignored))
+                    WT_RET_MSG(session, EINVAL, "invalid Unicode within JSON string");
+                src += 4;
             }
-            src++;
         }
         if (result == 's')
             break;
@@ -690,62 +673,15 @@ json_uint_arg(WT_SESSION_IMPL *session, const char **jstr, uint64_t *up)
     } while (0)
 
 /*
- * __json_pack_struct --
- *     Pack a byte string from a JSON string.
- */
-static int
-__json_pack_struct(
-  WT_SESSION_IMPL *session, void *buffer, size_t size, const char *fmt, const char *jstr)
-{
-    WT_DECL_PACK_VALUE(pv);
-    WT_DECL_RET;
-    WT_PACK pack;
-    size_t toksize;
-    uint8_t *p, *end;
-    const char *tokstart;
-    bool multi;
-
-    p = buffer;
-    end = p + size;
-    multi = false;
-
-    if (fmt[0] != '\0' && fmt[1] == '\0') {
-        JSON_EXPECT_TOKEN_GET(session, jstr, 's', tokstart, toksize);
-        /* the key name was verified in __json_pack_size */
-        JSON_EXPECT_TOKEN(session, jstr, ':');
-        pv.type = fmt[0];
-        WT_PACK_JSON_GET(session, pv, jstr);
-        return (__pack_write(session, &pv, &p, size));
-    }
-
-    WT_RET(__pack_init(session, &pack, fmt));
-    while ((ret = __pack_next(&pack, &pv)) == 0) {
-        if (multi)
-            JSON_EXPECT_TOKEN(session, jstr, ',');
-        JSON_EXPECT_TOKEN_GET(session, jstr, 's', tokstart, toksize);
-        /* the key name was verified in __json_pack_size */
-        JSON_EXPECT_TOKEN(session, jstr, ':');
-        WT_PACK_JSON_GET(session, pv, jstr);
-        WT_RET(__pack_write(session, &pv, &p, (size_t)(end - p)));
-        multi = true;
-    }
-    WT_RET_NOTFOUND_OK(ret);
-
-    /* Be paranoid - __pack_write should never overflow. */
-    WT_ASSERT(session, p <= end);
-
-    return (0);
-}
-
-/*
- * __json_pack_size --
- *     Calculate the size of a packed byte string from a JSON string. We verify that the names and
- *     value types provided in JSON match the column names and type from the schema format,
- *     returning error if not.
+ * __wt_json_to_item --
+ *     Convert a JSON input string for either key/value to a raw WT_ITEM. Checks that the input
+ *     matches the expected format: we verify that the names and value types provided in JSON match
+ *     the column names and type from the schema format, returning error if not. The input is
+ *     tokenized once, each column is packed as it is parsed into the item's existing memory.
  */
-static int
-__json_pack_size(WT_SESSION_IMPL *session, const char *fmt, WT_CONFIG_ITEM *names, bool iskey,
-  const char *jstr, size_t *sizep)
+int
+__wt_json_to_item(WT_SESSION_IMPL *session, const char *jstr, const char *format,
+  WT_CURSOR_JSON *json, bool iskey, WT_ITEM *item)
 {
     WT_CONFIG_ITEM name;
     WT_DECL_PACK_VALUE(pv);
@@ -753,13 +689,15 @@ __json_pack_size(WT_SESSION_IMPL *session, const char *fmt, WT_CONFIG_ITEM *name
     WT_PACK pack;
     WT_PACK_NAME packname;
     size_t toksize, v;
+    uint8_t *p;
     const char *tokstart;
     bool multi;
 
-    __pack_name_init(session, names, iskey, &packname);
+    __pack_name_init(session, iskey ? &json->key_names : &json->value_names, iskey, &packname);
     multi = false;
-    WT_RET(__pack_init(session, &pack, fmt));
-    for (*sizep = 0; (ret = __pack_next(&pack, &pv)) == 0;) {
+    WT_RET(__wt_buf_init(session, item, 0));
+    WT_RET(__pack_init(session, &pack, format));
+    while ((ret = __pack_next(&pack, &pv)) == 0) {
         if (multi)
             JSON_EXPECT_TOKEN(session, jstr, ',');
         JSON_EXPECT_TOKEN_GET(session, jstr, 's', tokstart, toksize);
@@ -770,7 +708,10 @@ __json_pack_size(WT_SESSION_IMPL *session, const char *fmt, WT_CONFIG_ITEM *name
         JSON_EXPECT_TOKEN(session, jstr, ':');
         WT_PACK_JSON_GET(session, pv, jstr);
         WT_RET(__pack_size(session, &pv, &v));
-        *sizep += v;
+        WT_RET(__wt_buf_extend(session, item, item->size + v));
+        p = (uint8_t *)item->mem + item->size;
+        WT_RET(__pack_write(session, &pv, &p, v));
+        item->size += v;
         multi = true;
     }
     WT_RET_NOTFOUND_OK(ret);
@@ -781,25 +722,6 @@ __json_pack_size(WT_SESSION_IMPL *session, const char *fmt, WT_CONFIG_ITEM *name
     return (0);
 }
 
-/*
- * __wt_json_to_item --
- *     Convert a JSON input string for either key/value to a raw WT_ITEM. Checks that the input
- *     matches the expected format.
- */
-int
-__wt_json_to_item(WT_SESSION_IMPL *session, const char *jstr, const char *format,
-  WT_CURSOR_JSON *json, bool iskey, WT_ITEM *item)
-{
-    size_t sz;
-    sz = 0; /* Initialize because GCC 4.1 is paranoid */
-
-    WT_RET(__json_pack_size(
-      session, format, iskey ? &json->key_names : &json->value_names, iskey, jstr, &sz));
-    WT_RET(__wt_buf_initsize(session, item, sz));
-    WT_RET(__json_pack_struct(session, item->mem, sz, format, jstr));
-    return (0);
-}
-
 /*
  * __wt_json_strlen --
  *     Return the number of bytes represented by a string in JSON format, or -1 if the format is
@@ -810,33 +732,38 @@ __wt_json_strlen(const char *src, size_t srclen) WT_GCC_FUNC_ATTRIBUTE((visibili
 {
     size_t dstlen;
     u_char hi, lo;
-    const char *srcend;
+    const char *esc, *srcend;
 
     dstlen = 0;
     srcend = src + srclen;
     while (src < srcend) {
-        /* JSON can include any UTF-8 expressed in 4 hex chars. */
-        if (*src == '\\') {
-            if (*++src == 'u') {
-                if (__wt_hex2byte((const u_char *)++src, &hi))
-                    return (-1);
-                src += 2;
-                if (__wt_hex2byte((const u_char *)src, &lo))
-                    return (-1);
-                src += 2;
-                if (hi != 0)
-                    /*
-                     * For our dump representation, every Unicode character on input represents a
-                     * single byte.
-                     */
-                    return (-1);
-            }
-        } else
-            src++;
+        /* Count the run up to the next escape in one go. */
+        if ((esc = memchr(src, '\\', WT_PTRDIFF(srcend, src))) == NULL) {
+            dstlen += WT_PTRDIFF(srcend, src);
+            break;
+        }
+        dstlen += WT_PTRDIFF(esc, src);
+        src = esc + 1;
+        if (src == srcend)
+            return (-1); /* invalid input, final char is '\\' */
+
+        /* Every escape sequence represents a single byte. */
         dstlen++;
+
+        /* JSON can include any UTF-8 expressed in 4 hex chars. */
+        if (*src++ != 'u')
+            continue;
+        if (srcend - src < 4 || __wt_hex2byte((const u_char *)src, &hi) ||
+          __wt_hex2byte((const u_char *)src + 2, &lo))
+            return (-1);
+        src += 4;
+        if (hi != 0)
+            /*
+             * For our dump representation, every Unicode character on input represents a single
+             * byte.
+             */
+            return (-1);
     }
-    if (src != srcend)
-        return (-1); /* invalid input, e.g. final char is '\\' */
     return ((ssize_t)dstlen);
 }
 
@@ -850,9 +777,10 @@ __wt_json_strncpy(WT_SESSION *wt_session, char **pdst, size_t dstlen, const char
   size_t srclen) WT_GCC_FUNC_ATTRIBUTE((visibility("default")))
 {
     WT_SESSION_IMPL *session;
+    size_t n;
     u_char hi, lo;
     char ch, *dst;
-    const char *dstend, *srcend;
+    const char *dstend, *esc, *srcend;
 
     session = (WT_SESSION_IMPL *)wt_session;
 
@@ -860,42 +788,51 @@ __wt_json_strncpy(WT_SESSION *wt_session, char **pdst, size_t dstlen, const char
     dstend = dst + dstlen;
     srcend = src + srclen;
     while (src < srcend && dst < dstend) {
-        /* JSON can include any UTF-8 expressed in 4 hex chars. */
-        if ((ch = *src++) == '\\')
-            switch (ch = *src++) {
-            case 'u':
-                if (__wt_hex2byte((const u_char *)src, &hi) ||
-                  __wt_hex2byte((const u_char *)src + 2, &lo))
-                    WT_RET_MSG(session, EINVAL, "invalid Unicode within JSON string");
-                src += 4;
-                if (hi != 0)
-                    WT_RET_MSG(session, EINVAL,
-                      "Unicode \"%6.6s\" byte out of "
-                      "range in JSON",
-                      src - 6);
-                *dst++ = (char)lo;
-                break;
-            case 'f':
-                *dst++ = '\f';
-                break;
-            case 'n':
-                *dst++ = '\n';
-                break;
-            case 'r':
-                *dst++ = '\r';
-                break;
-            case 't':
-                *dst++ = '\t';
-                break;
-            case '"':
-            case '\\':
-                *dst++ = ch;
-                break;
-            default:
-                return (__wt_illegal_value(session, ch));
-            }
-        else
+        /* Copy the run up to the next escape in one go. */
+        if ((esc = memchr(src, '\\', WT_PTRDIFF(srcend, src))) == NULL)
+            esc = srcend;
+        if (esc > src) {
+            n = WT_MIN(WT_PTRDIFF(esc, src), WT_PTRDIFF(dstend, dst));
+            memcpy(dst, src, n);
+            dst += n;
+            src += n;
+            continue;
+        }
+
+        /* Otherwise this is an escape: JSON can include any UTF-8 expressed in 4 hex chars. */
+        ++src;
+        switch (ch = *src++) {
+        case 'u':
+            if (__wt_hex2byte((const u_char *)src, &hi) ||
+              __wt_hex2byte((const u_char *)src + 2, &lo))
+                WT_RET_MSG(session, EINVAL, "invalid Unicode within JSON string");
+            src += 4;
+            if (hi != 0)
+                WT_RET_MSG(session, EINVAL,
+                  "Unicode \"%6.6s\" byte out of "
+                  "range in JSON",
+                  src - 6);
+            *dst++ = (char)lo;
+            break;
+        case 'f':
+            *dst++ = '\f';
+            break;
+        case 'n':
+            *dst++ = '\n';
+            break;
+        case 'r':
+            *dst++ = '\r';
+            break;
+        case 't':
+            *dst++ = '\t';
+            break;
+        case '"':
+        case '\\':
             *dst++ = ch;
+            break;
+        default:
+            return (__wt_illegal_value(session, ch));
+        }
     }
     if (src != srcend)
         WT_RET_MSG(session, ENOMEM, "JSON string copy destination buffer too small");
@@ -329,6 +329,24 @@ __wt_cursor_set_raw_value(WT_CURSOR *cursor, WT_ITEM *value)
         F_CLR(cursor, WT_CURSTD_RAW);
 }
 
+/*
+ * __cursor_pack_format --
+ *     Return the compiled form of a cursor's key or value format, or NULL if the format has to be
+ *     interpreted.
+ */
+static inline WT_PACK_FORMAT *
+__cursor_pack_format(const char *fmt, void *pack)
+{
+    WT_PACK_FORMAT *pf;
+
+    /*
+     * Formats are compiled when the handle owning them is opened. Cursors with projections replace
+     * the handle's format with their own, only use the compiled format if it's the cursor's.
+     */
+    pf = pack;
+    return (pf == NULL || pf->fmt != fmt || pf->interpret ? NULL : pf);
+}
+
 /*
  * __wt_cursor_get_keyv --
  *     WT_CURSOR->get_key worker function.
@@ -338,6 +356,7 @@ __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
 {
     WT_DECL_RET;
     WT_ITEM *key;
+    WT_PACK_FORMAT *pf;
     WT_SESSION_IMPL *session;
     size_t size;
     const char *fmt;
@@ -365,8 +384,12 @@ __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
             key->size = cursor->key.size;
         } else if (WT_STREQ(fmt, "S"))
             *va_arg(ap, const char **) = cursor->key.data;
-        else
-            ret = __wt_struct_unpackv(session, cursor->key.data, cursor->key.size, fmt, ap);
+        else {
+            pf = __cursor_pack_format(fmt, cursor->key_pack);
+            ret = pf == NULL ?
+              __wt_struct_unpackv(session, cursor->key.data, cursor->key.size, fmt, ap) :
+              __wt_pack_format_unpackv(session, pf, cursor->key.data, cursor->key.size, ap);
+        }
     }
 
 err:
@@ -382,6 +405,7 @@ __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
 {
     WT_DECL_RET;
     WT_ITEM *buf, *item, tmp;
+    WT_PACK_FORMAT *pf;
     WT_SESSION_IMPL *session;
     size_t sz;
     const char *fmt, *str;
@@ -421,13 +445,19 @@ __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap)
             sz = strlen(str) + 1;
             buf->data = (void *)str;
         } else {
-            va_copy(ap_copy, ap);
-            ret = __wt_struct_sizev(session, &sz, cursor->key_format, ap_copy);
-            va_end(ap_copy);
-            WT_ERR(ret);
+            pf = __cursor_pack_format(fmt, cursor->key_pack);
+            if (pf != NULL) {
+                WT_ERR(__wt_pack_format_packv(session, pf, buf, ap));
+                sz = buf->size;
+            } else {
+                va_copy(ap_copy, ap);
+                ret = __wt_struct_sizev(session, &sz, fmt, ap_copy);
+                va_end(ap_copy);
+                WT_ERR(ret);
 
-            WT_ERR(__wt_buf_initsize(session, buf, sz));
-            WT_ERR(__wt_struct_packv(session, buf->mem, sz, cursor->key_format, ap));
+                WT_ERR(__wt_buf_initsize(session, buf, sz));
+                WT_ERR(__wt_struct_packv(session, buf->mem, sz, fmt, ap));
+            }
         }
     }
     if (sz == 0)
@@ -481,6 +511,7 @@ __wt_cursor_get_valuev(WT_CURSOR *cursor, va_list ap)
 {
     WT_DECL_RET;
     WT_ITEM *value;
+    WT_PACK_FORMAT *pf;
     WT_SESSION_IMPL *session;
     const char *fmt;
 
@@ -499,8 +530,12 @@ __wt_cursor_get_valuev(WT_CURSOR *cursor, va_list ap)
         *va_arg(ap, const char **) = cursor->value.data;
     else if (WT_STREQ(fmt, "t") || (__wt_isdigit((u_char)fmt[0]) && WT_STREQ(fmt + 1, "t")))
         *va_arg(ap, uint8_t *) = *(uint8_t *)cursor->value.data;
-    else
-        ret = __wt_struct_unpackv(session, cursor->value.data, cursor->value.size, fmt, ap);
+    else {
+        pf = __cursor_pack_format(fmt, cursor->value_pack);
+        ret = pf == NULL ?
+          __wt_struct_unpackv(session, cursor->value.data, cursor->value.size, fmt, ap) :
+          __wt_pack_format_unpackv(session, pf, cursor->value.data, cursor->value.size, ap);
+    }
 
 err:
     API_END_RET(session, ret);
@@ -529,6 +564,7 @@ __wt_cursor_set_valuev(WT_CURSOR *cursor, va_list ap)
 {
     WT_DECL_RET;
     WT_ITEM *buf, *item, tmp;
+    WT_PACK_FORMAT *pf;
     WT_SESSION_IMPL *session;
     size_t sz;
     const char *fmt, *str;
@@ -561,12 +597,18 @@ __wt_cursor_set_valuev(WT_CURSOR *cursor, va_list ap)
         WT_ERR(__wt_buf_initsize(session, buf, sz));
         *(uint8_t *)buf->mem = (uint8_t)va_arg(ap, int);
     } else {
-        va_copy(ap_copy, ap);
-        ret = __wt_struct_sizev(session, &sz, cursor->value_format, ap_copy);
-        va_end(ap_copy);
-        WT_ERR(ret);
-        WT_ERR(__wt_buf_initsize(session, buf, sz));
-        WT_ERR(__wt_struct_packv(session, buf->mem, sz, cursor->value_format, ap));
+        pf = __cursor_pack_format(fmt, cursor->value_pack);
+        if (pf != NULL) {
+            WT_ERR(__wt_pack_format_packv(session, pf, buf, ap));
+            sz = buf->size;
+        } else {
+            va_copy(ap_copy, ap);
+            ret = __wt_struct_sizev(session, &sz, fmt, ap_copy);
+            va_end(ap_copy);
+            WT_ERR(ret);
+            WT_ERR(__wt_buf_initsize(session, buf, sz));
+            WT_ERR(__wt_struct_packv(session, buf->mem, sz, fmt, ap));
+        }
     }
     F_SET(cursor, WT_CURSTD_VALUE_EXT);
     buf->size = sz;
@@ -126,9 +126,12 @@ __wt_apply_single_idx(WT_SESSION_IMPL *session, WT_INDEX *idx, WT_CURSOR *cur,
         WT_RET(__wt_schema_project_merge(
           session, ctable->cg_cursors, idx->key_plan, idx->key_format, &cur->key));
         /*
-         * The index key is now set and the value is empty
-         * (it starts clear and is never set).
+         * The index key is now set. The value holds the included columns, if any, otherwise it is
+         * empty (it starts clear and is never set).
          */
+        if (idx->include_plan != NULL)
+            WT_RET(__wt_schema_project_merge(
+              session, ctable->cg_cursors, idx->include_plan, idx->include_format, &cur->value));
         F_SET(cur, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
         WT_RET(f(cur));
     }
@@ -140,7 +143,7 @@ __wt_apply_single_idx(WT_SESSION_IMPL *session, WT_INDEX *idx, WT_CURSOR *cur,
  *     Apply an operation to all indices of a table.
  */
 static int
-__apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, bool skip_immutable)
+__apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, bool skip_immutable, bool skip_unchanged)
 {
     WT_CURSOR **cp;
     WT_INDEX *idx;
@@ -155,6 +158,8 @@ __apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, bool skip_immutable)
         idx = ctable->table->indices[i];
         if (skip_immutable && F_ISSET(idx, WT_INDEX_IMMUTABLE))
             continue;
+        if (skip_unchanged && ctable->idx_unchanged[i])
+            continue;
 
         f = *(int (**)(WT_CURSOR *))((uint8_t *)*cp + func_off);
         WT_RET(__wt_apply_single_idx(session, idx, *cp, ctable, f));
@@ -533,7 +538,7 @@ __curtable_insert(WT_CURSOR *cursor)
             WT_ERR((*cp)->insert(*cp));
         }
 
-        WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, insert), false));
+        WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, insert), false, false));
     }
 
     /*
@@ -553,6 +558,83 @@ err:
     return (ret);
 }
 
+/*
+ * __curtable_update_idx_remove --
+ *     Remove the old index keys of a record being updated, and install the new value in the column
+ *     groups. Indices where the update leaves the key and any included columns unchanged are
+ *     flagged and left alone: removing and re-inserting the same index entry would cost two
+ *     searches of the index for nothing.
+ */
+static int
+__curtable_update_idx_remove(WT_CURSOR_TABLE *ctable, WT_ITEM *value_copy)
+{
+    WT_CURSOR *cursor, *idxc;
+    WT_INDEX *idx;
+    WT_ITEM *oldkey, *oldvalue;
+    WT_SESSION_IMPL *session;
+    WT_TABLE *table;
+    u_int i;
+
+    cursor = &ctable->iface;
+    session = (WT_SESSION_IMPL *)cursor->session;
+    table = ctable->table;
+
+    /*
+     * While the column groups still hold the old value, save the old index keys and included
+     * columns. Keys produced by a custom extractor can't be compared, remove those now.
+     */
+    for (i = 0; i < table->nindices; i++) {
+        idx = table->indices[i];
+        ctable->idx_unchanged[i] = false;
+        if (F_ISSET(idx, WT_INDEX_IMMUTABLE))
+            continue;
+        idxc = ctable->idx_cursors[i];
+        if (idx->extractor != NULL) {
+            WT_RET(__wt_apply_single_idx(session, idx, idxc, ctable, idxc->remove));
+            WT_RET(idxc->reset(idxc));
+            continue;
+        }
+        WT_RET(__wt_schema_project_merge(
+          session, ctable->cg_cursors, idx->key_plan, idx->key_format, &ctable->idx_keys[i]));
+        if (idx->include_plan != NULL)
+            WT_RET(__wt_schema_project_merge(session, ctable->cg_cursors, idx->include_plan,
+              idx->include_format, &ctable->idx_values[i]));
+    }
+
+    WT_RET(__wt_schema_project_slice(
+      session, ctable->cg_cursors, ctable->plan, 0, cursor->value_format, value_copy));
+
+    /* Build the new index entries, and remove the old entries that differ. */
+    for (i = 0; i < table->nindices; i++) {
+        idx = table->indices[i];
+        if (F_ISSET(idx, WT_INDEX_IMMUTABLE) || idx->extractor != NULL)
+            continue;
+        idxc = ctable->idx_cursors[i];
+        oldkey = &ctable->idx_keys[i];
+        oldvalue = &ctable->idx_values[i];
+        WT_RET(__wt_schema_project_merge(
+          session, ctable->cg_cursors, idx->key_plan, idx->key_format, &idxc->key));
+        if (idx->include_plan != NULL)
+            WT_RET(__wt_schema_project_merge(
+              session, ctable->cg_cursors, idx->include_plan, idx->include_format, &idxc->value));
+        if (idxc->key.size == oldkey->size &&
+          memcmp(idxc->key.data, oldkey->data, oldkey->size) == 0 &&
+          (idx->include_plan == NULL ||
+            (idxc->value.size == oldvalue->size &&
+              memcmp(idxc->value.data, oldvalue->data, oldvalue->size) == 0))) {
+            ctable->idx_unchanged[i] = true;
+            WT_STAT_CONN_INCR(session, cursor_update_index_unchanged);
+            continue;
+        }
+
+        WT_RET(__wt_buf_set(session, &idxc->key, oldkey->data, oldkey->size));
+        F_SET(idxc, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
+        WT_RET(idxc->remove(idxc));
+        WT_RET(idxc->reset(idxc));
+    }
+    return (0);
+}
+
 /*
  * __curtable_update --
  *     WT_CURSOR->update method for the table cursor type.
@@ -564,10 +646,12 @@ __curtable_update(WT_CURSOR *cursor)
     WT_DECL_ITEM(value_copy);
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
+    bool found;
 
     ctable = (WT_CURSOR_TABLE *)cursor;
     JOINABLE_CURSOR_UPDATE_API_CALL(cursor, session, update);
     WT_ERR(__curtable_open_indices(ctable));
+    found = false;
 
     /*
      * If the table has indices, first delete any old index keys, then update the primary, then
@@ -582,9 +666,8 @@ __curtable_update(WT_CURSOR *cursor)
 
         /* Remove only if the key exists. */
         if (ret == 0) {
-            WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, remove), true));
-            WT_ERR(__wt_schema_project_slice(
-              session, ctable->cg_cursors, ctable->plan, 0, cursor->value_format, value_copy));
+            found = true;
+            WT_ERR(__curtable_update_idx_remove(ctable, value_copy));
         } else
             WT_ERR_NOTFOUND_OK(ret);
     }
@@ -593,7 +676,7 @@ __curtable_update(WT_CURSOR *cursor)
     WT_ERR(ret);
 
     if (ctable->table->nindices > 0)
-        WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, insert), true));
+        WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, insert), true, found));
 
 err:
     CURSOR_UPDATE_API_END(session, ret);
@@ -628,7 +711,7 @@ __curtable_remove(WT_CURSOR *cursor)
         if (ret == WT_NOTFOUND)
             goto notfound;
         WT_ERR(ret);
-        WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, remove), false));
+        WT_ERR(__apply_idx(ctable, offsetof(WT_CURSOR, remove), false, false));
     }
 
     APPLY_CG(ctable, remove);
@@ -744,7 +827,7 @@ __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop)
             do {
                 APPLY_CG(stop, search);
                 WT_ERR(ret);
-                WT_ERR(__apply_idx(stop, offsetof(WT_CURSOR, remove), false));
+                WT_ERR(__apply_idx(stop, offsetof(WT_CURSOR, remove), false, false));
             } while ((ret = wt_stop->prev(wt_stop)) == 0);
             WT_ERR_NOTFOUND_OK(ret);
 
@@ -758,7 +841,7 @@ __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop)
             do {
                 APPLY_CG(start, search);
                 WT_ERR(ret);
-                WT_ERR(__apply_idx(start, offsetof(WT_CURSOR, remove), false));
+                WT_ERR(__apply_idx(start, offsetof(WT_CURSOR, remove), false, false));
                 if (stop != NULL)
                     WT_ERR(wt_start->compare(wt_start, wt_stop, &cmp));
             } while (cmp < 0 && (ret = wt_start->next(wt_start)) == 0);
@@ -822,6 +905,14 @@ err:
     __wt_free(session, ctable->cg_cursors);
     __wt_free(session, ctable->cg_valcopy);
     __wt_free(session, ctable->idx_cursors);
+    if (ctable->idx_keys != NULL)
+        for (i = 0; i < ctable->table->nindices; i++) {
+            __wt_buf_free(session, &ctable->idx_keys[i]);
+            __wt_buf_free(session, &ctable->idx_values[i]);
+        }
+    __wt_free(session, ctable->idx_keys);
+    __wt_free(session, ctable->idx_values);
+    __wt_free(session, ctable->idx_unchanged);
 
     WT_TRET(__wt_schema_release_table(session, &ctable->table));
     /* The URI is owned by the table. */
@@ -907,6 +998,9 @@ __curtable_open_indices(WT_CURSOR_TABLE *ctable)
     if (F_ISSET(primary, WT_CURSTD_BULK))
         WT_RET_MSG(session, ENOTSUP, "Bulk load is not supported for tables with indices");
 
+    WT_RET(__wt_calloc_def(session, table->nindices, &ctable->idx_keys));
+    WT_RET(__wt_calloc_def(session, table->nindices, &ctable->idx_values));
+    WT_RET(__wt_calloc_def(session, table->nindices, &ctable->idx_unchanged));
     WT_RET(__wt_calloc_def(session, table->nindices, &ctable->idx_cursors));
     for (i = 0, cp = ctable->idx_cursors; i < table->nindices; i++, cp++)
         WT_RET(
@@ -987,6 +1081,8 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
     cursor->internal_uri = table->iface.name;
     cursor->key_format = table->key_format;
     cursor->value_format = table->value_format;
+    cursor->key_pack = table->key_pack;
+    cursor->value_pack = table->value_pack;
 
     ctable->table = table;
     ctable->plan = table->plan;
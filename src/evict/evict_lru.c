@@ -545,8 +545,9 @@ __evict_update_work(WT_SESSION_IMPL *session)
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
     double dirty_target, dirty_trigger, target, trigger;
-    uint64_t bytes_inuse, bytes_max, dirty_inuse;
+    uint64_t bytes_inuse, bytes_lookaside, bytes_max, dirty_inuse;
     uint32_t flags;
+    u_int i;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -570,8 +571,11 @@ __evict_update_work(WT_SESSION_IMPL *session)
     if (F_ISSET(conn, WT_CONN_LOOKASIDE_OPEN)) {
         WT_ASSERT(session, F_ISSET(session, WT_SESSION_LOOKASIDE_CURSOR));
 
-        las_tree = ((WT_CURSOR_BTREE *)session->las_cursor)->btree;
-        cache->bytes_lookaside = las_tree->bytes_inmem;
+        for (bytes_lookaside = 0, i = 0; i < WT_LAS_PARTITIONS; i++) {
+            las_tree = ((WT_CURSOR_BTREE *)session->las_cursor[i])->btree;
+            bytes_lookaside += las_tree->bytes_inmem;
+        }
+        cache->bytes_lookaside = bytes_lookaside;
     }
 
     /*
@@ -404,11 +404,16 @@ __evict_page_dirty_update(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t evict_
          * Eviction wants to keep this page if we have a disk image, re-instantiate the page in
          * memory, else discard the page.
          */
-        __wt_free(session, ref->page_las);
+        if (ref->page_las != NULL) {
+            __wt_las_history_free(session, ref->page_las);
+            __wt_free(session, ref->page_las);
+        }
         if (mod->mod_disk_image == NULL) {
             if (mod->mod_page_las.las_pageid != 0) {
                 WT_RET(__wt_calloc_one(session, &ref->page_las));
                 *ref->page_las = mod->mod_page_las;
+                mod->mod_page_las.history = NULL;
+                mod->mod_page_las.history_size = 0;
                 __wt_page_modify_clear(session, ref->page);
                 __wt_ref_out(session, ref);
                 WT_REF_SET_STATE(ref, WT_REF_LOOKASIDE);
@@ -721,3 +726,105 @@ __evict_review(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t evict_flags, bool
 
     return (0);
 }
+
+/*
+ * __page_shrink_skip_array --
+ *     Discard obsolete updates from an array of skip lists.
+ */
+static void
+__page_shrink_skip_array(
+  WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD **head, uint32_t entries)
+{
+    WT_INSERT *ins;
+    WT_UPDATE *obsolete;
+
+    for (; entries > 0; --entries, ++head) {
+        if (*head == NULL)
+            continue;
+        WT_SKIP_FOREACH (ins, *head)
+            if (ins->upd != NULL &&
+              (obsolete = __wt_update_obsolete_check(session, page, ins->upd, true)) != NULL)
+                __wt_free_update_list(session, obsolete);
+    }
+}
+
+/*
+ * __page_shrink_keys --
+ *     Discard a row-store leaf page's cold instantiated keys. Readers can hold references to
+ *     instantiated keys as long as they hold a hazard pointer to the page, so lock the page and
+ *     give up if another session has a hazard pointer to it.
+ */
+static void
+__page_shrink_keys(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    /* Pages of in-memory trees are used without hazard pointers. */
+    if (F_ISSET(S2BT(session), WT_BTREE_IN_MEMORY))
+        return;
+
+    if (!WT_REF_CAS_STATE(session, ref, WT_REF_MEM, WT_REF_LOCKED))
+        return;
+    if (__wt_hazard_check_exclusive(session, ref))
+        WT_IGNORE_RET(__wt_row_leaf_keys_discard(session, ref->page));
+    WT_REF_SET_STATE(ref, WT_REF_MEM);
+}
+
+/*
+ * __wt_page_shrink --
+ *     Reduce a leaf page's memory footprint without evicting it, by discarding updates no running
+ *     transaction can read and, if that's not enough, instantiated keys searches rarely use. Hot
+ *     pages with long update chains are otherwise only trimmed as a side effect of new updates to
+ *     the same key, and forced eviction of a page that's in active use is expensive and often
+ *     fails. Our caller holds a single hazard pointer to the page.
+ */
+void
+__wt_page_shrink(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_PAGE *page;
+    WT_PAGE_MODIFY *mod;
+    WT_UPDATE *obsolete, **upd_array;
+    size_t footprint;
+    uint32_t i;
+
+    page = ref->page;
+    if ((mod = page->modify) == NULL)
+        return;
+
+    /*
+     * Obsolete update checks are serialized by the page lock. If we can't get it, another thread
+     * is updating the page and will trim the chains it touches.
+     */
+    if (WT_PAGE_TRYLOCK(session, page) != 0)
+        return;
+
+    switch (page->type) {
+    case WT_PAGE_COL_FIX:
+    case WT_PAGE_COL_VAR:
+        if (mod->mod_col_update != NULL)
+            __page_shrink_skip_array(session, page, mod->mod_col_update,
+              page->type == WT_PAGE_COL_FIX ? 1 : page->entries);
+        if (mod->mod_col_append != NULL)
+            __page_shrink_skip_array(session, page, mod->mod_col_append, 1);
+        break;
+    case WT_PAGE_ROW_LEAF:
+        if (mod->mod_row_insert != NULL)
+            __page_shrink_skip_array(session, page, mod->mod_row_insert, page->entries + 1);
+        if ((upd_array = mod->mod_row_update) != NULL)
+            for (i = 0; i < page->entries; ++i)
+                if (upd_array[i] != NULL &&
+                  (obsolete = __wt_update_obsolete_check(session, page, upd_array[i], true)) !=
+                    NULL)
+                    __wt_free_update_list(session, obsolete);
+        break;
+    }
+
+    WT_PAGE_UNLOCK(session, page);
+
+    /* Instantiated keys can be rebuilt from the disk image, discard them if still too large. */
+    if (page->type != WT_PAGE_ROW_LEAF)
+        return;
+    footprint = page->memory_footprint;
+    if (page->dsk != NULL)
+        footprint -= page->dsk->mem_size;
+    if (footprint >= S2BT(session)->maxmempage)
+        __page_shrink_keys(session, ref);
+}
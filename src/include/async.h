@@ -6,6 +6,7 @@
  * See the file LICENSE for redistribution information.
  */
 
+#define MAX_ASYNC_BATCH 16           /* Maximum ops dequeued together */
 #define MAX_ASYNC_SLEEP_USECS 100000 /* Maximum sleep waiting for work */
 #define MAX_ASYNC_YIELD 200          /* Maximum number of yields for work */
 
@@ -43,9 +44,13 @@ struct __wt_async_op_impl {
 #define WT_ASYNCOP_FREE 1     /* Able to be allocated to user */
 #define WT_ASYNCOP_READY 2    /* Allocated, ready for user to use */
 #define WT_ASYNCOP_WORKING 3  /* Operation in progress by worker */
+#define WT_ASYNCOP_COMPLETE 4 /* Placed on the completion queue */
     uint32_t state;
 
     WT_ASYNC_OPTYPE optype; /* Operation type */
+
+    bool poll;  /* Result returned by async_poll */
+    int op_ret; /* Result of a polled operation */
 };
 
 /*
@@ -83,6 +88,17 @@ struct __wt_async {
     uint32_t cur_queue; /* Currently enqueued */
     uint32_t max_queue; /* Maximum enqueued */
 
+    WT_CONDVAR *worker_cond; /* Idle workers wait for work */
+
+    /*
+     * Completion queue for ops allocated with the poll configuration, protected by the cq_lock.
+     * Every op on the queue is one of the ops array entries, so the queue can't overflow.
+     */
+    WT_SPINLOCK cq_lock;         /* Locked: completion queue */
+    WT_ASYNC_OP_IMPL **async_cq; /* Completed ops */
+    uint64_t cq_head;            /* Next slot to complete */
+    uint64_t cq_tail;            /* Next slot to poll */
+
 #define WT_ASYNC_FLUSH_NONE 0        /* No flush in progress */
 #define WT_ASYNC_FLUSH_COMPLETE 1    /* Notify flush caller done */
 #define WT_ASYNC_FLUSH_IN_PROGRESS 2 /* Prevent other callers */
@@ -16,6 +16,12 @@
  */
 #define WT_BLOCK_INVALID_OFFSET 0
 
+/*
+ * The smallest available extent a sequential checkpoint allocation will start a new run of blocks
+ * in; anything smaller is allocated best-fit.
+ */
+#define WT_BLOCK_SEQ_RUN_MIN WT_MEGABYTE
+
 /*
  * The block manager maintains three per-checkpoint extent lists:
  *	alloc:	 the extents allocated in this checkpoint
@@ -233,6 +239,7 @@ struct __wt_block {
 
     /* Configuration information, set when the file is opened. */
     uint32_t allocfirst; /* Allocation is first-fit */
+    bool allocseq;       /* Checkpoint allocation is sequential */
     uint32_t allocsize;  /* Allocation size */
     size_t os_cache;     /* System buffer cache flush max */
     size_t os_cache_max;
@@ -261,6 +268,8 @@ struct __wt_block {
 
     WT_CKPT *final_ckpt; /* Final live checkpoint write */
 
+    wt_off_t seq_off; /* Next sequential checkpoint allocation */
+
     /* Compaction support */
     int compact_pct_tenths;          /* Percent to compact */
     uint64_t compact_pages_reviewed; /* Pages reviewed */
@@ -29,11 +29,10 @@ __wt_extlist_write_pair(uint8_t **p, wt_off_t off, wt_off_t size)
 static inline int
 __wt_extlist_read_pair(const uint8_t **p, wt_off_t *offp, wt_off_t *sizep)
 {
-    uint64_t v;
+    uint64_t v[2];
 
-    WT_RET(__wt_vunpack_uint(p, 0, &v));
-    *offp = (wt_off_t)v;
-    WT_RET(__wt_vunpack_uint(p, 0, &v));
-    *sizep = (wt_off_t)v;
+    WT_RET(__wt_vunpack_uint_n(p, 0, v, 2));
+    *offp = (wt_off_t)v[0];
+    *sizep = (wt_off_t)v[1];
     return (0);
 }
@@ -245,6 +245,13 @@ struct __wt_page_lookaside {
     bool has_prepares;          /* One or more updates are prepared */
     bool resolved;              /* History has been read into cache */
     bool skew_newest;           /* Page image has newest versions */
+
+    /*
+     * Small blocks of history are kept here rather than in the lookaside table, packed in the order
+     * they would have been inserted.
+     */
+    uint8_t *history;    /* Lookaside records kept in memory */
+    size_t history_size; /* Lookaside records size */
 };
 
 /*
@@ -671,7 +678,8 @@ struct __wt_page {
                                         /* AUTOMATIC FLAG VALUE GENERATION STOP */
     uint8_t flags_atomic;               /* Atomic flags, use F_*_ATOMIC */
 
-    uint8_t unused[2]; /* Unused padding */
+    bool arena_bump;   /* Bump-allocate from the arena */
+    uint8_t unused[1]; /* Unused padding */
 
 /*
  * The page's read generation acts as an LRU value for each page in the
@@ -714,7 +722,34 @@ struct __wt_page {
 
     uint64_t cache_create_gen; /* Page create timestamp */
     uint64_t evict_pass_gen;   /* Eviction pass generation */
+
+    WT_PAGE_ARENA *arena; /* Memory freed with the page */
+};
+
+/*
+ * WT_PAGE_ARENA --
+ *	Structures that are never freed before the page itself (insert and update
+ * array heads, the column-store repeats array) are allocated by
+ * __wt_page_arena_alloc. By default, they're allocated and freed individually.
+ * If the cache_page_arena connection setting is configured when the page is
+ * created, they're instead bump-allocated from a list of chunks attached to the
+ * page, and the whole list is freed when the page is discarded: threads
+ * atomically reserve space in the newest chunk, and swap in a new chunk when it
+ * fills. Chunks double in size up to a maximum, so pages with few structures
+ * don't pay for a full chunk, and the page is charged for the space reserved
+ * rather than the chunk. Space reserved by a thread that loses a race to
+ * install a structure is not reclaimed until the page is discarded.
+ *
+ * Instantiated keys aren't allocated from the arena, eviction can free them
+ * while the page stays in memory.
+ */
+struct __wt_page_arena {
+    WT_PAGE_ARENA *next; /* Older chunks */
+    size_t size;         /* Chunk size */
+    size_t used;         /* Bytes reserved */
 };
+#define WT_PAGE_ARENA_MIN 256
+#define WT_PAGE_ARENA_MAX 4096
 
 /*
  * WT_PAGE_DISK_OFFSET, WT_PAGE_REF_OFFSET --
@@ -1191,15 +1226,15 @@ struct __wt_insert {
 /*
  * Atomically allocate and swap a structure or array into place.
  */
-#define WT_PAGE_ALLOC_AND_SWAP(s, page, dest, v, count)                      \
-    do {                                                                     \
-        if (((v) = (dest)) == NULL) {                                        \
-            WT_ERR(__wt_calloc_def(s, count, &(v)));                         \
-            if (__wt_atomic_cas_ptr(&(dest), NULL, v))                       \
-                __wt_cache_page_inmem_incr(s, page, (count) * sizeof(*(v))); \
-            else                                                             \
-                __wt_free(s, v);                                             \
-        }                                                                    \
+#define WT_PAGE_ALLOC_AND_SWAP(s, page, dest, v, count)                           \
+    do {                                                                          \
+        if (((v) = (dest)) == NULL) {                                             \
+            WT_ERR(__wt_page_arena_alloc(s, page, (count) * sizeof(*(v)), &(v))); \
+            if (!__wt_atomic_cas_ptr(&(dest), NULL, v)) {                         \
+                __wt_page_arena_free(s, page, (count) * sizeof(*(v)), &(v));      \
+                (v) = (dest);                                                     \
+            }                                                                     \
+        }                                                                         \
     } while (0)
 
 /*
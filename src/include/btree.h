@@ -77,9 +77,11 @@ struct __wt_btree {
         BTREE_ROW = 3      /* Row-store */
     } type;                /* Type */
 
-    const char *key_format;   /* Key format */
-    const char *value_format; /* Value format */
-    uint8_t bitcnt;           /* Fixed-length field size in bits */
+    const char *key_format;     /* Key format */
+    const char *value_format;   /* Value format */
+    WT_PACK_FORMAT *key_pack;   /* Compiled key format */
+    WT_PACK_FORMAT *value_pack; /* Compiled value format */
+    uint8_t bitcnt;             /* Fixed-length field size in bits */
 
     WT_COLLATOR *collator; /* Row-store comparator */
     int collator_owned;    /* The collator needs to be freed */
@@ -59,6 +59,43 @@ typedef enum __wt_cache_op {
 #define WT_LAS_SWEEP_ENTRIES (20 * WT_THOUSAND)
 #define WT_LAS_SWEEP_SEC 2
 
+/*
+ * Blocks of lookaside records smaller than WT_LAS_HISTORY_MAX are kept in memory with the page's
+ * lookaside information rather than written to the lookaside table, as long as the total doesn't
+ * exceed 1/WT_LAS_HISTORY_CACHE_PCT of the cache.
+ */
+#define WT_LAS_HISTORY_MAX 2048
+#define WT_LAS_HISTORY_CACHE_PCT 100
+
+/*
+ * WT_LAS_PARTITION --
+ *	The lookaside table is partitioned into separate files, and each tree's entries go to the
+ * partition selected by its btree ID. Reading, removing and sweeping one tree's entries only locks
+ * that tree's partition, and the entries of a tree are kept together rather than interleaved with
+ * every other tree's evictions.
+ */
+#define WT_LAS_PARTITIONS 4
+#define WT_LAS_PARTITION_ID(btree_id) ((btree_id) % WT_LAS_PARTITIONS)
+struct __wt_las_partition {
+    char *uri; /* Partition URI */
+
+    uint64_t insert_count; /* Count of inserts to the partition */
+    uint64_t remove_count; /* Count of removes from the partition */
+    wt_off_t ondisk;       /* Partition file size */
+
+    bool reader; /* Indicate a reader to sweep */
+    WT_RWLOCK sweepwalk_lock;
+    WT_ITEM sweep_key;         /* Track sweep position. */
+    uint32_t sweep_dropmin;    /* Minimum btree ID in current set. */
+    uint8_t *sweep_dropmap;    /* Bitmap of dropped btree IDs. */
+    uint32_t sweep_dropmax;    /* Maximum btree ID in current set. */
+    uint64_t sweep_max_pageid; /* Maximum page ID for sweep. */
+
+    uint32_t *dropped;    /* List of dropped btree IDs. */
+    size_t dropped_next;  /* Next index into drop list. */
+    size_t dropped_alloc; /* Allocated size of drop list. */
+};
+
 /*
  * WiredTiger cache structure.
  */
@@ -122,6 +159,7 @@ struct __wt_cache {
     double eviction_scrub_target;      /* Current scrub target */
 
     u_int overhead_pct;         /* Cache percent adjustment */
+    bool page_arena;            /* Bump-allocate page structures */
     uint64_t cache_max_wait_us; /* Maximum time an operation waits for
                                  * space in cache */
 
@@ -195,23 +233,11 @@ struct __wt_cache {
     WT_SESSION_IMPL *las_session[WT_LAS_NUM_SESSIONS];
     bool las_session_inuse[WT_LAS_NUM_SESSIONS];
 
-    uint32_t las_fileid;       /* Lookaside table file ID */
-    uint64_t las_insert_count; /* Count of inserts to lookaside */
-    uint64_t las_remove_count; /* Count of removes from lookaside */
-    uint64_t las_pageid;       /* Lookaside table page ID counter */
-
-    bool las_reader; /* Indicate an LAS reader to sweep */
-    WT_RWLOCK las_sweepwalk_lock;
-    WT_SPINLOCK las_sweep_lock;
-    WT_ITEM las_sweep_key;         /* Track sweep position. */
-    uint32_t las_sweep_dropmin;    /* Minimum btree ID in current set. */
-    uint8_t *las_sweep_dropmap;    /* Bitmap of dropped btree IDs. */
-    uint32_t las_sweep_dropmax;    /* Maximum btree ID in current set. */
-    uint64_t las_sweep_max_pageid; /* Maximum page ID for sweep. */
-
-    uint32_t *las_dropped;    /* List of dropped btree IDs. */
-    size_t las_dropped_next;  /* Next index into drop list. */
-    size_t las_dropped_alloc; /* Allocated size of drop list. */
+    uint64_t las_pageid;        /* Lookaside table page ID counter */
+    uint64_t las_history_bytes; /* Bytes of lookaside history in memory */
+
+    WT_SPINLOCK las_sweep_lock; /* Lookaside drop list lock */
+    WT_LAS_PARTITION las_part[WT_LAS_PARTITIONS];
 
     /*
      * The "lookaside_activity" verbose messages are throttled to once per checkpoint. To accomplish
@@ -125,12 +125,12 @@ __wt_cache_bytes_plus_overhead(WT_CACHE *cache, uint64_t sz)
 
 /*
  * __wt_cache_bytes_inuse --
- *     Return the number of bytes in use.
+ *     Return the number of bytes in use, including lookaside history kept in memory.
  */
 static inline uint64_t
 __wt_cache_bytes_inuse(WT_CACHE *cache)
 {
-    return (__wt_cache_bytes_plus_overhead(cache, cache->bytes_inmem));
+    return (__wt_cache_bytes_plus_overhead(cache, cache->bytes_inmem + cache->las_history_bytes));
 }
 
 /*
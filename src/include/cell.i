@@ -269,6 +269,21 @@ __wt_cell_pack_value(WT_SESSION_IMPL *session, WT_CELL *cell, wt_timestamp_t sta
     return (WT_PTRDIFF(p, cell));
 }
 
+/*
+ * __cell_value_window_fields --
+ *     Return the number of integers packed in a value cell's validity window.
+ */
+static inline u_int
+__cell_value_window_fields(uint8_t flags)
+{
+    u_int n;
+
+    flags &= WT_CELL_TS_START | WT_CELL_TS_STOP | WT_CELL_TXN_START | WT_CELL_TXN_STOP;
+    for (n = 0; flags != 0; flags &= (uint8_t)(flags - 1))
+        ++n;
+    return (n);
+}
+
 /*
  * __wt_cell_pack_value_match --
  *     Return if two value items would have identical WT_CELLs (except for their validity window and
@@ -278,10 +293,10 @@ static inline int
 __wt_cell_pack_value_match(
   WT_CELL *page_cell, WT_CELL *val_cell, const uint8_t *val_data, bool *matchp)
 {
-    uint64_t alen, blen, v;
-    uint8_t flags;
+    uint64_t alen, blen, v[4 + 1 + 1]; /* Validity window, RLE, length */
+    u_int n;
     const uint8_t *a, *b;
-    bool rle, validity;
+    bool validity;
 
     *matchp = false; /* Default to no-match */
 
@@ -298,24 +313,16 @@ __wt_cell_pack_value_match(
         alen = a[0] >> WT_CELL_SHORT_SHIFT;
         ++a;
     } else if (WT_CELL_TYPE(a[0]) == WT_CELL_VALUE) {
-        rle = (a[0] & WT_CELL_64V) != 0;
+        n = (a[0] & WT_CELL_64V) != 0 ? 1 : 0; /* RLE */
         validity = (a[0] & WT_CELL_SECOND_DESC) != 0;
         ++a;
-        if (validity) { /* Skip validity window */
-            flags = *a;
+        if (validity) { /* Validity window */
+            n += __cell_value_window_fields(*a);
             ++a;
-            if (LF_ISSET(WT_CELL_TS_START))
-                WT_RET(__wt_vunpack_uint(&a, 0, &v));
-            if (LF_ISSET(WT_CELL_TS_STOP))
-                WT_RET(__wt_vunpack_uint(&a, 0, &v));
-            if (LF_ISSET(WT_CELL_TXN_START))
-                WT_RET(__wt_vunpack_uint(&a, 0, &v));
-            if (LF_ISSET(WT_CELL_TXN_STOP))
-                WT_RET(__wt_vunpack_uint(&a, 0, &v));
         }
-        if (rle) /* Skip RLE */
-            WT_RET(__wt_vunpack_uint(&a, 0, &v));
-        WT_RET(__wt_vunpack_uint(&a, 0, &alen)); /* Length */
+        /* Skip the validity window and RLE, and read the length. */
+        WT_RET(__wt_vunpack_uint_n(&a, 0, v, n + 1));
+        alen = v[n];
     } else
         return (0);
 
@@ -323,24 +330,16 @@ __wt_cell_pack_value_match(
         blen = b[0] >> WT_CELL_SHORT_SHIFT;
         ++b;
     } else if (WT_CELL_TYPE(b[0]) == WT_CELL_VALUE) {
-        rle = (b[0] & WT_CELL_64V) != 0;
+        n = (b[0] & WT_CELL_64V) != 0 ? 1 : 0; /* RLE */
         validity = (b[0] & WT_CELL_SECOND_DESC) != 0;
         ++b;
-        if (validity) { /* Skip validity window */
-            flags = *b;
+        if (validity) { /* Validity window */
+            n += __cell_value_window_fields(*b);
             ++b;
-            if (LF_ISSET(WT_CELL_TS_START))
-                WT_RET(__wt_vunpack_uint(&b, 0, &v));
-            if (LF_ISSET(WT_CELL_TS_STOP))
-                WT_RET(__wt_vunpack_uint(&b, 0, &v));
-            if (LF_ISSET(WT_CELL_TXN_START))
-                WT_RET(__wt_vunpack_uint(&b, 0, &v));
-            if (LF_ISSET(WT_CELL_TXN_STOP))
-                WT_RET(__wt_vunpack_uint(&b, 0, &v));
         }
-        if (rle) /* Skip RLE */
-            WT_RET(__wt_vunpack_uint(&b, 0, &v));
-        WT_RET(__wt_vunpack_uint(&b, 0, &blen)); /* Length */
+        /* Skip the validity window and RLE, and read the length. */
+        WT_RET(__wt_vunpack_uint_n(&b, 0, v, n + 1));
+        blen = v[n];
     } else
         return (0);
 
@@ -657,7 +656,7 @@ __wt_cell_unpack_safe(WT_SESSION_IMPL *session, const WT_PAGE_HEADER *dsk, WT_CE
         uint32_t len;
     } copy;
     uint64_t v;
-    const uint8_t *p;
+    const uint8_t *lim, *p;
     uint8_t flags;
 
     copy.v = 0; /* -Werror=maybe-uninitialized */
@@ -679,6 +678,12 @@ __wt_cell_unpack_safe(WT_SESSION_IMPL *session, const WT_PAGE_HEADER *dsk, WT_CE
             return (WT_ERROR);                                                              \
     } while (0)
 
+    /*
+     * Bound integer decoding by the end of the page image even when our caller didn't ask for
+     * boundary checks: the decoder reads wide words when it knows there's room.
+     */
+    lim = end != NULL ? end : (dsk == NULL ? NULL : (uint8_t *)dsk + dsk->mem_size);
+
     /*
      * NB: when unpacking a WT_CELL_VALUE_COPY cell, unpack.cell is returned as the original cell,
      * not the copied cell (in other words, data from the copied cell must be available from unpack
@@ -758,21 +763,21 @@ restart:
 
         if (LF_ISSET(WT_CELL_TS_DURABLE))
             WT_RET(__wt_vunpack_uint(
-              &p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->newest_durable_ts));
+              &p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->newest_durable_ts));
         if (LF_ISSET(WT_CELL_TS_START))
             WT_RET(__wt_vunpack_uint(
-              &p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->oldest_start_ts));
+              &p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->oldest_start_ts));
         if (LF_ISSET(WT_CELL_TXN_START))
             WT_RET(__wt_vunpack_uint(
-              &p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->oldest_start_txn));
+              &p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->oldest_start_txn));
         if (LF_ISSET(WT_CELL_TS_STOP)) {
             WT_RET(
-              __wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->newest_stop_ts));
+              __wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->newest_stop_ts));
             unpack->newest_stop_ts += unpack->oldest_start_ts;
         }
         if (LF_ISSET(WT_CELL_TXN_STOP)) {
             WT_RET(__wt_vunpack_uint(
-              &p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->newest_stop_txn));
+              &p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->newest_stop_txn));
             unpack->newest_stop_txn += unpack->oldest_start_txn;
         }
         __wt_check_addr_validity(session, unpack->oldest_start_ts, unpack->oldest_start_txn,
@@ -788,15 +793,15 @@ restart:
         flags = *p++; /* skip second descriptor byte */
 
         if (LF_ISSET(WT_CELL_TS_START))
-            WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->start_ts));
+            WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->start_ts));
         if (LF_ISSET(WT_CELL_TXN_START))
-            WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->start_txn));
+            WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->start_txn));
         if (LF_ISSET(WT_CELL_TS_STOP)) {
-            WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->stop_ts));
+            WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->stop_ts));
             unpack->stop_ts += unpack->start_ts;
         }
         if (LF_ISSET(WT_CELL_TXN_STOP)) {
-            WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->stop_txn));
+            WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->stop_txn));
             unpack->stop_txn += unpack->start_txn;
         }
         __cell_check_value_validity(
@@ -809,7 +814,7 @@ restart:
      * column-store variable-length pages.
      */
     if (cell->__chunk[0] & WT_CELL_64V) /* skip value */
-        WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &unpack->v));
+        WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &unpack->v));
 
     /*
      * Handle special actions for a few different cell types and set the data length (deleted cells
@@ -822,7 +827,7 @@ restart:
          * length and RLE of this cell, we need the length to step through the set of cells on the
          * page and this RLE is probably different from the RLE of the earlier cell.
          */
-        WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &v));
+        WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &v));
         copy.v = unpack->v;
         copy.start_ts = unpack->start_ts;
         copy.start_txn = unpack->start_txn;
@@ -852,7 +857,7 @@ restart:
         /*
          * The cell is followed by a 4B data length and a chunk of data.
          */
-        WT_RET(__wt_vunpack_uint(&p, end == NULL ? 0 : WT_PTRDIFF(end, p), &v));
+        WT_RET(__wt_vunpack_uint(&p, lim == NULL ? 0 : WT_PTRDIFF(lim, p), &v));
 
         /*
          * If the size was what prevented us from using a short cell, it's larger than the
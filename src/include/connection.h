@@ -261,9 +261,16 @@ struct __wt_connection_impl {
     WT_SESSION_IMPL *sessions; /* Session reference */
     uint32_t session_size;     /* Session array size */
     uint32_t session_cnt;      /* Session count */
+    uint32_t session_parked;   /* Inactive sessions with cached cursors */
 
     size_t session_scratch_max; /* Max scratch memory per session */
 
+    /* Reader-biased lock slots, by session. */
+    WT_RWLOCK_READERS *rwlock_readers;
+
+    /* Hazard pointer counts, by session shard. */
+    WT_HAZARD_FILTER hazard_filter[WT_HAZARD_FILTER_SHARDS];
+
     WT_CACHE *cache;              /* Page cache */
     volatile uint64_t cache_size; /* Cache size (either statically
                                      configured or the current size
@@ -298,6 +305,12 @@ struct __wt_connection_impl {
     uint64_t ckpt_write_bytes;
     uint64_t ckpt_write_pages;
 
+    WT_SESSION_IMPL *compact_session; /* Background compaction session */
+    wt_thread_t compact_tid;          /* Background compaction thread */
+    bool compact_tid_set;             /* Background compaction thread set */
+    WT_CONDVAR *compact_cond;         /* Background compaction wait mutex */
+    uint64_t compact_usecs;           /* Background compaction timer */
+
     /* Connection's maximum and base write generations. */
     uint64_t max_write_gen;
     uint64_t base_write_gen;
@@ -424,6 +437,7 @@ struct __wt_connection_impl {
     uint64_t stashed_objects;
     /* Generations manager */
     volatile uint64_t generations[WT_GENERATIONS];
+    uint64_t gen_oldest[WT_GENERATIONS]; /* Atomic: oldest generation lower bound */
 
     wt_off_t data_extend_len; /* file_extend data length */
     wt_off_t log_extend_len;  /* file_extend log length */
@@ -506,34 +520,36 @@ struct __wt_connection_impl {
     WT_FILE_SYSTEM *file_system;
 
 /* AUTOMATIC FLAG VALUE GENERATION START */
-#define WT_CONN_CACHE_CURSORS 0x0000001u
-#define WT_CONN_CACHE_POOL 0x0000002u
-#define WT_CONN_CKPT_SYNC 0x0000004u
-#define WT_CONN_CLOSING 0x0000008u
-#define WT_CONN_CLOSING_NO_MORE_OPENS 0x0000010u
-#define WT_CONN_CLOSING_TIMESTAMP 0x0000020u
-#define WT_CONN_COMPATIBILITY 0x0000040u
-#define WT_CONN_DATA_CORRUPTION 0x0000080u
-#define WT_CONN_EVICTION_NO_LOOKASIDE 0x0000100u
-#define WT_CONN_EVICTION_RUN 0x0000200u
-#define WT_CONN_IN_MEMORY 0x0000400u
-#define WT_CONN_LEAK_MEMORY 0x0000800u
-#define WT_CONN_LOOKASIDE_OPEN 0x0001000u
-#define WT_CONN_LSM_MERGE 0x0002000u
-#define WT_CONN_OPTRACK 0x0004000u
-#define WT_CONN_PANIC 0x0008000u
-#define WT_CONN_READONLY 0x0010000u
-#define WT_CONN_RECONFIGURING 0x0020000u
-#define WT_CONN_RECOVERING 0x0040000u
-#define WT_CONN_SALVAGE 0x0080000u
-#define WT_CONN_SERVER_ASYNC 0x0100000u
-#define WT_CONN_SERVER_CAPACITY 0x0200000u
-#define WT_CONN_SERVER_CHECKPOINT 0x0400000u
-#define WT_CONN_SERVER_LOG 0x0800000u
-#define WT_CONN_SERVER_LSM 0x1000000u
-#define WT_CONN_SERVER_STATISTICS 0x2000000u
-#define WT_CONN_SERVER_SWEEP 0x4000000u
-#define WT_CONN_WAS_BACKUP 0x8000000u
+#define WT_CONN_CACHE_CURSORS 0x00000001u
+#define WT_CONN_CACHE_POOL 0x00000002u
+#define WT_CONN_CKPT_SYNC 0x00000004u
+#define WT_CONN_CLOSING 0x00000008u
+#define WT_CONN_CLOSING_NO_MORE_OPENS 0x00000010u
+#define WT_CONN_CLOSING_TIMESTAMP 0x00000020u
+#define WT_CONN_COMPATIBILITY 0x00000040u
+#define WT_CONN_CURSOR_POOL 0x00000080u
+#define WT_CONN_DATA_CORRUPTION 0x00000100u
+#define WT_CONN_EVICTION_NO_LOOKASIDE 0x00000200u
+#define WT_CONN_EVICTION_RUN 0x00000400u
+#define WT_CONN_IN_MEMORY 0x00000800u
+#define WT_CONN_LEAK_MEMORY 0x00001000u
+#define WT_CONN_LOOKASIDE_OPEN 0x00002000u
+#define WT_CONN_LSM_MERGE 0x00004000u
+#define WT_CONN_OPTRACK 0x00008000u
+#define WT_CONN_PANIC 0x00010000u
+#define WT_CONN_READONLY 0x00020000u
+#define WT_CONN_RECONFIGURING 0x00040000u
+#define WT_CONN_RECOVERING 0x00080000u
+#define WT_CONN_SALVAGE 0x00100000u
+#define WT_CONN_SERVER_ASYNC 0x00200000u
+#define WT_CONN_SERVER_CAPACITY 0x00400000u
+#define WT_CONN_SERVER_CHECKPOINT 0x00800000u
+#define WT_CONN_SERVER_COMPACT 0x01000000u
+#define WT_CONN_SERVER_LOG 0x02000000u
+#define WT_CONN_SERVER_LSM 0x04000000u
+#define WT_CONN_SERVER_STATISTICS 0x08000000u
+#define WT_CONN_SERVER_SWEEP 0x10000000u
+#define WT_CONN_WAS_BACKUP 0x20000000u
     /* AUTOMATIC FLAG VALUE GENERATION STOP */
     uint32_t flags;
 };
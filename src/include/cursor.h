@@ -25,6 +25,8 @@
       {0},                   /* recno raw buffer */                                             \
       NULL,                  /* json_private */                                                 \
       NULL,                  /* lang_private */                                                 \
+      NULL,                  /* key_pack */                                                     \
+      NULL,                  /* value_pack */                                                   \
       {NULL, 0, NULL, 0, 0}, /* WT_ITEM key */                                                  \
       {NULL, 0, NULL, 0, 0}, /* WT_ITEM value */                                                \
       0,                     /* int saved_err */                                                \
@@ -260,6 +262,8 @@ struct __wt_cursor_index {
     WT_CURSOR *child;
     WT_CURSOR **cg_cursors;
     uint8_t *cg_needvalue;
+
+    bool index_only; /* Values are read from the index alone */
 };
 
 /*
@@ -323,6 +327,33 @@ struct __wt_cursor_join_endpoint {
 #define WT_CURJOIN_END_RANGE(endp) \
     ((endp)->flags & (WT_CURJOIN_END_GT | WT_CURJOIN_END_EQ | WT_CURJOIN_END_LT))
 
+/*
+ * An in-memory hash set of primary keys, built for join entries that are compared only for
+ * equality. Membership in the set is exact, so checking an entry with a hash set avoids both the
+ * false positives of a Bloom filter and any access to the main table.
+ */
+struct __wt_cursor_join_hash_item {
+    WT_CURSOR_JOIN_HASH_ITEM *next; /* bucket chain */
+    uint64_t hash;                  /* hash of the primary key */
+    size_t size;                    /* primary key follows the item */
+};
+
+struct __wt_cursor_join_hash {
+    WT_CURSOR_JOIN_HASH_ITEM **buckets;
+    uint64_t bucket_count; /* power of two */
+    uint64_t item_count;
+    size_t bytes; /* memory footprint */
+
+    /*
+     * The transaction snapshot the set was built in: the set is only exact while the snapshot is
+     * unchanged and the transaction hasn't made updates of its own.
+     */
+    uint64_t snap_min, snap_max;
+    uint32_t snapshot_count;
+    u_int mod_count;
+    wt_timestamp_t read_timestamp;
+};
+
 /*
  * Each join entry typically represents an index's participation in a join. For example, if 'k' is
  * an index, then "t.k > 10 && t.k < 20" would be represented by a single entry, with two endpoints.
@@ -334,6 +365,7 @@ struct __wt_cursor_join_entry {
     WT_CURSOR *main;           /* raw main table cursor */
     WT_CURSOR_JOIN *subjoin;   /* a nested join clause */
     WT_BLOOM *bloom;           /* Bloom filter handle */
+    WT_CURSOR_JOIN_HASH *hash; /* primary key hash set */
     char *repack_format;       /* target format for repack */
     uint32_t bloom_bit_count;  /* bits per item in bloom */
     uint32_t bloom_hash_count; /* hash functions in bloom */
@@ -377,7 +409,9 @@ struct __wt_cursor_join {
 
 struct __wt_cursor_json {
     char *key_buf;              /* JSON formatted string */
+    size_t key_bufsize;         /* Allocated size of key_buf */
     char *value_buf;            /* JSON formatted string */
+    size_t value_bufsize;       /* Allocated size of value_buf */
     WT_CONFIG_ITEM key_names;   /* Names of key columns */
     WT_CONFIG_ITEM value_names; /* Names of value columns */
 };
@@ -474,6 +508,9 @@ struct __wt_cursor_table {
                           * overlapping set_value calls.
                           */
     WT_CURSOR **idx_cursors;
+    WT_ITEM *idx_keys;    /* Old index keys during an update */
+    WT_ITEM *idx_values;  /* Old included columns during an update */
+    bool *idx_unchanged; /* Update leaves the index entry unchanged */
 };
 
 #define WT_CURSOR_PRIMARY(cursor) (((WT_CURSOR_TABLE *)(cursor))->cg_cursors[0])
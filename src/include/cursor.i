@@ -218,6 +218,7 @@ __cursor_reset(WT_CURSOR_BTREE *cbt)
 static inline int
 __wt_curindex_get_valuev(WT_CURSOR *cursor, va_list ap)
 {
+    WT_CURSOR **cp;
     WT_CURSOR_INDEX *cindex;
     WT_ITEM *item;
     WT_SESSION_IMPL *session;
@@ -226,14 +227,16 @@ __wt_curindex_get_valuev(WT_CURSOR *cursor, va_list ap)
     session = (WT_SESSION_IMPL *)cursor->session;
     WT_RET(__cursor_checkvalue(cursor));
 
+    /* Index-only plans read from the index cursor rather than the column groups. */
+    cp = cindex->index_only ? &cindex->child : cindex->cg_cursors;
     if (F_ISSET(cursor, WT_CURSOR_RAW_OK)) {
         WT_RET(__wt_schema_project_merge(
-          session, cindex->cg_cursors, cindex->value_plan, cursor->value_format, &cursor->value));
+          session, cp, cindex->value_plan, cursor->value_format, &cursor->value));
         item = va_arg(ap, WT_ITEM *);
         item->data = cursor->value.data;
         item->size = cursor->value.size;
     } else
-        WT_RET(__wt_schema_project_out(session, cindex->cg_cursors, cindex->value_plan, ap));
+        WT_RET(__wt_schema_project_out(session, cp, cindex->value_plan, ap));
     return (0);
 }
 
@@ -132,6 +132,55 @@ __wt_vpack_negint(uint8_t **pp, size_t maxlen, uint64_t x)
     return (0);
 }
 
+/*
+ * __wt_vunpack_bytes --
+ *     Shift <len> big-endian bytes into a value. If the buffer is known to hold a full 64-bit word,
+ *     read it with a single load instead of a byte at a time.
+ */
+static inline uint64_t
+__wt_vunpack_bytes(const uint8_t *p, size_t maxlen, u_int len, uint64_t x)
+{
+    uint64_t w;
+
+    if (len == 0)
+        return (x);
+    if (maxlen >= sizeof(w)) {
+        memcpy(&w, p, sizeof(w));
+#ifndef WORDS_BIGENDIAN
+        w = __wt_bswap64(w);
+#endif
+        return (len == sizeof(w) ? w : (x << (len << 3)) | (w >> ((sizeof(w) - len) << 3)));
+    }
+
+    switch (len) {
+    case 8:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 7:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 6:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 5:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 4:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 3:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 2:
+        x = (x << 8) | *p++;
+    /* FALLTHROUGH */
+    case 1:
+        x = (x << 8) | *p;
+        break;
+    }
+    return (x);
+}
+
 /*
  * __wt_vunpack_posint --
  *     Reads a variable-length positive integer from the specified location.
@@ -139,20 +188,17 @@ __wt_vpack_negint(uint8_t **pp, size_t maxlen, uint64_t x)
 static inline int
 __wt_vunpack_posint(const uint8_t **pp, size_t maxlen, uint64_t *retp)
 {
-    uint64_t x;
-    uint8_t len;
+    u_int len;
     const uint8_t *p;
 
     /* There are four length bits in the first byte. */
     p = *pp;
     len = (*p++ & 0xf);
     WT_SIZE_CHECK_UNPACK(len + 1, maxlen);
+    WT_RET_TEST(len > sizeof(uint64_t), EINVAL);
 
-    for (x = 0; len != 0; --len)
-        x = (x << 8) | *p++;
-
-    *retp = x;
-    *pp = p;
+    *retp = __wt_vunpack_bytes(p, maxlen == 0 ? 0 : maxlen - 1, len, 0);
+    *pp = p + len;
     return (0);
 }
 
@@ -163,20 +209,17 @@ __wt_vunpack_posint(const uint8_t **pp, size_t maxlen, uint64_t *retp)
 static inline int
 __wt_vunpack_negint(const uint8_t **pp, size_t maxlen, uint64_t *retp)
 {
-    uint64_t x;
-    uint8_t len;
+    u_int len;
     const uint8_t *p;
 
     /* There are four length bits in the first byte. */
     p = *pp;
-    len = (int)sizeof(x) - (*p++ & 0xf);
+    len = (u_int)sizeof(uint64_t) - (*p++ & 0xf);
     WT_SIZE_CHECK_UNPACK(len + 1, maxlen);
+    WT_RET_TEST(len > sizeof(uint64_t), EINVAL);
 
-    for (x = UINT64_MAX; len != 0; --len)
-        x = (x << 8) | *p++;
-
-    *retp = x;
-    *pp = p;
+    *retp = __wt_vunpack_bytes(p, maxlen == 0 ? 0 : maxlen - 1, len, UINT64_MAX);
+    *pp = p + len;
     return (0);
 }
 
@@ -257,6 +300,14 @@ __wt_vunpack_uint(const uint8_t **pp, size_t maxlen, uint64_t *xp)
 
     WT_SIZE_CHECK_UNPACK(1, maxlen);
     p = *pp;
+
+    /* Small values are the common case, check for them before dispatching on the marker. */
+    if ((*p & 0xc0) == POS_1BYTE_MARKER) {
+        *xp = GET_BITS(*p, 6, 0);
+        *pp = p + 1;
+        return (0);
+    }
+
     switch (*p & 0xf0) {
     case POS_1BYTE_MARKER:
     case POS_1BYTE_MARKER | 0x10:
@@ -322,6 +373,39 @@ __wt_vunpack_int(const uint8_t **pp, size_t maxlen, int64_t *xp)
     return (0);
 }
 
+/*
+ * __wt_vunpack_uint_n --
+ *     Variable-sized unpacking for a run of unsigned integers.
+ */
+static inline int
+__wt_vunpack_uint_n(const uint8_t **pp, size_t maxlen, uint64_t *xp, u_int n)
+{
+    size_t left;
+    u_int i;
+    const uint8_t *p;
+
+    p = *pp;
+    for (i = 0; i < n; ++i) {
+        /*
+         * Decode single-byte values in the loop, they're the common case for lengths and small
+         * counts.
+         */
+        if (maxlen == 0)
+            left = 0;
+        else {
+            left = maxlen - WT_PTRDIFF(p, *pp);
+            WT_RET_TEST(left == 0, EINVAL);
+        }
+        if ((*p & 0xc0) == POS_1BYTE_MARKER)
+            xp[i] = GET_BITS(*p++, 6, 0);
+        else
+            WT_RET(__wt_vunpack_uint(&p, left, &xp[i]));
+    }
+
+    *pp = p;
+    return (0);
+}
+
 /*
  * __wt_vsize_posint --
  *     Return the packed size of a positive variable-length integer.
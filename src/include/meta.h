@@ -27,8 +27,14 @@
 #define WT_METAFILE_SLVG "WiredTiger.wt.orig" /* Metadata copy */
 #define WT_METAFILE_URI "file:WiredTiger.wt"  /* Metadata table URI */
 
-#define WT_LAS_FILE "WiredTigerLAS.wt"     /* Lookaside table */
-#define WT_LAS_URI "file:WiredTigerLAS.wt" /* Lookaside table URI*/
+#define WT_LAS_FILE "WiredTigerLAS.wt"          /* Lookaside table */
+#define WT_LAS_URI "file:WiredTigerLAS.wt"      /* Lookaside table URI*/
+#define WT_LAS_URI_PREFIX "file:WiredTigerLAS." /* Lookaside partition URI prefix */
+
+/*
+ * The first lookaside partition is WT_LAS_URI, the rest are named "WiredTigerLAS.<N>.wt".
+ */
+#define WT_IS_LAS_URI(uri) WT_PREFIX_MATCH(uri, WT_LAS_URI_PREFIX)
 
 #define WT_SYSTEM_PREFIX "system:"             /* System URI prefix */
 #define WT_SYSTEM_CKPT_URI "system:checkpoint" /* Checkpoint URI */
@@ -234,6 +234,20 @@ __wt_spin_backoff(uint64_t *yield_count, uint64_t *sleep_usecs)
     __wt_sleep(0, (*sleep_usecs));
 }
 
+/*
+ * __wt_stats_slot_update --
+ *     Direct the session's statistics updates to the slot of the CPU the thread is running on.
+ */
+static inline void
+__wt_stats_slot_update(WT_SESSION_IMPL *session)
+{
+    int cpu;
+
+    /* If the CPU can't be determined, keep using the slot chosen when the session was opened. */
+    if (WT_STAT_ENABLED(session) && (cpu = __wt_thread_cpu()) >= 0)
+        session->stat_bucket = cpu < WT_COUNTER_SLOTS ? (u_int)cpu : (u_int)cpu % WT_COUNTER_SLOTS;
+}
+
 /* Maximum stress delay is 1/10 of a second. */
 #define WT_TIMING_STRESS_MAX_DELAY (100000)
 
@@ -28,6 +28,12 @@ struct __wt_condvar {
     uint64_t prev_wait; /* Wait duration used last time */
 };
 
+/*
+ * WT_LOCK_HIST_BUCKETS --
+ *	Lock wait time histograms: 0-9us, 10-99us, 100-999us, 1-9ms and 10ms+.
+ */
+#define WT_LOCK_HIST_BUCKETS 5
+
 /*
  * Read/write locks:
  *
@@ -53,11 +59,42 @@ struct __wt_rwlock { /* Read/write lock */
     int16_t stat_app_usecs_off;     /* waiting application threads offset */
     int16_t stat_int_usecs_off;     /* waiting server threads offset */
     int16_t stat_session_usecs_off; /* waiting session offset */
+    int16_t stat_hist_off[WT_LOCK_HIST_BUCKETS]; /* wait time histogram offsets */
 
     WT_CONDVAR *cond_readers; /* Blocking readers */
     WT_CONDVAR *cond_writers; /* Blocking writers */
+
+    /*
+     * Reader-biased locks: while the bias is set, readers announce themselves in per-session slots
+     * instead of updating the lock word, writers clear the bias and wait for the slots to drain.
+     */
+    volatile bool read_bias;    /* Readers bypass the lock word */
+    bool read_bias_config;      /* Reader bias configured */
+    uint64_t read_bias_inhibit; /* Don't set the bias before this time */
 };
 
+/*
+ * WT_RWLOCK_READERS --
+ *	A session's reader slots for reader-biased locks, hashed by the lock's
+ * address; a writer only has to review its lock's slot in each session. Each
+ * session's slots are padded to separate cache lines, readers in different
+ * sessions never update the same cache line.
+ */
+#define WT_RWLOCK_READER_SLOTS 16
+#define WT_RWLOCK_READER_SLOT(l) ((uint32_t)(((uintptr_t)(l) >> 6) % WT_RWLOCK_READER_SLOTS))
+struct __wt_rwlock_readers {
+    WT_CACHE_LINE_PAD_BEGIN
+    WT_RWLOCK *slot[WT_RWLOCK_READER_SLOTS]; /* Reader-biased locks entered */
+    WT_CACHE_LINE_PAD_END
+};
+
+/*
+ * WT_RWLOCK_READ_BIAS_INHIBIT --
+ *	After a writer clears a lock's reader bias, the bias isn't set again
+ * for this multiple of the time the writer spent waiting for readers to drain.
+ */
+#define WT_RWLOCK_READ_BIAS_INHIBIT 9
+
 /*
  * WT_RWLOCK_INIT_TRACKED --
  *	Read write lock initialization, with tracking.
@@ -85,6 +122,25 @@ struct __wt_rwlock { /* Read/write lock */
           (int16_t)WT_SESSION_STATS_FIELD_TO_OFFSET(&(session)->stats, lock_##name##_wait); \
     } while (0)
 
+/*
+ * WT_LOCK_INIT_HIST --
+ *	Configure a tracked spinlock or read/write lock to also record a wait
+ * time histogram.
+ */
+#define WT_LOCK_INIT_HIST(session, l, name)                                                    \
+    do {                                                                                       \
+        (l)->stat_hist_off[0] =                                                                \
+          (int16_t)WT_STATS_FIELD_TO_OFFSET(S2C(session)->stats, lock_##name##_hist_lt10);     \
+        (l)->stat_hist_off[1] =                                                                \
+          (int16_t)WT_STATS_FIELD_TO_OFFSET(S2C(session)->stats, lock_##name##_hist_lt100);    \
+        (l)->stat_hist_off[2] =                                                                \
+          (int16_t)WT_STATS_FIELD_TO_OFFSET(S2C(session)->stats, lock_##name##_hist_lt1000);   \
+        (l)->stat_hist_off[3] =                                                                \
+          (int16_t)WT_STATS_FIELD_TO_OFFSET(S2C(session)->stats, lock_##name##_hist_lt10000);  \
+        (l)->stat_hist_off[4] =                                                                \
+          (int16_t)WT_STATS_FIELD_TO_OFFSET(S2C(session)->stats, lock_##name##_hist_gt10000);  \
+    } while (0)
+
 /*
  * Spin locks:
  *
@@ -101,6 +157,7 @@ struct __wt_spinlock {
 #if SPINLOCK_TYPE == SPINLOCK_GCC
     WT_CACHE_LINE_PAD_BEGIN
     volatile int lock;
+    int spins; /* Recent spins to acquire the lock */
 #elif SPINLOCK_TYPE == SPINLOCK_PTHREAD_MUTEX || \
   SPINLOCK_TYPE == SPINLOCK_PTHREAD_MUTEX_ADAPTIVE || SPINLOCK_TYPE == SPINLOCK_MSVC
     wt_mutex_t lock;
@@ -119,6 +176,7 @@ struct __wt_spinlock {
     int16_t stat_app_usecs_off;     /* waiting application threads offset */
     int16_t stat_int_usecs_off;     /* waiting server threads offset */
     int16_t stat_session_usecs_off; /* waiting session offset */
+    int16_t stat_hist_off[WT_LOCK_HIST_BUCKETS]; /* wait time histogram offsets */
 
     int8_t initialized; /* Lock initialized, for cleanup */
 
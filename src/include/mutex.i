@@ -23,9 +23,38 @@ __spin_init_internal(WT_SPINLOCK *t, const char *name)
 {
     t->name = name;
     t->stat_count_off = t->stat_app_usecs_off = t->stat_int_usecs_off = -1;
+    t->stat_hist_off[0] = -1;
     t->initialized = 1;
 }
 
+/*
+ * __wt_lock_hist_incr --
+ *     Update a lock's wait time histogram, if the lock has one.
+ */
+static inline void
+__wt_lock_hist_incr(WT_SESSION_IMPL *session, const int16_t *hist_off, uint64_t usecs)
+{
+    int64_t **stats;
+    u_int bucket;
+
+    if (hist_off[0] == -1)
+        return;
+
+    if (usecs < 10)
+        bucket = 0;
+    else if (usecs < 100)
+        bucket = 1;
+    else if (usecs < WT_THOUSAND)
+        bucket = 2;
+    else if (usecs < 10 * WT_THOUSAND)
+        bucket = 3;
+    else
+        bucket = 4;
+
+    stats = (int64_t **)S2C(session)->stats;
+    stats[session->stat_bucket][hist_off[bucket]]++;
+}
+
 #if SPINLOCK_TYPE == SPINLOCK_GCC
 
 /* Default to spinning 1000 times before yielding. */
@@ -43,6 +72,7 @@ __wt_spin_init(WT_SESSION_IMPL *session, WT_SPINLOCK *t, const char *name)
     WT_UNUSED(session);
 
     t->lock = 0;
+    t->spins = 0;
     __spin_init_internal(t, name);
     return (0);
 }
@@ -73,21 +103,41 @@ __wt_spin_trylock(WT_SESSION_IMPL *session, WT_SPINLOCK *t)
 
 /*
  * __wt_spin_lock --
- *     Spin until the lock is acquired.
+ *     Spin until the lock is acquired. The lock learns how long it is usually held: the spin limit
+ *     tracks a moving average of the spins recent callers needed, so short critical sections are
+ *     waited out without a context switch and long ones yield the CPU without burning the full
+ *     spin count first.
  */
 static inline void
 __wt_spin_lock(WT_SESSION_IMPL *session, WT_SPINLOCK *t)
 {
-    int i;
+    int i, max_spins, spins;
+    bool yielded;
 
     WT_UNUSED(session);
 
-    while (__atomic_test_and_set(&t->lock, __ATOMIC_ACQUIRE)) {
-        for (i = 0; t->lock && i < WT_SPIN_COUNT; i++)
+    if (!__atomic_test_and_set(&t->lock, __ATOMIC_ACQUIRE))
+        return;
+
+    spins = t->spins;
+    max_spins = WT_MIN(WT_SPIN_COUNT, spins * 2 + 10);
+    for (i = 0, yielded = false;;) {
+        for (; t->lock && i < max_spins; i++)
             WT_PAUSE();
-        if (t->lock)
+        if (!__atomic_test_and_set(&t->lock, __ATOMIC_ACQUIRE))
+            break;
+        if (i >= max_spins) {
+            yielded = true;
             __wt_yield();
+            i = 0;
+        }
     }
+
+    /* We hold the lock: adjust the average, there is no race with other writers. */
+    if (yielded)
+        t->spins = spins - spins / 8;
+    else
+        t->spins = spins + (i - spins) / 8;
 }
 
 /*
@@ -315,6 +365,7 @@ __wt_spin_lock_track(WT_SESSION_IMPL *session, WT_SPINLOCK *t)
             stats[session->stat_bucket][t->stat_app_usecs_off] += (int64_t)time_diff;
         }
         session_stats[t->stat_session_usecs_off] += (int64_t)time_diff;
+        __wt_lock_hist_incr(session, t->stat_hist_off, time_diff);
     } else
         __wt_spin_lock(session, t);
 }
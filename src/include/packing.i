@@ -45,6 +45,23 @@ typedef struct {
     }
 #define WT_DECL_PACK(pack) WT_PACK pack = WT_PACK_INIT
 
+/*
+ * WT_PACK_FORMAT --
+ *     A format string compiled into its list of fields, with repeat counts expanded and sizes
+ *     resolved, so cursors can pack and unpack without parsing the format on each call.
+ */
+#define WT_PACK_FORMAT_MAX 32 /* Longest format compiled */
+struct __wt_pack_format {
+    const char *fmt; /* Format compiled, owned by the handle */
+
+    WT_PACK_VALUE *fields; /* Fields, repeats expanded */
+    u_int nfields;
+
+    size_t fixed_size; /* Packed size, if all fields are fixed-size */
+    bool fixed;
+    bool interpret; /* Too long to compile: interpret the format */
+};
+
 typedef struct {
     WT_CONFIG config;
     char buf[20];
@@ -715,6 +732,71 @@ __wt_struct_unpackv(
     return (0);
 }
 
+/*
+ * __wt_pack_format_packv --
+ *     Pack a compiled format into a buffer, sizing the buffer first (va_list version).
+ */
+static inline int
+__wt_pack_format_packv(WT_SESSION_IMPL *session, WT_PACK_FORMAT *pf, WT_ITEM *buf, va_list ap)
+{
+    WT_PACK_VALUE pv[WT_PACK_FORMAT_MAX];
+    size_t size, v;
+    u_int i;
+    uint8_t *p, *end;
+
+    /*
+     * Gather the arguments once: the interpreted path walks the argument list twice, once to size
+     * the result and once to pack it.
+     */
+    size = pf->fixed_size;
+    for (i = 0; i < pf->nfields; ++i) {
+        pv[i] = pf->fields[i];
+        WT_PACK_GET(session, pv[i], ap);
+        if (!pf->fixed) {
+            WT_RET(__pack_size(session, &pv[i], &v));
+            size += v;
+        }
+    }
+
+    WT_RET(__wt_buf_initsize(session, buf, size));
+    p = buf->mem;
+    end = p + size;
+    for (i = 0; i < pf->nfields; ++i)
+        WT_RET(__pack_write(session, &pv[i], &p, (size_t)(end - p)));
+
+    /* Be paranoid - __pack_write should never overflow. */
+    WT_ASSERT(session, p <= end);
+
+    return (0);
+}
+
+/*
+ * __wt_pack_format_unpackv --
+ *     Unpack a byte string with a compiled format (va_list version).
+ */
+static inline int
+__wt_pack_format_unpackv(
+  WT_SESSION_IMPL *session, WT_PACK_FORMAT *pf, const void *buffer, size_t size, va_list ap)
+{
+    WT_PACK_VALUE pv;
+    u_int i;
+    const uint8_t *p, *end;
+
+    p = buffer;
+    end = p + size;
+
+    for (i = 0; i < pf->nfields; ++i) {
+        pv = pf->fields[i];
+        WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+        WT_UNPACK_PUT(session, pv, ap);
+    }
+
+    /* Be paranoid - __unpack_read should never overflow. */
+    WT_ASSERT(session, p <= end);
+
+    return (0);
+}
+
 /*
  * __wt_struct_size_adjust --
  *     Adjust the size field for a packed structure. Sometimes we want to include the size as a
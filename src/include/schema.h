@@ -26,7 +26,8 @@ struct __wt_index {
     const char *source; /* Underlying data source */
     const char *config; /* Configuration string */
 
-    WT_CONFIG_ITEM colconf; /* List of columns from config */
+    WT_CONFIG_ITEM colconf;     /* List of columns from config */
+    WT_CONFIG_ITEM includeconf; /* List of included columns from config */
 
     WT_COLLATOR *collator; /* Custom collator */
     int collator_owned;    /* Collator is owned by this index */
@@ -38,6 +39,10 @@ struct __wt_index {
     const char *key_plan;   /* Key projection plan */
     const char *value_plan; /* Value projection plan */
 
+    const char *key_columns;    /* Index file key columns (with primary) */
+    const char *include_format; /* Included columns format */
+    const char *include_plan;   /* Included columns projection plan */
+
     const char *idxkey_format; /* Index key format (hides primary) */
     const char *exkey_format;  /* Key format for custom extractors */
 
@@ -59,6 +64,7 @@ struct __wt_table {
 
     const char *plan;
     const char *key_format, *value_format;
+    WT_PACK_FORMAT *key_pack, *value_pack; /* Compiled formats */
 
     WT_CONFIG_ITEM cgconf, colconf;
 
@@ -30,6 +30,26 @@ struct __wt_hazard {
 #endif
 };
 
+/*
+ * WT_HAZARD_FILTER --
+ *	Every hazard pointer set is counted in a connection-wide filter, hashed
+ * by the page's WT_REF, so eviction can usually rule out a hazard pointer to
+ * a page without walking every session's hazard pointer array. The counts are
+ * sharded by session, and each shard is padded to separate cache lines, so
+ * sessions reading the same hot page don't update the same cache line unless
+ * there are more sessions than shards.
+ */
+#define WT_HAZARD_FILTER_SHARDS 64
+#define WT_HAZARD_FILTER_SHARD(s) ((s)->id % WT_HAZARD_FILTER_SHARDS)
+#define WT_HAZARD_FILTER_SLOTS 256
+#define WT_HAZARD_FILTER_SLOT(ref) \
+    ((uint32_t)((((uintptr_t)(ref) >> 4) * 2654435761U) >> 7) % WT_HAZARD_FILTER_SLOTS)
+struct __wt_hazard_filter {
+    WT_CACHE_LINE_PAD_BEGIN
+    uint32_t count[WT_HAZARD_FILTER_SLOTS]; /* Hazard pointers, by hashed page reference */
+    WT_CACHE_LINE_PAD_END
+};
+
 /* Get the connection implementation for a session */
 #define S2C(session) ((WT_CONNECTION_IMPL *)(session)->iface.connection)
 
@@ -87,7 +107,7 @@ struct __wt_session_impl {
     WT_COMPACT_STATE *compact; /* Compaction information */
     enum { WT_COMPACT_NONE = 0, WT_COMPACT_RUNNING, WT_COMPACT_SUCCESS } compact_state;
 
-    WT_CURSOR *las_cursor; /* Lookaside table cursor */
+    WT_CURSOR *las_cursor[WT_LAS_PARTITIONS]; /* Lookaside table cursors */
 
     WT_CURSOR *meta_cursor;  /* Metadata file */
     void *meta_track;        /* Metadata operation tracking */
@@ -208,6 +228,7 @@ struct __wt_session_impl {
      * growing too large.
      */
     WT_CURSOR_LIST *cursor_cache; /* Hash table of cached cursors */
+    bool cursor_cache_parked;     /* Cached cursors kept past session close */
 
     /* Hashed handle reference list array */
     TAILQ_HEAD(__dhandles_hash, __wt_data_handle_cache) * dhhash;
@@ -235,8 +256,18 @@ struct __wt_session_impl {
         } * list;
         size_t cnt;   /* Array entries */
         size_t alloc; /* Allocated bytes */
+
+        uint64_t scan_gen; /* Resource generation at last scan */
+        size_t scan_cnt;   /* Array entries at last scan */
     } stash[WT_GENERATIONS];
 
+/*
+ * WT_STASH_SCAN_BATCH --
+ *	Stash entries added in a single generation before the session rescans the other sessions'
+ * generations.
+ */
+#define WT_STASH_SCAN_BATCH 16
+
 /*
  * Hazard pointers.
  *
@@ -70,6 +70,15 @@
  *
  * Our solution is to use the session ID; there is normally a session per thread
  * and the session ID is a small, monotonically increasing number.
+ *
+ * Where the operating system can cheaply return the current CPU (for example,
+ * sched_getcpu on Linux, which glibc answers from a per-thread restartable
+ * sequence area without a system call), each API call made by an application
+ * thread switches the session to the slot of the CPU it's running on. Threads
+ * running on different CPUs then update different structures, regardless of
+ * how many sessions are open, and threads sharing a CPU rarely race. The
+ * session ID slot is the fallback, and is still used by internal threads which
+ * don't make API calls.
  */
 #define WT_STATS_SLOT_ID(session) (((session)->id) % WT_COUNTER_SLOTS)
 
@@ -129,6 +138,33 @@ __wt_stats_aggregate(void *stats_arg, int slot)
     return (aggr_v);
 }
 
+/*
+ * Sum all the values from all structures in the array into a single structure.
+ *
+ * Reading one field at a time from each structure touches a cache line in every slot for every
+ * statistic; instead, walk each slot's structure sequentially, adding it into the sum. The same
+ * races and negative values described above apply, and are handled the same way.
+ */
+static inline void
+__wt_stats_sum(void *stats_arg, void *sum_arg, size_t size)
+{
+    int64_t **stats, *sum;
+    size_t cnt, j;
+    int i;
+
+    stats = stats_arg;
+    sum = sum_arg;
+    cnt = size / sizeof(int64_t);
+
+    memset(sum, 0, size);
+    for (i = 0; i < WT_COUNTER_SLOTS; i++)
+        for (j = 0; j < cnt; j++)
+            sum[j] += stats[i][j];
+    for (j = 0; j < cnt; j++)
+        if (sum[j] < 0)
+            sum[j] = 0;
+}
+
 /*
  * Clear the values in all structures in the array.
  */
@@ -254,6 +290,20 @@ __wt_stats_clear(void *stats_arg, int slot)
 #define WT_STAT_SESSION_INCRV(session, fld, value) \
     WT_STAT_INCRV_BASE(session, &(session)->stats, fld, value)
 
+/*
+ * Update latency histograms if statistics gathering is enabled: a histogram's buckets are
+ * consecutive statistics, indexed from the first bucket. Latency histograms are only kept for the
+ * connection: each data handle has a copy of its statistics for every counter slot, per-handle
+ * histograms would add tens of KB to every open handle.
+ */
+#define WT_STAT_LAT_HIST_INCR_BASE(session, stat, name, value)             \
+    do {                                                                   \
+        if (WT_STAT_ENABLED(session))                                      \
+            (&(stat)->name##_hist_00)[__wt_stat_lat_hist_bucket(value)]++; \
+    } while (0)
+#define WT_STAT_CONN_LAT_HIST_INCR(session, name, value) \
+    WT_STAT_LAT_HIST_INCR_BASE(session, S2C(session)->stats[(session)->stat_bucket], name, value)
+
 /*
  * Construct histogram increment functions to put the passed value into the right bucket. Bucket
  * ranges, represented by various statistics, depend upon whether the passed value is in
@@ -296,6 +346,74 @@ __wt_stats_clear(void *stats_arg, int slot)
             WT_STAT_CONN_INCR(session, stat##_gt10000);                                           \
     }
 
+/*
+ * Latency histograms are log-linear, in the style of HDR histograms: values less than 8 are counted
+ * in the first bucket, each following power of two up to 2^17 is split into two buckets of equal
+ * width, and values of 2^17 and larger are counted in the last bucket. Bucket widths grow with the
+ * values they hold, which bounds the relative error of percentiles read from the histogram while
+ * covering microseconds to over a hundred milliseconds (or milliseconds to minutes) in 30 buckets.
+ * The bucket bounds are also encoded in dist/stat_data.py, which generates the statistics for each
+ * histogram's buckets, change them together.
+ */
+#define WT_LAT_HIST_BUCKETS 30
+#define WT_LAT_HIST_MAX_BIT 16 /* Last bit split into two buckets */
+#define WT_LAT_HIST_MIN_BIT 3  /* First bit split into two buckets */
+
+/*
+ * __wt_stat_lat_hist_bucket --
+ *     Return the latency histogram bucket counting a value.
+ */
+static inline u_int
+__wt_stat_lat_hist_bucket(uint64_t v)
+{
+    u_int bit;
+
+    if (v < (1 << WT_LAT_HIST_MIN_BIT))
+        return (0);
+    if (v >= (2 << WT_LAT_HIST_MAX_BIT))
+        return (WT_LAT_HIST_BUCKETS - 1);
+
+    /* Find the most significant bit, the bit below it selects one of its two buckets. */
+    for (bit = WT_LAT_HIST_MIN_BIT; v >> (bit + 1) != 0; ++bit)
+        ;
+    return (1 + 2 * (bit - WT_LAT_HIST_MIN_BIT) + (u_int)((v >> (bit - 1)) & 1));
+}
+
+/*
+ * __wt_stat_lat_hist_percentile --
+ *     Return a percentile, in tenths of a percent, of the values counted by a latency histogram.
+ *     The value is interpolated within the bucket holding it; values in the last bucket are
+ *     reported as the bucket's lower bound.
+ */
+static inline int64_t
+__wt_stat_lat_hist_percentile(const int64_t *hist, u_int permille)
+{
+    int64_t count, low, rank, total, width;
+    u_int bit, i;
+
+    for (total = 0, i = 0; i < WT_LAT_HIST_BUCKETS; ++i)
+        total += hist[i];
+    if (total <= 0)
+        return (0);
+
+    /* Find the bucket holding the value with the percentile's rank, counting from 1. */
+    rank = (total * (int64_t)permille + 999) / 1000;
+    for (count = 0, i = 0; count + hist[i] < rank; ++i)
+        count += hist[i];
+
+    if (i == WT_LAT_HIST_BUCKETS - 1)
+        return ((int64_t)2 << WT_LAT_HIST_MAX_BIT);
+    if (i == 0) {
+        low = 0;
+        width = 1 << WT_LAT_HIST_MIN_BIT;
+    } else {
+        bit = WT_LAT_HIST_MIN_BIT + (i - 1) / 2;
+        width = (int64_t)1 << (bit - 1);
+        low = ((int64_t)1 << bit) + (int64_t)((i - 1) % 2) * width;
+    }
+    return (low + (width * (rank - count) - 1) / hist[i]);
+}
+
 /*
  * DO NOT EDIT: automatically built by dist/stat.py.
  */
@@ -346,10 +464,12 @@ struct __wt_connection_stats {
     int64_t cache_bytes_inuse;
     int64_t cache_bytes_dirty_total;
     int64_t cache_bytes_other;
+    int64_t cache_bytes_lookaside_history;
     int64_t cache_bytes_read;
     int64_t cache_bytes_write;
     int64_t cache_lookaside_cursor_wait_application;
     int64_t cache_lookaside_cursor_wait_internal;
+    int64_t cache_lookaside_history_inmem;
     int64_t cache_lookaside_score;
     int64_t cache_lookaside_entries;
     int64_t cache_lookaside_insert;
@@ -400,8 +520,10 @@ struct __wt_connection_stats {
     int64_t cache_eviction_force;
     int64_t cache_eviction_force_fail;
     int64_t cache_eviction_force_fail_time;
+    int64_t cache_eviction_force_shrink;
     int64_t cache_eviction_hazard;
     int64_t cache_hazard_checks;
+    int64_t cache_hazard_filtered;
     int64_t cache_hazard_walks;
     int64_t cache_hazard_max;
     int64_t cache_inmem_splittable;
@@ -474,6 +596,7 @@ struct __wt_connection_stats {
     int64_t cursor_insert_bulk;
     int64_t cursor_cache;
     int64_t cursor_create;
+    int64_t cursor_index_only;
     int64_t cursor_insert;
     int64_t cursor_insert_bytes;
     int64_t cursor_modify;
@@ -494,6 +617,7 @@ struct __wt_connection_stats {
     int64_t cursor_sweep;
     int64_t cursor_truncate;
     int64_t cursor_update;
+    int64_t cursor_update_index_unchanged;
     int64_t cursor_update_bytes;
     int64_t cursor_update_bytes_changed;
     int64_t cursor_reopen;
@@ -507,11 +631,373 @@ struct __wt_connection_stats {
     int64_t dh_sweeps;
     int64_t dh_session_handles;
     int64_t dh_session_sweeps;
+    int64_t lat_page_read_p999;
+    int64_t lat_page_read_p99;
+    int64_t lat_page_read_hist_00;
+    int64_t lat_page_read_hist_01;
+    int64_t lat_page_read_hist_02;
+    int64_t lat_page_read_hist_03;
+    int64_t lat_page_read_hist_04;
+    int64_t lat_page_read_hist_05;
+    int64_t lat_page_read_hist_06;
+    int64_t lat_page_read_hist_07;
+    int64_t lat_page_read_hist_08;
+    int64_t lat_page_read_hist_09;
+    int64_t lat_page_read_hist_10;
+    int64_t lat_page_read_hist_11;
+    int64_t lat_page_read_hist_12;
+    int64_t lat_page_read_hist_13;
+    int64_t lat_page_read_hist_14;
+    int64_t lat_page_read_hist_15;
+    int64_t lat_page_read_hist_16;
+    int64_t lat_page_read_hist_17;
+    int64_t lat_page_read_hist_18;
+    int64_t lat_page_read_hist_19;
+    int64_t lat_page_read_hist_20;
+    int64_t lat_page_read_hist_21;
+    int64_t lat_page_read_hist_22;
+    int64_t lat_page_read_hist_23;
+    int64_t lat_page_read_hist_24;
+    int64_t lat_page_read_hist_25;
+    int64_t lat_page_read_hist_26;
+    int64_t lat_page_read_hist_27;
+    int64_t lat_page_read_hist_28;
+    int64_t lat_page_read_hist_29;
+    int64_t lat_checkpoint_metadata_p999;
+    int64_t lat_checkpoint_metadata_p99;
+    int64_t lat_checkpoint_metadata_hist_00;
+    int64_t lat_checkpoint_metadata_hist_01;
+    int64_t lat_checkpoint_metadata_hist_02;
+    int64_t lat_checkpoint_metadata_hist_03;
+    int64_t lat_checkpoint_metadata_hist_04;
+    int64_t lat_checkpoint_metadata_hist_05;
+    int64_t lat_checkpoint_metadata_hist_06;
+    int64_t lat_checkpoint_metadata_hist_07;
+    int64_t lat_checkpoint_metadata_hist_08;
+    int64_t lat_checkpoint_metadata_hist_09;
+    int64_t lat_checkpoint_metadata_hist_10;
+    int64_t lat_checkpoint_metadata_hist_11;
+    int64_t lat_checkpoint_metadata_hist_12;
+    int64_t lat_checkpoint_metadata_hist_13;
+    int64_t lat_checkpoint_metadata_hist_14;
+    int64_t lat_checkpoint_metadata_hist_15;
+    int64_t lat_checkpoint_metadata_hist_16;
+    int64_t lat_checkpoint_metadata_hist_17;
+    int64_t lat_checkpoint_metadata_hist_18;
+    int64_t lat_checkpoint_metadata_hist_19;
+    int64_t lat_checkpoint_metadata_hist_20;
+    int64_t lat_checkpoint_metadata_hist_21;
+    int64_t lat_checkpoint_metadata_hist_22;
+    int64_t lat_checkpoint_metadata_hist_23;
+    int64_t lat_checkpoint_metadata_hist_24;
+    int64_t lat_checkpoint_metadata_hist_25;
+    int64_t lat_checkpoint_metadata_hist_26;
+    int64_t lat_checkpoint_metadata_hist_27;
+    int64_t lat_checkpoint_metadata_hist_28;
+    int64_t lat_checkpoint_metadata_hist_29;
+    int64_t lat_checkpoint_prepare_p999;
+    int64_t lat_checkpoint_prepare_p99;
+    int64_t lat_checkpoint_prepare_hist_00;
+    int64_t lat_checkpoint_prepare_hist_01;
+    int64_t lat_checkpoint_prepare_hist_02;
+    int64_t lat_checkpoint_prepare_hist_03;
+    int64_t lat_checkpoint_prepare_hist_04;
+    int64_t lat_checkpoint_prepare_hist_05;
+    int64_t lat_checkpoint_prepare_hist_06;
+    int64_t lat_checkpoint_prepare_hist_07;
+    int64_t lat_checkpoint_prepare_hist_08;
+    int64_t lat_checkpoint_prepare_hist_09;
+    int64_t lat_checkpoint_prepare_hist_10;
+    int64_t lat_checkpoint_prepare_hist_11;
+    int64_t lat_checkpoint_prepare_hist_12;
+    int64_t lat_checkpoint_prepare_hist_13;
+    int64_t lat_checkpoint_prepare_hist_14;
+    int64_t lat_checkpoint_prepare_hist_15;
+    int64_t lat_checkpoint_prepare_hist_16;
+    int64_t lat_checkpoint_prepare_hist_17;
+    int64_t lat_checkpoint_prepare_hist_18;
+    int64_t lat_checkpoint_prepare_hist_19;
+    int64_t lat_checkpoint_prepare_hist_20;
+    int64_t lat_checkpoint_prepare_hist_21;
+    int64_t lat_checkpoint_prepare_hist_22;
+    int64_t lat_checkpoint_prepare_hist_23;
+    int64_t lat_checkpoint_prepare_hist_24;
+    int64_t lat_checkpoint_prepare_hist_25;
+    int64_t lat_checkpoint_prepare_hist_26;
+    int64_t lat_checkpoint_prepare_hist_27;
+    int64_t lat_checkpoint_prepare_hist_28;
+    int64_t lat_checkpoint_prepare_hist_29;
+    int64_t lat_checkpoint_scrub_p999;
+    int64_t lat_checkpoint_scrub_p99;
+    int64_t lat_checkpoint_scrub_hist_00;
+    int64_t lat_checkpoint_scrub_hist_01;
+    int64_t lat_checkpoint_scrub_hist_02;
+    int64_t lat_checkpoint_scrub_hist_03;
+    int64_t lat_checkpoint_scrub_hist_04;
+    int64_t lat_checkpoint_scrub_hist_05;
+    int64_t lat_checkpoint_scrub_hist_06;
+    int64_t lat_checkpoint_scrub_hist_07;
+    int64_t lat_checkpoint_scrub_hist_08;
+    int64_t lat_checkpoint_scrub_hist_09;
+    int64_t lat_checkpoint_scrub_hist_10;
+    int64_t lat_checkpoint_scrub_hist_11;
+    int64_t lat_checkpoint_scrub_hist_12;
+    int64_t lat_checkpoint_scrub_hist_13;
+    int64_t lat_checkpoint_scrub_hist_14;
+    int64_t lat_checkpoint_scrub_hist_15;
+    int64_t lat_checkpoint_scrub_hist_16;
+    int64_t lat_checkpoint_scrub_hist_17;
+    int64_t lat_checkpoint_scrub_hist_18;
+    int64_t lat_checkpoint_scrub_hist_19;
+    int64_t lat_checkpoint_scrub_hist_20;
+    int64_t lat_checkpoint_scrub_hist_21;
+    int64_t lat_checkpoint_scrub_hist_22;
+    int64_t lat_checkpoint_scrub_hist_23;
+    int64_t lat_checkpoint_scrub_hist_24;
+    int64_t lat_checkpoint_scrub_hist_25;
+    int64_t lat_checkpoint_scrub_hist_26;
+    int64_t lat_checkpoint_scrub_hist_27;
+    int64_t lat_checkpoint_scrub_hist_28;
+    int64_t lat_checkpoint_scrub_hist_29;
+    int64_t lat_checkpoint_sync_p999;
+    int64_t lat_checkpoint_sync_p99;
+    int64_t lat_checkpoint_sync_hist_00;
+    int64_t lat_checkpoint_sync_hist_01;
+    int64_t lat_checkpoint_sync_hist_02;
+    int64_t lat_checkpoint_sync_hist_03;
+    int64_t lat_checkpoint_sync_hist_04;
+    int64_t lat_checkpoint_sync_hist_05;
+    int64_t lat_checkpoint_sync_hist_06;
+    int64_t lat_checkpoint_sync_hist_07;
+    int64_t lat_checkpoint_sync_hist_08;
+    int64_t lat_checkpoint_sync_hist_09;
+    int64_t lat_checkpoint_sync_hist_10;
+    int64_t lat_checkpoint_sync_hist_11;
+    int64_t lat_checkpoint_sync_hist_12;
+    int64_t lat_checkpoint_sync_hist_13;
+    int64_t lat_checkpoint_sync_hist_14;
+    int64_t lat_checkpoint_sync_hist_15;
+    int64_t lat_checkpoint_sync_hist_16;
+    int64_t lat_checkpoint_sync_hist_17;
+    int64_t lat_checkpoint_sync_hist_18;
+    int64_t lat_checkpoint_sync_hist_19;
+    int64_t lat_checkpoint_sync_hist_20;
+    int64_t lat_checkpoint_sync_hist_21;
+    int64_t lat_checkpoint_sync_hist_22;
+    int64_t lat_checkpoint_sync_hist_23;
+    int64_t lat_checkpoint_sync_hist_24;
+    int64_t lat_checkpoint_sync_hist_25;
+    int64_t lat_checkpoint_sync_hist_26;
+    int64_t lat_checkpoint_sync_hist_27;
+    int64_t lat_checkpoint_sync_hist_28;
+    int64_t lat_checkpoint_sync_hist_29;
+    int64_t lat_checkpoint_tree_p999;
+    int64_t lat_checkpoint_tree_p99;
+    int64_t lat_checkpoint_tree_hist_00;
+    int64_t lat_checkpoint_tree_hist_01;
+    int64_t lat_checkpoint_tree_hist_02;
+    int64_t lat_checkpoint_tree_hist_03;
+    int64_t lat_checkpoint_tree_hist_04;
+    int64_t lat_checkpoint_tree_hist_05;
+    int64_t lat_checkpoint_tree_hist_06;
+    int64_t lat_checkpoint_tree_hist_07;
+    int64_t lat_checkpoint_tree_hist_08;
+    int64_t lat_checkpoint_tree_hist_09;
+    int64_t lat_checkpoint_tree_hist_10;
+    int64_t lat_checkpoint_tree_hist_11;
+    int64_t lat_checkpoint_tree_hist_12;
+    int64_t lat_checkpoint_tree_hist_13;
+    int64_t lat_checkpoint_tree_hist_14;
+    int64_t lat_checkpoint_tree_hist_15;
+    int64_t lat_checkpoint_tree_hist_16;
+    int64_t lat_checkpoint_tree_hist_17;
+    int64_t lat_checkpoint_tree_hist_18;
+    int64_t lat_checkpoint_tree_hist_19;
+    int64_t lat_checkpoint_tree_hist_20;
+    int64_t lat_checkpoint_tree_hist_21;
+    int64_t lat_checkpoint_tree_hist_22;
+    int64_t lat_checkpoint_tree_hist_23;
+    int64_t lat_checkpoint_tree_hist_24;
+    int64_t lat_checkpoint_tree_hist_25;
+    int64_t lat_checkpoint_tree_hist_26;
+    int64_t lat_checkpoint_tree_hist_27;
+    int64_t lat_checkpoint_tree_hist_28;
+    int64_t lat_checkpoint_tree_hist_29;
+    int64_t lat_cursor_insert_p999;
+    int64_t lat_cursor_insert_p99;
+    int64_t lat_cursor_insert_hist_00;
+    int64_t lat_cursor_insert_hist_01;
+    int64_t lat_cursor_insert_hist_02;
+    int64_t lat_cursor_insert_hist_03;
+    int64_t lat_cursor_insert_hist_04;
+    int64_t lat_cursor_insert_hist_05;
+    int64_t lat_cursor_insert_hist_06;
+    int64_t lat_cursor_insert_hist_07;
+    int64_t lat_cursor_insert_hist_08;
+    int64_t lat_cursor_insert_hist_09;
+    int64_t lat_cursor_insert_hist_10;
+    int64_t lat_cursor_insert_hist_11;
+    int64_t lat_cursor_insert_hist_12;
+    int64_t lat_cursor_insert_hist_13;
+    int64_t lat_cursor_insert_hist_14;
+    int64_t lat_cursor_insert_hist_15;
+    int64_t lat_cursor_insert_hist_16;
+    int64_t lat_cursor_insert_hist_17;
+    int64_t lat_cursor_insert_hist_18;
+    int64_t lat_cursor_insert_hist_19;
+    int64_t lat_cursor_insert_hist_20;
+    int64_t lat_cursor_insert_hist_21;
+    int64_t lat_cursor_insert_hist_22;
+    int64_t lat_cursor_insert_hist_23;
+    int64_t lat_cursor_insert_hist_24;
+    int64_t lat_cursor_insert_hist_25;
+    int64_t lat_cursor_insert_hist_26;
+    int64_t lat_cursor_insert_hist_27;
+    int64_t lat_cursor_insert_hist_28;
+    int64_t lat_cursor_insert_hist_29;
+    int64_t lat_cursor_remove_p999;
+    int64_t lat_cursor_remove_p99;
+    int64_t lat_cursor_remove_hist_00;
+    int64_t lat_cursor_remove_hist_01;
+    int64_t lat_cursor_remove_hist_02;
+    int64_t lat_cursor_remove_hist_03;
+    int64_t lat_cursor_remove_hist_04;
+    int64_t lat_cursor_remove_hist_05;
+    int64_t lat_cursor_remove_hist_06;
+    int64_t lat_cursor_remove_hist_07;
+    int64_t lat_cursor_remove_hist_08;
+    int64_t lat_cursor_remove_hist_09;
+    int64_t lat_cursor_remove_hist_10;
+    int64_t lat_cursor_remove_hist_11;
+    int64_t lat_cursor_remove_hist_12;
+    int64_t lat_cursor_remove_hist_13;
+    int64_t lat_cursor_remove_hist_14;
+    int64_t lat_cursor_remove_hist_15;
+    int64_t lat_cursor_remove_hist_16;
+    int64_t lat_cursor_remove_hist_17;
+    int64_t lat_cursor_remove_hist_18;
+    int64_t lat_cursor_remove_hist_19;
+    int64_t lat_cursor_remove_hist_20;
+    int64_t lat_cursor_remove_hist_21;
+    int64_t lat_cursor_remove_hist_22;
+    int64_t lat_cursor_remove_hist_23;
+    int64_t lat_cursor_remove_hist_24;
+    int64_t lat_cursor_remove_hist_25;
+    int64_t lat_cursor_remove_hist_26;
+    int64_t lat_cursor_remove_hist_27;
+    int64_t lat_cursor_remove_hist_28;
+    int64_t lat_cursor_remove_hist_29;
+    int64_t lat_cursor_search_p999;
+    int64_t lat_cursor_search_p99;
+    int64_t lat_cursor_search_hist_00;
+    int64_t lat_cursor_search_hist_01;
+    int64_t lat_cursor_search_hist_02;
+    int64_t lat_cursor_search_hist_03;
+    int64_t lat_cursor_search_hist_04;
+    int64_t lat_cursor_search_hist_05;
+    int64_t lat_cursor_search_hist_06;
+    int64_t lat_cursor_search_hist_07;
+    int64_t lat_cursor_search_hist_08;
+    int64_t lat_cursor_search_hist_09;
+    int64_t lat_cursor_search_hist_10;
+    int64_t lat_cursor_search_hist_11;
+    int64_t lat_cursor_search_hist_12;
+    int64_t lat_cursor_search_hist_13;
+    int64_t lat_cursor_search_hist_14;
+    int64_t lat_cursor_search_hist_15;
+    int64_t lat_cursor_search_hist_16;
+    int64_t lat_cursor_search_hist_17;
+    int64_t lat_cursor_search_hist_18;
+    int64_t lat_cursor_search_hist_19;
+    int64_t lat_cursor_search_hist_20;
+    int64_t lat_cursor_search_hist_21;
+    int64_t lat_cursor_search_hist_22;
+    int64_t lat_cursor_search_hist_23;
+    int64_t lat_cursor_search_hist_24;
+    int64_t lat_cursor_search_hist_25;
+    int64_t lat_cursor_search_hist_26;
+    int64_t lat_cursor_search_hist_27;
+    int64_t lat_cursor_search_hist_28;
+    int64_t lat_cursor_search_hist_29;
+    int64_t lat_cursor_update_p999;
+    int64_t lat_cursor_update_p99;
+    int64_t lat_cursor_update_hist_00;
+    int64_t lat_cursor_update_hist_01;
+    int64_t lat_cursor_update_hist_02;
+    int64_t lat_cursor_update_hist_03;
+    int64_t lat_cursor_update_hist_04;
+    int64_t lat_cursor_update_hist_05;
+    int64_t lat_cursor_update_hist_06;
+    int64_t lat_cursor_update_hist_07;
+    int64_t lat_cursor_update_hist_08;
+    int64_t lat_cursor_update_hist_09;
+    int64_t lat_cursor_update_hist_10;
+    int64_t lat_cursor_update_hist_11;
+    int64_t lat_cursor_update_hist_12;
+    int64_t lat_cursor_update_hist_13;
+    int64_t lat_cursor_update_hist_14;
+    int64_t lat_cursor_update_hist_15;
+    int64_t lat_cursor_update_hist_16;
+    int64_t lat_cursor_update_hist_17;
+    int64_t lat_cursor_update_hist_18;
+    int64_t lat_cursor_update_hist_19;
+    int64_t lat_cursor_update_hist_20;
+    int64_t lat_cursor_update_hist_21;
+    int64_t lat_cursor_update_hist_22;
+    int64_t lat_cursor_update_hist_23;
+    int64_t lat_cursor_update_hist_24;
+    int64_t lat_cursor_update_hist_25;
+    int64_t lat_cursor_update_hist_26;
+    int64_t lat_cursor_update_hist_27;
+    int64_t lat_cursor_update_hist_28;
+    int64_t lat_cursor_update_hist_29;
+    int64_t lat_txn_commit_p999;
+    int64_t lat_txn_commit_p99;
+    int64_t lat_txn_commit_hist_00;
+    int64_t lat_txn_commit_hist_01;
+    int64_t lat_txn_commit_hist_02;
+    int64_t lat_txn_commit_hist_03;
+    int64_t lat_txn_commit_hist_04;
+    int64_t lat_txn_commit_hist_05;
+    int64_t lat_txn_commit_hist_06;
+    int64_t lat_txn_commit_hist_07;
+    int64_t lat_txn_commit_hist_08;
+    int64_t lat_txn_commit_hist_09;
+    int64_t lat_txn_commit_hist_10;
+    int64_t lat_txn_commit_hist_11;
+    int64_t lat_txn_commit_hist_12;
+    int64_t lat_txn_commit_hist_13;
+    int64_t lat_txn_commit_hist_14;
+    int64_t lat_txn_commit_hist_15;
+    int64_t lat_txn_commit_hist_16;
+    int64_t lat_txn_commit_hist_17;
+    int64_t lat_txn_commit_hist_18;
+    int64_t lat_txn_commit_hist_19;
+    int64_t lat_txn_commit_hist_20;
+    int64_t lat_txn_commit_hist_21;
+    int64_t lat_txn_commit_hist_22;
+    int64_t lat_txn_commit_hist_23;
+    int64_t lat_txn_commit_hist_24;
+    int64_t lat_txn_commit_hist_25;
+    int64_t lat_txn_commit_hist_26;
+    int64_t lat_txn_commit_hist_27;
+    int64_t lat_txn_commit_hist_28;
+    int64_t lat_txn_commit_hist_29;
     int64_t lock_checkpoint_count;
     int64_t lock_checkpoint_wait_application;
     int64_t lock_checkpoint_wait_internal;
+    int64_t lock_checkpoint_hist_lt10;
+    int64_t lock_checkpoint_hist_lt100;
+    int64_t lock_checkpoint_hist_lt1000;
+    int64_t lock_checkpoint_hist_lt10000;
+    int64_t lock_checkpoint_hist_gt10000;
     int64_t lock_dhandle_wait_application;
     int64_t lock_dhandle_wait_internal;
+    int64_t lock_dhandle_hist_lt10;
+    int64_t lock_dhandle_hist_lt100;
+    int64_t lock_dhandle_hist_lt1000;
+    int64_t lock_dhandle_hist_lt10000;
+    int64_t lock_dhandle_hist_gt10000;
     int64_t lock_dhandle_read_count;
     int64_t lock_dhandle_write_count;
     int64_t lock_durable_timestamp_wait_application;
@@ -521,6 +1007,11 @@ struct __wt_connection_stats {
     int64_t lock_metadata_count;
     int64_t lock_metadata_wait_application;
     int64_t lock_metadata_wait_internal;
+    int64_t lock_metadata_hist_lt10;
+    int64_t lock_metadata_hist_lt100;
+    int64_t lock_metadata_hist_lt1000;
+    int64_t lock_metadata_hist_lt10000;
+    int64_t lock_metadata_hist_gt10000;
     int64_t lock_read_timestamp_wait_application;
     int64_t lock_read_timestamp_wait_internal;
     int64_t lock_read_timestamp_read_count;
@@ -528,8 +1019,18 @@ struct __wt_connection_stats {
     int64_t lock_schema_count;
     int64_t lock_schema_wait_application;
     int64_t lock_schema_wait_internal;
+    int64_t lock_schema_hist_lt10;
+    int64_t lock_schema_hist_lt100;
+    int64_t lock_schema_hist_lt1000;
+    int64_t lock_schema_hist_lt10000;
+    int64_t lock_schema_hist_gt10000;
     int64_t lock_table_wait_application;
     int64_t lock_table_wait_internal;
+    int64_t lock_table_hist_lt10;
+    int64_t lock_table_hist_lt100;
+    int64_t lock_table_hist_lt1000;
+    int64_t lock_table_hist_lt10000;
+    int64_t lock_table_hist_gt10000;
     int64_t lock_table_read_count;
     int64_t lock_table_write_count;
     int64_t lock_txn_global_wait_application;
@@ -703,6 +1204,8 @@ struct __wt_connection_stats {
     int64_t txn_pinned_timestamp_reader;
     int64_t txn_pinned_timestamp_oldest;
     int64_t txn_timestamp_oldest_active_read;
+    int64_t txn_snapshot_cache_set;
+    int64_t txn_snapshot_cache_hit;
     int64_t txn_sync;
     int64_t txn_commit;
     int64_t txn_rollback;
@@ -871,6 +1374,7 @@ struct __wt_join_stats {
     int64_t bloom_false_positive;
     int64_t membership_check;
     int64_t bloom_insert;
+    int64_t hash_insert;
     int64_t iterated;
 };
 
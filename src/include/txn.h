@@ -104,6 +104,21 @@ struct __wt_named_snapshot {
     uint32_t snapshot_count;
 };
 
+/*
+ * WT_TXN_SNAPSHOT --
+ *	A snapshot cached at the connection level. Read-only transactions that
+ *	start in the same commit generation share it rather than rebuilding and
+ *	sorting their own copy.
+ */
+struct __wt_txn_snapshot {
+    uint64_t commit_gen;    /* Commit generation it was built in */
+    uint64_t checkpoint_id; /* Checkpoint ID included in the snapshot */
+    uint64_t pinned_id;     /* Oldest ID the snapshot requires */
+    uint64_t snap_min, snap_max;
+    uint64_t *snapshot;
+    uint32_t snapshot_count;
+};
+
 struct __wt_txn_state {
     WT_CACHE_LINE_PAD_BEGIN
     volatile uint64_t id;
@@ -114,6 +129,23 @@ struct __wt_txn_state {
     WT_CACHE_LINE_PAD_END
 };
 
+/*
+ * WT_TXN_TS_QUEUE --
+ *	A list of transactions sorted by timestamp. Transactions publishing
+ *	timestamps are spread across several lists by session ID so concurrent
+ *	commits rarely contend for a list lock: the oldest timestamp overall is
+ *	the oldest of the list heads.
+ */
+#define WT_TXN_TS_QUEUE_SLOTS 8
+#define WT_TXN_TS_QUEUE(s, queues) (&(queues)[(s)->id % WT_TXN_TS_QUEUE_SLOTS])
+struct __wt_txn_ts_queue {
+    WT_CACHE_LINE_PAD_BEGIN
+    WT_RWLOCK rwlock;
+    TAILQ_HEAD(__wt_txn_ts_qh, __wt_txn) qh;
+    uint32_t len;
+    WT_CACHE_LINE_PAD_END
+};
+
 struct __wt_txn_global {
     volatile uint64_t current; /* Current transaction ID. */
 
@@ -147,15 +179,11 @@ struct __wt_txn_global {
     /* Protects logging, checkpoints and transaction visibility. */
     WT_RWLOCK visibility_rwlock;
 
-    /* List of transactions sorted by durable timestamp. */
-    WT_RWLOCK durable_timestamp_rwlock;
-    TAILQ_HEAD(__wt_txn_dts_qh, __wt_txn) durable_timestamph;
-    uint32_t durable_timestampq_len;
+    /* Lists of transactions sorted by durable timestamp. */
+    WT_TXN_TS_QUEUE durable_timestamp_queues[WT_TXN_TS_QUEUE_SLOTS];
 
-    /* List of transactions sorted by read timestamp. */
-    WT_RWLOCK read_timestamp_rwlock;
-    TAILQ_HEAD(__wt_txn_rts_qh, __wt_txn) read_timestamph;
-    uint32_t read_timestampq_len;
+    /* Lists of transactions sorted by read timestamp. */
+    WT_TXN_TS_QUEUE read_timestamp_queues[WT_TXN_TS_QUEUE_SLOTS];
 
     /*
      * Track information about the running checkpoint. The transaction
@@ -182,6 +210,12 @@ struct __wt_txn_global {
     volatile uint64_t nsnap_oldest_id;
     TAILQ_HEAD(__wt_nsnap_qh, __wt_named_snapshot) nsnaph;
 
+    /*
+     * Snapshot shared by read-only transactions, valid until the commit generation moves on.
+     * Replaced snapshots are freed through the commit generation stash.
+     */
+    WT_TXN_SNAPSHOT *snapshot_cache;
+
     WT_TXN_STATE *states; /* Per-session transaction states */
 };
 
@@ -270,7 +304,8 @@ struct __wt_txn {
      *	everything else is visible unless it is in the snapshot.
      */
     uint64_t snap_min, snap_max;
-    uint64_t *snapshot;
+    uint64_t *snapshot;       /* Private or shared snapshot */
+    uint64_t *snapshot_local; /* Private snapshot array */
     uint32_t snapshot_count;
     uint32_t txn_logsync; /* Log sync configuration */
 
@@ -64,7 +64,9 @@ __wt_verify_build(void)
 #define WT_PADDING_CHECK(s) \
     WT_STATIC_ASSERT(       \
       sizeof(s) > WT_CACHE_LINE_ALIGNMENT || sizeof(s) % WT_CACHE_LINE_ALIGNMENT == 0)
+    WT_PADDING_CHECK(WT_HAZARD_FILTER);
     WT_PADDING_CHECK(WT_LOGSLOT);
+    WT_PADDING_CHECK(WT_RWLOCK_READERS);
     WT_PADDING_CHECK(WT_TXN_STATE);
 
     /*
@@ -149,6 +149,10 @@ struct __wt_cursor_join_endpoint;
 typedef struct __wt_cursor_join_endpoint WT_CURSOR_JOIN_ENDPOINT;
 struct __wt_cursor_join_entry;
 typedef struct __wt_cursor_join_entry WT_CURSOR_JOIN_ENTRY;
+struct __wt_cursor_join_hash;
+typedef struct __wt_cursor_join_hash WT_CURSOR_JOIN_HASH;
+struct __wt_cursor_join_hash_item;
+typedef struct __wt_cursor_join_hash_item WT_CURSOR_JOIN_HASH_ITEM;
 struct __wt_cursor_join_iter;
 typedef struct __wt_cursor_join_iter WT_CURSOR_JOIN_ITER;
 struct __wt_cursor_json;
@@ -191,6 +195,8 @@ struct __wt_fstream;
 typedef struct __wt_fstream WT_FSTREAM;
 struct __wt_hazard;
 typedef struct __wt_hazard WT_HAZARD;
+struct __wt_hazard_filter;
+typedef struct __wt_hazard_filter WT_HAZARD_FILTER;
 struct __wt_ikey;
 typedef struct __wt_ikey WT_IKEY;
 struct __wt_index;
@@ -205,6 +211,8 @@ struct __wt_join_stats_group;
 typedef struct __wt_join_stats_group WT_JOIN_STATS_GROUP;
 struct __wt_keyed_encryptor;
 typedef struct __wt_keyed_encryptor WT_KEYED_ENCRYPTOR;
+struct __wt_las_partition;
+typedef struct __wt_las_partition WT_LAS_PARTITION;
 struct __wt_log;
 typedef struct __wt_log WT_LOG;
 struct __wt_log_desc;
@@ -257,8 +265,12 @@ struct __wt_ovfl_reuse;
 typedef struct __wt_ovfl_reuse WT_OVFL_REUSE;
 struct __wt_ovfl_track;
 typedef struct __wt_ovfl_track WT_OVFL_TRACK;
+struct __wt_pack_format;
+typedef struct __wt_pack_format WT_PACK_FORMAT;
 struct __wt_page;
 typedef struct __wt_page WT_PAGE;
+struct __wt_page_arena;
+typedef struct __wt_page_arena WT_PAGE_ARENA;
 struct __wt_page_deleted;
 typedef struct __wt_page_deleted WT_PAGE_DELETED;
 struct __wt_page_header;
@@ -287,6 +299,8 @@ struct __wt_row;
 typedef struct __wt_row WT_ROW;
 struct __wt_rwlock;
 typedef struct __wt_rwlock WT_RWLOCK;
+struct __wt_rwlock_readers;
+typedef struct __wt_rwlock_readers WT_RWLOCK_READERS;
 struct __wt_salvage_cookie;
 typedef struct __wt_salvage_cookie WT_SALVAGE_COOKIE;
 struct __wt_save_upd;
@@ -319,8 +333,12 @@ struct __wt_txn_op;
 typedef struct __wt_txn_op WT_TXN_OP;
 struct __wt_txn_printlog_args;
 typedef struct __wt_txn_printlog_args WT_TXN_PRINTLOG_ARGS;
+struct __wt_txn_snapshot;
+typedef struct __wt_txn_snapshot WT_TXN_SNAPSHOT;
 struct __wt_txn_state;
 typedef struct __wt_txn_state WT_TXN_STATE;
+struct __wt_txn_ts_queue;
+typedef struct __wt_txn_ts_queue WT_TXN_TS_QUEUE;
 struct __wt_update;
 typedef struct __wt_update WT_UPDATE;
 union __wt_lsn;
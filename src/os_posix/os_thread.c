@@ -8,6 +8,10 @@
 
 #include "wt_internal.h"
 
+#ifdef HAVE_SCHED_GETCPU
+#include <sched.h>
+#endif
+
 /*
  * __wt_thread_create --
  *     Create a new thread of control.
@@ -61,6 +65,20 @@ __wt_thread_join(WT_SESSION_IMPL *session, wt_thread_t *tid)
     WT_RET_MSG(session, ret, "pthread_join");
 }
 
+/*
+ * __wt_thread_cpu --
+ *     Return the CPU the calling thread is running on, or -1 if it's unknown.
+ */
+int
+__wt_thread_cpu(void)
+{
+#ifdef HAVE_SCHED_GETCPU
+    return (sched_getcpu());
+#else
+    return (-1);
+#endif
+}
+
 /*
  * __wt_thread_id --
  *     Return an arithmetic representation of a thread ID on POSIX.
@@ -74,6 +74,16 @@ __wt_thread_join(WT_SESSION_IMPL *session, wt_thread_t *tid)
     return (0);
 }
 
+/*
+ * __wt_thread_cpu --
+ *     Return the CPU the calling thread is running on, or -1 if it's unknown.
+ */
+int
+__wt_thread_cpu(void)
+{
+    return ((int)GetCurrentProcessorNumber());
+}
+
 /*
  * __wt_thread_id --
  *     Return an arithmetic representation of a thread ID on POSIX.
@@ -149,3 +149,97 @@ __wt_struct_repack(WT_SESSION_IMPL *session, const char *infmt, const char *outf
 
     return (0);
 }
+
+/*
+ * __wt_pack_format_compile --
+ *     Compile a format string into a list of fields.
+ */
+int
+__wt_pack_format_compile(WT_SESSION_IMPL *session, const char *fmt, WT_PACK_FORMAT **pfp)
+{
+    WT_DECL_PACK_VALUE(pv);
+    WT_DECL_RET;
+    WT_PACK pack;
+    WT_PACK_FORMAT *pf;
+    u_int n;
+
+    *pfp = NULL;
+
+    /* Count the fields, this also validates the format. */
+    WT_RET(__pack_init(session, &pack, fmt));
+    for (n = 0; (ret = __pack_next(&pack, &pv)) == 0; ++n)
+        ;
+    WT_RET_NOTFOUND_OK(ret);
+
+    WT_RET(__wt_calloc_one(session, &pf));
+    pf->fmt = fmt;
+    if (n > WT_PACK_FORMAT_MAX) {
+        pf->interpret = true;
+        *pfp = pf;
+        return (0);
+    }
+    if (n > 0)
+        WT_ERR(__wt_calloc_def(session, n, &pf->fields));
+
+    /*
+     * Sum the sizes of the fields whose packed size doesn't depend on their value: if every field
+     * is fixed-size, packing doesn't have to size each value.
+     */
+    pf->fixed = true;
+    WT_ERR(__pack_init(session, &pack, fmt));
+    for (n = 0; (ret = __pack_next(&pack, &pv)) == 0; ++n) {
+        pf->fields[n] = pv;
+        switch (pv.type) {
+        case 'b':
+        case 'B':
+        case 't':
+            pf->fixed_size += 1;
+            break;
+        case 'R':
+            pf->fixed_size += sizeof(uint64_t);
+            break;
+        case 's':
+        case 'x':
+            pf->fixed_size += pv.size;
+            break;
+        case 'S':
+        case 'u':
+            if (pv.havesize) {
+                pf->fixed_size += pv.size;
+                break;
+            }
+        /* FALLTHROUGH */
+        default:
+            pf->fixed = false;
+            break;
+        }
+    }
+    WT_ERR_NOTFOUND_OK(ret);
+    pf->nfields = n;
+    if (!pf->fixed)
+        pf->fixed_size = 0;
+
+    *pfp = pf;
+    return (0);
+
+err:
+    __wt_pack_format_free(session, &pf);
+    return (ret);
+}
+
+/*
+ * __wt_pack_format_free --
+ *     Discard a compiled format.
+ */
+void
+__wt_pack_format_free(WT_SESSION_IMPL *session, WT_PACK_FORMAT **pfp)
+{
+    WT_PACK_FORMAT *pf;
+
+    if ((pf = *pfp) == NULL)
+        return;
+    *pfp = NULL;
+
+    __wt_free(session, pf->fields);
+    __wt_free(session, pf);
+}
@@ -783,6 +783,7 @@ __rec_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
         __wt_free(session, multi->disk_image);
         __wt_free(session, multi->supd);
         __wt_free(session, multi->addr.addr);
+        __wt_las_history_free(session, &multi->page_las);
     }
     __wt_free(session, r->multi);
 
@@ -2155,6 +2156,7 @@ __rec_split_discard(WT_SESSION_IMPL *session, WT_PAGE *page)
 
         __wt_free(session, multi->disk_image);
         __wt_free(session, multi->supd);
+        __wt_las_history_free(session, &multi->page_las);
 
         /*
          * If the page was re-written free the backing disk blocks used in the previous write
@@ -2276,6 +2278,7 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
         __wt_free(session, mod->mod_replace.addr);
         mod->mod_replace.size = 0;
         __wt_free(session, mod->mod_disk_image);
+        __wt_las_history_free(session, &mod->mod_page_las);
         break;
     default:
         return (__wt_illegal_value(session, mod->rec_result));
@@ -2354,6 +2357,8 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
             mod->mod_disk_image = r->multi->disk_image;
             r->multi->disk_image = NULL;
             mod->mod_page_las = r->multi->page_las;
+            r->multi->page_las.history = NULL;
+            r->multi->page_las.history_size = 0;
         } else {
             __wt_checkpoint_tree_reconcile_update(session, r->multi->addr.newest_durable_ts,
               r->multi->addr.oldest_start_ts, r->multi->addr.oldest_start_txn,
@@ -2468,7 +2473,7 @@ __rec_las_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
     /* Ensure enough room for a column-store key without checking. */
     WT_RET(__wt_scr_alloc(session, WT_INTPACK64_MAXSIZE, &key));
 
-    __wt_las_cursor(session, &cursor, &session_flags);
+    __wt_las_cursor(session, WT_LAS_PARTITION_ID(S2BT(session)->id), &cursor, &session_flags);
 
     for (multi = r->multi, i = 0; i < r->multi_next; ++multi, ++i)
         if (multi->supd != NULL) {
@@ -2499,10 +2504,12 @@ __rec_las_wrapup_err(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 
     /*
      * Note the additional check for a non-zero lookaside page ID, that flags if lookaside table
-     * entries for this page have been written.
+     * entries for this page have been written. History kept in memory is discarded with the rest of
+     * the reconciliation state.
      */
     for (multi = r->multi, i = 0; i < r->multi_next; ++multi, ++i)
-        if (multi->supd != NULL && (las_pageid = multi->page_las.las_pageid) != 0)
+        if (multi->supd != NULL && (las_pageid = multi->page_las.las_pageid) != 0 &&
+          multi->page_las.history == NULL)
             WT_TRET(__wt_las_remove_block(session, las_pageid));
 
     return (ret);
@@ -338,7 +338,7 @@ static int
 __create_index(WT_SESSION_IMPL *session, const char *name, bool exclusive, const char *config)
 {
     WT_CONFIG kcols, pkcols;
-    WT_CONFIG_ITEM ckey, cval, icols, kval;
+    WT_CONFIG_ITEM ckey, cval, icols, incl, kval;
     WT_DECL_PACK_VALUE(pv);
     WT_DECL_RET;
     WT_INDEX *idx;
@@ -445,6 +445,26 @@ __create_index(WT_SESSION_IMPL *session, const char *name, bool exclusive, const
         WT_ERR_NOTFOUND_OK(ret);
     }
 
+    /*
+     * Included columns are stored in the index value: they must be value columns of the table that
+     * are not already part of the index key.
+     */
+    WT_CLEAR(incl);
+    WT_ERR_NOTFOUND_OK(__wt_config_getones(session, config, "include", &incl));
+    if (incl.len != 0) {
+        if (have_extractor)
+            WT_ERR_MSG(session, EINVAL,
+              "%s: an index with a custom extractor may not include columns", name);
+        if (__wt_config_getones(session, config, "immutable", &cval) == 0 && cval.val)
+            WT_ERR_MSG(session, EINVAL, "%s: an immutable index may not include columns", name);
+        __wt_config_subinit(session, &kcols, &incl);
+        while ((ret = __wt_config_next(&kcols, &ckey, &cval)) == 0)
+            if (__wt_config_subgetraw(session, &icols, &ckey, &cval) == 0)
+                WT_ERR_MSG(session, EINVAL, "%s: included column '%.*s' is part of the index key",
+                  name, (int)ckey.len, ckey.str);
+        WT_ERR_NOTFOUND_OK(ret);
+    }
+
     /*
      * The key format for an index is somewhat subtle: the application specifies a set of columns
      * that it will use for the key, but the engine usually adds some hidden columns in order to
@@ -454,6 +474,11 @@ __create_index(WT_SESSION_IMPL *session, const char *name, bool exclusive, const
     __wt_config_subinit(session, &pkcols, &table->colconf);
     for (i = 0; i < table->nkey_columns && (ret = __wt_config_next(&pkcols, &ckey, &cval)) == 0;
          i++) {
+        /* The primary key is always in the index key, it can't also be included. */
+        if (incl.len != 0 && __wt_config_subgetraw(session, &incl, &ckey, &cval) == 0)
+            WT_ERR_MSG(session, EINVAL, "%s: included column '%.*s' is a primary key column", name,
+              (int)ckey.len, ckey.str);
+
         /*
          * If the primary key column is already in the secondary key, don't add it again.
          */
@@ -468,8 +493,14 @@ __create_index(WT_SESSION_IMPL *session, const char *name, bool exclusive, const
     }
     WT_ERR_NOTFOUND_OK(ret);
 
-    /* Index values are empty: all columns are packed into the index key. */
-    WT_ERR(__wt_buf_fmt(session, &fmt, "value_format=,key_format="));
+    /*
+     * Index values hold the included columns, if any, otherwise they are empty: all other columns
+     * are packed into the index key.
+     */
+    WT_ERR(__wt_buf_fmt(session, &fmt, "value_format="));
+    if (incl.len != 0)
+        WT_ERR(__wt_struct_reformat(session, table, incl.str, incl.len, NULL, true, &fmt));
+    WT_ERR(__wt_buf_catfmt(session, &fmt, ",key_format="));
 
     if (have_extractor) {
         WT_ERR(__wt_buf_catfmt(session, &fmt, "%.*s", (int)kval.len, kval.str));
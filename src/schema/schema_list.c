@@ -134,6 +134,9 @@ __wt_schema_destroy_index(WT_SESSION_IMPL *session, WT_INDEX **idxp)
     __wt_free(session, idx->key_format);
     __wt_free(session, idx->key_plan);
     __wt_free(session, idx->value_plan);
+    __wt_free(session, idx->key_columns);
+    __wt_free(session, idx->include_format);
+    __wt_free(session, idx->include_plan);
     __wt_free(session, idx->idxkey_format);
     __wt_free(session, idx->exkey_format);
     __wt_free(session, idx);
@@ -152,6 +155,8 @@ __wt_schema_close_table(WT_SESSION_IMPL *session, WT_TABLE *table)
     u_int i;
 
     __wt_free(session, table->plan);
+    __wt_pack_format_free(session, &table->key_pack);
+    __wt_pack_format_free(session, &table->value_pack);
     __wt_free(session, table->key_format);
     __wt_free(session, table->value_format);
     if (table->cgroups != NULL) {
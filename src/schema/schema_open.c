@@ -147,6 +147,17 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
     WT_ERR(__wt_config_getones(session, idx->config, "key_format", &cval));
     WT_ERR(__wt_strndup(session, cval.str, cval.len, &idx->key_format));
 
+    /*
+     * Compatibility: we didn't always support included columns in index metadata, cope when they
+     * aren't found.
+     */
+    WT_CLEAR(idx->includeconf);
+    WT_ERR_NOTFOUND_OK(__wt_config_getones(session, idx->config, "include", &idx->includeconf));
+    if (idx->includeconf.len != 0) {
+        WT_ERR(__wt_config_getones(session, idx->config, "value_format", &cval));
+        WT_ERR(__wt_strndup(session, cval.str, cval.len, &idx->include_format));
+    }
+
     /*
      * The key format for an index is somewhat subtle: the application
      * specifies a set of columns that it will use for the key, but the
@@ -205,6 +216,13 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
     WT_ERR(__wt_struct_plan(session, table, buf->data, buf->size, false, plan));
     WT_ERR(__wt_strndup(session, plan->data, plan->size, &idx->key_plan));
 
+    /*
+     * Remember the columns in the index file's key: index cursors can return them without reading
+     * the table. The column names are unknown if the index has a custom extractor.
+     */
+    if (idx->extractor == NULL)
+        WT_ERR(__wt_strndup(session, buf->data, buf->size, &idx->key_columns));
+
     /* Set up the cursor key format (the visible columns). */
     WT_ERR(__wt_buf_init(session, buf, 0));
     WT_ERR(__wt_struct_truncate(session, idx->key_format, npublic_cols, buf));
@@ -218,11 +236,18 @@ __open_index(WT_SESSION_IMPL *session, WT_TABLE *table, WT_INDEX *idx)
     WT_ERR(__wt_strndup(session, buf->data, buf->size, &idx->exkey_format));
 
     /* By default, index cursor values are the table value columns. */
-    /* TODO Optimize to use index columns in preference to table lookups. */
     WT_ERR(__wt_buf_init(session, plan, 0));
     WT_ERR(__wt_struct_plan(session, table, table->colconf.str, table->colconf.len, true, plan));
     WT_ERR(__wt_strndup(session, plan->data, plan->size, &idx->value_plan));
 
+    /* Included columns are projected from the table into the index value. */
+    if (idx->includeconf.len != 0) {
+        WT_ERR(__wt_buf_init(session, plan, 0));
+        WT_ERR(__wt_struct_plan(
+          session, table, idx->includeconf.str, idx->includeconf.len, false, plan));
+        WT_ERR(__wt_strndup(session, plan->data, plan->size, &idx->include_plan));
+    }
+
 err:
     __wt_scr_free(session, &buf);
     __wt_scr_free(session, &plan);
@@ -416,6 +441,10 @@ __schema_open_table(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RET(__wt_config_gets(session, table_cfg, "value_format", &cval));
     WT_RET(__wt_strndup(session, cval.str, cval.len, &table->value_format));
 
+    /* Compile the formats once, for the table's cursors. */
+    WT_RET(__wt_pack_format_compile(session, table->key_format, &table->key_pack));
+    WT_RET(__wt_pack_format_compile(session, table->value_format, &table->value_pack));
+
     /* Point to some items in the copy to save re-parsing. */
     WT_RET(__wt_config_gets(session, table_cfg, "columns", &table->colconf));
 
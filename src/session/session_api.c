@@ -116,6 +116,46 @@ __wt_session_cursor_cache_sweep(WT_SESSION_IMPL *session)
     return (ret);
 }
 
+/*
+ * __session_cursor_cache_close_dead --
+ *     Close all cached cursors that can't be reopened.
+ */
+static int
+__session_cursor_cache_close_dead(WT_SESSION_IMPL *session)
+{
+    WT_CURSOR *cursor, *cursor_tmp;
+    WT_DECL_RET;
+    int i, t_ret, nexamined, nclosed;
+
+    if (!F_ISSET(session, WT_SESSION_CACHE_CURSORS))
+        return (0);
+
+    nexamined = nclosed = 0;
+
+    /* Turn off caching so that cursor close doesn't try to cache. */
+    F_CLR(session, WT_SESSION_CACHE_CURSORS);
+    for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
+        TAILQ_FOREACH_SAFE(cursor, &session->cursor_cache[i], q, cursor_tmp)
+        {
+            ++nexamined;
+            t_ret = cursor->reopen(cursor, true);
+            if (t_ret != 0) {
+                WT_TRET_NOTFOUND_OK(t_ret);
+                WT_TRET_NOTFOUND_OK(cursor->reopen(cursor, false));
+                WT_TRET(cursor->close(cursor));
+                ++nclosed;
+            }
+        }
+    F_SET(session, WT_SESSION_CACHE_CURSORS);
+
+    WT_STAT_CONN_INCR(session, cursor_sweep);
+    WT_STAT_CONN_INCRV(session, cursor_sweep_buckets, WT_HASH_ARRAY_SIZE);
+    WT_STAT_CONN_INCRV(session, cursor_sweep_examined, nexamined);
+    WT_STAT_CONN_INCRV(session, cursor_sweep_closed, nclosed);
+
+    return (ret);
+}
+
 /*
  * __wt_session_copy_values --
  *     Copy values into all positioned cursors, so that they don't keep transaction IDs pinned.
@@ -223,7 +263,7 @@ __session_close_cursors(WT_SESSION_IMPL *session, WT_CURSOR_LIST *cursors)
              */
             WT_TRET_NOTFOUND_OK(cursor->reopen(cursor, false));
         else if (session->event_handler->handle_close != NULL &&
-          strcmp(cursor->internal_uri, WT_LAS_URI) != 0)
+          !WT_IS_LAS_URI(cursor->internal_uri))
             /*
              * Notify the user that we are closing the cursor handle via the registered close
              * callback.
@@ -263,9 +303,12 @@ __session_close(WT_SESSION *wt_session, const char *config)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
+    int i;
+    bool park;
 
     conn = (WT_CONNECTION_IMPL *)wt_session->connection;
     session = (WT_SESSION_IMPL *)wt_session;
+    park = false;
 
     SESSION_API_CALL_PREPARE_ALLOWED(session, close, config, cfg);
     WT_UNUSED(cfg);
@@ -285,7 +328,21 @@ __session_close(WT_SESSION *wt_session, const char *config)
 
     /* Close all open cursors. */
     WT_TRET(__session_close_cursors(session, &session->cursors));
-    WT_TRET(__session_close_cached_cursors(session));
+
+    /*
+     * If configured, application sessions leave their cached cursors in the session slot for the
+     * next session opened in the slot. The cursors hold their own data handle references, they
+     * don't depend on anything discarded when the session is cleared.
+     */
+    if (ret == 0 && F_ISSET(conn, WT_CONN_CURSOR_POOL) && !F_ISSET(conn, WT_CONN_CLOSING) &&
+      !F_ISSET(session, WT_SESSION_INTERNAL))
+        for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
+            if (!TAILQ_EMPTY(&session->cursor_cache[i])) {
+                park = true;
+                break;
+            }
+    if (!park)
+        WT_TRET(__session_close_cached_cursors(session));
 
     WT_ASSERT(session, session->ncursors == 0);
 
@@ -324,6 +381,11 @@ __session_close(WT_SESSION *wt_session, const char *config)
     /* Decrement the count of open sessions. */
     WT_STAT_CONN_DECR(session, session_open);
 
+    if (park) {
+        session->cursor_cache_parked = true;
+        ++conn->session_parked;
+    }
+
     /*
      * Sessions are re-used, clear the structure: the clear sets the active
      * field to 0, which will exclude the hazard array from review by the
@@ -1039,6 +1101,10 @@ __session_drop(WT_SESSION *wt_session, const char *uri, const char *config)
                                                        ret = __wt_schema_drop(session, uri, cfg)));
     }
 
+    /* Close cursors closed sessions left on the dropped object. */
+    if (ret == 0 && S2C(session)->session_parked > 0)
+        ret = __wt_session_parked_sweep(session);
+
 err:
     if (ret != 0)
         WT_STAT_CONN_INCR(session, session_table_drop_fail);
@@ -1168,7 +1234,8 @@ __session_join(
         cindex = (WT_CURSOR_INDEX *)ref_cursor;
         idx = cindex->index;
         table = cindex->table;
-        firstcg = cindex->cg_cursors[0];
+        /* Index-only cursors don't open the column groups, check the index position. */
+        firstcg = cindex->index_only ? cindex->child : cindex->cg_cursors[0];
     } else if (WT_PREFIX_MATCH(ref_cursor->uri, "table:")) {
         idx = NULL;
         ctable = (WT_CURSOR_TABLE *)ref_cursor;
@@ -1636,6 +1703,7 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
     WT_TXN *txn;
+    uint64_t time_start, time_stop;
 
     session = (WT_SESSION_IMPL *)wt_session;
     SESSION_API_CALL_PREPARE_ALLOWED(session, commit_transaction, config, cfg);
@@ -1654,9 +1722,12 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
           txn->rollback_reason == NULL ? "" : ": ",
           txn->rollback_reason == NULL ? "" : txn->rollback_reason);
 
-    if (ret == 0)
+    if (ret == 0) {
+        time_start = __wt_clock(session);
         ret = __wt_txn_commit(session, cfg);
-    else {
+        time_stop = __wt_clock(session);
+        WT_STAT_CONN_LAT_HIST_INCR(session, lat_txn_commit, WT_CLOCKDIFF_US(time_stop, time_start));
+    } else {
         WT_TRET(__wt_session_reset_cursors(session, false));
         WT_TRET(__wt_txn_rollback(session, cfg));
     }
@@ -2066,11 +2137,12 @@ __wt_session_breakpoint(WT_SESSION *wt_session)
 
 /*
  * __open_session --
- *     Allocate a session handle.
+ *     Allocate a session handle, optionally in a specific slot holding cursors left by a closed
+ *     session.
  */
 static int
 __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const char *config,
-  WT_SESSION_IMPL **sessionp)
+  WT_SESSION_IMPL *parked, WT_SESSION_IMPL **sessionp)
 {
     static const WT_SESSION
       stds = {NULL, NULL, __session_close, __session_reconfigure, __wt_session_strerror,
@@ -2110,10 +2182,24 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
      */
     WT_ASSERT(session, !F_ISSET(conn, WT_CONN_CLOSING));
 
-    /* Find the first inactive session slot. */
-    for (session_ret = conn->sessions, i = 0; i < conn->session_size; ++session_ret, ++i)
-        if (!session_ret->active)
-            break;
+    /*
+     * Find the first inactive session slot, preferring a slot where a closed session left cached
+     * cursors. If asked for a specific slot, there's nothing to do if another session took it over.
+     */
+    i = conn->session_size;
+    if (parked != NULL) {
+        if (parked->active || !parked->cursor_cache_parked)
+            goto err;
+        session_ret = parked;
+        i = (uint32_t)(parked - conn->sessions);
+    } else if (conn->session_parked > 0)
+        for (session_ret = conn->sessions, i = 0; i < conn->session_size; ++session_ret, ++i)
+            if (!session_ret->active && session_ret->cursor_cache_parked)
+                break;
+    if (i == conn->session_size)
+        for (session_ret = conn->sessions, i = 0; i < conn->session_size; ++session_ret, ++i)
+            if (!session_ret->active)
+                break;
     if (i == conn->session_size)
         WT_ERR_MSG(session, WT_ERROR, "out of sessions, configured for %" PRIu32
                                       " (including "
@@ -2156,9 +2242,13 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
     for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
         TAILQ_INIT(&session_ret->dhhash[i]);
 
-    /* Initialize the cursor cache hash buckets and sweep trigger. */
-    for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
-        TAILQ_INIT(&session_ret->cursor_cache[i]);
+    /*
+     * Initialize the cursor cache hash buckets and sweep trigger. If a closed session left cached
+     * cursors in this slot, take them over instead.
+     */
+    if (!session_ret->cursor_cache_parked)
+        for (i = 0; i < WT_HASH_ARRAY_SIZE; i++)
+            TAILQ_INIT(&session_ret->cursor_cache[i]);
     session_ret->cursor_sweep_countdown = WT_SESSION_CURSOR_SWEEP_COUNTDOWN;
 
     /* Initialize transaction support: default to read-committed. */
@@ -2198,6 +2288,12 @@ __open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const
     if (config != NULL)
         WT_ERR(__session_reconfigure((WT_SESSION *)session_ret, config));
 
+    /* The session owns any cursors left in the slot. */
+    if (session_ret->cursor_cache_parked) {
+        session_ret->cursor_cache_parked = false;
+        --conn->session_parked;
+    }
+
     /*
      * Publish: make the entry visible to server threads. There must be a barrier for two reasons,
      * to ensure structure fields are set before any other thread will consider the session, and to
@@ -2215,6 +2311,39 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_session_parked_sweep --
+ *     Close the cursors closed sessions left in their slots on data handles that are dead or have
+ *     been closed, the cursors would otherwise keep the handles from being discarded.
+ */
+int
+__wt_session_parked_sweep(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *s;
+    uint32_t i;
+
+    conn = S2C(session);
+
+    /*
+     * Take over each slot holding cursors in turn: the cursors can only be used from their own
+     * session. Closing the session leaves the remaining cursors in the slot again.
+     */
+    for (i = 0; i < conn->session_size && conn->session_parked > 0; ++i) {
+        if (!F_ISSET(conn, WT_CONN_CURSOR_POOL))
+            break;
+        WT_TRET(__open_session(conn, NULL, NULL, &conn->sessions[i], &s));
+        if (s == NULL)
+            continue;
+        wt_session = &s->iface;
+        WT_TRET(__session_cursor_cache_close_dead(s));
+        WT_TRET(wt_session->close(wt_session, NULL));
+    }
+    return (ret);
+}
+
 /*
  * __wt_open_session --
  *     Allocate a session handle.
@@ -2230,7 +2359,7 @@ __wt_open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, con
     *sessionp = NULL;
 
     /* Acquire a session. */
-    WT_RET(__open_session(conn, event_handler, config, &session));
+    WT_RET(__open_session(conn, event_handler, config, NULL, &session));
 
     /*
      * Acquiring the metadata handle requires the schema lock; we've seen problems in the past where
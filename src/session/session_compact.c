@@ -182,6 +182,10 @@ __wt_session_compact_check_timeout(WT_SESSION_IMPL *session)
 {
     struct timespec end;
 
+    /* The background compaction server gives up as soon as it's told to stop. */
+    if (session == S2C(session)->compact_session && !F_ISSET(S2C(session), WT_CONN_SERVER_COMPACT))
+        return (ECANCELED);
+
     if (session->compact->max_time == 0)
         return (0);
 
@@ -14,6 +14,12 @@
  * replace an object in memory replaces the object and increments the object's generation. Once no
  * threads have the previous generation published, it is safe to discard the previous version of the
  * object.
+ *
+ * Finding the oldest generation in use means reviewing every session. To amortize that work, the
+ * connection caches a lower bound on the oldest generation any session is in, or will enter. Once
+ * true, the bound stays true: sessions leave generations, and only enter the current generation.
+ * Draining threads and sessions discarding stashed memory check the cached bound first, and update
+ * it whenever they do review the sessions.
  */
 
 /*
@@ -29,7 +35,7 @@ __wt_gen_init(WT_SESSION_IMPL *session)
      * All generations start at 1, a session with a generation of 0 isn't using the resource.
      */
     for (i = 0; i < WT_GENERATIONS; ++i)
-        S2C(session)->generations[i] = 1;
+        S2C(session)->generations[i] = S2C(session)->gen_oldest[i] = 1;
 
     /* Ensure threads see the state change. */
     WT_WRITE_BARRIER();
@@ -55,6 +61,36 @@ __wt_gen_next(WT_SESSION_IMPL *session, int which)
     return (__wt_atomic_addv64(&S2C(session)->generations[which], 1));
 }
 
+/*
+ * __gen_oldest_bound --
+ *     Return the cached lower bound on the oldest generation in use for the resource.
+ */
+static inline uint64_t
+__gen_oldest_bound(WT_SESSION_IMPL *session, int which)
+{
+    uint64_t v;
+
+    WT_ORDERED_READ(v, S2C(session)->gen_oldest[which]);
+    return (v);
+}
+
+/*
+ * __gen_oldest_bound_set --
+ *     Raise the cached lower bound on the oldest generation in use for the resource.
+ */
+static inline void
+__gen_oldest_bound_set(WT_SESSION_IMPL *session, int which, uint64_t generation)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint64_t v;
+
+    conn = S2C(session);
+    for (v = __gen_oldest_bound(session, which); v < generation;
+         v = __gen_oldest_bound(session, which))
+        if (__wt_atomic_cas64(&conn->gen_oldest[which], v, generation))
+            break;
+}
+
 /*
  * __wt_gen_next_drain --
  *     Switch the resource to its next generation, then wait for it to drain.
@@ -84,6 +120,10 @@ __wt_gen_drain(WT_SESSION_IMPL *session, int which, uint64_t generation)
 
     conn = S2C(session);
 
+    /* If no session can be in an older generation, there's nothing to wait for. */
+    if (__gen_oldest_bound(session, which) >= generation)
+        return;
+
     /*
      * No lock is required because the session array is fixed size, but it may contain inactive
      * entries. We must review any active session, so insert a read barrier after reading the active
@@ -125,6 +165,12 @@ __wt_gen_drain(WT_SESSION_IMPL *session, int which, uint64_t generation)
                 __wt_sleep(0, 10);
         }
     }
+
+    /*
+     * Every session is now in the argument generation or a newer one, and sessions can only enter
+     * the current generation: save other threads the review.
+     */
+    __gen_oldest_bound_set(session, which, generation);
 }
 
 /*
@@ -136,7 +182,7 @@ __gen_oldest(WT_SESSION_IMPL *session, int which)
 {
     WT_CONNECTION_IMPL *conn;
     WT_SESSION_IMPL *s;
-    uint64_t oldest, v;
+    uint64_t current, oldest, v;
     uint32_t i, session_cnt;
 
     conn = S2C(session);
@@ -148,8 +194,8 @@ __gen_oldest(WT_SESSION_IMPL *session, int which)
      * the sessions that could have been active when we started our check.
      */
     WT_ORDERED_READ(session_cnt, conn->session_cnt);
-    for (oldest = conn->generations[which] + 1, s = conn->sessions, i = 0; i < session_cnt;
-         ++s, ++i) {
+    WT_ORDERED_READ(current, conn->generations[which]);
+    for (oldest = current + 1, s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
         if (!s->active)
             continue;
 
@@ -160,6 +206,12 @@ __gen_oldest(WT_SESSION_IMPL *session, int which)
             oldest = v;
     }
 
+    /*
+     * Sessions can still enter the current generation, so the current generation caps the bound
+     * other threads can rely on.
+     */
+    __gen_oldest_bound_set(session, which, WT_MIN(oldest, current));
+
     return (oldest);
 }
 
@@ -177,6 +229,10 @@ __wt_gen_active(WT_SESSION_IMPL *session, int which, uint64_t generation)
 
     conn = S2C(session);
 
+    /* No session can be in a generation older than the bound. */
+    if (__gen_oldest_bound(session, which) > generation)
+        return (false);
+
     /*
      * No lock is required because the session array is fixed size, but it may contain inactive
      * entries. We must review any active session, so insert a read barrier after reading the active
@@ -258,13 +314,15 @@ __stash_discard(WT_SESSION_IMPL *session, int which)
     WT_SESSION_STASH *session_stash;
     WT_STASH *stash;
     size_t i;
-    uint64_t oldest;
+    uint64_t current, oldest;
+    bool scanned;
 
     conn = S2C(session);
     session_stash = &session->stash[which];
 
-    /* Get the resource's oldest generation. */
-    oldest = __gen_oldest(session, which);
+    /* Start with the resource's cached oldest generation, it's free. */
+    oldest = __gen_oldest_bound(session, which);
+    scanned = false;
 
     for (i = 0, stash = session_stash->list; i < session_stash->cnt; ++i, ++stash) {
         if (stash->p == NULL)
@@ -272,9 +330,28 @@ __stash_discard(WT_SESSION_IMPL *session, int which)
         /*
          * The list is expected to be in generation-sorted order, quit as soon as we find a object
          * we can't discard.
+         *
+         * If the cached generation isn't enough, review the sessions for the resource's oldest
+         * generation. Review whenever the resource generation has changed since our last review,
+         * and whenever the object is older than the generation at our last review: only threads
+         * lingering in older generations hold it, and they can leave at any time. Otherwise the
+         * object was stashed in the current generation and it's usually the generation moving on
+         * that frees it, only review again once a batch of objects has been stashed: reviewing
+         * every session on every call is expensive.
          */
-        if (stash->gen >= oldest)
-            break;
+        if (stash->gen >= oldest) {
+            if (scanned)
+                break;
+            current = __wt_gen(session, which);
+            if (session_stash->scan_gen == current && stash->gen >= current &&
+              session_stash->cnt < session_stash->scan_cnt + WT_STASH_SCAN_BATCH)
+                break;
+            oldest = __gen_oldest(session, which);
+            scanned = true;
+            session_stash->scan_gen = current;
+            if (stash->gen >= oldest)
+                break;
+        }
 
         (void)__wt_atomic_sub64(&conn->stashed_bytes, stash->len);
         (void)__wt_atomic_sub64(&conn->stashed_objects, 1);
@@ -292,6 +369,8 @@ __stash_discard(WT_SESSION_IMPL *session, int which)
     if (i > 100 || i == session_stash->cnt)
         if ((session_stash->cnt -= i) > 0)
             memmove(session_stash->list, stash, session_stash->cnt * sizeof(*stash));
+    if (scanned || session_stash->scan_cnt > session_stash->cnt)
+        session_stash->scan_cnt = session_stash->cnt;
 }
 
 /*
@@ -374,6 +453,6 @@ __wt_stash_discard_all(WT_SESSION_IMPL *session_safe, WT_SESSION_IMPL *session)
             __wt_free(session_safe, stash->p);
 
         __wt_free(session_safe, session_stash->list);
-        session_stash->cnt = session_stash->alloc = 0;
+        session_stash->cnt = session_stash->alloc = session_stash->scan_cnt = 0;
     }
 }
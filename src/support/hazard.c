@@ -12,6 +12,19 @@
 static void __hazard_dump(WT_SESSION_IMPL *);
 #endif
 
+/*
+ * hazard_filter --
+ *     Return the session's hazard filter count for a page.
+ */
+static inline uint32_t *
+hazard_filter(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_HAZARD_FILTER *filter;
+
+    filter = &S2C(session)->hazard_filter[WT_HAZARD_FILTER_SHARD(session)];
+    return (&filter->count[WT_HAZARD_FILTER_SLOT(ref)]);
+}
+
 /*
  * hazard_grow --
  *     Grow a hazard pointer array.
@@ -134,7 +147,12 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, bool *busyp
      * pointer before it discards the page (the eviction server sets the
      * state to WT_REF_LOCKED, then flushes memory and checks the hazard
      * pointers).
+     *
+     * Count the hazard pointer in the filter before publishing it: if the
+     * eviction server doesn't see the count, it can't see the hazard
+     * pointer either, and we'll see the page's locked state.
      */
+    (void)__wt_atomic_add32(hazard_filter(session, ref), 1);
     hp->ref = ref;
 #ifdef HAVE_DIAGNOSTIC
     hp->func = func;
@@ -170,6 +188,7 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, bool *busyp
      * prevent some random page from being evicted.
      */
     hp->ref = NULL;
+    (void)__wt_atomic_sub32(hazard_filter(session, ref), 1);
     *busyp = true;
     return (0);
 }
@@ -198,6 +217,7 @@ __wt_hazard_clear(WT_SESSION_IMPL *session, WT_REF *ref)
              * selected for eviction.
              */
             hp->ref = NULL;
+            (void)__wt_atomic_sub32(hazard_filter(session, ref), 1);
 
             /*
              * If this was the last hazard pointer in the session,
@@ -261,6 +281,7 @@ __wt_hazard_close(WT_SESSION_IMPL *session)
      */
     for (hp = session->hazard; hp < session->hazard + session->hazard_inuse; ++hp)
         if (hp->ref != NULL) {
+            (void)__wt_atomic_sub32(hazard_filter(session, hp->ref), 1);
             hp->ref = NULL;
             --session->nhazard;
         }
@@ -305,7 +326,7 @@ __wt_hazard_check(WT_SESSION_IMPL *session, WT_REF *ref, WT_SESSION_IMPL **sessi
     WT_CONNECTION_IMPL *conn;
     WT_HAZARD *hp;
     WT_SESSION_IMPL *s;
-    uint32_t i, j, hazard_inuse, max, session_cnt, walk_cnt;
+    uint32_t i, j, count, hazard_inuse, max, session_cnt, slot, walk_cnt;
 
     /* If a file can never be evicted, hazard pointers aren't required. */
     if (F_ISSET(S2BT(session), WT_BTREE_IN_MEMORY))
@@ -315,6 +336,21 @@ __wt_hazard_check(WT_SESSION_IMPL *session, WT_REF *ref, WT_SESSION_IMPL **sessi
 
     WT_STAT_CONN_INCR(session, cache_hazard_checks);
 
+    /*
+     * Check the hazard filter: if no session has counted a hazard pointer in the page's slot, there
+     * can't be a hazard pointer to the page, and there's no reason to walk the sessions. Our caller
+     * has locked the page, flushing memory, so any hazard pointer set after we read the counts will
+     * see the page's locked state and be backed out. The cost of the check depends on the number of
+     * shards, not the number of sessions.
+     */
+    slot = WT_HAZARD_FILTER_SLOT(ref);
+    for (count = 0, i = 0; i < WT_HAZARD_FILTER_SHARDS; ++i)
+        count += conn->hazard_filter[i].count[slot];
+    if (count == 0) {
+        WT_STAT_CONN_INCR(session, cache_hazard_filtered);
+        return (NULL);
+    }
+
     /*
      * Hazard pointer arrays might grow and be freed underneath us; enter the current hazard
      * resource generation for the duration of the walk to ensure that doesn't happen.
@@ -360,6 +396,50 @@ done:
     return (hp);
 }
 
+/*
+ * __wt_hazard_check_exclusive --
+ *     Return if the session's own hazard pointers are the only ones to a page. Our caller has
+ *     locked the page.
+ */
+bool
+__wt_hazard_check_exclusive(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_HAZARD *hp;
+    WT_SESSION_IMPL *s;
+    uint32_t count, hazard_inuse, i, j, session_cnt, slot;
+    bool exclusive;
+
+    conn = S2C(session);
+
+    /* If the filter only counts our own hazard pointers, there's no reason to walk the sessions. */
+    slot = WT_HAZARD_FILTER_SLOT(ref);
+    for (count = 0, i = 0; i < WT_HAZARD_FILTER_SHARDS; ++i)
+        count += conn->hazard_filter[i].count[slot];
+    if (count == __wt_hazard_count(session, ref))
+        return (true);
+
+    /* Otherwise, check the other sessions as __wt_hazard_check does. */
+    __wt_session_gen_enter(session, WT_GEN_HAZARD);
+
+    exclusive = true;
+    WT_ORDERED_READ(session_cnt, conn->session_cnt);
+    for (s = conn->sessions, i = 0; exclusive && i < session_cnt; ++s, ++i) {
+        if (!s->active || s == session)
+            continue;
+
+        hazard_get_reference(s, &hp, &hazard_inuse);
+        for (j = 0; j < hazard_inuse; ++hp, ++j)
+            if (hp->ref == ref) {
+                exclusive = false;
+                break;
+            }
+    }
+
+    __wt_session_gen_leave(session, WT_GEN_HAZARD);
+    return (exclusive);
+}
+
 /*
  * __wt_hazard_count --
  *     Count how many hazard pointers this session has on the given page.
@@ -63,6 +63,20 @@ typedef struct __wt_huffman_code {
     uint8_t length;
 } WT_HUFFMAN_CODE;
 
+/*
+ * Multi-symbol decoding table. The table is indexed by the next WT_HUFFMAN_MULTI_BITS bits of
+ * input, each entry holds the symbols whose codes fit entirely in those bits, so a single lookup
+ * decodes several short codes at once. Entries where the first code is longer than the index
+ * have a count of 0, and are decoded a symbol at a time.
+ */
+#define WT_HUFFMAN_MULTI_BITS 12
+#define WT_HUFFMAN_MULTI_SYMBOLS 6
+typedef struct {
+    uint8_t symbol[WT_HUFFMAN_MULTI_SYMBOLS];
+    uint8_t count; /* Symbols in the entry */
+    uint8_t bits;  /* Bits used by the symbols */
+} WT_HUFFMAN_MULTI;
+
 typedef struct __wt_huffman_obj {
     /*
      * Data structure here defines specific instance of the encoder/decoder.
@@ -82,6 +96,12 @@ typedef struct __wt_huffman_obj {
      * max_code_length]
      */
     uint8_t *code2symbol;
+
+    /*
+     * use: multi[next WT_HUFFMAN_MULTI_BITS of input] = symbols decoded. Used in decoding. memory:
+     * multi[1 << WT_HUFFMAN_MULTI_BITS]
+     */
+    WT_HUFFMAN_MULTI *multi;
 } WT_HUFFMAN_OBJ;
 
 /*
@@ -116,6 +136,7 @@ typedef struct __indexed_byte {
 
 static int WT_CDECL indexed_freq_compare(const void *, const void *);
 static int WT_CDECL indexed_symbol_compare(const void *, const void *);
+static void make_multi_table(WT_HUFFMAN_OBJ *);
 static void make_table(WT_SESSION_IMPL *, uint8_t *, uint16_t, WT_HUFFMAN_CODE *, u_int);
 static void node_queue_close(WT_SESSION_IMPL *, NODE_QUEUE *);
 static void node_queue_dequeue(WT_SESSION_IMPL *, NODE_QUEUE *, WT_FREQTREE_NODE **);
@@ -274,6 +295,42 @@ make_table(WT_SESSION_IMPL *session, uint8_t *code2symbol, uint16_t max_depth,
     }
 }
 
+/*
+ * make_multi_table --
+ *     Computes the multi-symbol decoding table: for every possible WT_HUFFMAN_MULTI_BITS bits of
+ *     input, decode codes from the single-symbol table until the next code doesn't fit in the bits
+ *     remaining or the entry is full.
+ */
+static void
+make_multi_table(WT_HUFFMAN_OBJ *huffman)
+{
+    WT_HUFFMAN_MULTI *e;
+    uint32_t i, pattern;
+    uint16_t max;
+    uint8_t len, remain, symbol;
+
+    max = huffman->max_depth;
+    for (i = 0; i < (1U << WT_HUFFMAN_MULTI_BITS); i++) {
+        e = &huffman->multi[i];
+        for (remain = WT_HUFFMAN_MULTI_BITS; e->count < WT_HUFFMAN_MULTI_SYMBOLS;) {
+            /*
+             * Take the next max-depth bits of the index, or the bits remaining with zeroes below
+             * them: codes are unique prefixes, so if the code found fits in the remaining bits, the
+             * fill bits don't matter.
+             */
+            pattern = i & ((1U << remain) - 1);
+            pattern = remain >= max ? pattern >> (remain - max) : pattern << (max - remain);
+            symbol = huffman->code2symbol[pattern];
+            len = huffman->codes[symbol].length;
+            if (len == 0 || len > remain)
+                break;
+            e->symbol[e->count++] = symbol;
+            e->bits += len;
+            remain -= len;
+        }
+    }
+}
+
 /*
  * recursive_free_node --
  *     Recursively free the huffman frequency tree's nodes.
@@ -453,6 +510,9 @@ __wt_huffman_open(
     make_table(
       session, huffman->code2symbol, huffman->max_depth, huffman->codes, huffman->numSymbols);
 
+    WT_ERR(__wt_calloc_def(session, (size_t)1U << WT_HUFFMAN_MULTI_BITS, &huffman->multi));
+    make_multi_table(huffman);
+
 #if __HUFFMAN_DETAIL
     {
         uint8_t symbol;
@@ -512,6 +572,7 @@ __wt_huffman_close(WT_SESSION_IMPL *session, void *huffman_arg)
 
     __wt_free(session, huffman->code2symbol);
     __wt_free(session, huffman->codes);
+    __wt_free(session, huffman->multi);
     __wt_free(session, huffman);
 }
 
@@ -568,13 +629,14 @@ __wt_huffman_encode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *
     const uint8_t *from;
 
     /*
-     * Shift register to accumulate bits from input. Should be >= (MAX_CODE_LENGTH + 7), but also
-     * efficient to shift bits and preferably in a machine register.
+     * Shift register to accumulate bits from input. Should be >= (MAX_CODE_LENGTH + 31) so it can
+     * hold a full 32-bit word plus the next code, and efficient to shift bits in a machine
+     * register.
      */
-    uint32_t bits;
+    uint64_t bits;
 
     /* Count of bits in shift register ('bits' above). */
-    uint8_t valid;
+    u_int valid;
 
     huffman = huffman_arg;
     from = from_arg;
@@ -619,12 +681,23 @@ __wt_huffman_encode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *
         bits = (bits << len) | code.pattern;
         valid += len;
         bitpos += len;
-        while (valid >= 8) {
-            WT_ASSERT(session, WT_PTR_IN_RANGE(out, tmp->mem, tmp->memsize));
-            *out++ = (uint8_t)(bits >> (valid - 8));
-            valid -= 8;
+
+        /* Drain the shift register a 32-bit word at a time. */
+        if (valid >= 32) {
+            WT_ASSERT(session, WT_BLOCK_FITS(out, 4, tmp->mem, tmp->memsize));
+            valid -= 32;
+            out[0] = (uint8_t)(bits >> (valid + 24));
+            out[1] = (uint8_t)(bits >> (valid + 16));
+            out[2] = (uint8_t)(bits >> (valid + 8));
+            out[3] = (uint8_t)(bits >> valid);
+            out += 4;
         }
     }
+    while (valid >= 8) {
+        WT_ASSERT(session, WT_PTR_IN_RANGE(out, tmp->mem, tmp->memsize));
+        *out++ = (uint8_t)(bits >> (valid - 8));
+        valid -= 8;
+    }
     if (valid > 0) { /* Flush shift register. */
         WT_ASSERT(session, WT_PTR_IN_RANGE(out, tmp->mem, tmp->memsize));
         *out = (uint8_t)(bits << (8 - valid));
@@ -671,20 +744,25 @@ err:
  *     (code+1) << shift exclusive]. To decode a message, we read in enough bits from input to fill
  *     the shift register with at least MAX_CODE_LENGTH bits. We look up in the table code2symbol to
  *     obtain the symbol. We look up the symbol in 'codes' to obtain the code length Finally,
- *     subtract off these bits from the shift register.
+ *     subtract off these bits from the shift register. Before the single symbol lookup, we look up
+ *     the next WT_HUFFMAN_MULTI_BITS bits in the 'multi' table, which returns all of the symbols
+ *     whose codes fit in those bits: short codes are the common ones, so most lookups decode
+ *     several symbols.
  */
 int
 __wt_huffman_decode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *from_arg,
   size_t from_len, WT_ITEM *to_buf)
 {
     WT_DECL_RET;
+    WT_HUFFMAN_MULTI *e;
     WT_HUFFMAN_OBJ *huffman;
     WT_ITEM *tmp;
     size_t from_bytes, len, max_len, outlen;
-    uint64_t from_len_bits;
-    uint32_t bits, mask, max;
+    uint64_t bits, from_len_bits;
+    uint32_t mask, max, multi_mask;
+    u_int valid;
     uint16_t pattern;
-    uint8_t padding_info, symbol, *to, valid;
+    uint8_t padding_info, symbol, *to;
     const uint8_t *from;
 
     huffman = huffman_arg;
@@ -716,10 +794,11 @@ __wt_huffman_decode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *
      * Compute largest uncompressed output size, which is if all symbols are most frequent and so
      * have smallest Huffman codes and therefore largest expansion. Use the shared system buffer
      * while uncompressing, then allocate a new buffer of exactly the right size and copy the result
-     * into it.
+     * into it. Multi-symbol table entries are copied as a whole, leave room for a full entry past
+     * the end.
      */
     max_len = (uint32_t)(from_len_bits / huffman->min_depth);
-    WT_ERR(__wt_scr_alloc(session, max_len, &tmp));
+    WT_ERR(__wt_scr_alloc(session, max_len + WT_HUFFMAN_MULTI_SYMBOLS, &tmp));
     to = tmp->mem;
 
     /* The first byte of input is a special case because of header bits. */
@@ -729,19 +808,41 @@ __wt_huffman_decode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *
 
     max = huffman->max_depth;
     mask = (1U << max) - 1;
-    for (outlen = 0; from_len_bits > 0; outlen++) {
-        while (valid < max && from_bytes > 0) {
+    multi_mask = (1U << WT_HUFFMAN_MULTI_BITS) - 1;
+    while (from_len_bits > 0) {
+        /* Fill the shift register, it holds up to 7 bytes of input at a time. */
+        while (valid <= 56 && from_bytes > 0) {
             WT_ASSERT(session, WT_PTR_IN_RANGE(from, from_arg, from_len));
             bits = (bits << 8) | *from++;
             valid += 8;
             from_bytes--;
         }
+
+        /*
+         * Decode as many symbols as the multi-symbol table has for the next bits of input. Near the
+         * end of the input, the table entry may include symbols decoded from the zero fill below
+         * the last bits: that can't be the case if all of the entry's bits are input.
+         */
+        e = &huffman->multi[(valid >= WT_HUFFMAN_MULTI_BITS ?
+                                (bits >> (valid - WT_HUFFMAN_MULTI_BITS)) :
+                                (bits << (WT_HUFFMAN_MULTI_BITS - valid))) &
+          multi_mask];
+        if (e->count != 0 && e->bits <= from_len_bits) {
+            WT_ASSERT(session,
+              WT_BLOCK_FITS(to, WT_HUFFMAN_MULTI_SYMBOLS, tmp->mem, tmp->memsize));
+            memcpy(to, e->symbol, WT_HUFFMAN_MULTI_SYMBOLS);
+            to += e->count;
+            valid -= e->bits;
+            from_len_bits -= e->bits;
+            continue;
+        }
+
         pattern = (uint16_t)(valid >= max ? /* short patterns near end */
             (bits >> (valid - max)) :
             (bits << (max - valid)));
         symbol = huffman->code2symbol[pattern & mask];
         len = huffman->codes[symbol].length;
-        valid -= (uint8_t)len;
+        valid -= (u_int)len;
 
         /*
          * from_len_bits is the total number of input bits, reduced by the number of bits we consume
@@ -757,6 +858,7 @@ __wt_huffman_decode(WT_SESSION_IMPL *session, void *huffman_arg, const uint8_t *
         WT_ASSERT(session, WT_PTR_IN_RANGE(to, tmp->mem, tmp->memsize));
         *to++ = symbol;
     }
+    outlen = WT_PTRDIFF(to, tmp->mem);
 
     /* Return the number of bytes used. */
     WT_ERR(__wt_buf_initsize(session, to_buf, outlen));
@@ -84,10 +84,132 @@
  * after 256 requests. If a thread's write lock request would cause the 'next'
  * field to catch up with 'current', instead it waits to avoid the same ticket
  * being allocated to multiple threads.
+ *
+ * Reader-biased locks are inspired by "BRAVO - Biased Locking for Reader-Writer
+ * Locks" by Dave Dice and Alex Kogan. Every reader updating the lock word makes
+ * the lock's cache line a bottleneck for read-mostly locks. While a lock's
+ * reader bias is set, readers instead announce themselves in a slot owned by
+ * their session: each session has a handful of slots, hashed by lock address,
+ * padded to separate cache lines so readers in different sessions don't share
+ * them. A reader stores the lock's address in its slot, flushes memory
+ * and checks the bias is still set; if it isn't, it clears the slot and takes
+ * the lock as usual. A writer first takes the lock as usual, excluding other
+ * writers and readers that didn't use a slot, then clears the bias, flushes
+ * memory and waits until no session's slot for that hash references the lock.
+ * Clearing the bias is expensive, so it isn't set again (by a reader acquiring
+ * the lock the usual way) until a multiple of the time the writer waited has
+ * passed.
  */
 
 #include "wt_internal.h"
 
+/*
+ * __rwlock_reader_slot --
+ *     Return the session's reader slot for a lock, or NULL if the session doesn't have slots.
+ */
+static inline WT_RWLOCK **
+__rwlock_reader_slot(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+
+    /* The connection's default session during startup isn't in the session array. */
+    if (conn->rwlock_readers == NULL || session != &conn->sessions[session->id])
+        return (NULL);
+    return (&conn->rwlock_readers[session->id].slot[WT_RWLOCK_READER_SLOT(l)]);
+}
+
+/*
+ * __rwlock_read_bias_enter --
+ *     Try to enter a reader-biased lock without updating the lock word.
+ */
+static inline bool
+__rwlock_read_bias_enter(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    WT_RWLOCK **slot;
+
+    if (!l->read_bias || (slot = __rwlock_reader_slot(session, l)) == NULL || *slot != NULL)
+        return (false);
+
+    /* Publish the slot before checking the bias, a writer clears the bias before checking slots. */
+    *slot = l;
+    WT_FULL_BARRIER();
+    if (l->read_bias)
+        return (true);
+    *slot = NULL;
+    return (false);
+}
+
+/*
+ * __rwlock_read_bias_set --
+ *     A reader acquired the lock the usual way, set the reader bias if it's configured and enough
+ *     time has passed since a writer cleared it.
+ */
+static inline void
+__rwlock_read_bias_set(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    if (l->read_bias_config && !l->read_bias && __wt_clock(session) >= l->read_bias_inhibit)
+        l->read_bias = true;
+}
+
+/*
+ * __rwlock_read_bias_clear --
+ *     Clear a lock's reader bias, then wait for (or if not waiting, check for) readers that
+ *     entered the lock through their slots. Our caller holds the lock exclusive.
+ */
+static bool
+__rwlock_read_bias_clear(WT_SESSION_IMPL *session, WT_RWLOCK *l, bool wait)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_RWLOCK_READERS *readers;
+    uint64_t time_start, time_stop;
+    uint32_t i, session_cnt, slot;
+    int pause_cnt;
+
+    conn = S2C(session);
+
+    l->read_bias = false;
+    WT_FULL_BARRIER();
+
+    /*
+     * Sessions opened after we read the session count will see the cleared bias, no reader from a
+     * session past the count can be in the lock.
+     */
+    time_start = __wt_clock(session);
+    WT_ORDERED_READ(session_cnt, conn->session_cnt);
+    slot = WT_RWLOCK_READER_SLOT(l);
+    for (readers = conn->rwlock_readers, i = 0; i < session_cnt; ++readers, ++i)
+        for (pause_cnt = 0; readers->slot[slot] == l; pause_cnt++) {
+            /*
+             * If not waiting, restore the bias before giving up: the next writer must see it set
+             * and wait for readers still in the lock through their slots.
+             */
+            if (!wait) {
+                l->read_bias = true;
+                return (false);
+            }
+            if (pause_cnt < 1000)
+                WT_PAUSE();
+            else
+                __wt_yield();
+        }
+    time_stop = __wt_clock(session);
+
+    l->read_bias_inhibit = time_stop + (time_stop - time_start) * WT_RWLOCK_READ_BIAS_INHIBIT;
+    return (true);
+}
+
+/*
+ * __wt_rwlock_read_bias --
+ *     Configure a read/write lock to be reader-biased.
+ */
+void
+__wt_rwlock_read_bias(WT_RWLOCK *l)
+{
+    l->read_bias_config = l->read_bias = true;
+}
+
 /*
  * __wt_rwlock_init --
  *     Initialize a read/write lock.
@@ -98,6 +220,7 @@ __wt_rwlock_init(WT_SESSION_IMPL *session, WT_RWLOCK *l)
     l->u.v = 0;
     l->stat_read_count_off = l->stat_write_count_off = -1;
     l->stat_app_usecs_off = l->stat_int_usecs_off = -1;
+    l->stat_hist_off[0] = -1;
 
     WT_RET(__wt_cond_alloc(session, "rwlock wait", &l->cond_readers));
     WT_RET(__wt_cond_alloc(session, "rwlock wait", &l->cond_writers));
@@ -112,6 +235,7 @@ void
 __wt_rwlock_destroy(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 {
     l->u.v = 0;
+    l->read_bias_config = l->read_bias = false;
 
     __wt_cond_destroy(session, &l->cond_readers);
     __wt_cond_destroy(session, &l->cond_writers);
@@ -133,6 +257,9 @@ __wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
         stats[session->stat_bucket][l->stat_read_count_off]++;
     }
 
+    if (__rwlock_read_bias_enter(session, l))
+        return (0);
+
     old.u.v = l->u.v;
 
     /* This read lock can only be granted if there are no active writers. */
@@ -148,7 +275,10 @@ __wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
         return (__wt_set_return(session, EBUSY));
 
     /* We rely on this atomic operation to provide a barrier. */
-    return (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v) ? 0 : EBUSY);
+    if (!__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v))
+        return (EBUSY);
+    __rwlock_read_bias_set(session, l);
+    return (0);
 }
 
 /*
@@ -184,6 +314,10 @@ __wt_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 
     WT_DIAGNOSTIC_YIELD;
 
+    /* Fastest path: a reader-biased lock doesn't need the lock word. */
+    if (__rwlock_read_bias_enter(session, l))
+        return;
+
     for (;;) {
         /*
          * Fast path: if there is no active writer, join the current group.
@@ -196,8 +330,10 @@ __wt_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
              */
             if (++new.u.s.readers_active == 0)
                 goto stall;
-            if (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v))
+            if (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v)) {
+                __rwlock_read_bias_set(session, l);
                 return;
+            }
             WT_PAUSE();
         }
 
@@ -261,6 +397,7 @@ stall:
             stats[session->stat_bucket][l->stat_app_usecs_off] += (int64_t)time_diff;
         }
         session_stats[l->stat_session_usecs_off] += (int64_t)time_diff;
+        __wt_lock_hist_incr(session, l->stat_hist_off, time_diff);
     }
 
     /*
@@ -272,6 +409,8 @@ stall:
 
     /* Sanity check that we (still) have the lock. */
     WT_ASSERT(session, ticket == l->u.s.current && l->u.s.readers_active > 0);
+
+    __rwlock_read_bias_set(session, l);
 }
 
 /*
@@ -282,6 +421,17 @@ void
 __wt_readunlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 {
     WT_RWLOCK new, old;
+    WT_RWLOCK **slot;
+
+    /*
+     * If we entered through our slot, clear it. Only this session sets its slots, so if the slot
+     * references the lock, it's ours.
+     */
+    if (l->read_bias_config && (slot = __rwlock_reader_slot(session, l)) != NULL && *slot == l) {
+        WT_FULL_BARRIER();
+        *slot = NULL;
+        return;
+    }
 
     do {
         old.u.v = l->u.v;
@@ -337,7 +487,15 @@ __wt_try_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
      */
     new.u.v = old.u.v;
     new.u.s.next++;
-    return (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v) ? 0 : EBUSY);
+    if (!__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v))
+        return (EBUSY);
+
+    /* Give up if readers have entered through their slots. */
+    if (l->read_bias && !__rwlock_read_bias_clear(session, l, false)) {
+        __wt_writeunlock(session, l);
+        return (__wt_set_return(session, EBUSY));
+    }
+    return (0);
 }
 
 /*
@@ -419,6 +577,11 @@ __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
             __wt_cond_wait(session, l->cond_writers, 10 * WT_THOUSAND, __write_blocked);
         }
     }
+
+    /* Wait for any readers that entered through their slots. */
+    if (l->read_bias)
+        (void)__rwlock_read_bias_clear(session, l, true);
+
     if (set_stats) {
         time_stop = __wt_clock(session);
         time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
@@ -427,6 +590,7 @@ __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
         else
             stats[session->stat_bucket][l->stat_app_usecs_off] += (int64_t)time_diff;
         session_stats[l->stat_session_usecs_off] += (int64_t)time_diff;
+        __wt_lock_hist_incr(session, l->stat_hist_off, time_diff);
     }
 
     /*
@@ -487,11 +651,23 @@ __wt_writeunlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 bool
 __wt_rwlock_islocked(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 {
+    WT_CONNECTION_IMPL *conn;
     WT_RWLOCK old;
-
-    WT_UNUSED(session);
+    WT_RWLOCK_READERS *readers;
+    uint32_t i, slot;
 
     old.u.v = l->u.v;
-    return (old.u.s.current != old.u.s.next || old.u.s.readers_active != 0);
+    if (old.u.s.current != old.u.s.next || old.u.s.readers_active != 0)
+        return (true);
+
+    /* Check for readers that entered through their slots. */
+    conn = S2C(session);
+    if (!l->read_bias_config || conn->rwlock_readers == NULL)
+        return (false);
+    slot = WT_RWLOCK_READER_SLOT(l);
+    for (readers = conn->rwlock_readers, i = 0; i < conn->session_cnt; ++readers, ++i)
+        if (readers->slot[slot] == l)
+            return (true);
+    return (false);
 }
 #endif
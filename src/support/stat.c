@@ -455,171 +455,10 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
 void
 __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
 {
-    int64_t v;
+    WT_DSRC_STATS sum;
 
-    to->bloom_false_positive += WT_STAT_READ(from, bloom_false_positive);
-    to->bloom_hit += WT_STAT_READ(from, bloom_hit);
-    to->bloom_miss += WT_STAT_READ(from, bloom_miss);
-    to->bloom_page_evict += WT_STAT_READ(from, bloom_page_evict);
-    to->bloom_page_read += WT_STAT_READ(from, bloom_page_read);
-    to->bloom_count += WT_STAT_READ(from, bloom_count);
-    to->lsm_chunk_count += WT_STAT_READ(from, lsm_chunk_count);
-    if ((v = WT_STAT_READ(from, lsm_generation_max)) > to->lsm_generation_max)
-        to->lsm_generation_max = v;
-    to->lsm_lookup_no_bloom += WT_STAT_READ(from, lsm_lookup_no_bloom);
-    to->lsm_checkpoint_throttle += WT_STAT_READ(from, lsm_checkpoint_throttle);
-    to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
-    to->bloom_size += WT_STAT_READ(from, bloom_size);
-    to->block_extension += WT_STAT_READ(from, block_extension);
-    to->block_alloc += WT_STAT_READ(from, block_alloc);
-    to->block_free += WT_STAT_READ(from, block_free);
-    to->block_checkpoint_size += WT_STAT_READ(from, block_checkpoint_size);
-    if ((v = WT_STAT_READ(from, allocation_size)) > to->allocation_size)
-        to->allocation_size = v;
-    to->block_reuse_bytes += WT_STAT_READ(from, block_reuse_bytes);
-    if ((v = WT_STAT_READ(from, block_magic)) > to->block_magic)
-        to->block_magic = v;
-    if ((v = WT_STAT_READ(from, block_major)) > to->block_major)
-        to->block_major = v;
-    to->block_size += WT_STAT_READ(from, block_size);
-    if ((v = WT_STAT_READ(from, block_minor)) > to->block_minor)
-        to->block_minor = v;
-    to->btree_checkpoint_generation += WT_STAT_READ(from, btree_checkpoint_generation);
-    to->btree_column_fix += WT_STAT_READ(from, btree_column_fix);
-    to->btree_column_internal += WT_STAT_READ(from, btree_column_internal);
-    to->btree_column_rle += WT_STAT_READ(from, btree_column_rle);
-    to->btree_column_deleted += WT_STAT_READ(from, btree_column_deleted);
-    to->btree_column_variable += WT_STAT_READ(from, btree_column_variable);
-    if ((v = WT_STAT_READ(from, btree_fixed_len)) > to->btree_fixed_len)
-        to->btree_fixed_len = v;
-    if ((v = WT_STAT_READ(from, btree_maxintlkey)) > to->btree_maxintlkey)
-        to->btree_maxintlkey = v;
-    if ((v = WT_STAT_READ(from, btree_maxintlpage)) > to->btree_maxintlpage)
-        to->btree_maxintlpage = v;
-    if ((v = WT_STAT_READ(from, btree_maxleafkey)) > to->btree_maxleafkey)
-        to->btree_maxleafkey = v;
-    if ((v = WT_STAT_READ(from, btree_maxleafpage)) > to->btree_maxleafpage)
-        to->btree_maxleafpage = v;
-    if ((v = WT_STAT_READ(from, btree_maxleafvalue)) > to->btree_maxleafvalue)
-        to->btree_maxleafvalue = v;
-    if ((v = WT_STAT_READ(from, btree_maximum_depth)) > to->btree_maximum_depth)
-        to->btree_maximum_depth = v;
-    to->btree_entries += WT_STAT_READ(from, btree_entries);
-    to->btree_overflow += WT_STAT_READ(from, btree_overflow);
-    to->btree_compact_rewrite += WT_STAT_READ(from, btree_compact_rewrite);
-    to->btree_row_empty_values += WT_STAT_READ(from, btree_row_empty_values);
-    to->btree_row_internal += WT_STAT_READ(from, btree_row_internal);
-    to->btree_row_leaf += WT_STAT_READ(from, btree_row_leaf);
-    to->cache_bytes_inuse += WT_STAT_READ(from, cache_bytes_inuse);
-    to->cache_bytes_dirty_total += WT_STAT_READ(from, cache_bytes_dirty_total);
-    to->cache_bytes_read += WT_STAT_READ(from, cache_bytes_read);
-    to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
-    to->cache_eviction_checkpoint += WT_STAT_READ(from, cache_eviction_checkpoint);
-    to->cache_eviction_fail += WT_STAT_READ(from, cache_eviction_fail);
-    to->cache_eviction_walk_passes += WT_STAT_READ(from, cache_eviction_walk_passes);
-    to->cache_eviction_target_page_lt10 += WT_STAT_READ(from, cache_eviction_target_page_lt10);
-    to->cache_eviction_target_page_lt32 += WT_STAT_READ(from, cache_eviction_target_page_lt32);
-    to->cache_eviction_target_page_ge128 += WT_STAT_READ(from, cache_eviction_target_page_ge128);
-    to->cache_eviction_target_page_lt64 += WT_STAT_READ(from, cache_eviction_target_page_lt64);
-    to->cache_eviction_target_page_lt128 += WT_STAT_READ(from, cache_eviction_target_page_lt128);
-    to->cache_eviction_walks_abandoned += WT_STAT_READ(from, cache_eviction_walks_abandoned);
-    to->cache_eviction_walks_stopped += WT_STAT_READ(from, cache_eviction_walks_stopped);
-    to->cache_eviction_walks_gave_up_no_targets +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_no_targets);
-    to->cache_eviction_walks_gave_up_ratio +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_ratio);
-    to->cache_eviction_walks_ended += WT_STAT_READ(from, cache_eviction_walks_ended);
-    to->cache_eviction_walk_from_root += WT_STAT_READ(from, cache_eviction_walk_from_root);
-    to->cache_eviction_walk_saved_pos += WT_STAT_READ(from, cache_eviction_walk_saved_pos);
-    to->cache_eviction_hazard += WT_STAT_READ(from, cache_eviction_hazard);
-    to->cache_inmem_splittable += WT_STAT_READ(from, cache_inmem_splittable);
-    to->cache_inmem_split += WT_STAT_READ(from, cache_inmem_split);
-    to->cache_eviction_internal += WT_STAT_READ(from, cache_eviction_internal);
-    to->cache_eviction_split_internal += WT_STAT_READ(from, cache_eviction_split_internal);
-    to->cache_eviction_split_leaf += WT_STAT_READ(from, cache_eviction_split_leaf);
-    to->cache_eviction_dirty += WT_STAT_READ(from, cache_eviction_dirty);
-    to->cache_read_overflow += WT_STAT_READ(from, cache_read_overflow);
-    to->cache_eviction_deepen += WT_STAT_READ(from, cache_eviction_deepen);
-    to->cache_write_lookaside += WT_STAT_READ(from, cache_write_lookaside);
-    to->cache_read += WT_STAT_READ(from, cache_read);
-    to->cache_read_deleted += WT_STAT_READ(from, cache_read_deleted);
-    to->cache_read_deleted_prepared += WT_STAT_READ(from, cache_read_deleted_prepared);
-    to->cache_read_lookaside += WT_STAT_READ(from, cache_read_lookaside);
-    to->cache_pages_requested += WT_STAT_READ(from, cache_pages_requested);
-    to->cache_eviction_pages_seen += WT_STAT_READ(from, cache_eviction_pages_seen);
-    to->cache_write += WT_STAT_READ(from, cache_write);
-    to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
-    to->cache_bytes_dirty += WT_STAT_READ(from, cache_bytes_dirty);
-    to->cache_eviction_clean += WT_STAT_READ(from, cache_eviction_clean);
-    to->cache_state_gen_avg_gap += WT_STAT_READ(from, cache_state_gen_avg_gap);
-    to->cache_state_avg_written_size += WT_STAT_READ(from, cache_state_avg_written_size);
-    to->cache_state_avg_visited_age += WT_STAT_READ(from, cache_state_avg_visited_age);
-    to->cache_state_avg_unvisited_age += WT_STAT_READ(from, cache_state_avg_unvisited_age);
-    to->cache_state_pages_clean += WT_STAT_READ(from, cache_state_pages_clean);
-    to->cache_state_gen_current += WT_STAT_READ(from, cache_state_gen_current);
-    to->cache_state_pages_dirty += WT_STAT_READ(from, cache_state_pages_dirty);
-    to->cache_state_root_entries += WT_STAT_READ(from, cache_state_root_entries);
-    to->cache_state_pages_internal += WT_STAT_READ(from, cache_state_pages_internal);
-    to->cache_state_pages_leaf += WT_STAT_READ(from, cache_state_pages_leaf);
-    to->cache_state_gen_max_gap += WT_STAT_READ(from, cache_state_gen_max_gap);
-    to->cache_state_max_pagesize += WT_STAT_READ(from, cache_state_max_pagesize);
-    to->cache_state_min_written_size += WT_STAT_READ(from, cache_state_min_written_size);
-    to->cache_state_unvisited_count += WT_STAT_READ(from, cache_state_unvisited_count);
-    to->cache_state_smaller_alloc_size += WT_STAT_READ(from, cache_state_smaller_alloc_size);
-    to->cache_state_memory += WT_STAT_READ(from, cache_state_memory);
-    to->cache_state_queued += WT_STAT_READ(from, cache_state_queued);
-    to->cache_state_not_queueable += WT_STAT_READ(from, cache_state_not_queueable);
-    to->cache_state_refs_skipped += WT_STAT_READ(from, cache_state_refs_skipped);
-    to->cache_state_root_size += WT_STAT_READ(from, cache_state_root_size);
-    to->cache_state_pages += WT_STAT_READ(from, cache_state_pages);
-    to->compress_precomp_intl_max_page_size +=
-      WT_STAT_READ(from, compress_precomp_intl_max_page_size);
-    to->compress_precomp_leaf_max_page_size +=
-      WT_STAT_READ(from, compress_precomp_leaf_max_page_size);
-    to->compress_read += WT_STAT_READ(from, compress_read);
-    to->compress_write += WT_STAT_READ(from, compress_write);
-    to->compress_write_fail += WT_STAT_READ(from, compress_write_fail);
-    to->compress_write_too_small += WT_STAT_READ(from, compress_write_too_small);
-    to->cursor_insert_bulk += WT_STAT_READ(from, cursor_insert_bulk);
-    to->cursor_reopen += WT_STAT_READ(from, cursor_reopen);
-    to->cursor_cache += WT_STAT_READ(from, cursor_cache);
-    to->cursor_create += WT_STAT_READ(from, cursor_create);
-    to->cursor_insert += WT_STAT_READ(from, cursor_insert);
-    to->cursor_insert_bytes += WT_STAT_READ(from, cursor_insert_bytes);
-    to->cursor_modify += WT_STAT_READ(from, cursor_modify);
-    to->cursor_modify_bytes += WT_STAT_READ(from, cursor_modify_bytes);
-    to->cursor_modify_bytes_touch += WT_STAT_READ(from, cursor_modify_bytes_touch);
-    to->cursor_next += WT_STAT_READ(from, cursor_next);
-    to->cursor_open_count += WT_STAT_READ(from, cursor_open_count);
-    to->cursor_restart += WT_STAT_READ(from, cursor_restart);
-    to->cursor_prev += WT_STAT_READ(from, cursor_prev);
-    to->cursor_remove += WT_STAT_READ(from, cursor_remove);
-    to->cursor_remove_bytes += WT_STAT_READ(from, cursor_remove_bytes);
-    to->cursor_reserve += WT_STAT_READ(from, cursor_reserve);
-    to->cursor_reset += WT_STAT_READ(from, cursor_reset);
-    to->cursor_search += WT_STAT_READ(from, cursor_search);
-    to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
-    to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
-    to->cursor_update += WT_STAT_READ(from, cursor_update);
-    to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
-    to->cursor_update_bytes_changed += WT_STAT_READ(from, cursor_update_bytes_changed);
-    to->rec_dictionary += WT_STAT_READ(from, rec_dictionary);
-    to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
-    to->rec_suffix_compression += WT_STAT_READ(from, rec_suffix_compression);
-    to->rec_multiblock_internal += WT_STAT_READ(from, rec_multiblock_internal);
-    to->rec_overflow_key_internal += WT_STAT_READ(from, rec_overflow_key_internal);
-    to->rec_prefix_compression += WT_STAT_READ(from, rec_prefix_compression);
-    to->rec_multiblock_leaf += WT_STAT_READ(from, rec_multiblock_leaf);
-    to->rec_overflow_key_leaf += WT_STAT_READ(from, rec_overflow_key_leaf);
-    if ((v = WT_STAT_READ(from, rec_multiblock_max)) > to->rec_multiblock_max)
-        to->rec_multiblock_max = v;
-    to->rec_overflow_value += WT_STAT_READ(from, rec_overflow_value);
-    to->rec_page_match += WT_STAT_READ(from, rec_page_match);
-    to->rec_pages += WT_STAT_READ(from, rec_pages);
-    to->rec_pages_eviction += WT_STAT_READ(from, rec_pages_eviction);
-    to->rec_page_delete += WT_STAT_READ(from, rec_page_delete);
-    to->session_compact += WT_STAT_READ(from, session_compact);
-    to->txn_update_conflict += WT_STAT_READ(from, txn_update_conflict);
+    __wt_stats_sum(from, &sum, sizeof(sum));
+    __wt_stat_dsrc_aggregate_single(&sum, to);
 }
 
 static const char *const __stats_connection_desc[] = {
@@ -645,10 +484,12 @@ static const char *const __stats_connection_desc[] = {
   "cache: bytes belonging to page images in the cache",
   "cache: bytes belonging to the cache overflow table in the cache",
   "cache: bytes currently in the cache", "cache: bytes dirty in the cache cumulative",
-  "cache: bytes not belonging to page images in the cache", "cache: bytes read into cache",
+  "cache: bytes not belonging to page images in the cache",
+  "cache: bytes of cache overflow history kept in memory", "cache: bytes read into cache",
   "cache: bytes written from cache",
   "cache: cache overflow cursor application thread wait time (usecs)",
-  "cache: cache overflow cursor internal thread wait time (usecs)", "cache: cache overflow score",
+  "cache: cache overflow cursor internal thread wait time (usecs)",
+  "cache: cache overflow history blocks kept in memory", "cache: cache overflow score",
   "cache: cache overflow table entries", "cache: cache overflow table insert calls",
   "cache: cache overflow table max on-disk size", "cache: cache overflow table on-disk size",
   "cache: cache overflow table remove calls", "cache: checkpoint blocked page eviction",
@@ -687,7 +528,9 @@ static const char *const __stats_connection_desc[] = {
   "cache: forced eviction - pages selected count",
   "cache: forced eviction - pages selected unable to be evicted count",
   "cache: forced eviction - pages selected unable to be evicted time",
+  "cache: forced eviction - pages shrunk in memory instead of evicted",
   "cache: hazard pointer blocked page eviction", "cache: hazard pointer check calls",
+  "cache: hazard pointer check calls resolved by the hazard filter",
   "cache: hazard pointer check entries walked", "cache: hazard pointer maximum array length",
   "cache: in-memory page passed criteria to be split", "cache: in-memory page splits",
   "cache: internal pages evicted", "cache: internal pages split during eviction",
@@ -731,43 +574,422 @@ static const char *const __stats_connection_desc[] = {
   "connection: total read I/Os", "connection: total write I/Os", "cursor: cached cursor count",
   "cursor: cursor bulk loaded cursor insert calls",
   "cursor: cursor close calls that result in cache", "cursor: cursor create calls",
-  "cursor: cursor insert calls", "cursor: cursor insert key and value bytes",
-  "cursor: cursor modify calls", "cursor: cursor modify key and value bytes affected",
+  "cursor: cursor index positions read without the table", "cursor: cursor insert calls",
+  "cursor: cursor insert key and value bytes", "cursor: cursor modify calls",
+  "cursor: cursor modify key and value bytes affected",
   "cursor: cursor modify value bytes modified", "cursor: cursor next calls",
   "cursor: cursor operation restarted", "cursor: cursor prev calls", "cursor: cursor remove calls",
   "cursor: cursor remove key bytes removed", "cursor: cursor reserve calls",
   "cursor: cursor reset calls", "cursor: cursor search calls", "cursor: cursor search near calls",
   "cursor: cursor sweep buckets", "cursor: cursor sweep cursors closed",
   "cursor: cursor sweep cursors examined", "cursor: cursor sweeps", "cursor: cursor truncate calls",
-  "cursor: cursor update calls", "cursor: cursor update key and value bytes",
-  "cursor: cursor update value size change", "cursor: cursors reused from cache",
-  "cursor: open cursor count", "data-handle: connection data handle size",
+  "cursor: cursor update calls", "cursor: cursor update index keys left unchanged",
+  "cursor: cursor update key and value bytes", "cursor: cursor update value size change",
+  "cursor: cursors reused from cache", "cursor: open cursor count",
+  "data-handle: connection data handle size",
   "data-handle: connection data handles currently active",
   "data-handle: connection sweep candidate became referenced",
   "data-handle: connection sweep dhandles closed",
   "data-handle: connection sweep dhandles removed from hash list",
   "data-handle: connection sweep time-of-death sets", "data-handle: connection sweeps",
   "data-handle: session dhandles swept", "data-handle: session sweep attempts",
+  "latency: application thread page read 99.9th percentile (usecs)",
+  "latency: application thread page read 99th percentile (usecs)",
+  "latency: application thread page read histogram (bucket 00) - 0-7us",
+  "latency: application thread page read histogram (bucket 01) - 8-11us",
+  "latency: application thread page read histogram (bucket 02) - 12-15us",
+  "latency: application thread page read histogram (bucket 03) - 16-23us",
+  "latency: application thread page read histogram (bucket 04) - 24-31us",
+  "latency: application thread page read histogram (bucket 05) - 32-47us",
+  "latency: application thread page read histogram (bucket 06) - 48-63us",
+  "latency: application thread page read histogram (bucket 07) - 64-95us",
+  "latency: application thread page read histogram (bucket 08) - 96-127us",
+  "latency: application thread page read histogram (bucket 09) - 128-191us",
+  "latency: application thread page read histogram (bucket 10) - 192-255us",
+  "latency: application thread page read histogram (bucket 11) - 256-383us",
+  "latency: application thread page read histogram (bucket 12) - 384-511us",
+  "latency: application thread page read histogram (bucket 13) - 512-767us",
+  "latency: application thread page read histogram (bucket 14) - 768-1023us",
+  "latency: application thread page read histogram (bucket 15) - 1024-1535us",
+  "latency: application thread page read histogram (bucket 16) - 1536-2047us",
+  "latency: application thread page read histogram (bucket 17) - 2048-3071us",
+  "latency: application thread page read histogram (bucket 18) - 3072-4095us",
+  "latency: application thread page read histogram (bucket 19) - 4096-6143us",
+  "latency: application thread page read histogram (bucket 20) - 6144-8191us",
+  "latency: application thread page read histogram (bucket 21) - 8192-12287us",
+  "latency: application thread page read histogram (bucket 22) - 12288-16383us",
+  "latency: application thread page read histogram (bucket 23) - 16384-24575us",
+  "latency: application thread page read histogram (bucket 24) - 24576-32767us",
+  "latency: application thread page read histogram (bucket 25) - 32768-49151us",
+  "latency: application thread page read histogram (bucket 26) - 49152-65535us",
+  "latency: application thread page read histogram (bucket 27) - 65536-98303us",
+  "latency: application thread page read histogram (bucket 28) - 98304-131071us",
+  "latency: application thread page read histogram (bucket 29) - 131072us+",
+  "latency: checkpoint metadata 99.9th percentile (msecs)",
+  "latency: checkpoint metadata 99th percentile (msecs)",
+  "latency: checkpoint metadata histogram (bucket 00) - 0-7ms",
+  "latency: checkpoint metadata histogram (bucket 01) - 8-11ms",
+  "latency: checkpoint metadata histogram (bucket 02) - 12-15ms",
+  "latency: checkpoint metadata histogram (bucket 03) - 16-23ms",
+  "latency: checkpoint metadata histogram (bucket 04) - 24-31ms",
+  "latency: checkpoint metadata histogram (bucket 05) - 32-47ms",
+  "latency: checkpoint metadata histogram (bucket 06) - 48-63ms",
+  "latency: checkpoint metadata histogram (bucket 07) - 64-95ms",
+  "latency: checkpoint metadata histogram (bucket 08) - 96-127ms",
+  "latency: checkpoint metadata histogram (bucket 09) - 128-191ms",
+  "latency: checkpoint metadata histogram (bucket 10) - 192-255ms",
+  "latency: checkpoint metadata histogram (bucket 11) - 256-383ms",
+  "latency: checkpoint metadata histogram (bucket 12) - 384-511ms",
+  "latency: checkpoint metadata histogram (bucket 13) - 512-767ms",
+  "latency: checkpoint metadata histogram (bucket 14) - 768-1023ms",
+  "latency: checkpoint metadata histogram (bucket 15) - 1024-1535ms",
+  "latency: checkpoint metadata histogram (bucket 16) - 1536-2047ms",
+  "latency: checkpoint metadata histogram (bucket 17) - 2048-3071ms",
+  "latency: checkpoint metadata histogram (bucket 18) - 3072-4095ms",
+  "latency: checkpoint metadata histogram (bucket 19) - 4096-6143ms",
+  "latency: checkpoint metadata histogram (bucket 20) - 6144-8191ms",
+  "latency: checkpoint metadata histogram (bucket 21) - 8192-12287ms",
+  "latency: checkpoint metadata histogram (bucket 22) - 12288-16383ms",
+  "latency: checkpoint metadata histogram (bucket 23) - 16384-24575ms",
+  "latency: checkpoint metadata histogram (bucket 24) - 24576-32767ms",
+  "latency: checkpoint metadata histogram (bucket 25) - 32768-49151ms",
+  "latency: checkpoint metadata histogram (bucket 26) - 49152-65535ms",
+  "latency: checkpoint metadata histogram (bucket 27) - 65536-98303ms",
+  "latency: checkpoint metadata histogram (bucket 28) - 98304-131071ms",
+  "latency: checkpoint metadata histogram (bucket 29) - 131072ms+",
+  "latency: checkpoint prepare 99.9th percentile (msecs)",
+  "latency: checkpoint prepare 99th percentile (msecs)",
+  "latency: checkpoint prepare histogram (bucket 00) - 0-7ms",
+  "latency: checkpoint prepare histogram (bucket 01) - 8-11ms",
+  "latency: checkpoint prepare histogram (bucket 02) - 12-15ms",
+  "latency: checkpoint prepare histogram (bucket 03) - 16-23ms",
+  "latency: checkpoint prepare histogram (bucket 04) - 24-31ms",
+  "latency: checkpoint prepare histogram (bucket 05) - 32-47ms",
+  "latency: checkpoint prepare histogram (bucket 06) - 48-63ms",
+  "latency: checkpoint prepare histogram (bucket 07) - 64-95ms",
+  "latency: checkpoint prepare histogram (bucket 08) - 96-127ms",
+  "latency: checkpoint prepare histogram (bucket 09) - 128-191ms",
+  "latency: checkpoint prepare histogram (bucket 10) - 192-255ms",
+  "latency: checkpoint prepare histogram (bucket 11) - 256-383ms",
+  "latency: checkpoint prepare histogram (bucket 12) - 384-511ms",
+  "latency: checkpoint prepare histogram (bucket 13) - 512-767ms",
+  "latency: checkpoint prepare histogram (bucket 14) - 768-1023ms",
+  "latency: checkpoint prepare histogram (bucket 15) - 1024-1535ms",
+  "latency: checkpoint prepare histogram (bucket 16) - 1536-2047ms",
+  "latency: checkpoint prepare histogram (bucket 17) - 2048-3071ms",
+  "latency: checkpoint prepare histogram (bucket 18) - 3072-4095ms",
+  "latency: checkpoint prepare histogram (bucket 19) - 4096-6143ms",
+  "latency: checkpoint prepare histogram (bucket 20) - 6144-8191ms",
+  "latency: checkpoint prepare histogram (bucket 21) - 8192-12287ms",
+  "latency: checkpoint prepare histogram (bucket 22) - 12288-16383ms",
+  "latency: checkpoint prepare histogram (bucket 23) - 16384-24575ms",
+  "latency: checkpoint prepare histogram (bucket 24) - 24576-32767ms",
+  "latency: checkpoint prepare histogram (bucket 25) - 32768-49151ms",
+  "latency: checkpoint prepare histogram (bucket 26) - 49152-65535ms",
+  "latency: checkpoint prepare histogram (bucket 27) - 65536-98303ms",
+  "latency: checkpoint prepare histogram (bucket 28) - 98304-131071ms",
+  "latency: checkpoint prepare histogram (bucket 29) - 131072ms+",
+  "latency: checkpoint scrub 99.9th percentile (msecs)",
+  "latency: checkpoint scrub 99th percentile (msecs)",
+  "latency: checkpoint scrub histogram (bucket 00) - 0-7ms",
+  "latency: checkpoint scrub histogram (bucket 01) - 8-11ms",
+  "latency: checkpoint scrub histogram (bucket 02) - 12-15ms",
+  "latency: checkpoint scrub histogram (bucket 03) - 16-23ms",
+  "latency: checkpoint scrub histogram (bucket 04) - 24-31ms",
+  "latency: checkpoint scrub histogram (bucket 05) - 32-47ms",
+  "latency: checkpoint scrub histogram (bucket 06) - 48-63ms",
+  "latency: checkpoint scrub histogram (bucket 07) - 64-95ms",
+  "latency: checkpoint scrub histogram (bucket 08) - 96-127ms",
+  "latency: checkpoint scrub histogram (bucket 09) - 128-191ms",
+  "latency: checkpoint scrub histogram (bucket 10) - 192-255ms",
+  "latency: checkpoint scrub histogram (bucket 11) - 256-383ms",
+  "latency: checkpoint scrub histogram (bucket 12) - 384-511ms",
+  "latency: checkpoint scrub histogram (bucket 13) - 512-767ms",
+  "latency: checkpoint scrub histogram (bucket 14) - 768-1023ms",
+  "latency: checkpoint scrub histogram (bucket 15) - 1024-1535ms",
+  "latency: checkpoint scrub histogram (bucket 16) - 1536-2047ms",
+  "latency: checkpoint scrub histogram (bucket 17) - 2048-3071ms",
+  "latency: checkpoint scrub histogram (bucket 18) - 3072-4095ms",
+  "latency: checkpoint scrub histogram (bucket 19) - 4096-6143ms",
+  "latency: checkpoint scrub histogram (bucket 20) - 6144-8191ms",
+  "latency: checkpoint scrub histogram (bucket 21) - 8192-12287ms",
+  "latency: checkpoint scrub histogram (bucket 22) - 12288-16383ms",
+  "latency: checkpoint scrub histogram (bucket 23) - 16384-24575ms",
+  "latency: checkpoint scrub histogram (bucket 24) - 24576-32767ms",
+  "latency: checkpoint scrub histogram (bucket 25) - 32768-49151ms",
+  "latency: checkpoint scrub histogram (bucket 26) - 49152-65535ms",
+  "latency: checkpoint scrub histogram (bucket 27) - 65536-98303ms",
+  "latency: checkpoint scrub histogram (bucket 28) - 98304-131071ms",
+  "latency: checkpoint scrub histogram (bucket 29) - 131072ms+",
+  "latency: checkpoint sync 99.9th percentile (msecs)",
+  "latency: checkpoint sync 99th percentile (msecs)",
+  "latency: checkpoint sync histogram (bucket 00) - 0-7ms",
+  "latency: checkpoint sync histogram (bucket 01) - 8-11ms",
+  "latency: checkpoint sync histogram (bucket 02) - 12-15ms",
+  "latency: checkpoint sync histogram (bucket 03) - 16-23ms",
+  "latency: checkpoint sync histogram (bucket 04) - 24-31ms",
+  "latency: checkpoint sync histogram (bucket 05) - 32-47ms",
+  "latency: checkpoint sync histogram (bucket 06) - 48-63ms",
+  "latency: checkpoint sync histogram (bucket 07) - 64-95ms",
+  "latency: checkpoint sync histogram (bucket 08) - 96-127ms",
+  "latency: checkpoint sync histogram (bucket 09) - 128-191ms",
+  "latency: checkpoint sync histogram (bucket 10) - 192-255ms",
+  "latency: checkpoint sync histogram (bucket 11) - 256-383ms",
+  "latency: checkpoint sync histogram (bucket 12) - 384-511ms",
+  "latency: checkpoint sync histogram (bucket 13) - 512-767ms",
+  "latency: checkpoint sync histogram (bucket 14) - 768-1023ms",
+  "latency: checkpoint sync histogram (bucket 15) - 1024-1535ms",
+  "latency: checkpoint sync histogram (bucket 16) - 1536-2047ms",
+  "latency: checkpoint sync histogram (bucket 17) - 2048-3071ms",
+  "latency: checkpoint sync histogram (bucket 18) - 3072-4095ms",
+  "latency: checkpoint sync histogram (bucket 19) - 4096-6143ms",
+  "latency: checkpoint sync histogram (bucket 20) - 6144-8191ms",
+  "latency: checkpoint sync histogram (bucket 21) - 8192-12287ms",
+  "latency: checkpoint sync histogram (bucket 22) - 12288-16383ms",
+  "latency: checkpoint sync histogram (bucket 23) - 16384-24575ms",
+  "latency: checkpoint sync histogram (bucket 24) - 24576-32767ms",
+  "latency: checkpoint sync histogram (bucket 25) - 32768-49151ms",
+  "latency: checkpoint sync histogram (bucket 26) - 49152-65535ms",
+  "latency: checkpoint sync histogram (bucket 27) - 65536-98303ms",
+  "latency: checkpoint sync histogram (bucket 28) - 98304-131071ms",
+  "latency: checkpoint sync histogram (bucket 29) - 131072ms+",
+  "latency: checkpoint tree write 99.9th percentile (msecs)",
+  "latency: checkpoint tree write 99th percentile (msecs)",
+  "latency: checkpoint tree write histogram (bucket 00) - 0-7ms",
+  "latency: checkpoint tree write histogram (bucket 01) - 8-11ms",
+  "latency: checkpoint tree write histogram (bucket 02) - 12-15ms",
+  "latency: checkpoint tree write histogram (bucket 03) - 16-23ms",
+  "latency: checkpoint tree write histogram (bucket 04) - 24-31ms",
+  "latency: checkpoint tree write histogram (bucket 05) - 32-47ms",
+  "latency: checkpoint tree write histogram (bucket 06) - 48-63ms",
+  "latency: checkpoint tree write histogram (bucket 07) - 64-95ms",
+  "latency: checkpoint tree write histogram (bucket 08) - 96-127ms",
+  "latency: checkpoint tree write histogram (bucket 09) - 128-191ms",
+  "latency: checkpoint tree write histogram (bucket 10) - 192-255ms",
+  "latency: checkpoint tree write histogram (bucket 11) - 256-383ms",
+  "latency: checkpoint tree write histogram (bucket 12) - 384-511ms",
+  "latency: checkpoint tree write histogram (bucket 13) - 512-767ms",
+  "latency: checkpoint tree write histogram (bucket 14) - 768-1023ms",
+  "latency: checkpoint tree write histogram (bucket 15) - 1024-1535ms",
+  "latency: checkpoint tree write histogram (bucket 16) - 1536-2047ms",
+  "latency: checkpoint tree write histogram (bucket 17) - 2048-3071ms",
+  "latency: checkpoint tree write histogram (bucket 18) - 3072-4095ms",
+  "latency: checkpoint tree write histogram (bucket 19) - 4096-6143ms",
+  "latency: checkpoint tree write histogram (bucket 20) - 6144-8191ms",
+  "latency: checkpoint tree write histogram (bucket 21) - 8192-12287ms",
+  "latency: checkpoint tree write histogram (bucket 22) - 12288-16383ms",
+  "latency: checkpoint tree write histogram (bucket 23) - 16384-24575ms",
+  "latency: checkpoint tree write histogram (bucket 24) - 24576-32767ms",
+  "latency: checkpoint tree write histogram (bucket 25) - 32768-49151ms",
+  "latency: checkpoint tree write histogram (bucket 26) - 49152-65535ms",
+  "latency: checkpoint tree write histogram (bucket 27) - 65536-98303ms",
+  "latency: checkpoint tree write histogram (bucket 28) - 98304-131071ms",
+  "latency: checkpoint tree write histogram (bucket 29) - 131072ms+",
+  "latency: cursor insert 99.9th percentile (usecs)",
+  "latency: cursor insert 99th percentile (usecs)",
+  "latency: cursor insert histogram (bucket 00) - 0-7us",
+  "latency: cursor insert histogram (bucket 01) - 8-11us",
+  "latency: cursor insert histogram (bucket 02) - 12-15us",
+  "latency: cursor insert histogram (bucket 03) - 16-23us",
+  "latency: cursor insert histogram (bucket 04) - 24-31us",
+  "latency: cursor insert histogram (bucket 05) - 32-47us",
+  "latency: cursor insert histogram (bucket 06) - 48-63us",
+  "latency: cursor insert histogram (bucket 07) - 64-95us",
+  "latency: cursor insert histogram (bucket 08) - 96-127us",
+  "latency: cursor insert histogram (bucket 09) - 128-191us",
+  "latency: cursor insert histogram (bucket 10) - 192-255us",
+  "latency: cursor insert histogram (bucket 11) - 256-383us",
+  "latency: cursor insert histogram (bucket 12) - 384-511us",
+  "latency: cursor insert histogram (bucket 13) - 512-767us",
+  "latency: cursor insert histogram (bucket 14) - 768-1023us",
+  "latency: cursor insert histogram (bucket 15) - 1024-1535us",
+  "latency: cursor insert histogram (bucket 16) - 1536-2047us",
+  "latency: cursor insert histogram (bucket 17) - 2048-3071us",
+  "latency: cursor insert histogram (bucket 18) - 3072-4095us",
+  "latency: cursor insert histogram (bucket 19) - 4096-6143us",
+  "latency: cursor insert histogram (bucket 20) - 6144-8191us",
+  "latency: cursor insert histogram (bucket 21) - 8192-12287us",
+  "latency: cursor insert histogram (bucket 22) - 12288-16383us",
+  "latency: cursor insert histogram (bucket 23) - 16384-24575us",
+  "latency: cursor insert histogram (bucket 24) - 24576-32767us",
+  "latency: cursor insert histogram (bucket 25) - 32768-49151us",
+  "latency: cursor insert histogram (bucket 26) - 49152-65535us",
+  "latency: cursor insert histogram (bucket 27) - 65536-98303us",
+  "latency: cursor insert histogram (bucket 28) - 98304-131071us",
+  "latency: cursor insert histogram (bucket 29) - 131072us+",
+  "latency: cursor remove 99.9th percentile (usecs)",
+  "latency: cursor remove 99th percentile (usecs)",
+  "latency: cursor remove histogram (bucket 00) - 0-7us",
+  "latency: cursor remove histogram (bucket 01) - 8-11us",
+  "latency: cursor remove histogram (bucket 02) - 12-15us",
+  "latency: cursor remove histogram (bucket 03) - 16-23us",
+  "latency: cursor remove histogram (bucket 04) - 24-31us",
+  "latency: cursor remove histogram (bucket 05) - 32-47us",
+  "latency: cursor remove histogram (bucket 06) - 48-63us",
+  "latency: cursor remove histogram (bucket 07) - 64-95us",
+  "latency: cursor remove histogram (bucket 08) - 96-127us",
+  "latency: cursor remove histogram (bucket 09) - 128-191us",
+  "latency: cursor remove histogram (bucket 10) - 192-255us",
+  "latency: cursor remove histogram (bucket 11) - 256-383us",
+  "latency: cursor remove histogram (bucket 12) - 384-511us",
+  "latency: cursor remove histogram (bucket 13) - 512-767us",
+  "latency: cursor remove histogram (bucket 14) - 768-1023us",
+  "latency: cursor remove histogram (bucket 15) - 1024-1535us",
+  "latency: cursor remove histogram (bucket 16) - 1536-2047us",
+  "latency: cursor remove histogram (bucket 17) - 2048-3071us",
+  "latency: cursor remove histogram (bucket 18) - 3072-4095us",
+  "latency: cursor remove histogram (bucket 19) - 4096-6143us",
+  "latency: cursor remove histogram (bucket 20) - 6144-8191us",
+  "latency: cursor remove histogram (bucket 21) - 8192-12287us",
+  "latency: cursor remove histogram (bucket 22) - 12288-16383us",
+  "latency: cursor remove histogram (bucket 23) - 16384-24575us",
+  "latency: cursor remove histogram (bucket 24) - 24576-32767us",
+  "latency: cursor remove histogram (bucket 25) - 32768-49151us",
+  "latency: cursor remove histogram (bucket 26) - 49152-65535us",
+  "latency: cursor remove histogram (bucket 27) - 65536-98303us",
+  "latency: cursor remove histogram (bucket 28) - 98304-131071us",
+  "latency: cursor remove histogram (bucket 29) - 131072us+",
+  "latency: cursor search 99.9th percentile (usecs)",
+  "latency: cursor search 99th percentile (usecs)",
+  "latency: cursor search histogram (bucket 00) - 0-7us",
+  "latency: cursor search histogram (bucket 01) - 8-11us",
+  "latency: cursor search histogram (bucket 02) - 12-15us",
+  "latency: cursor search histogram (bucket 03) - 16-23us",
+  "latency: cursor search histogram (bucket 04) - 24-31us",
+  "latency: cursor search histogram (bucket 05) - 32-47us",
+  "latency: cursor search histogram (bucket 06) - 48-63us",
+  "latency: cursor search histogram (bucket 07) - 64-95us",
+  "latency: cursor search histogram (bucket 08) - 96-127us",
+  "latency: cursor search histogram (bucket 09) - 128-191us",
+  "latency: cursor search histogram (bucket 10) - 192-255us",
+  "latency: cursor search histogram (bucket 11) - 256-383us",
+  "latency: cursor search histogram (bucket 12) - 384-511us",
+  "latency: cursor search histogram (bucket 13) - 512-767us",
+  "latency: cursor search histogram (bucket 14) - 768-1023us",
+  "latency: cursor search histogram (bucket 15) - 1024-1535us",
+  "latency: cursor search histogram (bucket 16) - 1536-2047us",
+  "latency: cursor search histogram (bucket 17) - 2048-3071us",
+  "latency: cursor search histogram (bucket 18) - 3072-4095us",
+  "latency: cursor search histogram (bucket 19) - 4096-6143us",
+  "latency: cursor search histogram (bucket 20) - 6144-8191us",
+  "latency: cursor search histogram (bucket 21) - 8192-12287us",
+  "latency: cursor search histogram (bucket 22) - 12288-16383us",
+  "latency: cursor search histogram (bucket 23) - 16384-24575us",
+  "latency: cursor search histogram (bucket 24) - 24576-32767us",
+  "latency: cursor search histogram (bucket 25) - 32768-49151us",
+  "latency: cursor search histogram (bucket 26) - 49152-65535us",
+  "latency: cursor search histogram (bucket 27) - 65536-98303us",
+  "latency: cursor search histogram (bucket 28) - 98304-131071us",
+  "latency: cursor search histogram (bucket 29) - 131072us+",
+  "latency: cursor update 99.9th percentile (usecs)",
+  "latency: cursor update 99th percentile (usecs)",
+  "latency: cursor update histogram (bucket 00) - 0-7us",
+  "latency: cursor update histogram (bucket 01) - 8-11us",
+  "latency: cursor update histogram (bucket 02) - 12-15us",
+  "latency: cursor update histogram (bucket 03) - 16-23us",
+  "latency: cursor update histogram (bucket 04) - 24-31us",
+  "latency: cursor update histogram (bucket 05) - 32-47us",
+  "latency: cursor update histogram (bucket 06) - 48-63us",
+  "latency: cursor update histogram (bucket 07) - 64-95us",
+  "latency: cursor update histogram (bucket 08) - 96-127us",
+  "latency: cursor update histogram (bucket 09) - 128-191us",
+  "latency: cursor update histogram (bucket 10) - 192-255us",
+  "latency: cursor update histogram (bucket 11) - 256-383us",
+  "latency: cursor update histogram (bucket 12) - 384-511us",
+  "latency: cursor update histogram (bucket 13) - 512-767us",
+  "latency: cursor update histogram (bucket 14) - 768-1023us",
+  "latency: cursor update histogram (bucket 15) - 1024-1535us",
+  "latency: cursor update histogram (bucket 16) - 1536-2047us",
+  "latency: cursor update histogram (bucket 17) - 2048-3071us",
+  "latency: cursor update histogram (bucket 18) - 3072-4095us",
+  "latency: cursor update histogram (bucket 19) - 4096-6143us",
+  "latency: cursor update histogram (bucket 20) - 6144-8191us",
+  "latency: cursor update histogram (bucket 21) - 8192-12287us",
+  "latency: cursor update histogram (bucket 22) - 12288-16383us",
+  "latency: cursor update histogram (bucket 23) - 16384-24575us",
+  "latency: cursor update histogram (bucket 24) - 24576-32767us",
+  "latency: cursor update histogram (bucket 25) - 32768-49151us",
+  "latency: cursor update histogram (bucket 26) - 49152-65535us",
+  "latency: cursor update histogram (bucket 27) - 65536-98303us",
+  "latency: cursor update histogram (bucket 28) - 98304-131071us",
+  "latency: cursor update histogram (bucket 29) - 131072us+",
+  "latency: transaction commit 99.9th percentile (usecs)",
+  "latency: transaction commit 99th percentile (usecs)",
+  "latency: transaction commit histogram (bucket 00) - 0-7us",
+  "latency: transaction commit histogram (bucket 01) - 8-11us",
+  "latency: transaction commit histogram (bucket 02) - 12-15us",
+  "latency: transaction commit histogram (bucket 03) - 16-23us",
+  "latency: transaction commit histogram (bucket 04) - 24-31us",
+  "latency: transaction commit histogram (bucket 05) - 32-47us",
+  "latency: transaction commit histogram (bucket 06) - 48-63us",
+  "latency: transaction commit histogram (bucket 07) - 64-95us",
+  "latency: transaction commit histogram (bucket 08) - 96-127us",
+  "latency: transaction commit histogram (bucket 09) - 128-191us",
+  "latency: transaction commit histogram (bucket 10) - 192-255us",
+  "latency: transaction commit histogram (bucket 11) - 256-383us",
+  "latency: transaction commit histogram (bucket 12) - 384-511us",
+  "latency: transaction commit histogram (bucket 13) - 512-767us",
+  "latency: transaction commit histogram (bucket 14) - 768-1023us",
+  "latency: transaction commit histogram (bucket 15) - 1024-1535us",
+  "latency: transaction commit histogram (bucket 16) - 1536-2047us",
+  "latency: transaction commit histogram (bucket 17) - 2048-3071us",
+  "latency: transaction commit histogram (bucket 18) - 3072-4095us",
+  "latency: transaction commit histogram (bucket 19) - 4096-6143us",
+  "latency: transaction commit histogram (bucket 20) - 6144-8191us",
+  "latency: transaction commit histogram (bucket 21) - 8192-12287us",
+  "latency: transaction commit histogram (bucket 22) - 12288-16383us",
+  "latency: transaction commit histogram (bucket 23) - 16384-24575us",
+  "latency: transaction commit histogram (bucket 24) - 24576-32767us",
+  "latency: transaction commit histogram (bucket 25) - 32768-49151us",
+  "latency: transaction commit histogram (bucket 26) - 49152-65535us",
+  "latency: transaction commit histogram (bucket 27) - 65536-98303us",
+  "latency: transaction commit histogram (bucket 28) - 98304-131071us",
+  "latency: transaction commit histogram (bucket 29) - 131072us+",
   "lock: checkpoint lock acquisitions",
   "lock: checkpoint lock application thread wait time (usecs)",
   "lock: checkpoint lock internal thread wait time (usecs)",
+  "lock: checkpoint lock wait time histogram (bucket 1) - 0-9us",
+  "lock: checkpoint lock wait time histogram (bucket 2) - 10-99us",
+  "lock: checkpoint lock wait time histogram (bucket 3) - 100-999us",
+  "lock: checkpoint lock wait time histogram (bucket 4) - 1000-9999us",
+  "lock: checkpoint lock wait time histogram (bucket 5) - 10000us+",
   "lock: dhandle lock application thread time waiting (usecs)",
-  "lock: dhandle lock internal thread time waiting (usecs)", "lock: dhandle read lock acquisitions",
-  "lock: dhandle write lock acquisitions",
+  "lock: dhandle lock internal thread time waiting (usecs)",
+  "lock: dhandle lock wait time histogram (bucket 1) - 0-9us",
+  "lock: dhandle lock wait time histogram (bucket 2) - 10-99us",
+  "lock: dhandle lock wait time histogram (bucket 3) - 100-999us",
+  "lock: dhandle lock wait time histogram (bucket 4) - 1000-9999us",
+  "lock: dhandle lock wait time histogram (bucket 5) - 10000us+",
+  "lock: dhandle read lock acquisitions", "lock: dhandle write lock acquisitions",
   "lock: durable timestamp queue lock application thread time waiting (usecs)",
   "lock: durable timestamp queue lock internal thread time waiting (usecs)",
   "lock: durable timestamp queue read lock acquisitions",
   "lock: durable timestamp queue write lock acquisitions", "lock: metadata lock acquisitions",
   "lock: metadata lock application thread wait time (usecs)",
   "lock: metadata lock internal thread wait time (usecs)",
+  "lock: metadata lock wait time histogram (bucket 1) - 0-9us",
+  "lock: metadata lock wait time histogram (bucket 2) - 10-99us",
+  "lock: metadata lock wait time histogram (bucket 3) - 100-999us",
+  "lock: metadata lock wait time histogram (bucket 4) - 1000-9999us",
+  "lock: metadata lock wait time histogram (bucket 5) - 10000us+",
   "lock: read timestamp queue lock application thread time waiting (usecs)",
   "lock: read timestamp queue lock internal thread time waiting (usecs)",
   "lock: read timestamp queue read lock acquisitions",
   "lock: read timestamp queue write lock acquisitions", "lock: schema lock acquisitions",
   "lock: schema lock application thread wait time (usecs)",
   "lock: schema lock internal thread wait time (usecs)",
+  "lock: schema lock wait time histogram (bucket 1) - 0-9us",
+  "lock: schema lock wait time histogram (bucket 2) - 10-99us",
+  "lock: schema lock wait time histogram (bucket 3) - 100-999us",
+  "lock: schema lock wait time histogram (bucket 4) - 1000-9999us",
+  "lock: schema lock wait time histogram (bucket 5) - 10000us+",
   "lock: table lock application thread time waiting for the table lock (usecs)",
   "lock: table lock internal thread time waiting for the table lock (usecs)",
+  "lock: table lock wait time histogram (bucket 1) - 0-9us",
+  "lock: table lock wait time histogram (bucket 2) - 10-99us",
+  "lock: table lock wait time histogram (bucket 3) - 100-999us",
+  "lock: table lock wait time histogram (bucket 4) - 1000-9999us",
+  "lock: table lock wait time histogram (bucket 5) - 10000us+",
   "lock: table read lock acquisitions", "lock: table write lock acquisitions",
   "lock: txn global lock application thread time waiting (usecs)",
   "lock: txn global lock internal thread time waiting (usecs)",
@@ -890,6 +1112,8 @@ static const char *const __stats_connection_desc[] = {
   "transaction: transaction range of timestamps pinned by the oldest active read timestamp",
   "transaction: transaction range of timestamps pinned by the oldest timestamp",
   "transaction: transaction read timestamp of the oldest active reader",
+  "transaction: transaction snapshots added to the snapshot cache",
+  "transaction: transaction snapshots shared from the snapshot cache",
   "transaction: transaction sync calls", "transaction: transactions committed",
   "transaction: transactions rolled back", "transaction: update conflicts",
 };
@@ -972,10 +1196,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_bytes_inuse */
     /* not clearing cache_bytes_dirty_total */
     /* not clearing cache_bytes_other */
+    /* not clearing cache_bytes_lookaside_history */
     stats->cache_bytes_read = 0;
     stats->cache_bytes_write = 0;
     stats->cache_lookaside_cursor_wait_application = 0;
     stats->cache_lookaside_cursor_wait_internal = 0;
+    stats->cache_lookaside_history_inmem = 0;
     /* not clearing cache_lookaside_score */
     /* not clearing cache_lookaside_entries */
     stats->cache_lookaside_insert = 0;
@@ -1026,8 +1252,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_force = 0;
     stats->cache_eviction_force_fail = 0;
     stats->cache_eviction_force_fail_time = 0;
+    stats->cache_eviction_force_shrink = 0;
     stats->cache_eviction_hazard = 0;
     stats->cache_hazard_checks = 0;
+    stats->cache_hazard_filtered = 0;
     stats->cache_hazard_walks = 0;
     stats->cache_hazard_max = 0;
     stats->cache_inmem_splittable = 0;
@@ -1100,6 +1328,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_insert_bulk = 0;
     stats->cursor_cache = 0;
     stats->cursor_create = 0;
+    stats->cursor_index_only = 0;
     stats->cursor_insert = 0;
     stats->cursor_insert_bytes = 0;
     stats->cursor_modify = 0;
@@ -1120,6 +1349,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_sweep = 0;
     stats->cursor_truncate = 0;
     stats->cursor_update = 0;
+    stats->cursor_update_index_unchanged = 0;
     stats->cursor_update_bytes = 0;
     stats->cursor_update_bytes_changed = 0;
     stats->cursor_reopen = 0;
@@ -1133,11 +1363,373 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->dh_sweeps = 0;
     stats->dh_session_handles = 0;
     stats->dh_session_sweeps = 0;
+    /* not clearing lat_page_read_p999 */
+    /* not clearing lat_page_read_p99 */
+    stats->lat_page_read_hist_00 = 0;
+    stats->lat_page_read_hist_01 = 0;
+    stats->lat_page_read_hist_02 = 0;
+    stats->lat_page_read_hist_03 = 0;
+    stats->lat_page_read_hist_04 = 0;
+    stats->lat_page_read_hist_05 = 0;
+    stats->lat_page_read_hist_06 = 0;
+    stats->lat_page_read_hist_07 = 0;
+    stats->lat_page_read_hist_08 = 0;
+    stats->lat_page_read_hist_09 = 0;
+    stats->lat_page_read_hist_10 = 0;
+    stats->lat_page_read_hist_11 = 0;
+    stats->lat_page_read_hist_12 = 0;
+    stats->lat_page_read_hist_13 = 0;
+    stats->lat_page_read_hist_14 = 0;
+    stats->lat_page_read_hist_15 = 0;
+    stats->lat_page_read_hist_16 = 0;
+    stats->lat_page_read_hist_17 = 0;
+    stats->lat_page_read_hist_18 = 0;
+    stats->lat_page_read_hist_19 = 0;
+    stats->lat_page_read_hist_20 = 0;
+    stats->lat_page_read_hist_21 = 0;
+    stats->lat_page_read_hist_22 = 0;
+    stats->lat_page_read_hist_23 = 0;
+    stats->lat_page_read_hist_24 = 0;
+    stats->lat_page_read_hist_25 = 0;
+    stats->lat_page_read_hist_26 = 0;
+    stats->lat_page_read_hist_27 = 0;
+    stats->lat_page_read_hist_28 = 0;
+    stats->lat_page_read_hist_29 = 0;
+    /* not clearing lat_checkpoint_metadata_p999 */
+    /* not clearing lat_checkpoint_metadata_p99 */
+    stats->lat_checkpoint_metadata_hist_00 = 0;
+    stats->lat_checkpoint_metadata_hist_01 = 0;
+    stats->lat_checkpoint_metadata_hist_02 = 0;
+    stats->lat_checkpoint_metadata_hist_03 = 0;
+    stats->lat_checkpoint_metadata_hist_04 = 0;
+    stats->lat_checkpoint_metadata_hist_05 = 0;
+    stats->lat_checkpoint_metadata_hist_06 = 0;
+    stats->lat_checkpoint_metadata_hist_07 = 0;
+    stats->lat_checkpoint_metadata_hist_08 = 0;
+    stats->lat_checkpoint_metadata_hist_09 = 0;
+    stats->lat_checkpoint_metadata_hist_10 = 0;
+    stats->lat_checkpoint_metadata_hist_11 = 0;
+    stats->lat_checkpoint_metadata_hist_12 = 0;
+    stats->lat_checkpoint_metadata_hist_13 = 0;
+    stats->lat_checkpoint_metadata_hist_14 = 0;
+    stats->lat_checkpoint_metadata_hist_15 = 0;
+    stats->lat_checkpoint_metadata_hist_16 = 0;
+    stats->lat_checkpoint_metadata_hist_17 = 0;
+    stats->lat_checkpoint_metadata_hist_18 = 0;
+    stats->lat_checkpoint_metadata_hist_19 = 0;
+    stats->lat_checkpoint_metadata_hist_20 = 0;
+    stats->lat_checkpoint_metadata_hist_21 = 0;
+    stats->lat_checkpoint_metadata_hist_22 = 0;
+    stats->lat_checkpoint_metadata_hist_23 = 0;
+    stats->lat_checkpoint_metadata_hist_24 = 0;
+    stats->lat_checkpoint_metadata_hist_25 = 0;
+    stats->lat_checkpoint_metadata_hist_26 = 0;
+    stats->lat_checkpoint_metadata_hist_27 = 0;
+    stats->lat_checkpoint_metadata_hist_28 = 0;
+    stats->lat_checkpoint_metadata_hist_29 = 0;
+    /* not clearing lat_checkpoint_prepare_p999 */
+    /* not clearing lat_checkpoint_prepare_p99 */
+    stats->lat_checkpoint_prepare_hist_00 = 0;
+    stats->lat_checkpoint_prepare_hist_01 = 0;
+    stats->lat_checkpoint_prepare_hist_02 = 0;
+    stats->lat_checkpoint_prepare_hist_03 = 0;
+    stats->lat_checkpoint_prepare_hist_04 = 0;
+    stats->lat_checkpoint_prepare_hist_05 = 0;
+    stats->lat_checkpoint_prepare_hist_06 = 0;
+    stats->lat_checkpoint_prepare_hist_07 = 0;
+    stats->lat_checkpoint_prepare_hist_08 = 0;
+    stats->lat_checkpoint_prepare_hist_09 = 0;
+    stats->lat_checkpoint_prepare_hist_10 = 0;
+    stats->lat_checkpoint_prepare_hist_11 = 0;
+    stats->lat_checkpoint_prepare_hist_12 = 0;
+    stats->lat_checkpoint_prepare_hist_13 = 0;
+    stats->lat_checkpoint_prepare_hist_14 = 0;
+    stats->lat_checkpoint_prepare_hist_15 = 0;
+    stats->lat_checkpoint_prepare_hist_16 = 0;
+    stats->lat_checkpoint_prepare_hist_17 = 0;
+    stats->lat_checkpoint_prepare_hist_18 = 0;
+    stats->lat_checkpoint_prepare_hist_19 = 0;
+    stats->lat_checkpoint_prepare_hist_20 = 0;
+    stats->lat_checkpoint_prepare_hist_21 = 0;
+    stats->lat_checkpoint_prepare_hist_22 = 0;
+    stats->lat_checkpoint_prepare_hist_23 = 0;
+    stats->lat_checkpoint_prepare_hist_24 = 0;
+    stats->lat_checkpoint_prepare_hist_25 = 0;
+    stats->lat_checkpoint_prepare_hist_26 = 0;
+    stats->lat_checkpoint_prepare_hist_27 = 0;
+    stats->lat_checkpoint_prepare_hist_28 = 0;
+    stats->lat_checkpoint_prepare_hist_29 = 0;
+    /* not clearing lat_checkpoint_scrub_p999 */
+    /* not clearing lat_checkpoint_scrub_p99 */
+    stats->lat_checkpoint_scrub_hist_00 = 0;
+    stats->lat_checkpoint_scrub_hist_01 = 0;
+    stats->lat_checkpoint_scrub_hist_02 = 0;
+    stats->lat_checkpoint_scrub_hist_03 = 0;
+    stats->lat_checkpoint_scrub_hist_04 = 0;
+    stats->lat_checkpoint_scrub_hist_05 = 0;
+    stats->lat_checkpoint_scrub_hist_06 = 0;
+    stats->lat_checkpoint_scrub_hist_07 = 0;
+    stats->lat_checkpoint_scrub_hist_08 = 0;
+    stats->lat_checkpoint_scrub_hist_09 = 0;
+    stats->lat_checkpoint_scrub_hist_10 = 0;
+    stats->lat_checkpoint_scrub_hist_11 = 0;
+    stats->lat_checkpoint_scrub_hist_12 = 0;
+    stats->lat_checkpoint_scrub_hist_13 = 0;
+    stats->lat_checkpoint_scrub_hist_14 = 0;
+    stats->lat_checkpoint_scrub_hist_15 = 0;
+    stats->lat_checkpoint_scrub_hist_16 = 0;
+    stats->lat_checkpoint_scrub_hist_17 = 0;
+    stats->lat_checkpoint_scrub_hist_18 = 0;
+    stats->lat_checkpoint_scrub_hist_19 = 0;
+    stats->lat_checkpoint_scrub_hist_20 = 0;
+    stats->lat_checkpoint_scrub_hist_21 = 0;
+    stats->lat_checkpoint_scrub_hist_22 = 0;
+    stats->lat_checkpoint_scrub_hist_23 = 0;
+    stats->lat_checkpoint_scrub_hist_24 = 0;
+    stats->lat_checkpoint_scrub_hist_25 = 0;
+    stats->lat_checkpoint_scrub_hist_26 = 0;
+    stats->lat_checkpoint_scrub_hist_27 = 0;
+    stats->lat_checkpoint_scrub_hist_28 = 0;
+    stats->lat_checkpoint_scrub_hist_29 = 0;
+    /* not clearing lat_checkpoint_sync_p999 */
+    /* not clearing lat_checkpoint_sync_p99 */
+    stats->lat_checkpoint_sync_hist_00 = 0;
+    stats->lat_checkpoint_sync_hist_01 = 0;
+    stats->lat_checkpoint_sync_hist_02 = 0;
+    stats->lat_checkpoint_sync_hist_03 = 0;
+    stats->lat_checkpoint_sync_hist_04 = 0;
+    stats->lat_checkpoint_sync_hist_05 = 0;
+    stats->lat_checkpoint_sync_hist_06 = 0;
+    stats->lat_checkpoint_sync_hist_07 = 0;
+    stats->lat_checkpoint_sync_hist_08 = 0;
+    stats->lat_checkpoint_sync_hist_09 = 0;
+    stats->lat_checkpoint_sync_hist_10 = 0;
+    stats->lat_checkpoint_sync_hist_11 = 0;
+    stats->lat_checkpoint_sync_hist_12 = 0;
+    stats->lat_checkpoint_sync_hist_13 = 0;
+    stats->lat_checkpoint_sync_hist_14 = 0;
+    stats->lat_checkpoint_sync_hist_15 = 0;
+    stats->lat_checkpoint_sync_hist_16 = 0;
+    stats->lat_checkpoint_sync_hist_17 = 0;
+    stats->lat_checkpoint_sync_hist_18 = 0;
+    stats->lat_checkpoint_sync_hist_19 = 0;
+    stats->lat_checkpoint_sync_hist_20 = 0;
+    stats->lat_checkpoint_sync_hist_21 = 0;
+    stats->lat_checkpoint_sync_hist_22 = 0;
+    stats->lat_checkpoint_sync_hist_23 = 0;
+    stats->lat_checkpoint_sync_hist_24 = 0;
+    stats->lat_checkpoint_sync_hist_25 = 0;
+    stats->lat_checkpoint_sync_hist_26 = 0;
+    stats->lat_checkpoint_sync_hist_27 = 0;
+    stats->lat_checkpoint_sync_hist_28 = 0;
+    stats->lat_checkpoint_sync_hist_29 = 0;
+    /* not clearing lat_checkpoint_tree_p999 */
+    /* not clearing lat_checkpoint_tree_p99 */
+    stats->lat_checkpoint_tree_hist_00 = 0;
+    stats->lat_checkpoint_tree_hist_01 = 0;
+    stats->lat_checkpoint_tree_hist_02 = 0;
+    stats->lat_checkpoint_tree_hist_03 = 0;
+    stats->lat_checkpoint_tree_hist_04 = 0;
+    stats->lat_checkpoint_tree_hist_05 = 0;
+    stats->lat_checkpoint_tree_hist_06 = 0;
+    stats->lat_checkpoint_tree_hist_07 = 0;
+    stats->lat_checkpoint_tree_hist_08 = 0;
+    stats->lat_checkpoint_tree_hist_09 = 0;
+    stats->lat_checkpoint_tree_hist_10 = 0;
+    stats->lat_checkpoint_tree_hist_11 = 0;
+    stats->lat_checkpoint_tree_hist_12 = 0;
+    stats->lat_checkpoint_tree_hist_13 = 0;
+    stats->lat_checkpoint_tree_hist_14 = 0;
+    stats->lat_checkpoint_tree_hist_15 = 0;
+    stats->lat_checkpoint_tree_hist_16 = 0;
+    stats->lat_checkpoint_tree_hist_17 = 0;
+    stats->lat_checkpoint_tree_hist_18 = 0;
+    stats->lat_checkpoint_tree_hist_19 = 0;
+    stats->lat_checkpoint_tree_hist_20 = 0;
+    stats->lat_checkpoint_tree_hist_21 = 0;
+    stats->lat_checkpoint_tree_hist_22 = 0;
+    stats->lat_checkpoint_tree_hist_23 = 0;
+    stats->lat_checkpoint_tree_hist_24 = 0;
+    stats->lat_checkpoint_tree_hist_25 = 0;
+    stats->lat_checkpoint_tree_hist_26 = 0;
+    stats->lat_checkpoint_tree_hist_27 = 0;
+    stats->lat_checkpoint_tree_hist_28 = 0;
+    stats->lat_checkpoint_tree_hist_29 = 0;
+    /* not clearing lat_cursor_insert_p999 */
+    /* not clearing lat_cursor_insert_p99 */
+    stats->lat_cursor_insert_hist_00 = 0;
+    stats->lat_cursor_insert_hist_01 = 0;
+    stats->lat_cursor_insert_hist_02 = 0;
+    stats->lat_cursor_insert_hist_03 = 0;
+    stats->lat_cursor_insert_hist_04 = 0;
+    stats->lat_cursor_insert_hist_05 = 0;
+    stats->lat_cursor_insert_hist_06 = 0;
+    stats->lat_cursor_insert_hist_07 = 0;
+    stats->lat_cursor_insert_hist_08 = 0;
+    stats->lat_cursor_insert_hist_09 = 0;
+    stats->lat_cursor_insert_hist_10 = 0;
+    stats->lat_cursor_insert_hist_11 = 0;
+    stats->lat_cursor_insert_hist_12 = 0;
+    stats->lat_cursor_insert_hist_13 = 0;
+    stats->lat_cursor_insert_hist_14 = 0;
+    stats->lat_cursor_insert_hist_15 = 0;
+    stats->lat_cursor_insert_hist_16 = 0;
+    stats->lat_cursor_insert_hist_17 = 0;
+    stats->lat_cursor_insert_hist_18 = 0;
+    stats->lat_cursor_insert_hist_19 = 0;
+    stats->lat_cursor_insert_hist_20 = 0;
+    stats->lat_cursor_insert_hist_21 = 0;
+    stats->lat_cursor_insert_hist_22 = 0;
+    stats->lat_cursor_insert_hist_23 = 0;
+    stats->lat_cursor_insert_hist_24 = 0;
+    stats->lat_cursor_insert_hist_25 = 0;
+    stats->lat_cursor_insert_hist_26 = 0;
+    stats->lat_cursor_insert_hist_27 = 0;
+    stats->lat_cursor_insert_hist_28 = 0;
+    stats->lat_cursor_insert_hist_29 = 0;
+    /* not clearing lat_cursor_remove_p999 */
+    /* not clearing lat_cursor_remove_p99 */
+    stats->lat_cursor_remove_hist_00 = 0;
+    stats->lat_cursor_remove_hist_01 = 0;
+    stats->lat_cursor_remove_hist_02 = 0;
+    stats->lat_cursor_remove_hist_03 = 0;
+    stats->lat_cursor_remove_hist_04 = 0;
+    stats->lat_cursor_remove_hist_05 = 0;
+    stats->lat_cursor_remove_hist_06 = 0;
+    stats->lat_cursor_remove_hist_07 = 0;
+    stats->lat_cursor_remove_hist_08 = 0;
+    stats->lat_cursor_remove_hist_09 = 0;
+    stats->lat_cursor_remove_hist_10 = 0;
+    stats->lat_cursor_remove_hist_11 = 0;
+    stats->lat_cursor_remove_hist_12 = 0;
+    stats->lat_cursor_remove_hist_13 = 0;
+    stats->lat_cursor_remove_hist_14 = 0;
+    stats->lat_cursor_remove_hist_15 = 0;
+    stats->lat_cursor_remove_hist_16 = 0;
+    stats->lat_cursor_remove_hist_17 = 0;
+    stats->lat_cursor_remove_hist_18 = 0;
+    stats->lat_cursor_remove_hist_19 = 0;
+    stats->lat_cursor_remove_hist_20 = 0;
+    stats->lat_cursor_remove_hist_21 = 0;
+    stats->lat_cursor_remove_hist_22 = 0;
+    stats->lat_cursor_remove_hist_23 = 0;
+    stats->lat_cursor_remove_hist_24 = 0;
+    stats->lat_cursor_remove_hist_25 = 0;
+    stats->lat_cursor_remove_hist_26 = 0;
+    stats->lat_cursor_remove_hist_27 = 0;
+    stats->lat_cursor_remove_hist_28 = 0;
+    stats->lat_cursor_remove_hist_29 = 0;
+    /* not clearing lat_cursor_search_p999 */
+    /* not clearing lat_cursor_search_p99 */
+    stats->lat_cursor_search_hist_00 = 0;
+    stats->lat_cursor_search_hist_01 = 0;
+    stats->lat_cursor_search_hist_02 = 0;
+    stats->lat_cursor_search_hist_03 = 0;
+    stats->lat_cursor_search_hist_04 = 0;
+    stats->lat_cursor_search_hist_05 = 0;
+    stats->lat_cursor_search_hist_06 = 0;
+    stats->lat_cursor_search_hist_07 = 0;
+    stats->lat_cursor_search_hist_08 = 0;
+    stats->lat_cursor_search_hist_09 = 0;
+    stats->lat_cursor_search_hist_10 = 0;
+    stats->lat_cursor_search_hist_11 = 0;
+    stats->lat_cursor_search_hist_12 = 0;
+    stats->lat_cursor_search_hist_13 = 0;
+    stats->lat_cursor_search_hist_14 = 0;
+    stats->lat_cursor_search_hist_15 = 0;
+    stats->lat_cursor_search_hist_16 = 0;
+    stats->lat_cursor_search_hist_17 = 0;
+    stats->lat_cursor_search_hist_18 = 0;
+    stats->lat_cursor_search_hist_19 = 0;
+    stats->lat_cursor_search_hist_20 = 0;
+    stats->lat_cursor_search_hist_21 = 0;
+    stats->lat_cursor_search_hist_22 = 0;
+    stats->lat_cursor_search_hist_23 = 0;
+    stats->lat_cursor_search_hist_24 = 0;
+    stats->lat_cursor_search_hist_25 = 0;
+    stats->lat_cursor_search_hist_26 = 0;
+    stats->lat_cursor_search_hist_27 = 0;
+    stats->lat_cursor_search_hist_28 = 0;
+    stats->lat_cursor_search_hist_29 = 0;
+    /* not clearing lat_cursor_update_p999 */
+    /* not clearing lat_cursor_update_p99 */
+    stats->lat_cursor_update_hist_00 = 0;
+    stats->lat_cursor_update_hist_01 = 0;
+    stats->lat_cursor_update_hist_02 = 0;
+    stats->lat_cursor_update_hist_03 = 0;
+    stats->lat_cursor_update_hist_04 = 0;
+    stats->lat_cursor_update_hist_05 = 0;
+    stats->lat_cursor_update_hist_06 = 0;
+    stats->lat_cursor_update_hist_07 = 0;
+    stats->lat_cursor_update_hist_08 = 0;
+    stats->lat_cursor_update_hist_09 = 0;
+    stats->lat_cursor_update_hist_10 = 0;
+    stats->lat_cursor_update_hist_11 = 0;
+    stats->lat_cursor_update_hist_12 = 0;
+    stats->lat_cursor_update_hist_13 = 0;
+    stats->lat_cursor_update_hist_14 = 0;
+    stats->lat_cursor_update_hist_15 = 0;
+    stats->lat_cursor_update_hist_16 = 0;
+    stats->lat_cursor_update_hist_17 = 0;
+    stats->lat_cursor_update_hist_18 = 0;
+    stats->lat_cursor_update_hist_19 = 0;
+    stats->lat_cursor_update_hist_20 = 0;
+    stats->lat_cursor_update_hist_21 = 0;
+    stats->lat_cursor_update_hist_22 = 0;
+    stats->lat_cursor_update_hist_23 = 0;
+    stats->lat_cursor_update_hist_24 = 0;
+    stats->lat_cursor_update_hist_25 = 0;
+    stats->lat_cursor_update_hist_26 = 0;
+    stats->lat_cursor_update_hist_27 = 0;
+    stats->lat_cursor_update_hist_28 = 0;
+    stats->lat_cursor_update_hist_29 = 0;
+    /* not clearing lat_txn_commit_p999 */
+    /* not clearing lat_txn_commit_p99 */
+    stats->lat_txn_commit_hist_00 = 0;
+    stats->lat_txn_commit_hist_01 = 0;
+    stats->lat_txn_commit_hist_02 = 0;
+    stats->lat_txn_commit_hist_03 = 0;
+    stats->lat_txn_commit_hist_04 = 0;
+    stats->lat_txn_commit_hist_05 = 0;
+    stats->lat_txn_commit_hist_06 = 0;
+    stats->lat_txn_commit_hist_07 = 0;
+    stats->lat_txn_commit_hist_08 = 0;
+    stats->lat_txn_commit_hist_09 = 0;
+    stats->lat_txn_commit_hist_10 = 0;
+    stats->lat_txn_commit_hist_11 = 0;
+    stats->lat_txn_commit_hist_12 = 0;
+    stats->lat_txn_commit_hist_13 = 0;
+    stats->lat_txn_commit_hist_14 = 0;
+    stats->lat_txn_commit_hist_15 = 0;
+    stats->lat_txn_commit_hist_16 = 0;
+    stats->lat_txn_commit_hist_17 = 0;
+    stats->lat_txn_commit_hist_18 = 0;
+    stats->lat_txn_commit_hist_19 = 0;
+    stats->lat_txn_commit_hist_20 = 0;
+    stats->lat_txn_commit_hist_21 = 0;
+    stats->lat_txn_commit_hist_22 = 0;
+    stats->lat_txn_commit_hist_23 = 0;
+    stats->lat_txn_commit_hist_24 = 0;
+    stats->lat_txn_commit_hist_25 = 0;
+    stats->lat_txn_commit_hist_26 = 0;
+    stats->lat_txn_commit_hist_27 = 0;
+    stats->lat_txn_commit_hist_28 = 0;
+    stats->lat_txn_commit_hist_29 = 0;
     stats->lock_checkpoint_count = 0;
     stats->lock_checkpoint_wait_application = 0;
     stats->lock_checkpoint_wait_internal = 0;
+    stats->lock_checkpoint_hist_lt10 = 0;
+    stats->lock_checkpoint_hist_lt100 = 0;
+    stats->lock_checkpoint_hist_lt1000 = 0;
+    stats->lock_checkpoint_hist_lt10000 = 0;
+    stats->lock_checkpoint_hist_gt10000 = 0;
     stats->lock_dhandle_wait_application = 0;
     stats->lock_dhandle_wait_internal = 0;
+    stats->lock_dhandle_hist_lt10 = 0;
+    stats->lock_dhandle_hist_lt100 = 0;
+    stats->lock_dhandle_hist_lt1000 = 0;
+    stats->lock_dhandle_hist_lt10000 = 0;
+    stats->lock_dhandle_hist_gt10000 = 0;
     stats->lock_dhandle_read_count = 0;
     stats->lock_dhandle_write_count = 0;
     stats->lock_durable_timestamp_wait_application = 0;
@@ -1147,6 +1739,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->lock_metadata_count = 0;
     stats->lock_metadata_wait_application = 0;
     stats->lock_metadata_wait_internal = 0;
+    stats->lock_metadata_hist_lt10 = 0;
+    stats->lock_metadata_hist_lt100 = 0;
+    stats->lock_metadata_hist_lt1000 = 0;
+    stats->lock_metadata_hist_lt10000 = 0;
+    stats->lock_metadata_hist_gt10000 = 0;
     stats->lock_read_timestamp_wait_application = 0;
     stats->lock_read_timestamp_wait_internal = 0;
     stats->lock_read_timestamp_read_count = 0;
@@ -1154,8 +1751,18 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->lock_schema_count = 0;
     stats->lock_schema_wait_application = 0;
     stats->lock_schema_wait_internal = 0;
+    stats->lock_schema_hist_lt10 = 0;
+    stats->lock_schema_hist_lt100 = 0;
+    stats->lock_schema_hist_lt1000 = 0;
+    stats->lock_schema_hist_lt10000 = 0;
+    stats->lock_schema_hist_gt10000 = 0;
     stats->lock_table_wait_application = 0;
     stats->lock_table_wait_internal = 0;
+    stats->lock_table_hist_lt10 = 0;
+    stats->lock_table_hist_lt100 = 0;
+    stats->lock_table_hist_lt1000 = 0;
+    stats->lock_table_hist_lt10000 = 0;
+    stats->lock_table_hist_gt10000 = 0;
     stats->lock_table_read_count = 0;
     stats->lock_table_write_count = 0;
     stats->lock_txn_global_wait_application = 0;
@@ -1329,6 +1936,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing txn_pinned_timestamp_reader */
     /* not clearing txn_pinned_timestamp_oldest */
     /* not clearing txn_timestamp_oldest_active_read */
+    stats->txn_snapshot_cache_set = 0;
+    stats->txn_snapshot_cache_hit = 0;
     stats->txn_sync = 0;
     stats->txn_commit = 0;
     stats->txn_rollback = 0;
@@ -1344,435 +1953,856 @@ __wt_stat_connection_clear_all(WT_CONNECTION_STATS **stats)
         __wt_stat_connection_clear_single(stats[i]);
 }
 
+void
+__wt_stat_connection_aggregate_single(WT_CONNECTION_STATS *from, WT_CONNECTION_STATS *to)
+{
+    to->lsm_work_queue_app += from->lsm_work_queue_app;
+    to->lsm_work_queue_manager += from->lsm_work_queue_manager;
+    to->lsm_rows_merged += from->lsm_rows_merged;
+    to->lsm_checkpoint_throttle += from->lsm_checkpoint_throttle;
+    to->lsm_merge_throttle += from->lsm_merge_throttle;
+    to->lsm_work_queue_switch += from->lsm_work_queue_switch;
+    to->lsm_work_units_discarded += from->lsm_work_units_discarded;
+    to->lsm_work_units_done += from->lsm_work_units_done;
+    to->lsm_work_units_created += from->lsm_work_units_created;
+    to->lsm_work_queue_max += from->lsm_work_queue_max;
+    to->async_cur_queue += from->async_cur_queue;
+    to->async_max_queue += from->async_max_queue;
+    to->async_alloc_race += from->async_alloc_race;
+    to->async_flush += from->async_flush;
+    to->async_alloc_view += from->async_alloc_view;
+    to->async_full += from->async_full;
+    to->async_nowork += from->async_nowork;
+    to->async_op_alloc += from->async_op_alloc;
+    to->async_op_compact += from->async_op_compact;
+    to->async_op_insert += from->async_op_insert;
+    to->async_op_remove += from->async_op_remove;
+    to->async_op_search += from->async_op_search;
+    to->async_op_update += from->async_op_update;
+    to->block_preload += from->block_preload;
+    to->block_read += from->block_read;
+    to->block_write += from->block_write;
+    to->block_byte_read += from->block_byte_read;
+    to->block_byte_write += from->block_byte_write;
+    to->block_byte_write_checkpoint += from->block_byte_write_checkpoint;
+    to->block_map_read += from->block_map_read;
+    to->block_byte_map_read += from->block_byte_map_read;
+    to->cache_read_app_count += from->cache_read_app_count;
+    to->cache_read_app_time += from->cache_read_app_time;
+    to->cache_write_app_count += from->cache_write_app_count;
+    to->cache_write_app_time += from->cache_write_app_time;
+    to->cache_bytes_image += from->cache_bytes_image;
+    to->cache_bytes_lookaside += from->cache_bytes_lookaside;
+    to->cache_bytes_inuse += from->cache_bytes_inuse;
+    to->cache_bytes_dirty_total += from->cache_bytes_dirty_total;
+    to->cache_bytes_other += from->cache_bytes_other;
+    to->cache_bytes_lookaside_history += from->cache_bytes_lookaside_history;
+    to->cache_bytes_read += from->cache_bytes_read;
+    to->cache_bytes_write += from->cache_bytes_write;
+    to->cache_lookaside_cursor_wait_application += from->cache_lookaside_cursor_wait_application;
+    to->cache_lookaside_cursor_wait_internal += from->cache_lookaside_cursor_wait_internal;
+    to->cache_lookaside_history_inmem += from->cache_lookaside_history_inmem;
+    to->cache_lookaside_score += from->cache_lookaside_score;
+    to->cache_lookaside_entries += from->cache_lookaside_entries;
+    to->cache_lookaside_insert += from->cache_lookaside_insert;
+    to->cache_lookaside_ondisk_max += from->cache_lookaside_ondisk_max;
+    to->cache_lookaside_ondisk += from->cache_lookaside_ondisk;
+    to->cache_lookaside_remove += from->cache_lookaside_remove;
+    to->cache_eviction_checkpoint += from->cache_eviction_checkpoint;
+    to->cache_eviction_get_ref += from->cache_eviction_get_ref;
+    to->cache_eviction_get_ref_empty += from->cache_eviction_get_ref_empty;
+    to->cache_eviction_get_ref_empty2 += from->cache_eviction_get_ref_empty2;
+    to->cache_eviction_aggressive_set += from->cache_eviction_aggressive_set;
+    to->cache_eviction_empty_score += from->cache_eviction_empty_score;
+    to->cache_eviction_walk_passes += from->cache_eviction_walk_passes;
+    to->cache_eviction_queue_empty += from->cache_eviction_queue_empty;
+    to->cache_eviction_queue_not_empty += from->cache_eviction_queue_not_empty;
+    to->cache_eviction_server_evicting += from->cache_eviction_server_evicting;
+    to->cache_eviction_server_slept += from->cache_eviction_server_slept;
+    to->cache_eviction_slow += from->cache_eviction_slow;
+    to->cache_eviction_walk_leaf_notfound += from->cache_eviction_walk_leaf_notfound;
+    to->cache_eviction_walk_internal_wait += from->cache_eviction_walk_internal_wait;
+    to->cache_eviction_walk_internal_yield += from->cache_eviction_walk_internal_yield;
+    to->cache_eviction_state += from->cache_eviction_state;
+    to->cache_eviction_target_page_lt10 += from->cache_eviction_target_page_lt10;
+    to->cache_eviction_target_page_lt32 += from->cache_eviction_target_page_lt32;
+    to->cache_eviction_target_page_ge128 += from->cache_eviction_target_page_ge128;
+    to->cache_eviction_target_page_lt64 += from->cache_eviction_target_page_lt64;
+    to->cache_eviction_target_page_lt128 += from->cache_eviction_target_page_lt128;
+    to->cache_eviction_walks_abandoned += from->cache_eviction_walks_abandoned;
+    to->cache_eviction_walks_stopped += from->cache_eviction_walks_stopped;
+    to->cache_eviction_walks_gave_up_no_targets += from->cache_eviction_walks_gave_up_no_targets;
+    to->cache_eviction_walks_gave_up_ratio += from->cache_eviction_walks_gave_up_ratio;
+    to->cache_eviction_walks_ended += from->cache_eviction_walks_ended;
+    to->cache_eviction_walk_from_root += from->cache_eviction_walk_from_root;
+    to->cache_eviction_walk_saved_pos += from->cache_eviction_walk_saved_pos;
+    to->cache_eviction_active_workers += from->cache_eviction_active_workers;
+    to->cache_eviction_worker_created += from->cache_eviction_worker_created;
+    to->cache_eviction_worker_evicting += from->cache_eviction_worker_evicting;
+    to->cache_eviction_worker_removed += from->cache_eviction_worker_removed;
+    to->cache_eviction_stable_state_workers += from->cache_eviction_stable_state_workers;
+    to->cache_eviction_walks_active += from->cache_eviction_walks_active;
+    to->cache_eviction_walks_started += from->cache_eviction_walks_started;
+    to->cache_eviction_force_retune += from->cache_eviction_force_retune;
+    to->cache_eviction_force_clean += from->cache_eviction_force_clean;
+    to->cache_eviction_force_clean_time += from->cache_eviction_force_clean_time;
+    to->cache_eviction_force_dirty += from->cache_eviction_force_dirty;
+    to->cache_eviction_force_dirty_time += from->cache_eviction_force_dirty_time;
+    to->cache_eviction_force_delete += from->cache_eviction_force_delete;
+    to->cache_eviction_force += from->cache_eviction_force;
+    to->cache_eviction_force_fail += from->cache_eviction_force_fail;
+    to->cache_eviction_force_fail_time += from->cache_eviction_force_fail_time;
+    to->cache_eviction_force_shrink += from->cache_eviction_force_shrink;
+    to->cache_eviction_hazard += from->cache_eviction_hazard;
+    to->cache_hazard_checks += from->cache_hazard_checks;
+    to->cache_hazard_filtered += from->cache_hazard_filtered;
+    to->cache_hazard_walks += from->cache_hazard_walks;
+    if (from->cache_hazard_max > to->cache_hazard_max)
+        to->cache_hazard_max = from->cache_hazard_max;
+    to->cache_inmem_splittable += from->cache_inmem_splittable;
+    to->cache_inmem_split += from->cache_inmem_split;
+    to->cache_eviction_internal += from->cache_eviction_internal;
+    to->cache_eviction_split_internal += from->cache_eviction_split_internal;
+    to->cache_eviction_split_leaf += from->cache_eviction_split_leaf;
+    to->cache_bytes_max += from->cache_bytes_max;
+    to->cache_eviction_maximum_page_size += from->cache_eviction_maximum_page_size;
+    to->cache_eviction_dirty += from->cache_eviction_dirty;
+    to->cache_eviction_app_dirty += from->cache_eviction_app_dirty;
+    to->cache_timed_out_ops += from->cache_timed_out_ops;
+    to->cache_read_overflow += from->cache_read_overflow;
+    to->cache_eviction_deepen += from->cache_eviction_deepen;
+    to->cache_write_lookaside += from->cache_write_lookaside;
+    to->cache_pages_inuse += from->cache_pages_inuse;
+    to->cache_eviction_app += from->cache_eviction_app;
+    to->cache_eviction_pages_queued += from->cache_eviction_pages_queued;
+    to->cache_eviction_pages_queued_post_lru += from->cache_eviction_pages_queued_post_lru;
+    to->cache_eviction_pages_queued_urgent += from->cache_eviction_pages_queued_urgent;
+    to->cache_eviction_pages_queued_oldest += from->cache_eviction_pages_queued_oldest;
+    to->cache_read += from->cache_read;
+    to->cache_read_deleted += from->cache_read_deleted;
+    to->cache_read_deleted_prepared += from->cache_read_deleted_prepared;
+    to->cache_read_lookaside += from->cache_read_lookaside;
+    to->cache_read_lookaside_checkpoint += from->cache_read_lookaside_checkpoint;
+    to->cache_read_lookaside_skipped += from->cache_read_lookaside_skipped;
+    to->cache_read_lookaside_delay += from->cache_read_lookaside_delay;
+    to->cache_read_lookaside_delay_checkpoint += from->cache_read_lookaside_delay_checkpoint;
+    to->cache_pages_requested += from->cache_pages_requested;
+    to->cache_eviction_pages_seen += from->cache_eviction_pages_seen;
+    to->cache_eviction_fail += from->cache_eviction_fail;
+    to->cache_eviction_walk += from->cache_eviction_walk;
+    to->cache_write += from->cache_write;
+    to->cache_write_restore += from->cache_write_restore;
+    to->cache_overhead += from->cache_overhead;
+    to->cache_bytes_internal += from->cache_bytes_internal;
+    to->cache_bytes_leaf += from->cache_bytes_leaf;
+    to->cache_bytes_dirty += from->cache_bytes_dirty;
+    to->cache_pages_dirty += from->cache_pages_dirty;
+    to->cache_eviction_clean += from->cache_eviction_clean;
+    to->fsync_all_fh_total += from->fsync_all_fh_total;
+    to->fsync_all_fh += from->fsync_all_fh;
+    to->fsync_all_time += from->fsync_all_time;
+    to->capacity_bytes_read += from->capacity_bytes_read;
+    to->capacity_bytes_ckpt += from->capacity_bytes_ckpt;
+    to->capacity_bytes_evict += from->capacity_bytes_evict;
+    to->capacity_bytes_log += from->capacity_bytes_log;
+    to->capacity_bytes_written += from->capacity_bytes_written;
+    to->capacity_threshold += from->capacity_threshold;
+    to->capacity_time_total += from->capacity_time_total;
+    to->capacity_time_ckpt += from->capacity_time_ckpt;
+    to->capacity_time_evict += from->capacity_time_evict;
+    to->capacity_time_log += from->capacity_time_log;
+    to->capacity_time_read += from->capacity_time_read;
+    to->cond_auto_wait_reset += from->cond_auto_wait_reset;
+    to->cond_auto_wait += from->cond_auto_wait;
+    to->time_travel += from->time_travel;
+    to->file_open += from->file_open;
+    to->memory_allocation += from->memory_allocation;
+    to->memory_free += from->memory_free;
+    to->memory_grow += from->memory_grow;
+    to->cond_wait += from->cond_wait;
+    to->rwlock_read += from->rwlock_read;
+    to->rwlock_write += from->rwlock_write;
+    to->fsync_io += from->fsync_io;
+    to->read_io += from->read_io;
+    to->write_io += from->write_io;
+    to->cursor_cached_count += from->cursor_cached_count;
+    to->cursor_insert_bulk += from->cursor_insert_bulk;
+    to->cursor_cache += from->cursor_cache;
+    to->cursor_create += from->cursor_create;
+    to->cursor_index_only += from->cursor_index_only;
+    to->cursor_insert += from->cursor_insert;
+    to->cursor_insert_bytes += from->cursor_insert_bytes;
+    to->cursor_modify += from->cursor_modify;
+    to->cursor_modify_bytes += from->cursor_modify_bytes;
+    to->cursor_modify_bytes_touch += from->cursor_modify_bytes_touch;
+    to->cursor_next += from->cursor_next;
+    to->cursor_restart += from->cursor_restart;
+    to->cursor_prev += from->cursor_prev;
+    to->cursor_remove += from->cursor_remove;
+    to->cursor_remove_bytes += from->cursor_remove_bytes;
+    to->cursor_reserve += from->cursor_reserve;
+    to->cursor_reset += from->cursor_reset;
+    to->cursor_search += from->cursor_search;
+    to->cursor_search_near += from->cursor_search_near;
+    to->cursor_sweep_buckets += from->cursor_sweep_buckets;
+    to->cursor_sweep_closed += from->cursor_sweep_closed;
+    to->cursor_sweep_examined += from->cursor_sweep_examined;
+    to->cursor_sweep += from->cursor_sweep;
+    to->cursor_truncate += from->cursor_truncate;
+    to->cursor_update += from->cursor_update;
+    to->cursor_update_index_unchanged += from->cursor_update_index_unchanged;
+    to->cursor_update_bytes += from->cursor_update_bytes;
+    to->cursor_update_bytes_changed += from->cursor_update_bytes_changed;
+    to->cursor_reopen += from->cursor_reopen;
+    to->cursor_open_count += from->cursor_open_count;
+    to->dh_conn_handle_size += from->dh_conn_handle_size;
+    to->dh_conn_handle_count += from->dh_conn_handle_count;
+    to->dh_sweep_ref += from->dh_sweep_ref;
+    to->dh_sweep_close += from->dh_sweep_close;
+    to->dh_sweep_remove += from->dh_sweep_remove;
+    to->dh_sweep_tod += from->dh_sweep_tod;
+    to->dh_sweeps += from->dh_sweeps;
+    to->dh_session_handles += from->dh_session_handles;
+    to->dh_session_sweeps += from->dh_session_sweeps;
+    to->lat_page_read_p999 += from->lat_page_read_p999;
+    to->lat_page_read_p99 += from->lat_page_read_p99;
+    to->lat_page_read_hist_00 += from->lat_page_read_hist_00;
+    to->lat_page_read_hist_01 += from->lat_page_read_hist_01;
+    to->lat_page_read_hist_02 += from->lat_page_read_hist_02;
+    to->lat_page_read_hist_03 += from->lat_page_read_hist_03;
+    to->lat_page_read_hist_04 += from->lat_page_read_hist_04;
+    to->lat_page_read_hist_05 += from->lat_page_read_hist_05;
+    to->lat_page_read_hist_06 += from->lat_page_read_hist_06;
+    to->lat_page_read_hist_07 += from->lat_page_read_hist_07;
+    to->lat_page_read_hist_08 += from->lat_page_read_hist_08;
+    to->lat_page_read_hist_09 += from->lat_page_read_hist_09;
+    to->lat_page_read_hist_10 += from->lat_page_read_hist_10;
+    to->lat_page_read_hist_11 += from->lat_page_read_hist_11;
+    to->lat_page_read_hist_12 += from->lat_page_read_hist_12;
+    to->lat_page_read_hist_13 += from->lat_page_read_hist_13;
+    to->lat_page_read_hist_14 += from->lat_page_read_hist_14;
+    to->lat_page_read_hist_15 += from->lat_page_read_hist_15;
+    to->lat_page_read_hist_16 += from->lat_page_read_hist_16;
+    to->lat_page_read_hist_17 += from->lat_page_read_hist_17;
+    to->lat_page_read_hist_18 += from->lat_page_read_hist_18;
+    to->lat_page_read_hist_19 += from->lat_page_read_hist_19;
+    to->lat_page_read_hist_20 += from->lat_page_read_hist_20;
+    to->lat_page_read_hist_21 += from->lat_page_read_hist_21;
+    to->lat_page_read_hist_22 += from->lat_page_read_hist_22;
+    to->lat_page_read_hist_23 += from->lat_page_read_hist_23;
+    to->lat_page_read_hist_24 += from->lat_page_read_hist_24;
+    to->lat_page_read_hist_25 += from->lat_page_read_hist_25;
+    to->lat_page_read_hist_26 += from->lat_page_read_hist_26;
+    to->lat_page_read_hist_27 += from->lat_page_read_hist_27;
+    to->lat_page_read_hist_28 += from->lat_page_read_hist_28;
+    to->lat_page_read_hist_29 += from->lat_page_read_hist_29;
+    to->lat_checkpoint_metadata_p999 += from->lat_checkpoint_metadata_p999;
+    to->lat_checkpoint_metadata_p99 += from->lat_checkpoint_metadata_p99;
+    to->lat_checkpoint_metadata_hist_00 += from->lat_checkpoint_metadata_hist_00;
+    to->lat_checkpoint_metadata_hist_01 += from->lat_checkpoint_metadata_hist_01;
+    to->lat_checkpoint_metadata_hist_02 += from->lat_checkpoint_metadata_hist_02;
+    to->lat_checkpoint_metadata_hist_03 += from->lat_checkpoint_metadata_hist_03;
+    to->lat_checkpoint_metadata_hist_04 += from->lat_checkpoint_metadata_hist_04;
+    to->lat_checkpoint_metadata_hist_05 += from->lat_checkpoint_metadata_hist_05;
+    to->lat_checkpoint_metadata_hist_06 += from->lat_checkpoint_metadata_hist_06;
+    to->lat_checkpoint_metadata_hist_07 += from->lat_checkpoint_metadata_hist_07;
+    to->lat_checkpoint_metadata_hist_08 += from->lat_checkpoint_metadata_hist_08;
+    to->lat_checkpoint_metadata_hist_09 += from->lat_checkpoint_metadata_hist_09;
+    to->lat_checkpoint_metadata_hist_10 += from->lat_checkpoint_metadata_hist_10;
+    to->lat_checkpoint_metadata_hist_11 += from->lat_checkpoint_metadata_hist_11;
+    to->lat_checkpoint_metadata_hist_12 += from->lat_checkpoint_metadata_hist_12;
+    to->lat_checkpoint_metadata_hist_13 += from->lat_checkpoint_metadata_hist_13;
+    to->lat_checkpoint_metadata_hist_14 += from->lat_checkpoint_metadata_hist_14;
+    to->lat_checkpoint_metadata_hist_15 += from->lat_checkpoint_metadata_hist_15;
+    to->lat_checkpoint_metadata_hist_16 += from->lat_checkpoint_metadata_hist_16;
+    to->lat_checkpoint_metadata_hist_17 += from->lat_checkpoint_metadata_hist_17;
+    to->lat_checkpoint_metadata_hist_18 += from->lat_checkpoint_metadata_hist_18;
+    to->lat_checkpoint_metadata_hist_19 += from->lat_checkpoint_metadata_hist_19;
+    to->lat_checkpoint_metadata_hist_20 += from->lat_checkpoint_metadata_hist_20;
+    to->lat_checkpoint_metadata_hist_21 += from->lat_checkpoint_metadata_hist_21;
+    to->lat_checkpoint_metadata_hist_22 += from->lat_checkpoint_metadata_hist_22;
+    to->lat_checkpoint_metadata_hist_23 += from->lat_checkpoint_metadata_hist_23;
+    to->lat_checkpoint_metadata_hist_24 += from->lat_checkpoint_metadata_hist_24;
+    to->lat_checkpoint_metadata_hist_25 += from->lat_checkpoint_metadata_hist_25;
+    to->lat_checkpoint_metadata_hist_26 += from->lat_checkpoint_metadata_hist_26;
+    to->lat_checkpoint_metadata_hist_27 += from->lat_checkpoint_metadata_hist_27;
+    to->lat_checkpoint_metadata_hist_28 += from->lat_checkpoint_metadata_hist_28;
+    to->lat_checkpoint_metadata_hist_29 += from->lat_checkpoint_metadata_hist_29;
+    to->lat_checkpoint_prepare_p999 += from->lat_checkpoint_prepare_p999;
+    to->lat_checkpoint_prepare_p99 += from->lat_checkpoint_prepare_p99;
+    to->lat_checkpoint_prepare_hist_00 += from->lat_checkpoint_prepare_hist_00;
+    to->lat_checkpoint_prepare_hist_01 += from->lat_checkpoint_prepare_hist_01;
+    to->lat_checkpoint_prepare_hist_02 += from->lat_checkpoint_prepare_hist_02;
+    to->lat_checkpoint_prepare_hist_03 += from->lat_checkpoint_prepare_hist_03;
+    to->lat_checkpoint_prepare_hist_04 += from->lat_checkpoint_prepare_hist_04;
+    to->lat_checkpoint_prepare_hist_05 += from->lat_checkpoint_prepare_hist_05;
+    to->lat_checkpoint_prepare_hist_06 += from->lat_checkpoint_prepare_hist_06;
+    to->lat_checkpoint_prepare_hist_07 += from->lat_checkpoint_prepare_hist_07;
+    to->lat_checkpoint_prepare_hist_08 += from->lat_checkpoint_prepare_hist_08;
+    to->lat_checkpoint_prepare_hist_09 += from->lat_checkpoint_prepare_hist_09;
+    to->lat_checkpoint_prepare_hist_10 += from->lat_checkpoint_prepare_hist_10;
+    to->lat_checkpoint_prepare_hist_11 += from->lat_checkpoint_prepare_hist_11;
+    to->lat_checkpoint_prepare_hist_12 += from->lat_checkpoint_prepare_hist_12;
+    to->lat_checkpoint_prepare_hist_13 += from->lat_checkpoint_prepare_hist_13;
+    to->lat_checkpoint_prepare_hist_14 += from->lat_checkpoint_prepare_hist_14;
+    to->lat_checkpoint_prepare_hist_15 += from->lat_checkpoint_prepare_hist_15;
+    to->lat_checkpoint_prepare_hist_16 += from->lat_checkpoint_prepare_hist_16;
+    to->lat_checkpoint_prepare_hist_17 += from->lat_checkpoint_prepare_hist_17;
+    to->lat_checkpoint_prepare_hist_18 += from->lat_checkpoint_prepare_hist_18;
+    to->lat_checkpoint_prepare_hist_19 += from->lat_checkpoint_prepare_hist_19;
+    to->lat_checkpoint_prepare_hist_20 += from->lat_checkpoint_prepare_hist_20;
+    to->lat_checkpoint_prepare_hist_21 += from->lat_checkpoint_prepare_hist_21;
+    to->lat_checkpoint_prepare_hist_22 += from->lat_checkpoint_prepare_hist_22;
+    to->lat_checkpoint_prepare_hist_23 += from->lat_checkpoint_prepare_hist_23;
+    to->lat_checkpoint_prepare_hist_24 += from->lat_checkpoint_prepare_hist_24;
+    to->lat_checkpoint_prepare_hist_25 += from->lat_checkpoint_prepare_hist_25;
+    to->lat_checkpoint_prepare_hist_26 += from->lat_checkpoint_prepare_hist_26;
+    to->lat_checkpoint_prepare_hist_27 += from->lat_checkpoint_prepare_hist_27;
+    to->lat_checkpoint_prepare_hist_28 += from->lat_checkpoint_prepare_hist_28;
+    to->lat_checkpoint_prepare_hist_29 += from->lat_checkpoint_prepare_hist_29;
+    to->lat_checkpoint_scrub_p999 += from->lat_checkpoint_scrub_p999;
+    to->lat_checkpoint_scrub_p99 += from->lat_checkpoint_scrub_p99;
+    to->lat_checkpoint_scrub_hist_00 += from->lat_checkpoint_scrub_hist_00;
+    to->lat_checkpoint_scrub_hist_01 += from->lat_checkpoint_scrub_hist_01;
+    to->lat_checkpoint_scrub_hist_02 += from->lat_checkpoint_scrub_hist_02;
+    to->lat_checkpoint_scrub_hist_03 += from->lat_checkpoint_scrub_hist_03;
+    to->lat_checkpoint_scrub_hist_04 += from->lat_checkpoint_scrub_hist_04;
+    to->lat_checkpoint_scrub_hist_05 += from->lat_checkpoint_scrub_hist_05;
+    to->lat_checkpoint_scrub_hist_06 += from->lat_checkpoint_scrub_hist_06;
+    to->lat_checkpoint_scrub_hist_07 += from->lat_checkpoint_scrub_hist_07;
+    to->lat_checkpoint_scrub_hist_08 += from->lat_checkpoint_scrub_hist_08;
+    to->lat_checkpoint_scrub_hist_09 += from->lat_checkpoint_scrub_hist_09;
+    to->lat_checkpoint_scrub_hist_10 += from->lat_checkpoint_scrub_hist_10;
+    to->lat_checkpoint_scrub_hist_11 += from->lat_checkpoint_scrub_hist_11;
+    to->lat_checkpoint_scrub_hist_12 += from->lat_checkpoint_scrub_hist_12;
+    to->lat_checkpoint_scrub_hist_13 += from->lat_checkpoint_scrub_hist_13;
+    to->lat_checkpoint_scrub_hist_14 += from->lat_checkpoint_scrub_hist_14;
+    to->lat_checkpoint_scrub_hist_15 += from->lat_checkpoint_scrub_hist_15;
+    to->lat_checkpoint_scrub_hist_16 += from->lat_checkpoint_scrub_hist_16;
+    to->lat_checkpoint_scrub_hist_17 += from->lat_checkpoint_scrub_hist_17;
+    to->lat_checkpoint_scrub_hist_18 += from->lat_checkpoint_scrub_hist_18;
+    to->lat_checkpoint_scrub_hist_19 += from->lat_checkpoint_scrub_hist_19;
+    to->lat_checkpoint_scrub_hist_20 += from->lat_checkpoint_scrub_hist_20;
+    to->lat_checkpoint_scrub_hist_21 += from->lat_checkpoint_scrub_hist_21;
+    to->lat_checkpoint_scrub_hist_22 += from->lat_checkpoint_scrub_hist_22;
+    to->lat_checkpoint_scrub_hist_23 += from->lat_checkpoint_scrub_hist_23;
+    to->lat_checkpoint_scrub_hist_24 += from->lat_checkpoint_scrub_hist_24;
+    to->lat_checkpoint_scrub_hist_25 += from->lat_checkpoint_scrub_hist_25;
+    to->lat_checkpoint_scrub_hist_26 += from->lat_checkpoint_scrub_hist_26;
+    to->lat_checkpoint_scrub_hist_27 += from->lat_checkpoint_scrub_hist_27;
+    to->lat_checkpoint_scrub_hist_28 += from->lat_checkpoint_scrub_hist_28;
+    to->lat_checkpoint_scrub_hist_29 += from->lat_checkpoint_scrub_hist_29;
+    to->lat_checkpoint_sync_p999 += from->lat_checkpoint_sync_p999;
+    to->lat_checkpoint_sync_p99 += from->lat_checkpoint_sync_p99;
+    to->lat_checkpoint_sync_hist_00 += from->lat_checkpoint_sync_hist_00;
+    to->lat_checkpoint_sync_hist_01 += from->lat_checkpoint_sync_hist_01;
+    to->lat_checkpoint_sync_hist_02 += from->lat_checkpoint_sync_hist_02;
+    to->lat_checkpoint_sync_hist_03 += from->lat_checkpoint_sync_hist_03;
+    to->lat_checkpoint_sync_hist_04 += from->lat_checkpoint_sync_hist_04;
+    to->lat_checkpoint_sync_hist_05 += from->lat_checkpoint_sync_hist_05;
+    to->lat_checkpoint_sync_hist_06 += from->lat_checkpoint_sync_hist_06;
+    to->lat_checkpoint_sync_hist_07 += from->lat_checkpoint_sync_hist_07;
+    to->lat_checkpoint_sync_hist_08 += from->lat_checkpoint_sync_hist_08;
+    to->lat_checkpoint_sync_hist_09 += from->lat_checkpoint_sync_hist_09;
+    to->lat_checkpoint_sync_hist_10 += from->lat_checkpoint_sync_hist_10;
+    to->lat_checkpoint_sync_hist_11 += from->lat_checkpoint_sync_hist_11;
+    to->lat_checkpoint_sync_hist_12 += from->lat_checkpoint_sync_hist_12;
+    to->lat_checkpoint_sync_hist_13 += from->lat_checkpoint_sync_hist_13;
+    to->lat_checkpoint_sync_hist_14 += from->lat_checkpoint_sync_hist_14;
+    to->lat_checkpoint_sync_hist_15 += from->lat_checkpoint_sync_hist_15;
+    to->lat_checkpoint_sync_hist_16 += from->lat_checkpoint_sync_hist_16;
+    to->lat_checkpoint_sync_hist_17 += from->lat_checkpoint_sync_hist_17;
+    to->lat_checkpoint_sync_hist_18 += from->lat_checkpoint_sync_hist_18;
+    to->lat_checkpoint_sync_hist_19 += from->lat_checkpoint_sync_hist_19;
+    to->lat_checkpoint_sync_hist_20 += from->lat_checkpoint_sync_hist_20;
+    to->lat_checkpoint_sync_hist_21 += from->lat_checkpoint_sync_hist_21;
+    to->lat_checkpoint_sync_hist_22 += from->lat_checkpoint_sync_hist_22;
+    to->lat_checkpoint_sync_hist_23 += from->lat_checkpoint_sync_hist_23;
+    to->lat_checkpoint_sync_hist_24 += from->lat_checkpoint_sync_hist_24;
+    to->lat_checkpoint_sync_hist_25 += from->lat_checkpoint_sync_hist_25;
+    to->lat_checkpoint_sync_hist_26 += from->lat_checkpoint_sync_hist_26;
+    to->lat_checkpoint_sync_hist_27 += from->lat_checkpoint_sync_hist_27;
+    to->lat_checkpoint_sync_hist_28 += from->lat_checkpoint_sync_hist_28;
+    to->lat_checkpoint_sync_hist_29 += from->lat_checkpoint_sync_hist_29;
+    to->lat_checkpoint_tree_p999 += from->lat_checkpoint_tree_p999;
+    to->lat_checkpoint_tree_p99 += from->lat_checkpoint_tree_p99;
+    to->lat_checkpoint_tree_hist_00 += from->lat_checkpoint_tree_hist_00;
+    to->lat_checkpoint_tree_hist_01 += from->lat_checkpoint_tree_hist_01;
+    to->lat_checkpoint_tree_hist_02 += from->lat_checkpoint_tree_hist_02;
+    to->lat_checkpoint_tree_hist_03 += from->lat_checkpoint_tree_hist_03;
+    to->lat_checkpoint_tree_hist_04 += from->lat_checkpoint_tree_hist_04;
+    to->lat_checkpoint_tree_hist_05 += from->lat_checkpoint_tree_hist_05;
+    to->lat_checkpoint_tree_hist_06 += from->lat_checkpoint_tree_hist_06;
+    to->lat_checkpoint_tree_hist_07 += from->lat_checkpoint_tree_hist_07;
+    to->lat_checkpoint_tree_hist_08 += from->lat_checkpoint_tree_hist_08;
+    to->lat_checkpoint_tree_hist_09 += from->lat_checkpoint_tree_hist_09;
+    to->lat_checkpoint_tree_hist_10 += from->lat_checkpoint_tree_hist_10;
+    to->lat_checkpoint_tree_hist_11 += from->lat_checkpoint_tree_hist_11;
+    to->lat_checkpoint_tree_hist_12 += from->lat_checkpoint_tree_hist_12;
+    to->lat_checkpoint_tree_hist_13 += from->lat_checkpoint_tree_hist_13;
+    to->lat_checkpoint_tree_hist_14 += from->lat_checkpoint_tree_hist_14;
+    to->lat_checkpoint_tree_hist_15 += from->lat_checkpoint_tree_hist_15;
+    to->lat_checkpoint_tree_hist_16 += from->lat_checkpoint_tree_hist_16;
+    to->lat_checkpoint_tree_hist_17 += from->lat_checkpoint_tree_hist_17;
+    to->lat_checkpoint_tree_hist_18 += from->lat_checkpoint_tree_hist_18;
+    to->lat_checkpoint_tree_hist_19 += from->lat_checkpoint_tree_hist_19;
+    to->lat_checkpoint_tree_hist_20 += from->lat_checkpoint_tree_hist_20;
+    to->lat_checkpoint_tree_hist_21 += from->lat_checkpoint_tree_hist_21;
+    to->lat_checkpoint_tree_hist_22 += from->lat_checkpoint_tree_hist_22;
+    to->lat_checkpoint_tree_hist_23 += from->lat_checkpoint_tree_hist_23;
+    to->lat_checkpoint_tree_hist_24 += from->lat_checkpoint_tree_hist_24;
+    to->lat_checkpoint_tree_hist_25 += from->lat_checkpoint_tree_hist_25;
+    to->lat_checkpoint_tree_hist_26 += from->lat_checkpoint_tree_hist_26;
+    to->lat_checkpoint_tree_hist_27 += from->lat_checkpoint_tree_hist_27;
+    to->lat_checkpoint_tree_hist_28 += from->lat_checkpoint_tree_hist_28;
+    to->lat_checkpoint_tree_hist_29 += from->lat_checkpoint_tree_hist_29;
+    to->lat_cursor_insert_p999 += from->lat_cursor_insert_p999;
+    to->lat_cursor_insert_p99 += from->lat_cursor_insert_p99;
+    to->lat_cursor_insert_hist_00 += from->lat_cursor_insert_hist_00;
+    to->lat_cursor_insert_hist_01 += from->lat_cursor_insert_hist_01;
+    to->lat_cursor_insert_hist_02 += from->lat_cursor_insert_hist_02;
+    to->lat_cursor_insert_hist_03 += from->lat_cursor_insert_hist_03;
+    to->lat_cursor_insert_hist_04 += from->lat_cursor_insert_hist_04;
+    to->lat_cursor_insert_hist_05 += from->lat_cursor_insert_hist_05;
+    to->lat_cursor_insert_hist_06 += from->lat_cursor_insert_hist_06;
+    to->lat_cursor_insert_hist_07 += from->lat_cursor_insert_hist_07;
+    to->lat_cursor_insert_hist_08 += from->lat_cursor_insert_hist_08;
+    to->lat_cursor_insert_hist_09 += from->lat_cursor_insert_hist_09;
+    to->lat_cursor_insert_hist_10 += from->lat_cursor_insert_hist_10;
+    to->lat_cursor_insert_hist_11 += from->lat_cursor_insert_hist_11;
+    to->lat_cursor_insert_hist_12 += from->lat_cursor_insert_hist_12;
+    to->lat_cursor_insert_hist_13 += from->lat_cursor_insert_hist_13;
+    to->lat_cursor_insert_hist_14 += from->lat_cursor_insert_hist_14;
+    to->lat_cursor_insert_hist_15 += from->lat_cursor_insert_hist_15;
+    to->lat_cursor_insert_hist_16 += from->lat_cursor_insert_hist_16;
+    to->lat_cursor_insert_hist_17 += from->lat_cursor_insert_hist_17;
+    to->lat_cursor_insert_hist_18 += from->lat_cursor_insert_hist_18;
+    to->lat_cursor_insert_hist_19 += from->lat_cursor_insert_hist_19;
+    to->lat_cursor_insert_hist_20 += from->lat_cursor_insert_hist_20;
+    to->lat_cursor_insert_hist_21 += from->lat_cursor_insert_hist_21;
+    to->lat_cursor_insert_hist_22 += from->lat_cursor_insert_hist_22;
+    to->lat_cursor_insert_hist_23 += from->lat_cursor_insert_hist_23;
+    to->lat_cursor_insert_hist_24 += from->lat_cursor_insert_hist_24;
+    to->lat_cursor_insert_hist_25 += from->lat_cursor_insert_hist_25;
+    to->lat_cursor_insert_hist_26 += from->lat_cursor_insert_hist_26;
+    to->lat_cursor_insert_hist_27 += from->lat_cursor_insert_hist_27;
+    to->lat_cursor_insert_hist_28 += from->lat_cursor_insert_hist_28;
+    to->lat_cursor_insert_hist_29 += from->lat_cursor_insert_hist_29;
+    to->lat_cursor_remove_p999 += from->lat_cursor_remove_p999;
+    to->lat_cursor_remove_p99 += from->lat_cursor_remove_p99;
+    to->lat_cursor_remove_hist_00 += from->lat_cursor_remove_hist_00;
+    to->lat_cursor_remove_hist_01 += from->lat_cursor_remove_hist_01;
+    to->lat_cursor_remove_hist_02 += from->lat_cursor_remove_hist_02;
+    to->lat_cursor_remove_hist_03 += from->lat_cursor_remove_hist_03;
+    to->lat_cursor_remove_hist_04 += from->lat_cursor_remove_hist_04;
+    to->lat_cursor_remove_hist_05 += from->lat_cursor_remove_hist_05;
+    to->lat_cursor_remove_hist_06 += from->lat_cursor_remove_hist_06;
+    to->lat_cursor_remove_hist_07 += from->lat_cursor_remove_hist_07;
+    to->lat_cursor_remove_hist_08 += from->lat_cursor_remove_hist_08;
+    to->lat_cursor_remove_hist_09 += from->lat_cursor_remove_hist_09;
+    to->lat_cursor_remove_hist_10 += from->lat_cursor_remove_hist_10;
+    to->lat_cursor_remove_hist_11 += from->lat_cursor_remove_hist_11;
+    to->lat_cursor_remove_hist_12 += from->lat_cursor_remove_hist_12;
+    to->lat_cursor_remove_hist_13 += from->lat_cursor_remove_hist_13;
+    to->lat_cursor_remove_hist_14 += from->lat_cursor_remove_hist_14;
+    to->lat_cursor_remove_hist_15 += from->lat_cursor_remove_hist_15;
+    to->lat_cursor_remove_hist_16 += from->lat_cursor_remove_hist_16;
+    to->lat_cursor_remove_hist_17 += from->lat_cursor_remove_hist_17;
+    to->lat_cursor_remove_hist_18 += from->lat_cursor_remove_hist_18;
+    to->lat_cursor_remove_hist_19 += from->lat_cursor_remove_hist_19;
+    to->lat_cursor_remove_hist_20 += from->lat_cursor_remove_hist_20;
+    to->lat_cursor_remove_hist_21 += from->lat_cursor_remove_hist_21;
+    to->lat_cursor_remove_hist_22 += from->lat_cursor_remove_hist_22;
+    to->lat_cursor_remove_hist_23 += from->lat_cursor_remove_hist_23;
+    to->lat_cursor_remove_hist_24 += from->lat_cursor_remove_hist_24;
+    to->lat_cursor_remove_hist_25 += from->lat_cursor_remove_hist_25;
+    to->lat_cursor_remove_hist_26 += from->lat_cursor_remove_hist_26;
+    to->lat_cursor_remove_hist_27 += from->lat_cursor_remove_hist_27;
+    to->lat_cursor_remove_hist_28 += from->lat_cursor_remove_hist_28;
+    to->lat_cursor_remove_hist_29 += from->lat_cursor_remove_hist_29;
+    to->lat_cursor_search_p999 += from->lat_cursor_search_p999;
+    to->lat_cursor_search_p99 += from->lat_cursor_search_p99;
+    to->lat_cursor_search_hist_00 += from->lat_cursor_search_hist_00;
+    to->lat_cursor_search_hist_01 += from->lat_cursor_search_hist_01;
+    to->lat_cursor_search_hist_02 += from->lat_cursor_search_hist_02;
+    to->lat_cursor_search_hist_03 += from->lat_cursor_search_hist_03;
+    to->lat_cursor_search_hist_04 += from->lat_cursor_search_hist_04;
+    to->lat_cursor_search_hist_05 += from->lat_cursor_search_hist_05;
+    to->lat_cursor_search_hist_06 += from->lat_cursor_search_hist_06;
+    to->lat_cursor_search_hist_07 += from->lat_cursor_search_hist_07;
+    to->lat_cursor_search_hist_08 += from->lat_cursor_search_hist_08;
+    to->lat_cursor_search_hist_09 += from->lat_cursor_search_hist_09;
+    to->lat_cursor_search_hist_10 += from->lat_cursor_search_hist_10;
+    to->lat_cursor_search_hist_11 += from->lat_cursor_search_hist_11;
+    to->lat_cursor_search_hist_12 += from->lat_cursor_search_hist_12;
+    to->lat_cursor_search_hist_13 += from->lat_cursor_search_hist_13;
+    to->lat_cursor_search_hist_14 += from->lat_cursor_search_hist_14;
+    to->lat_cursor_search_hist_15 += from->lat_cursor_search_hist_15;
+    to->lat_cursor_search_hist_16 += from->lat_cursor_search_hist_16;
+    to->lat_cursor_search_hist_17 += from->lat_cursor_search_hist_17;
+    to->lat_cursor_search_hist_18 += from->lat_cursor_search_hist_18;
+    to->lat_cursor_search_hist_19 += from->lat_cursor_search_hist_19;
+    to->lat_cursor_search_hist_20 += from->lat_cursor_search_hist_20;
+    to->lat_cursor_search_hist_21 += from->lat_cursor_search_hist_21;
+    to->lat_cursor_search_hist_22 += from->lat_cursor_search_hist_22;
+    to->lat_cursor_search_hist_23 += from->lat_cursor_search_hist_23;
+    to->lat_cursor_search_hist_24 += from->lat_cursor_search_hist_24;
+    to->lat_cursor_search_hist_25 += from->lat_cursor_search_hist_25;
+    to->lat_cursor_search_hist_26 += from->lat_cursor_search_hist_26;
+    to->lat_cursor_search_hist_27 += from->lat_cursor_search_hist_27;
+    to->lat_cursor_search_hist_28 += from->lat_cursor_search_hist_28;
+    to->lat_cursor_search_hist_29 += from->lat_cursor_search_hist_29;
+    to->lat_cursor_update_p999 += from->lat_cursor_update_p999;
+    to->lat_cursor_update_p99 += from->lat_cursor_update_p99;
+    to->lat_cursor_update_hist_00 += from->lat_cursor_update_hist_00;
+    to->lat_cursor_update_hist_01 += from->lat_cursor_update_hist_01;
+    to->lat_cursor_update_hist_02 += from->lat_cursor_update_hist_02;
+    to->lat_cursor_update_hist_03 += from->lat_cursor_update_hist_03;
+    to->lat_cursor_update_hist_04 += from->lat_cursor_update_hist_04;
+    to->lat_cursor_update_hist_05 += from->lat_cursor_update_hist_05;
+    to->lat_cursor_update_hist_06 += from->lat_cursor_update_hist_06;
+    to->lat_cursor_update_hist_07 += from->lat_cursor_update_hist_07;
+    to->lat_cursor_update_hist_08 += from->lat_cursor_update_hist_08;
+    to->lat_cursor_update_hist_09 += from->lat_cursor_update_hist_09;
+    to->lat_cursor_update_hist_10 += from->lat_cursor_update_hist_10;
+    to->lat_cursor_update_hist_11 += from->lat_cursor_update_hist_11;
+    to->lat_cursor_update_hist_12 += from->lat_cursor_update_hist_12;
+    to->lat_cursor_update_hist_13 += from->lat_cursor_update_hist_13;
+    to->lat_cursor_update_hist_14 += from->lat_cursor_update_hist_14;
+    to->lat_cursor_update_hist_15 += from->lat_cursor_update_hist_15;
+    to->lat_cursor_update_hist_16 += from->lat_cursor_update_hist_16;
+    to->lat_cursor_update_hist_17 += from->lat_cursor_update_hist_17;
+    to->lat_cursor_update_hist_18 += from->lat_cursor_update_hist_18;
+    to->lat_cursor_update_hist_19 += from->lat_cursor_update_hist_19;
+    to->lat_cursor_update_hist_20 += from->lat_cursor_update_hist_20;
+    to->lat_cursor_update_hist_21 += from->lat_cursor_update_hist_21;
+    to->lat_cursor_update_hist_22 += from->lat_cursor_update_hist_22;
+    to->lat_cursor_update_hist_23 += from->lat_cursor_update_hist_23;
+    to->lat_cursor_update_hist_24 += from->lat_cursor_update_hist_24;
+    to->lat_cursor_update_hist_25 += from->lat_cursor_update_hist_25;
+    to->lat_cursor_update_hist_26 += from->lat_cursor_update_hist_26;
+    to->lat_cursor_update_hist_27 += from->lat_cursor_update_hist_27;
+    to->lat_cursor_update_hist_28 += from->lat_cursor_update_hist_28;
+    to->lat_cursor_update_hist_29 += from->lat_cursor_update_hist_29;
+    to->lat_txn_commit_p999 += from->lat_txn_commit_p999;
+    to->lat_txn_commit_p99 += from->lat_txn_commit_p99;
+    to->lat_txn_commit_hist_00 += from->lat_txn_commit_hist_00;
+    to->lat_txn_commit_hist_01 += from->lat_txn_commit_hist_01;
+    to->lat_txn_commit_hist_02 += from->lat_txn_commit_hist_02;
+    to->lat_txn_commit_hist_03 += from->lat_txn_commit_hist_03;
+    to->lat_txn_commit_hist_04 += from->lat_txn_commit_hist_04;
+    to->lat_txn_commit_hist_05 += from->lat_txn_commit_hist_05;
+    to->lat_txn_commit_hist_06 += from->lat_txn_commit_hist_06;
+    to->lat_txn_commit_hist_07 += from->lat_txn_commit_hist_07;
+    to->lat_txn_commit_hist_08 += from->lat_txn_commit_hist_08;
+    to->lat_txn_commit_hist_09 += from->lat_txn_commit_hist_09;
+    to->lat_txn_commit_hist_10 += from->lat_txn_commit_hist_10;
+    to->lat_txn_commit_hist_11 += from->lat_txn_commit_hist_11;
+    to->lat_txn_commit_hist_12 += from->lat_txn_commit_hist_12;
+    to->lat_txn_commit_hist_13 += from->lat_txn_commit_hist_13;
+    to->lat_txn_commit_hist_14 += from->lat_txn_commit_hist_14;
+    to->lat_txn_commit_hist_15 += from->lat_txn_commit_hist_15;
+    to->lat_txn_commit_hist_16 += from->lat_txn_commit_hist_16;
+    to->lat_txn_commit_hist_17 += from->lat_txn_commit_hist_17;
+    to->lat_txn_commit_hist_18 += from->lat_txn_commit_hist_18;
+    to->lat_txn_commit_hist_19 += from->lat_txn_commit_hist_19;
+    to->lat_txn_commit_hist_20 += from->lat_txn_commit_hist_20;
+    to->lat_txn_commit_hist_21 += from->lat_txn_commit_hist_21;
+    to->lat_txn_commit_hist_22 += from->lat_txn_commit_hist_22;
+    to->lat_txn_commit_hist_23 += from->lat_txn_commit_hist_23;
+    to->lat_txn_commit_hist_24 += from->lat_txn_commit_hist_24;
+    to->lat_txn_commit_hist_25 += from->lat_txn_commit_hist_25;
+    to->lat_txn_commit_hist_26 += from->lat_txn_commit_hist_26;
+    to->lat_txn_commit_hist_27 += from->lat_txn_commit_hist_27;
+    to->lat_txn_commit_hist_28 += from->lat_txn_commit_hist_28;
+    to->lat_txn_commit_hist_29 += from->lat_txn_commit_hist_29;
+    to->lock_checkpoint_count += from->lock_checkpoint_count;
+    to->lock_checkpoint_wait_application += from->lock_checkpoint_wait_application;
+    to->lock_checkpoint_wait_internal += from->lock_checkpoint_wait_internal;
+    to->lock_checkpoint_hist_lt10 += from->lock_checkpoint_hist_lt10;
+    to->lock_checkpoint_hist_lt100 += from->lock_checkpoint_hist_lt100;
+    to->lock_checkpoint_hist_lt1000 += from->lock_checkpoint_hist_lt1000;
+    to->lock_checkpoint_hist_lt10000 += from->lock_checkpoint_hist_lt10000;
+    to->lock_checkpoint_hist_gt10000 += from->lock_checkpoint_hist_gt10000;
+    to->lock_dhandle_wait_application += from->lock_dhandle_wait_application;
+    to->lock_dhandle_wait_internal += from->lock_dhandle_wait_internal;
+    to->lock_dhandle_hist_lt10 += from->lock_dhandle_hist_lt10;
+    to->lock_dhandle_hist_lt100 += from->lock_dhandle_hist_lt100;
+    to->lock_dhandle_hist_lt1000 += from->lock_dhandle_hist_lt1000;
+    to->lock_dhandle_hist_lt10000 += from->lock_dhandle_hist_lt10000;
+    to->lock_dhandle_hist_gt10000 += from->lock_dhandle_hist_gt10000;
+    to->lock_dhandle_read_count += from->lock_dhandle_read_count;
+    to->lock_dhandle_write_count += from->lock_dhandle_write_count;
+    to->lock_durable_timestamp_wait_application += from->lock_durable_timestamp_wait_application;
+    to->lock_durable_timestamp_wait_internal += from->lock_durable_timestamp_wait_internal;
+    to->lock_durable_timestamp_read_count += from->lock_durable_timestamp_read_count;
+    to->lock_durable_timestamp_write_count += from->lock_durable_timestamp_write_count;
+    to->lock_metadata_count += from->lock_metadata_count;
+    to->lock_metadata_wait_application += from->lock_metadata_wait_application;
+    to->lock_metadata_wait_internal += from->lock_metadata_wait_internal;
+    to->lock_metadata_hist_lt10 += from->lock_metadata_hist_lt10;
+    to->lock_metadata_hist_lt100 += from->lock_metadata_hist_lt100;
+    to->lock_metadata_hist_lt1000 += from->lock_metadata_hist_lt1000;
+    to->lock_metadata_hist_lt10000 += from->lock_metadata_hist_lt10000;
+    to->lock_metadata_hist_gt10000 += from->lock_metadata_hist_gt10000;
+    to->lock_read_timestamp_wait_application += from->lock_read_timestamp_wait_application;
+    to->lock_read_timestamp_wait_internal += from->lock_read_timestamp_wait_internal;
+    to->lock_read_timestamp_read_count += from->lock_read_timestamp_read_count;
+    to->lock_read_timestamp_write_count += from->lock_read_timestamp_write_count;
+    to->lock_schema_count += from->lock_schema_count;
+    to->lock_schema_wait_application += from->lock_schema_wait_application;
+    to->lock_schema_wait_internal += from->lock_schema_wait_internal;
+    to->lock_schema_hist_lt10 += from->lock_schema_hist_lt10;
+    to->lock_schema_hist_lt100 += from->lock_schema_hist_lt100;
+    to->lock_schema_hist_lt1000 += from->lock_schema_hist_lt1000;
+    to->lock_schema_hist_lt10000 += from->lock_schema_hist_lt10000;
+    to->lock_schema_hist_gt10000 += from->lock_schema_hist_gt10000;
+    to->lock_table_wait_application += from->lock_table_wait_application;
+    to->lock_table_wait_internal += from->lock_table_wait_internal;
+    to->lock_table_hist_lt10 += from->lock_table_hist_lt10;
+    to->lock_table_hist_lt100 += from->lock_table_hist_lt100;
+    to->lock_table_hist_lt1000 += from->lock_table_hist_lt1000;
+    to->lock_table_hist_lt10000 += from->lock_table_hist_lt10000;
+    to->lock_table_hist_gt10000 += from->lock_table_hist_gt10000;
+    to->lock_table_read_count += from->lock_table_read_count;
+    to->lock_table_write_count += from->lock_table_write_count;
+    to->lock_txn_global_wait_application += from->lock_txn_global_wait_application;
+    to->lock_txn_global_wait_internal += from->lock_txn_global_wait_internal;
+    to->lock_txn_global_read_count += from->lock_txn_global_read_count;
+    to->lock_txn_global_write_count += from->lock_txn_global_write_count;
+    to->log_slot_switch_busy += from->log_slot_switch_busy;
+    to->log_force_archive_sleep += from->log_force_archive_sleep;
+    to->log_bytes_payload += from->log_bytes_payload;
+    to->log_bytes_written += from->log_bytes_written;
+    to->log_zero_fills += from->log_zero_fills;
+    to->log_flush += from->log_flush;
+    to->log_force_write += from->log_force_write;
+    to->log_force_write_skip += from->log_force_write_skip;
+    to->log_compress_writes += from->log_compress_writes;
+    to->log_compress_write_fails += from->log_compress_write_fails;
+    to->log_compress_small += from->log_compress_small;
+    to->log_release_write_lsn += from->log_release_write_lsn;
+    to->log_scans += from->log_scans;
+    to->log_scan_rereads += from->log_scan_rereads;
+    to->log_write_lsn += from->log_write_lsn;
+    to->log_write_lsn_skip += from->log_write_lsn_skip;
+    to->log_sync += from->log_sync;
+    to->log_sync_duration += from->log_sync_duration;
+    to->log_sync_dir += from->log_sync_dir;
+    to->log_sync_dir_duration += from->log_sync_dir_duration;
+    to->log_writes += from->log_writes;
+    to->log_slot_consolidated += from->log_slot_consolidated;
+    to->log_max_filesize += from->log_max_filesize;
+    to->log_prealloc_max += from->log_prealloc_max;
+    to->log_prealloc_missed += from->log_prealloc_missed;
+    to->log_prealloc_files += from->log_prealloc_files;
+    to->log_prealloc_used += from->log_prealloc_used;
+    to->log_scan_records += from->log_scan_records;
+    to->log_slot_close_race += from->log_slot_close_race;
+    to->log_slot_close_unbuf += from->log_slot_close_unbuf;
+    to->log_slot_closes += from->log_slot_closes;
+    to->log_slot_races += from->log_slot_races;
+    to->log_slot_yield_race += from->log_slot_yield_race;
+    to->log_slot_immediate += from->log_slot_immediate;
+    to->log_slot_yield_close += from->log_slot_yield_close;
+    to->log_slot_yield_sleep += from->log_slot_yield_sleep;
+    to->log_slot_yield += from->log_slot_yield;
+    to->log_slot_active_closed += from->log_slot_active_closed;
+    to->log_slot_yield_duration += from->log_slot_yield_duration;
+    to->log_slot_no_free_slots += from->log_slot_no_free_slots;
+    to->log_slot_unbuffered += from->log_slot_unbuffered;
+    to->log_compress_mem += from->log_compress_mem;
+    to->log_buffer_size += from->log_buffer_size;
+    to->log_compress_len += from->log_compress_len;
+    to->log_slot_coalesced += from->log_slot_coalesced;
+    to->log_close_yields += from->log_close_yields;
+    to->perf_hist_fsread_latency_lt50 += from->perf_hist_fsread_latency_lt50;
+    to->perf_hist_fsread_latency_lt100 += from->perf_hist_fsread_latency_lt100;
+    to->perf_hist_fsread_latency_lt250 += from->perf_hist_fsread_latency_lt250;
+    to->perf_hist_fsread_latency_lt500 += from->perf_hist_fsread_latency_lt500;
+    to->perf_hist_fsread_latency_lt1000 += from->perf_hist_fsread_latency_lt1000;
+    to->perf_hist_fsread_latency_gt1000 += from->perf_hist_fsread_latency_gt1000;
+    to->perf_hist_fswrite_latency_lt50 += from->perf_hist_fswrite_latency_lt50;
+    to->perf_hist_fswrite_latency_lt100 += from->perf_hist_fswrite_latency_lt100;
+    to->perf_hist_fswrite_latency_lt250 += from->perf_hist_fswrite_latency_lt250;
+    to->perf_hist_fswrite_latency_lt500 += from->perf_hist_fswrite_latency_lt500;
+    to->perf_hist_fswrite_latency_lt1000 += from->perf_hist_fswrite_latency_lt1000;
+    to->perf_hist_fswrite_latency_gt1000 += from->perf_hist_fswrite_latency_gt1000;
+    to->perf_hist_opread_latency_lt250 += from->perf_hist_opread_latency_lt250;
+    to->perf_hist_opread_latency_lt500 += from->perf_hist_opread_latency_lt500;
+    to->perf_hist_opread_latency_lt1000 += from->perf_hist_opread_latency_lt1000;
+    to->perf_hist_opread_latency_lt10000 += from->perf_hist_opread_latency_lt10000;
+    to->perf_hist_opread_latency_gt10000 += from->perf_hist_opread_latency_gt10000;
+    to->perf_hist_opwrite_latency_lt250 += from->perf_hist_opwrite_latency_lt250;
+    to->perf_hist_opwrite_latency_lt500 += from->perf_hist_opwrite_latency_lt500;
+    to->perf_hist_opwrite_latency_lt1000 += from->perf_hist_opwrite_latency_lt1000;
+    to->perf_hist_opwrite_latency_lt10000 += from->perf_hist_opwrite_latency_lt10000;
+    to->perf_hist_opwrite_latency_gt10000 += from->perf_hist_opwrite_latency_gt10000;
+    to->rec_page_delete_fast += from->rec_page_delete_fast;
+    to->rec_pages += from->rec_pages;
+    to->rec_pages_eviction += from->rec_pages_eviction;
+    to->rec_page_delete += from->rec_page_delete;
+    to->rec_split_stashed_bytes += from->rec_split_stashed_bytes;
+    to->rec_split_stashed_objects += from->rec_split_stashed_objects;
+    to->session_open += from->session_open;
+    to->session_query_ts += from->session_query_ts;
+    to->session_table_alter_fail += from->session_table_alter_fail;
+    to->session_table_alter_success += from->session_table_alter_success;
+    to->session_table_alter_skip += from->session_table_alter_skip;
+    to->session_table_compact_fail += from->session_table_compact_fail;
+    to->session_table_compact_success += from->session_table_compact_success;
+    to->session_table_create_fail += from->session_table_create_fail;
+    to->session_table_create_success += from->session_table_create_success;
+    to->session_table_drop_fail += from->session_table_drop_fail;
+    to->session_table_drop_success += from->session_table_drop_success;
+    to->session_table_import_fail += from->session_table_import_fail;
+    to->session_table_import_success += from->session_table_import_success;
+    to->session_table_rebalance_fail += from->session_table_rebalance_fail;
+    to->session_table_rebalance_success += from->session_table_rebalance_success;
+    to->session_table_rename_fail += from->session_table_rename_fail;
+    to->session_table_rename_success += from->session_table_rename_success;
+    to->session_table_salvage_fail += from->session_table_salvage_fail;
+    to->session_table_salvage_success += from->session_table_salvage_success;
+    to->session_table_truncate_fail += from->session_table_truncate_fail;
+    to->session_table_truncate_success += from->session_table_truncate_success;
+    to->session_table_verify_fail += from->session_table_verify_fail;
+    to->session_table_verify_success += from->session_table_verify_success;
+    to->thread_fsync_active += from->thread_fsync_active;
+    to->thread_read_active += from->thread_read_active;
+    to->thread_write_active += from->thread_write_active;
+    to->application_evict_time += from->application_evict_time;
+    to->application_cache_time += from->application_cache_time;
+    to->txn_release_blocked += from->txn_release_blocked;
+    to->conn_close_blocked_lsm += from->conn_close_blocked_lsm;
+    to->dhandle_lock_blocked += from->dhandle_lock_blocked;
+    to->page_index_slot_ref_blocked += from->page_index_slot_ref_blocked;
+    to->log_server_sync_blocked += from->log_server_sync_blocked;
+    to->prepared_transition_blocked_page += from->prepared_transition_blocked_page;
+    to->page_busy_blocked += from->page_busy_blocked;
+    to->page_forcible_evict_blocked += from->page_forcible_evict_blocked;
+    to->page_locked_blocked += from->page_locked_blocked;
+    to->page_read_blocked += from->page_read_blocked;
+    to->page_sleep += from->page_sleep;
+    to->page_del_rollback_blocked += from->page_del_rollback_blocked;
+    to->child_modify_blocked_page += from->child_modify_blocked_page;
+    to->txn_prepared_updates_count += from->txn_prepared_updates_count;
+    to->txn_prepared_updates_lookaside_inserts += from->txn_prepared_updates_lookaside_inserts;
+    to->txn_prepared_updates_resolved += from->txn_prepared_updates_resolved;
+    to->txn_durable_queue_walked += from->txn_durable_queue_walked;
+    to->txn_durable_queue_empty += from->txn_durable_queue_empty;
+    to->txn_durable_queue_head += from->txn_durable_queue_head;
+    to->txn_durable_queue_inserts += from->txn_durable_queue_inserts;
+    to->txn_durable_queue_len += from->txn_durable_queue_len;
+    to->txn_snapshots_created += from->txn_snapshots_created;
+    to->txn_snapshots_dropped += from->txn_snapshots_dropped;
+    to->txn_prepare += from->txn_prepare;
+    to->txn_prepare_commit += from->txn_prepare_commit;
+    to->txn_prepare_active += from->txn_prepare_active;
+    to->txn_prepare_rollback += from->txn_prepare_rollback;
+    to->txn_query_ts += from->txn_query_ts;
+    to->txn_read_queue_walked += from->txn_read_queue_walked;
+    to->txn_read_queue_empty += from->txn_read_queue_empty;
+    to->txn_read_queue_head += from->txn_read_queue_head;
+    to->txn_read_queue_inserts += from->txn_read_queue_inserts;
+    to->txn_read_queue_len += from->txn_read_queue_len;
+    to->txn_rollback_to_stable += from->txn_rollback_to_stable;
+    to->txn_rollback_upd_aborted += from->txn_rollback_upd_aborted;
+    to->txn_rollback_las_removed += from->txn_rollback_las_removed;
+    to->txn_set_ts += from->txn_set_ts;
+    to->txn_set_ts_durable += from->txn_set_ts_durable;
+    to->txn_set_ts_durable_upd += from->txn_set_ts_durable_upd;
+    to->txn_set_ts_oldest += from->txn_set_ts_oldest;
+    to->txn_set_ts_oldest_upd += from->txn_set_ts_oldest_upd;
+    to->txn_set_ts_stable += from->txn_set_ts_stable;
+    to->txn_set_ts_stable_upd += from->txn_set_ts_stable_upd;
+    to->txn_begin += from->txn_begin;
+    to->txn_checkpoint_running += from->txn_checkpoint_running;
+    to->txn_checkpoint_generation += from->txn_checkpoint_generation;
+    to->txn_checkpoint_time_max += from->txn_checkpoint_time_max;
+    to->txn_checkpoint_time_min += from->txn_checkpoint_time_min;
+    to->txn_checkpoint_time_recent += from->txn_checkpoint_time_recent;
+    to->txn_checkpoint_scrub_target += from->txn_checkpoint_scrub_target;
+    to->txn_checkpoint_scrub_time += from->txn_checkpoint_scrub_time;
+    to->txn_checkpoint_time_total += from->txn_checkpoint_time_total;
+    to->txn_checkpoint += from->txn_checkpoint;
+    to->txn_checkpoint_skipped += from->txn_checkpoint_skipped;
+    to->txn_fail_cache += from->txn_fail_cache;
+    to->txn_checkpoint_fsync_post += from->txn_checkpoint_fsync_post;
+    to->txn_checkpoint_fsync_post_duration += from->txn_checkpoint_fsync_post_duration;
+    to->txn_pinned_range += from->txn_pinned_range;
+    to->txn_pinned_checkpoint_range += from->txn_pinned_checkpoint_range;
+    to->txn_pinned_snapshot_range += from->txn_pinned_snapshot_range;
+    to->txn_pinned_timestamp += from->txn_pinned_timestamp;
+    to->txn_pinned_timestamp_checkpoint += from->txn_pinned_timestamp_checkpoint;
+    to->txn_pinned_timestamp_reader += from->txn_pinned_timestamp_reader;
+    to->txn_pinned_timestamp_oldest += from->txn_pinned_timestamp_oldest;
+    to->txn_timestamp_oldest_active_read += from->txn_timestamp_oldest_active_read;
+    to->txn_snapshot_cache_set += from->txn_snapshot_cache_set;
+    to->txn_snapshot_cache_hit += from->txn_snapshot_cache_hit;
+    to->txn_sync += from->txn_sync;
+    to->txn_commit += from->txn_commit;
+    to->txn_rollback += from->txn_rollback;
+    to->txn_update_conflict += from->txn_update_conflict;
+}
+
 void
 __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *to)
 {
-    int64_t v;
+    WT_CONNECTION_STATS sum;
 
-    to->lsm_work_queue_app += WT_STAT_READ(from, lsm_work_queue_app);
-    to->lsm_work_queue_manager += WT_STAT_READ(from, lsm_work_queue_manager);
-    to->lsm_rows_merged += WT_STAT_READ(from, lsm_rows_merged);
-    to->lsm_checkpoint_throttle += WT_STAT_READ(from, lsm_checkpoint_throttle);
-    to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
-    to->lsm_work_queue_switch += WT_STAT_READ(from, lsm_work_queue_switch);
-    to->lsm_work_units_discarded += WT_STAT_READ(from, lsm_work_units_discarded);
-    to->lsm_work_units_done += WT_STAT_READ(from, lsm_work_units_done);
-    to->lsm_work_units_created += WT_STAT_READ(from, lsm_work_units_created);
-    to->lsm_work_queue_max += WT_STAT_READ(from, lsm_work_queue_max);
-    to->async_cur_queue += WT_STAT_READ(from, async_cur_queue);
-    to->async_max_queue += WT_STAT_READ(from, async_max_queue);
-    to->async_alloc_race += WT_STAT_READ(from, async_alloc_race);
-    to->async_flush += WT_STAT_READ(from, async_flush);
-    to->async_alloc_view += WT_STAT_READ(from, async_alloc_view);
-    to->async_full += WT_STAT_READ(from, async_full);
-    to->async_nowork += WT_STAT_READ(from, async_nowork);
-    to->async_op_alloc += WT_STAT_READ(from, async_op_alloc);
-    to->async_op_compact += WT_STAT_READ(from, async_op_compact);
-    to->async_op_insert += WT_STAT_READ(from, async_op_insert);
-    to->async_op_remove += WT_STAT_READ(from, async_op_remove);
-    to->async_op_search += WT_STAT_READ(from, async_op_search);
-    to->async_op_update += WT_STAT_READ(from, async_op_update);
-    to->block_preload += WT_STAT_READ(from, block_preload);
-    to->block_read += WT_STAT_READ(from, block_read);
-    to->block_write += WT_STAT_READ(from, block_write);
-    to->block_byte_read += WT_STAT_READ(from, block_byte_read);
-    to->block_byte_write += WT_STAT_READ(from, block_byte_write);
-    to->block_byte_write_checkpoint += WT_STAT_READ(from, block_byte_write_checkpoint);
-    to->block_map_read += WT_STAT_READ(from, block_map_read);
-    to->block_byte_map_read += WT_STAT_READ(from, block_byte_map_read);
-    to->cache_read_app_count += WT_STAT_READ(from, cache_read_app_count);
-    to->cache_read_app_time += WT_STAT_READ(from, cache_read_app_time);
-    to->cache_write_app_count += WT_STAT_READ(from, cache_write_app_count);
-    to->cache_write_app_time += WT_STAT_READ(from, cache_write_app_time);
-    to->cache_bytes_image += WT_STAT_READ(from, cache_bytes_image);
-    to->cache_bytes_lookaside += WT_STAT_READ(from, cache_bytes_lookaside);
-    to->cache_bytes_inuse += WT_STAT_READ(from, cache_bytes_inuse);
-    to->cache_bytes_dirty_total += WT_STAT_READ(from, cache_bytes_dirty_total);
-    to->cache_bytes_other += WT_STAT_READ(from, cache_bytes_other);
-    to->cache_bytes_read += WT_STAT_READ(from, cache_bytes_read);
-    to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
-    to->cache_lookaside_cursor_wait_application +=
-      WT_STAT_READ(from, cache_lookaside_cursor_wait_application);
-    to->cache_lookaside_cursor_wait_internal +=
-      WT_STAT_READ(from, cache_lookaside_cursor_wait_internal);
-    to->cache_lookaside_score += WT_STAT_READ(from, cache_lookaside_score);
-    to->cache_lookaside_entries += WT_STAT_READ(from, cache_lookaside_entries);
-    to->cache_lookaside_insert += WT_STAT_READ(from, cache_lookaside_insert);
-    to->cache_lookaside_ondisk_max += WT_STAT_READ(from, cache_lookaside_ondisk_max);
-    to->cache_lookaside_ondisk += WT_STAT_READ(from, cache_lookaside_ondisk);
-    to->cache_lookaside_remove += WT_STAT_READ(from, cache_lookaside_remove);
-    to->cache_eviction_checkpoint += WT_STAT_READ(from, cache_eviction_checkpoint);
-    to->cache_eviction_get_ref += WT_STAT_READ(from, cache_eviction_get_ref);
-    to->cache_eviction_get_ref_empty += WT_STAT_READ(from, cache_eviction_get_ref_empty);
-    to->cache_eviction_get_ref_empty2 += WT_STAT_READ(from, cache_eviction_get_ref_empty2);
-    to->cache_eviction_aggressive_set += WT_STAT_READ(from, cache_eviction_aggressive_set);
-    to->cache_eviction_empty_score += WT_STAT_READ(from, cache_eviction_empty_score);
-    to->cache_eviction_walk_passes += WT_STAT_READ(from, cache_eviction_walk_passes);
-    to->cache_eviction_queue_empty += WT_STAT_READ(from, cache_eviction_queue_empty);
-    to->cache_eviction_queue_not_empty += WT_STAT_READ(from, cache_eviction_queue_not_empty);
-    to->cache_eviction_server_evicting += WT_STAT_READ(from, cache_eviction_server_evicting);
-    to->cache_eviction_server_slept += WT_STAT_READ(from, cache_eviction_server_slept);
-    to->cache_eviction_slow += WT_STAT_READ(from, cache_eviction_slow);
-    to->cache_eviction_walk_leaf_notfound += WT_STAT_READ(from, cache_eviction_walk_leaf_notfound);
-    to->cache_eviction_walk_internal_wait += WT_STAT_READ(from, cache_eviction_walk_internal_wait);
-    to->cache_eviction_walk_internal_yield +=
-      WT_STAT_READ(from, cache_eviction_walk_internal_yield);
-    to->cache_eviction_state += WT_STAT_READ(from, cache_eviction_state);
-    to->cache_eviction_target_page_lt10 += WT_STAT_READ(from, cache_eviction_target_page_lt10);
-    to->cache_eviction_target_page_lt32 += WT_STAT_READ(from, cache_eviction_target_page_lt32);
-    to->cache_eviction_target_page_ge128 += WT_STAT_READ(from, cache_eviction_target_page_ge128);
-    to->cache_eviction_target_page_lt64 += WT_STAT_READ(from, cache_eviction_target_page_lt64);
-    to->cache_eviction_target_page_lt128 += WT_STAT_READ(from, cache_eviction_target_page_lt128);
-    to->cache_eviction_walks_abandoned += WT_STAT_READ(from, cache_eviction_walks_abandoned);
-    to->cache_eviction_walks_stopped += WT_STAT_READ(from, cache_eviction_walks_stopped);
-    to->cache_eviction_walks_gave_up_no_targets +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_no_targets);
-    to->cache_eviction_walks_gave_up_ratio +=
-      WT_STAT_READ(from, cache_eviction_walks_gave_up_ratio);
-    to->cache_eviction_walks_ended += WT_STAT_READ(from, cache_eviction_walks_ended);
-    to->cache_eviction_walk_from_root += WT_STAT_READ(from, cache_eviction_walk_from_root);
-    to->cache_eviction_walk_saved_pos += WT_STAT_READ(from, cache_eviction_walk_saved_pos);
-    to->cache_eviction_active_workers += WT_STAT_READ(from, cache_eviction_active_workers);
-    to->cache_eviction_worker_created += WT_STAT_READ(from, cache_eviction_worker_created);
-    to->cache_eviction_worker_evicting += WT_STAT_READ(from, cache_eviction_worker_evicting);
-    to->cache_eviction_worker_removed += WT_STAT_READ(from, cache_eviction_worker_removed);
-    to->cache_eviction_stable_state_workers +=
-      WT_STAT_READ(from, cache_eviction_stable_state_workers);
-    to->cache_eviction_walks_active += WT_STAT_READ(from, cache_eviction_walks_active);
-    to->cache_eviction_walks_started += WT_STAT_READ(from, cache_eviction_walks_started);
-    to->cache_eviction_force_retune += WT_STAT_READ(from, cache_eviction_force_retune);
-    to->cache_eviction_force_clean += WT_STAT_READ(from, cache_eviction_force_clean);
-    to->cache_eviction_force_clean_time += WT_STAT_READ(from, cache_eviction_force_clean_time);
-    to->cache_eviction_force_dirty += WT_STAT_READ(from, cache_eviction_force_dirty);
-    to->cache_eviction_force_dirty_time += WT_STAT_READ(from, cache_eviction_force_dirty_time);
-    to->cache_eviction_force_delete += WT_STAT_READ(from, cache_eviction_force_delete);
-    to->cache_eviction_force += WT_STAT_READ(from, cache_eviction_force);
-    to->cache_eviction_force_fail += WT_STAT_READ(from, cache_eviction_force_fail);
-    to->cache_eviction_force_fail_time += WT_STAT_READ(from, cache_eviction_force_fail_time);
-    to->cache_eviction_hazard += WT_STAT_READ(from, cache_eviction_hazard);
-    to->cache_hazard_checks += WT_STAT_READ(from, cache_hazard_checks);
-    to->cache_hazard_walks += WT_STAT_READ(from, cache_hazard_walks);
-    if ((v = WT_STAT_READ(from, cache_hazard_max)) > to->cache_hazard_max)
-        to->cache_hazard_max = v;
-    to->cache_inmem_splittable += WT_STAT_READ(from, cache_inmem_splittable);
-    to->cache_inmem_split += WT_STAT_READ(from, cache_inmem_split);
-    to->cache_eviction_internal += WT_STAT_READ(from, cache_eviction_internal);
-    to->cache_eviction_split_internal += WT_STAT_READ(from, cache_eviction_split_internal);
-    to->cache_eviction_split_leaf += WT_STAT_READ(from, cache_eviction_split_leaf);
-    to->cache_bytes_max += WT_STAT_READ(from, cache_bytes_max);
-    to->cache_eviction_maximum_page_size += WT_STAT_READ(from, cache_eviction_maximum_page_size);
-    to->cache_eviction_dirty += WT_STAT_READ(from, cache_eviction_dirty);
-    to->cache_eviction_app_dirty += WT_STAT_READ(from, cache_eviction_app_dirty);
-    to->cache_timed_out_ops += WT_STAT_READ(from, cache_timed_out_ops);
-    to->cache_read_overflow += WT_STAT_READ(from, cache_read_overflow);
-    to->cache_eviction_deepen += WT_STAT_READ(from, cache_eviction_deepen);
-    to->cache_write_lookaside += WT_STAT_READ(from, cache_write_lookaside);
-    to->cache_pages_inuse += WT_STAT_READ(from, cache_pages_inuse);
-    to->cache_eviction_app += WT_STAT_READ(from, cache_eviction_app);
-    to->cache_eviction_pages_queued += WT_STAT_READ(from, cache_eviction_pages_queued);
-    to->cache_eviction_pages_queued_post_lru +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_post_lru);
-    to->cache_eviction_pages_queued_urgent +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_urgent);
-    to->cache_eviction_pages_queued_oldest +=
-      WT_STAT_READ(from, cache_eviction_pages_queued_oldest);
-    to->cache_read += WT_STAT_READ(from, cache_read);
-    to->cache_read_deleted += WT_STAT_READ(from, cache_read_deleted);
-    to->cache_read_deleted_prepared += WT_STAT_READ(from, cache_read_deleted_prepared);
-    to->cache_read_lookaside += WT_STAT_READ(from, cache_read_lookaside);
-    to->cache_read_lookaside_checkpoint += WT_STAT_READ(from, cache_read_lookaside_checkpoint);
-    to->cache_read_lookaside_skipped += WT_STAT_READ(from, cache_read_lookaside_skipped);
-    to->cache_read_lookaside_delay += WT_STAT_READ(from, cache_read_lookaside_delay);
-    to->cache_read_lookaside_delay_checkpoint +=
-      WT_STAT_READ(from, cache_read_lookaside_delay_checkpoint);
-    to->cache_pages_requested += WT_STAT_READ(from, cache_pages_requested);
-    to->cache_eviction_pages_seen += WT_STAT_READ(from, cache_eviction_pages_seen);
-    to->cache_eviction_fail += WT_STAT_READ(from, cache_eviction_fail);
-    to->cache_eviction_walk += WT_STAT_READ(from, cache_eviction_walk);
-    to->cache_write += WT_STAT_READ(from, cache_write);
-    to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
-    to->cache_overhead += WT_STAT_READ(from, cache_overhead);
-    to->cache_bytes_internal += WT_STAT_READ(from, cache_bytes_internal);
-    to->cache_bytes_leaf += WT_STAT_READ(from, cache_bytes_leaf);
-    to->cache_bytes_dirty += WT_STAT_READ(from, cache_bytes_dirty);
-    to->cache_pages_dirty += WT_STAT_READ(from, cache_pages_dirty);
-    to->cache_eviction_clean += WT_STAT_READ(from, cache_eviction_clean);
-    to->fsync_all_fh_total += WT_STAT_READ(from, fsync_all_fh_total);
-    to->fsync_all_fh += WT_STAT_READ(from, fsync_all_fh);
-    to->fsync_all_time += WT_STAT_READ(from, fsync_all_time);
-    to->capacity_bytes_read += WT_STAT_READ(from, capacity_bytes_read);
-    to->capacity_bytes_ckpt += WT_STAT_READ(from, capacity_bytes_ckpt);
-    to->capacity_bytes_evict += WT_STAT_READ(from, capacity_bytes_evict);
-    to->capacity_bytes_log += WT_STAT_READ(from, capacity_bytes_log);
-    to->capacity_bytes_written += WT_STAT_READ(from, capacity_bytes_written);
-    to->capacity_threshold += WT_STAT_READ(from, capacity_threshold);
-    to->capacity_time_total += WT_STAT_READ(from, capacity_time_total);
-    to->capacity_time_ckpt += WT_STAT_READ(from, capacity_time_ckpt);
-    to->capacity_time_evict += WT_STAT_READ(from, capacity_time_evict);
-    to->capacity_time_log += WT_STAT_READ(from, capacity_time_log);
-    to->capacity_time_read += WT_STAT_READ(from, capacity_time_read);
-    to->cond_auto_wait_reset += WT_STAT_READ(from, cond_auto_wait_reset);
-    to->cond_auto_wait += WT_STAT_READ(from, cond_auto_wait);
-    to->time_travel += WT_STAT_READ(from, time_travel);
-    to->file_open += WT_STAT_READ(from, file_open);
-    to->memory_allocation += WT_STAT_READ(from, memory_allocation);
-    to->memory_free += WT_STAT_READ(from, memory_free);
-    to->memory_grow += WT_STAT_READ(from, memory_grow);
-    to->cond_wait += WT_STAT_READ(from, cond_wait);
-    to->rwlock_read += WT_STAT_READ(from, rwlock_read);
-    to->rwlock_write += WT_STAT_READ(from, rwlock_write);
-    to->fsync_io += WT_STAT_READ(from, fsync_io);
-    to->read_io += WT_STAT_READ(from, read_io);
-    to->write_io += WT_STAT_READ(from, write_io);
-    to->cursor_cached_count += WT_STAT_READ(from, cursor_cached_count);
-    to->cursor_insert_bulk += WT_STAT_READ(from, cursor_insert_bulk);
-    to->cursor_cache += WT_STAT_READ(from, cursor_cache);
-    to->cursor_create += WT_STAT_READ(from, cursor_create);
-    to->cursor_insert += WT_STAT_READ(from, cursor_insert);
-    to->cursor_insert_bytes += WT_STAT_READ(from, cursor_insert_bytes);
-    to->cursor_modify += WT_STAT_READ(from, cursor_modify);
-    to->cursor_modify_bytes += WT_STAT_READ(from, cursor_modify_bytes);
-    to->cursor_modify_bytes_touch += WT_STAT_READ(from, cursor_modify_bytes_touch);
-    to->cursor_next += WT_STAT_READ(from, cursor_next);
-    to->cursor_restart += WT_STAT_READ(from, cursor_restart);
-    to->cursor_prev += WT_STAT_READ(from, cursor_prev);
-    to->cursor_remove += WT_STAT_READ(from, cursor_remove);
-    to->cursor_remove_bytes += WT_STAT_READ(from, cursor_remove_bytes);
-    to->cursor_reserve += WT_STAT_READ(from, cursor_reserve);
-    to->cursor_reset += WT_STAT_READ(from, cursor_reset);
-    to->cursor_search += WT_STAT_READ(from, cursor_search);
-    to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
-    to->cursor_sweep_buckets += WT_STAT_READ(from, cursor_sweep_buckets);
-    to->cursor_sweep_closed += WT_STAT_READ(from, cursor_sweep_closed);
-    to->cursor_sweep_examined += WT_STAT_READ(from, cursor_sweep_examined);
-    to->cursor_sweep += WT_STAT_READ(from, cursor_sweep);
-    to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
-    to->cursor_update += WT_STAT_READ(from, cursor_update);
-    to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
-    to->cursor_update_bytes_changed += WT_STAT_READ(from, cursor_update_bytes_changed);
-    to->cursor_reopen += WT_STAT_READ(from, cursor_reopen);
-    to->cursor_open_count += WT_STAT_READ(from, cursor_open_count);
-    to->dh_conn_handle_size += WT_STAT_READ(from, dh_conn_handle_size);
-    to->dh_conn_handle_count += WT_STAT_READ(from, dh_conn_handle_count);
-    to->dh_sweep_ref += WT_STAT_READ(from, dh_sweep_ref);
-    to->dh_sweep_close += WT_STAT_READ(from, dh_sweep_close);
-    to->dh_sweep_remove += WT_STAT_READ(from, dh_sweep_remove);
-    to->dh_sweep_tod += WT_STAT_READ(from, dh_sweep_tod);
-    to->dh_sweeps += WT_STAT_READ(from, dh_sweeps);
-    to->dh_session_handles += WT_STAT_READ(from, dh_session_handles);
-    to->dh_session_sweeps += WT_STAT_READ(from, dh_session_sweeps);
-    to->lock_checkpoint_count += WT_STAT_READ(from, lock_checkpoint_count);
-    to->lock_checkpoint_wait_application += WT_STAT_READ(from, lock_checkpoint_wait_application);
-    to->lock_checkpoint_wait_internal += WT_STAT_READ(from, lock_checkpoint_wait_internal);
-    to->lock_dhandle_wait_application += WT_STAT_READ(from, lock_dhandle_wait_application);
-    to->lock_dhandle_wait_internal += WT_STAT_READ(from, lock_dhandle_wait_internal);
-    to->lock_dhandle_read_count += WT_STAT_READ(from, lock_dhandle_read_count);
-    to->lock_dhandle_write_count += WT_STAT_READ(from, lock_dhandle_write_count);
-    to->lock_durable_timestamp_wait_application +=
-      WT_STAT_READ(from, lock_durable_timestamp_wait_application);
-    to->lock_durable_timestamp_wait_internal +=
-      WT_STAT_READ(from, lock_durable_timestamp_wait_internal);
-    to->lock_durable_timestamp_read_count += WT_STAT_READ(from, lock_durable_timestamp_read_count);
-    to->lock_durable_timestamp_write_count +=
-      WT_STAT_READ(from, lock_durable_timestamp_write_count);
-    to->lock_metadata_count += WT_STAT_READ(from, lock_metadata_count);
-    to->lock_metadata_wait_application += WT_STAT_READ(from, lock_metadata_wait_application);
-    to->lock_metadata_wait_internal += WT_STAT_READ(from, lock_metadata_wait_internal);
-    to->lock_read_timestamp_wait_application +=
-      WT_STAT_READ(from, lock_read_timestamp_wait_application);
-    to->lock_read_timestamp_wait_internal += WT_STAT_READ(from, lock_read_timestamp_wait_internal);
-    to->lock_read_timestamp_read_count += WT_STAT_READ(from, lock_read_timestamp_read_count);
-    to->lock_read_timestamp_write_count += WT_STAT_READ(from, lock_read_timestamp_write_count);
-    to->lock_schema_count += WT_STAT_READ(from, lock_schema_count);
-    to->lock_schema_wait_application += WT_STAT_READ(from, lock_schema_wait_application);
-    to->lock_schema_wait_internal += WT_STAT_READ(from, lock_schema_wait_internal);
-    to->lock_table_wait_application += WT_STAT_READ(from, lock_table_wait_application);
-    to->lock_table_wait_internal += WT_STAT_READ(from, lock_table_wait_internal);
-    to->lock_table_read_count += WT_STAT_READ(from, lock_table_read_count);
-    to->lock_table_write_count += WT_STAT_READ(from, lock_table_write_count);
-    to->lock_txn_global_wait_application += WT_STAT_READ(from, lock_txn_global_wait_application);
-    to->lock_txn_global_wait_internal += WT_STAT_READ(from, lock_txn_global_wait_internal);
-    to->lock_txn_global_read_count += WT_STAT_READ(from, lock_txn_global_read_count);
-    to->lock_txn_global_write_count += WT_STAT_READ(from, lock_txn_global_write_count);
-    to->log_slot_switch_busy += WT_STAT_READ(from, log_slot_switch_busy);
-    to->log_force_archive_sleep += WT_STAT_READ(from, log_force_archive_sleep);
-    to->log_bytes_payload += WT_STAT_READ(from, log_bytes_payload);
-    to->log_bytes_written += WT_STAT_READ(from, log_bytes_written);
-    to->log_zero_fills += WT_STAT_READ(from, log_zero_fills);
-    to->log_flush += WT_STAT_READ(from, log_flush);
-    to->log_force_write += WT_STAT_READ(from, log_force_write);
-    to->log_force_write_skip += WT_STAT_READ(from, log_force_write_skip);
-    to->log_compress_writes += WT_STAT_READ(from, log_compress_writes);
-    to->log_compress_write_fails += WT_STAT_READ(from, log_compress_write_fails);
-    to->log_compress_small += WT_STAT_READ(from, log_compress_small);
-    to->log_release_write_lsn += WT_STAT_READ(from, log_release_write_lsn);
-    to->log_scans += WT_STAT_READ(from, log_scans);
-    to->log_scan_rereads += WT_STAT_READ(from, log_scan_rereads);
-    to->log_write_lsn += WT_STAT_READ(from, log_write_lsn);
-    to->log_write_lsn_skip += WT_STAT_READ(from, log_write_lsn_skip);
-    to->log_sync += WT_STAT_READ(from, log_sync);
-    to->log_sync_duration += WT_STAT_READ(from, log_sync_duration);
-    to->log_sync_dir += WT_STAT_READ(from, log_sync_dir);
-    to->log_sync_dir_duration += WT_STAT_READ(from, log_sync_dir_duration);
-    to->log_writes += WT_STAT_READ(from, log_writes);
-    to->log_slot_consolidated += WT_STAT_READ(from, log_slot_consolidated);
-    to->log_max_filesize += WT_STAT_READ(from, log_max_filesize);
-    to->log_prealloc_max += WT_STAT_READ(from, log_prealloc_max);
-    to->log_prealloc_missed += WT_STAT_READ(from, log_prealloc_missed);
-    to->log_prealloc_files += WT_STAT_READ(from, log_prealloc_files);
-    to->log_prealloc_used += WT_STAT_READ(from, log_prealloc_used);
-    to->log_scan_records += WT_STAT_READ(from, log_scan_records);
-    to->log_slot_close_race += WT_STAT_READ(from, log_slot_close_race);
-    to->log_slot_close_unbuf += WT_STAT_READ(from, log_slot_close_unbuf);
-    to->log_slot_closes += WT_STAT_READ(from, log_slot_closes);
-    to->log_slot_races += WT_STAT_READ(from, log_slot_races);
-    to->log_slot_yield_race += WT_STAT_READ(from, log_slot_yield_race);
-    to->log_slot_immediate += WT_STAT_READ(from, log_slot_immediate);
-    to->log_slot_yield_close += WT_STAT_READ(from, log_slot_yield_close);
-    to->log_slot_yield_sleep += WT_STAT_READ(from, log_slot_yield_sleep);
-    to->log_slot_yield += WT_STAT_READ(from, log_slot_yield);
-    to->log_slot_active_closed += WT_STAT_READ(from, log_slot_active_closed);
-    to->log_slot_yield_duration += WT_STAT_READ(from, log_slot_yield_duration);
-    to->log_slot_no_free_slots += WT_STAT_READ(from, log_slot_no_free_slots);
-    to->log_slot_unbuffered += WT_STAT_READ(from, log_slot_unbuffered);
-    to->log_compress_mem += WT_STAT_READ(from, log_compress_mem);
-    to->log_buffer_size += WT_STAT_READ(from, log_buffer_size);
-    to->log_compress_len += WT_STAT_READ(from, log_compress_len);
-    to->log_slot_coalesced += WT_STAT_READ(from, log_slot_coalesced);
-    to->log_close_yields += WT_STAT_READ(from, log_close_yields);
-    to->perf_hist_fsread_latency_lt50 += WT_STAT_READ(from, perf_hist_fsread_latency_lt50);
-    to->perf_hist_fsread_latency_lt100 += WT_STAT_READ(from, perf_hist_fsread_latency_lt100);
-    to->perf_hist_fsread_latency_lt250 += WT_STAT_READ(from, perf_hist_fsread_latency_lt250);
-    to->perf_hist_fsread_latency_lt500 += WT_STAT_READ(from, perf_hist_fsread_latency_lt500);
-    to->perf_hist_fsread_latency_lt1000 += WT_STAT_READ(from, perf_hist_fsread_latency_lt1000);
-    to->perf_hist_fsread_latency_gt1000 += WT_STAT_READ(from, perf_hist_fsread_latency_gt1000);
-    to->perf_hist_fswrite_latency_lt50 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt50);
-    to->perf_hist_fswrite_latency_lt100 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt100);
-    to->perf_hist_fswrite_latency_lt250 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt250);
-    to->perf_hist_fswrite_latency_lt500 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt500);
-    to->perf_hist_fswrite_latency_lt1000 += WT_STAT_READ(from, perf_hist_fswrite_latency_lt1000);
-    to->perf_hist_fswrite_latency_gt1000 += WT_STAT_READ(from, perf_hist_fswrite_latency_gt1000);
-    to->perf_hist_opread_latency_lt250 += WT_STAT_READ(from, perf_hist_opread_latency_lt250);
-    to->perf_hist_opread_latency_lt500 += WT_STAT_READ(from, perf_hist_opread_latency_lt500);
-    to->perf_hist_opread_latency_lt1000 += WT_STAT_READ(from, perf_hist_opread_latency_lt1000);
-    to->perf_hist_opread_latency_lt10000 += WT_STAT_READ(from, perf_hist_opread_latency_lt10000);
-    to->perf_hist_opread_latency_gt10000 += WT_STAT_READ(from, perf_hist_opread_latency_gt10000);
-    to->perf_hist_opwrite_latency_lt250 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt250);
-    to->perf_hist_opwrite_latency_lt500 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt500);
-    to->perf_hist_opwrite_latency_lt1000 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt1000);
-    to->perf_hist_opwrite_latency_lt10000 += WT_STAT_READ(from, perf_hist_opwrite_latency_lt10000);
-    to->perf_hist_opwrite_latency_gt10000 += WT_STAT_READ(from, perf_hist_opwrite_latency_gt10000);
-    to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
-    to->rec_pages += WT_STAT_READ(from, rec_pages);
-    to->rec_pages_eviction += WT_STAT_READ(from, rec_pages_eviction);
-    to->rec_page_delete += WT_STAT_READ(from, rec_page_delete);
-    to->rec_split_stashed_bytes += WT_STAT_READ(from, rec_split_stashed_bytes);
-    to->rec_split_stashed_objects += WT_STAT_READ(from, rec_split_stashed_objects);
-    to->session_open += WT_STAT_READ(from, session_open);
-    to->session_query_ts += WT_STAT_READ(from, session_query_ts);
-    to->session_table_alter_fail += WT_STAT_READ(from, session_table_alter_fail);
-    to->session_table_alter_success += WT_STAT_READ(from, session_table_alter_success);
-    to->session_table_alter_skip += WT_STAT_READ(from, session_table_alter_skip);
-    to->session_table_compact_fail += WT_STAT_READ(from, session_table_compact_fail);
-    to->session_table_compact_success += WT_STAT_READ(from, session_table_compact_success);
-    to->session_table_create_fail += WT_STAT_READ(from, session_table_create_fail);
-    to->session_table_create_success += WT_STAT_READ(from, session_table_create_success);
-    to->session_table_drop_fail += WT_STAT_READ(from, session_table_drop_fail);
-    to->session_table_drop_success += WT_STAT_READ(from, session_table_drop_success);
-    to->session_table_import_fail += WT_STAT_READ(from, session_table_import_fail);
-    to->session_table_import_success += WT_STAT_READ(from, session_table_import_success);
-    to->session_table_rebalance_fail += WT_STAT_READ(from, session_table_rebalance_fail);
-    to->session_table_rebalance_success += WT_STAT_READ(from, session_table_rebalance_success);
-    to->session_table_rename_fail += WT_STAT_READ(from, session_table_rename_fail);
-    to->session_table_rename_success += WT_STAT_READ(from, session_table_rename_success);
-    to->session_table_salvage_fail += WT_STAT_READ(from, session_table_salvage_fail);
-    to->session_table_salvage_success += WT_STAT_READ(from, session_table_salvage_success);
-    to->session_table_truncate_fail += WT_STAT_READ(from, session_table_truncate_fail);
-    to->session_table_truncate_success += WT_STAT_READ(from, session_table_truncate_success);
-    to->session_table_verify_fail += WT_STAT_READ(from, session_table_verify_fail);
-    to->session_table_verify_success += WT_STAT_READ(from, session_table_verify_success);
-    to->thread_fsync_active += WT_STAT_READ(from, thread_fsync_active);
-    to->thread_read_active += WT_STAT_READ(from, thread_read_active);
-    to->thread_write_active += WT_STAT_READ(from, thread_write_active);
-    to->application_evict_time += WT_STAT_READ(from, application_evict_time);
-    to->application_cache_time += WT_STAT_READ(from, application_cache_time);
-    to->txn_release_blocked += WT_STAT_READ(from, txn_release_blocked);
-    to->conn_close_blocked_lsm += WT_STAT_READ(from, conn_close_blocked_lsm);
-    to->dhandle_lock_blocked += WT_STAT_READ(from, dhandle_lock_blocked);
-    to->page_index_slot_ref_blocked += WT_STAT_READ(from, page_index_slot_ref_blocked);
-    to->log_server_sync_blocked += WT_STAT_READ(from, log_server_sync_blocked);
-    to->prepared_transition_blocked_page += WT_STAT_READ(from, prepared_transition_blocked_page);
-    to->page_busy_blocked += WT_STAT_READ(from, page_busy_blocked);
-    to->page_forcible_evict_blocked += WT_STAT_READ(from, page_forcible_evict_blocked);
-    to->page_locked_blocked += WT_STAT_READ(from, page_locked_blocked);
-    to->page_read_blocked += WT_STAT_READ(from, page_read_blocked);
-    to->page_sleep += WT_STAT_READ(from, page_sleep);
-    to->page_del_rollback_blocked += WT_STAT_READ(from, page_del_rollback_blocked);
-    to->child_modify_blocked_page += WT_STAT_READ(from, child_modify_blocked_page);
-    to->txn_prepared_updates_count += WT_STAT_READ(from, txn_prepared_updates_count);
-    to->txn_prepared_updates_lookaside_inserts +=
-      WT_STAT_READ(from, txn_prepared_updates_lookaside_inserts);
-    to->txn_prepared_updates_resolved += WT_STAT_READ(from, txn_prepared_updates_resolved);
-    to->txn_durable_queue_walked += WT_STAT_READ(from, txn_durable_queue_walked);
-    to->txn_durable_queue_empty += WT_STAT_READ(from, txn_durable_queue_empty);
-    to->txn_durable_queue_head += WT_STAT_READ(from, txn_durable_queue_head);
-    to->txn_durable_queue_inserts += WT_STAT_READ(from, txn_durable_queue_inserts);
-    to->txn_durable_queue_len += WT_STAT_READ(from, txn_durable_queue_len);
-    to->txn_snapshots_created += WT_STAT_READ(from, txn_snapshots_created);
-    to->txn_snapshots_dropped += WT_STAT_READ(from, txn_snapshots_dropped);
-    to->txn_prepare += WT_STAT_READ(from, txn_prepare);
-    to->txn_prepare_commit += WT_STAT_READ(from, txn_prepare_commit);
-    to->txn_prepare_active += WT_STAT_READ(from, txn_prepare_active);
-    to->txn_prepare_rollback += WT_STAT_READ(from, txn_prepare_rollback);
-    to->txn_query_ts += WT_STAT_READ(from, txn_query_ts);
-    to->txn_read_queue_walked += WT_STAT_READ(from, txn_read_queue_walked);
-    to->txn_read_queue_empty += WT_STAT_READ(from, txn_read_queue_empty);
-    to->txn_read_queue_head += WT_STAT_READ(from, txn_read_queue_head);
-    to->txn_read_queue_inserts += WT_STAT_READ(from, txn_read_queue_inserts);
-    to->txn_read_queue_len += WT_STAT_READ(from, txn_read_queue_len);
-    to->txn_rollback_to_stable += WT_STAT_READ(from, txn_rollback_to_stable);
-    to->txn_rollback_upd_aborted += WT_STAT_READ(from, txn_rollback_upd_aborted);
-    to->txn_rollback_las_removed += WT_STAT_READ(from, txn_rollback_las_removed);
-    to->txn_set_ts += WT_STAT_READ(from, txn_set_ts);
-    to->txn_set_ts_durable += WT_STAT_READ(from, txn_set_ts_durable);
-    to->txn_set_ts_durable_upd += WT_STAT_READ(from, txn_set_ts_durable_upd);
-    to->txn_set_ts_oldest += WT_STAT_READ(from, txn_set_ts_oldest);
-    to->txn_set_ts_oldest_upd += WT_STAT_READ(from, txn_set_ts_oldest_upd);
-    to->txn_set_ts_stable += WT_STAT_READ(from, txn_set_ts_stable);
-    to->txn_set_ts_stable_upd += WT_STAT_READ(from, txn_set_ts_stable_upd);
-    to->txn_begin += WT_STAT_READ(from, txn_begin);
-    to->txn_checkpoint_running += WT_STAT_READ(from, txn_checkpoint_running);
-    to->txn_checkpoint_generation += WT_STAT_READ(from, txn_checkpoint_generation);
-    to->txn_checkpoint_time_max += WT_STAT_READ(from, txn_checkpoint_time_max);
-    to->txn_checkpoint_time_min += WT_STAT_READ(from, txn_checkpoint_time_min);
-    to->txn_checkpoint_time_recent += WT_STAT_READ(from, txn_checkpoint_time_recent);
-    to->txn_checkpoint_scrub_target += WT_STAT_READ(from, txn_checkpoint_scrub_target);
-    to->txn_checkpoint_scrub_time += WT_STAT_READ(from, txn_checkpoint_scrub_time);
-    to->txn_checkpoint_time_total += WT_STAT_READ(from, txn_checkpoint_time_total);
-    to->txn_checkpoint += WT_STAT_READ(from, txn_checkpoint);
-    to->txn_checkpoint_skipped += WT_STAT_READ(from, txn_checkpoint_skipped);
-    to->txn_fail_cache += WT_STAT_READ(from, txn_fail_cache);
-    to->txn_checkpoint_fsync_post += WT_STAT_READ(from, txn_checkpoint_fsync_post);
-    to->txn_checkpoint_fsync_post_duration +=
-      WT_STAT_READ(from, txn_checkpoint_fsync_post_duration);
-    to->txn_pinned_range += WT_STAT_READ(from, txn_pinned_range);
-    to->txn_pinned_checkpoint_range += WT_STAT_READ(from, txn_pinned_checkpoint_range);
-    to->txn_pinned_snapshot_range += WT_STAT_READ(from, txn_pinned_snapshot_range);
-    to->txn_pinned_timestamp += WT_STAT_READ(from, txn_pinned_timestamp);
-    to->txn_pinned_timestamp_checkpoint += WT_STAT_READ(from, txn_pinned_timestamp_checkpoint);
-    to->txn_pinned_timestamp_reader += WT_STAT_READ(from, txn_pinned_timestamp_reader);
-    to->txn_pinned_timestamp_oldest += WT_STAT_READ(from, txn_pinned_timestamp_oldest);
-    to->txn_timestamp_oldest_active_read += WT_STAT_READ(from, txn_timestamp_oldest_active_read);
-    to->txn_sync += WT_STAT_READ(from, txn_sync);
-    to->txn_commit += WT_STAT_READ(from, txn_commit);
-    to->txn_rollback += WT_STAT_READ(from, txn_rollback);
-    to->txn_update_conflict += WT_STAT_READ(from, txn_update_conflict);
+    __wt_stats_sum(from, &sum, sizeof(sum));
+    __wt_stat_connection_aggregate_single(&sum, to);
+}
+
+void
+__wt_stat_connection_percentiles(WT_CONNECTION_STATS *stats)
+{
+    stats->lat_page_read_p999 = __wt_stat_lat_hist_percentile(&stats->lat_page_read_hist_00, 999);
+    stats->lat_page_read_p99 = __wt_stat_lat_hist_percentile(&stats->lat_page_read_hist_00, 990);
+    stats->lat_checkpoint_metadata_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_metadata_hist_00, 999);
+    stats->lat_checkpoint_metadata_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_metadata_hist_00, 990);
+    stats->lat_checkpoint_prepare_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_prepare_hist_00, 999);
+    stats->lat_checkpoint_prepare_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_prepare_hist_00, 990);
+    stats->lat_checkpoint_scrub_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_scrub_hist_00, 999);
+    stats->lat_checkpoint_scrub_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_scrub_hist_00, 990);
+    stats->lat_checkpoint_sync_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_sync_hist_00, 999);
+    stats->lat_checkpoint_sync_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_sync_hist_00, 990);
+    stats->lat_checkpoint_tree_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_tree_hist_00, 999);
+    stats->lat_checkpoint_tree_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_checkpoint_tree_hist_00, 990);
+    stats->lat_cursor_insert_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_insert_hist_00, 999);
+    stats->lat_cursor_insert_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_insert_hist_00, 990);
+    stats->lat_cursor_remove_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_remove_hist_00, 999);
+    stats->lat_cursor_remove_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_remove_hist_00, 990);
+    stats->lat_cursor_search_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_search_hist_00, 999);
+    stats->lat_cursor_search_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_search_hist_00, 990);
+    stats->lat_cursor_update_p999 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_update_hist_00, 999);
+    stats->lat_cursor_update_p99 =
+      __wt_stat_lat_hist_percentile(&stats->lat_cursor_update_hist_00, 990);
+    stats->lat_txn_commit_p999 = __wt_stat_lat_hist_percentile(&stats->lat_txn_commit_hist_00, 999);
+    stats->lat_txn_commit_p99 = __wt_stat_lat_hist_percentile(&stats->lat_txn_commit_hist_00, 990);
 }
 
 static const char *const __stats_join_desc[] = {
   ": accesses to the main table", ": bloom filter false positives",
   ": checks that conditions of membership are satisfied", ": items inserted into a bloom filter",
-  ": items iterated",
+  ": items inserted into a hash set", ": items iterated",
 };
 
 int
@@ -1796,6 +2826,7 @@ __wt_stat_join_clear_single(WT_JOIN_STATS *stats)
     stats->bloom_false_positive = 0;
     stats->membership_check = 0;
     stats->bloom_insert = 0;
+    stats->hash_insert = 0;
     stats->iterated = 0;
 }
 
@@ -1808,14 +2839,24 @@ __wt_stat_join_clear_all(WT_JOIN_STATS **stats)
         __wt_stat_join_clear_single(stats[i]);
 }
 
+void
+__wt_stat_join_aggregate_single(WT_JOIN_STATS *from, WT_JOIN_STATS *to)
+{
+    to->main_access += from->main_access;
+    to->bloom_false_positive += from->bloom_false_positive;
+    to->membership_check += from->membership_check;
+    to->bloom_insert += from->bloom_insert;
+    to->hash_insert += from->hash_insert;
+    to->iterated += from->iterated;
+}
+
 void
 __wt_stat_join_aggregate(WT_JOIN_STATS **from, WT_JOIN_STATS *to)
 {
-    to->main_access += WT_STAT_READ(from, main_access);
-    to->bloom_false_positive += WT_STAT_READ(from, bloom_false_positive);
-    to->membership_check += WT_STAT_READ(from, membership_check);
-    to->bloom_insert += WT_STAT_READ(from, bloom_insert);
-    to->iterated += WT_STAT_READ(from, iterated);
+    WT_JOIN_STATS sum;
+
+    __wt_stats_sum(from, &sum, sizeof(sum));
+    __wt_stat_join_aggregate_single(&sum, to);
 }
 
 static const char *const __stats_session_desc[] = {
@@ -131,6 +131,12 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
     txn_state->metadata_pinned = txn_state->pinned_id = WT_TXN_NONE;
     F_CLR(txn, WT_TXN_HAS_SNAPSHOT);
 
+    /*
+     * Leave the commit generation: the snapshot may have been shared from the connection's cache,
+     * and replaced cached snapshots can't be freed while we're in an older generation.
+     */
+    __wt_session_gen_leave(session, WT_GEN_COMMIT);
+
     /* Clear a checkpoint's pinned ID. */
     if (WT_SESSION_IS_CHECKPOINT(session)) {
         txn_global->checkpoint_state.pinned_id = WT_TXN_NONE;
@@ -140,6 +146,97 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
     __wt_txn_clear_read_timestamp(session);
 }
 
+/*
+ * __txn_snapshot_cache_get --
+ *     Share the connection's cached snapshot if it is still current, called with the transaction
+ *     table read lock held.
+ */
+static bool
+__txn_snapshot_cache_get(WT_SESSION_IMPL *session)
+{
+    WT_TXN *txn;
+    WT_TXN_GLOBAL *txn_global;
+    WT_TXN_SNAPSHOT *snap;
+    WT_TXN_STATE *txn_state;
+
+    txn = &session->txn;
+    txn_global = &S2C(session)->txn_global;
+    txn_state = WT_SESSION_TXN_STATE(session);
+
+    /*
+     * The snapshot can't be freed while we are in its commit generation. It is current if no
+     * transaction has made updates visible since it was built, it includes the running checkpoint
+     * and the IDs it requires haven't been released.
+     */
+    WT_ORDERED_READ(snap, txn_global->snapshot_cache);
+    if (snap == NULL || snap->commit_gen != __wt_session_gen(session, WT_GEN_COMMIT) ||
+      snap->checkpoint_id != txn_global->checkpoint_state.id ||
+      WT_TXNID_LT(snap->pinned_id, txn_global->oldest_id))
+        return (false);
+
+    if (snap->checkpoint_id != WT_TXN_NONE)
+        txn_state->metadata_pinned = snap->checkpoint_id;
+    txn_state->pinned_id = snap->pinned_id;
+
+    txn->snapshot = snap->snapshot;
+    txn->snapshot_count = snap->snapshot_count;
+    txn->snap_min = snap->snap_min;
+    txn->snap_max = snap->snap_max;
+    F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+    return (true);
+}
+
+/*
+ * __txn_snapshot_cache_set --
+ *     Publish a read-only transaction's snapshot for sharing with other read-only transactions in
+ *     the same commit generation.
+ */
+static void
+__txn_snapshot_cache_set(WT_SESSION_IMPL *session, uint64_t checkpoint_id, uint64_t pinned_id)
+{
+    WT_TXN *txn;
+    WT_TXN_GLOBAL *txn_global;
+    WT_TXN_SNAPSHOT *old, *snap;
+    uint64_t commit_gen;
+
+    txn = &session->txn;
+    txn_global = &S2C(session)->txn_global;
+    commit_gen = __wt_session_gen(session, WT_GEN_COMMIT);
+
+    /* Check if another thread has already cached a snapshot for this generation. */
+    WT_ORDERED_READ(old, txn_global->snapshot_cache);
+    if (old != NULL && old->commit_gen >= commit_gen)
+        return;
+
+    /* Caching is an optimization, ignore allocation failures. */
+    if (__wt_malloc(session, sizeof(WT_TXN_SNAPSHOT) + txn->snapshot_count * sizeof(uint64_t),
+          &snap) != 0)
+        return;
+    snap->commit_gen = commit_gen;
+    snap->checkpoint_id = checkpoint_id;
+    snap->pinned_id = pinned_id;
+    snap->snap_min = txn->snap_min;
+    snap->snap_max = txn->snap_max;
+    snap->snapshot = (uint64_t *)(snap + 1);
+    snap->snapshot_count = txn->snapshot_count;
+    if (txn->snapshot_count != 0)
+        memcpy(snap->snapshot, txn->snapshot, txn->snapshot_count * sizeof(uint64_t));
+
+    if (!__wt_atomic_cas_ptr(&txn_global->snapshot_cache, old, snap)) {
+        __wt_free(session, snap);
+        return;
+    }
+    WT_STAT_CONN_INCR(session, txn_snapshot_cache_set);
+
+    /*
+     * Threads may still be reading the replaced snapshot: stash it until every thread has left the
+     * current commit generation.
+     */
+    if (old != NULL)
+        WT_IGNORE_RET(__wt_stash_add(session, WT_GEN_COMMIT, __wt_gen(session, WT_GEN_COMMIT),
+          old, sizeof(WT_TXN_SNAPSHOT) + old->snapshot_count * sizeof(uint64_t)));
+}
+
 /*
  * __wt_txn_get_snapshot --
  *     Allocate a snapshot.
@@ -151,8 +248,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_STATE *s, *txn_state;
-    uint64_t commit_gen, current_id, id, prev_oldest_id, pinned_id;
+    uint64_t checkpoint_id, commit_gen, current_id, id, prev_oldest_id, pinned_id;
     uint32_t i, n, session_cnt;
+    bool readonly;
 
     conn = S2C(session);
     txn = &session->txn;
@@ -160,6 +258,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
     txn_state = WT_SESSION_TXN_STATE(session);
     n = 0;
 
+    /* Only transactions without an ID can share snapshots, others exclude their own ID. */
+    readonly = txn->id == WT_TXN_NONE && txn_state->id == WT_TXN_NONE;
+
     /* Fast path if we already have the current snapshot. */
     if ((commit_gen = __wt_session_gen(session, WT_GEN_COMMIT)) != 0) {
         if (F_ISSET(txn, WT_TXN_HAS_SNAPSHOT) && commit_gen == __wt_gen(session, WT_GEN_COMMIT))
@@ -171,6 +272,14 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
     /* We're going to scan the table: wait for the lock. */
     __wt_readlock(session, &txn_global->rwlock);
 
+    /* Read-only transactions can avoid the scan if the cached snapshot is current. */
+    if (readonly && __txn_snapshot_cache_get(session)) {
+        __wt_readunlock(session, &txn_global->rwlock);
+        WT_STAT_CONN_INCR(session, txn_snapshot_cache_hit);
+        return;
+    }
+
+    txn->snapshot = txn->snapshot_local;
     current_id = pinned_id = txn_global->current;
     prev_oldest_id = txn_global->oldest_id;
 
@@ -179,9 +288,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
      * changes the checkpoint has written to the metadata. We don't have to keep the checkpoint's
      * changes pinned so don't including it in the published pinned ID.
      */
-    if ((id = txn_global->checkpoint_state.id) != WT_TXN_NONE) {
-        txn->snapshot[n++] = id;
-        txn_state->metadata_pinned = id;
+    if ((checkpoint_id = txn_global->checkpoint_state.id) != WT_TXN_NONE) {
+        txn->snapshot[n++] = checkpoint_id;
+        txn_state->metadata_pinned = checkpoint_id;
     }
 
     /* For pure read-only workloads, avoid scanning. */
@@ -245,6 +354,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
 done:
     __wt_readunlock(session, &txn_global->rwlock);
     __txn_sort_snapshot(session, n, current_id);
+
+    if (readonly)
+        __txn_snapshot_cache_set(session, checkpoint_id, txn_state->pinned_id);
 }
 
 /*
@@ -773,7 +885,6 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
     WT_UPDATE *upd;
     wt_timestamp_t candidate_durable_timestamp, prev_durable_timestamp;
     int64_t resolved_update_count, visited_update_count;
-    uint32_t fileid;
     u_int i;
     bool locked, prepare, readonly, skip_update_assert, update_durable_ts;
 
@@ -902,7 +1013,6 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 
     /* Process and free updates. */
     for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++) {
-        fileid = op->btree->id;
         switch (op->type) {
         case WT_TXN_OP_NONE:
             break;
@@ -928,7 +1038,7 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
                 /*
                  * Writes to the lookaside file can be evicted as soon as they commit.
                  */
-                if (conn->cache->las_fileid != 0 && fileid == conn->cache->las_fileid) {
+                if (F_ISSET(op->btree, WT_BTREE_LOOKASIDE)) {
                     upd->txnid = WT_TXN_NONE;
                     break;
                 }
@@ -1088,8 +1198,7 @@ __wt_txn_prepare(WT_SESSION_IMPL *session, const char *cfg[])
     for (i = txn->mod_count; i > 0; i--) {
         op = &txn->mod[i - 1];
         /* Assert it's not an update to the lookaside file. */
-        WT_ASSERT(
-          session, S2C(session)->cache->las_fileid == 0 || !F_ISSET(op->btree, WT_BTREE_LOOKASIDE));
+        WT_ASSERT(session, !F_ISSET(op->btree, WT_BTREE_LOOKASIDE));
 
         /* Metadata updates should never be prepared. */
         WT_ASSERT(session, !WT_IS_METADATA(op->btree->dhandle));
@@ -1163,9 +1272,16 @@ __wt_txn_prepare(WT_SESSION_IMPL *session, const char *cfg[])
      * Clear the transaction's ID from the global table, to facilitate prepared data visibility, but
      * not from local transaction structure.
      */
-    if (F_ISSET(txn, WT_TXN_HAS_ID))
+    if (F_ISSET(txn, WT_TXN_HAS_ID)) {
         __txn_remove_from_global_table(session);
 
+        /*
+         * Snapshots taken from now on don't include our ID, so a reader's check of the prepared
+         * updates finds the conflict: start a new commit generation to refresh cached snapshots.
+         */
+        WT_IGNORE_RET(__wt_gen_next(session, WT_GEN_COMMIT));
+    }
+
     return (0);
 }
 
@@ -1198,8 +1314,7 @@ __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
     /* Rollback updates. */
     for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++) {
         /* Assert it's not an update to the lookaside file. */
-        WT_ASSERT(
-          session, S2C(session)->cache->las_fileid == 0 || !F_ISSET(op->btree, WT_BTREE_LOOKASIDE));
+        WT_ASSERT(session, !F_ISSET(op->btree, WT_BTREE_LOOKASIDE));
 
         /* Metadata updates should never be rolled back. */
         WT_ASSERT(session, !WT_IS_METADATA(op->btree->dhandle));
@@ -1301,7 +1416,8 @@ __wt_txn_init(WT_SESSION_IMPL *session, WT_SESSION_IMPL *session_ret)
     txn = &session_ret->txn;
     txn->id = WT_TXN_NONE;
 
-    WT_RET(__wt_calloc_def(session, S2C(session_ret)->session_size, &txn->snapshot));
+    WT_RET(__wt_calloc_def(session, S2C(session_ret)->session_size, &txn->snapshot_local));
+    txn->snapshot = txn->snapshot_local;
 
 #ifdef HAVE_DIAGNOSTIC
     if (S2C(session_ret)->txn_global.states != NULL) {
@@ -1335,6 +1451,8 @@ __wt_txn_stats_update(WT_SESSION_IMPL *session)
     wt_timestamp_t oldest_active_read_timestamp;
     wt_timestamp_t pinned_timestamp;
     uint64_t checkpoint_pinned, snapshot_pinned;
+    uint32_t durable_queue_len, read_queue_len;
+    u_int i;
 
     conn = S2C(session);
     txn_global = &conn->txn_global;
@@ -1374,8 +1492,13 @@ __wt_txn_stats_update(WT_SESSION_IMPL *session)
     WT_STAT_SET(session, stats, txn_checkpoint_time_min, conn->ckpt_time_min);
     WT_STAT_SET(session, stats, txn_checkpoint_time_recent, conn->ckpt_time_recent);
     WT_STAT_SET(session, stats, txn_checkpoint_time_total, conn->ckpt_time_total);
-    WT_STAT_SET(session, stats, txn_durable_queue_len, txn_global->durable_timestampq_len);
-    WT_STAT_SET(session, stats, txn_read_queue_len, txn_global->read_timestampq_len);
+
+    for (durable_queue_len = read_queue_len = 0, i = 0; i < WT_TXN_TS_QUEUE_SLOTS; i++) {
+        durable_queue_len += txn_global->durable_timestamp_queues[i].len;
+        read_queue_len += txn_global->read_timestamp_queues[i].len;
+    }
+    WT_STAT_SET(session, stats, txn_durable_queue_len, durable_queue_len);
+    WT_STAT_SET(session, stats, txn_read_queue_len, read_queue_len);
 }
 
 /*
@@ -1403,7 +1526,8 @@ void
 __wt_txn_destroy(WT_SESSION_IMPL *session)
 {
     __wt_txn_release_resources(session);
-    __wt_free(session, session->txn.snapshot);
+    __wt_free(session, session->txn.snapshot_local);
+    session->txn.snapshot = NULL;
 }
 
 /*
@@ -1416,6 +1540,7 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
     WT_CONNECTION_IMPL *conn;
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_STATE *s;
+    WT_TXN_TS_QUEUE *qp;
     u_int i;
 
     WT_UNUSED(cfg);
@@ -1429,11 +1554,15 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RWLOCK_INIT_TRACKED(session, &txn_global->rwlock, txn_global);
     WT_RET(__wt_rwlock_init(session, &txn_global->visibility_rwlock));
 
-    WT_RWLOCK_INIT_TRACKED(session, &txn_global->durable_timestamp_rwlock, durable_timestamp);
-    TAILQ_INIT(&txn_global->durable_timestamph);
+    for (i = 0; i < WT_TXN_TS_QUEUE_SLOTS; i++) {
+        qp = &txn_global->durable_timestamp_queues[i];
+        WT_RWLOCK_INIT_TRACKED(session, &qp->rwlock, durable_timestamp);
+        TAILQ_INIT(&qp->qh);
 
-    WT_RWLOCK_INIT_TRACKED(session, &txn_global->read_timestamp_rwlock, read_timestamp);
-    TAILQ_INIT(&txn_global->read_timestamph);
+        qp = &txn_global->read_timestamp_queues[i];
+        WT_RWLOCK_INIT_TRACKED(session, &qp->rwlock, read_timestamp);
+        TAILQ_INIT(&qp->qh);
+    }
 
     WT_RET(__wt_rwlock_init(session, &txn_global->nsnap_rwlock));
     txn_global->nsnap_oldest_id = WT_TXN_NONE;
@@ -1456,6 +1585,7 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 {
     WT_CONNECTION_IMPL *conn;
     WT_TXN_GLOBAL *txn_global;
+    u_int i;
 
     conn = S2C(session);
     txn_global = &conn->txn_global;
@@ -1465,10 +1595,13 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 
     __wt_spin_destroy(session, &txn_global->id_lock);
     __wt_rwlock_destroy(session, &txn_global->rwlock);
-    __wt_rwlock_destroy(session, &txn_global->durable_timestamp_rwlock);
-    __wt_rwlock_destroy(session, &txn_global->read_timestamp_rwlock);
+    for (i = 0; i < WT_TXN_TS_QUEUE_SLOTS; i++) {
+        __wt_rwlock_destroy(session, &txn_global->durable_timestamp_queues[i].rwlock);
+        __wt_rwlock_destroy(session, &txn_global->read_timestamp_queues[i].rwlock);
+    }
     __wt_rwlock_destroy(session, &txn_global->nsnap_rwlock);
     __wt_rwlock_destroy(session, &txn_global->visibility_rwlock);
+    __wt_free(session, txn_global->snapshot_cache);
     __wt_free(session, txn_global->states);
 }
 
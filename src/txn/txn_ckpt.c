@@ -419,6 +419,7 @@ __checkpoint_reduce_dirty_cache(WT_SESSION_IMPL *session)
     time_stop = __wt_clock(session);
     total_ms = WT_CLOCKDIFF_MS(time_stop, time_start);
     WT_STAT_CONN_SET(session, txn_checkpoint_scrub_time, total_ms);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_checkpoint_scrub, total_ms);
 }
 
 /*
@@ -841,8 +842,12 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
      * Hold the schema lock while starting the transaction and gathering
      * handles so the set we get is complete and correct.
      */
+    time_start = __wt_clock(session);
     WT_WITH_SCHEMA_LOCK(session, ret = __checkpoint_prepare(session, &tracking, cfg));
     WT_ERR(ret);
+    time_stop = __wt_clock(session);
+    WT_STAT_CONN_LAT_HIST_INCR(
+      session, lat_checkpoint_prepare, WT_CLOCKDIFF_MS(time_stop, time_start));
 
     WT_ASSERT(session, txn->isolation == WT_ISO_SNAPSHOT);
 
@@ -859,7 +864,11 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 
     __checkpoint_timing_stress(session);
 
+    time_start = __wt_clock(session);
     WT_ERR(__checkpoint_apply(session, cfg, __checkpoint_tree_helper));
+    time_stop = __wt_clock(session);
+    WT_STAT_CONN_LAT_HIST_INCR(
+      session, lat_checkpoint_tree, WT_CLOCKDIFF_MS(time_stop, time_start));
 
     /*
      * Clear the dhandle so the visibility check doesn't get confused about the snap min. Don't
@@ -899,6 +908,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     fsync_duration_usecs = WT_CLOCKDIFF_US(time_stop, time_start);
     WT_STAT_CONN_INCR(session, txn_checkpoint_fsync_post);
     WT_STAT_CONN_SET(session, txn_checkpoint_fsync_post_duration, fsync_duration_usecs);
+    WT_STAT_CONN_LAT_HIST_INCR(session, lat_checkpoint_sync, fsync_duration_usecs / WT_THOUSAND);
 
     __checkpoint_verbose_track(session, "sync completed");
 
@@ -920,6 +930,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
      * This is very similar to __wt_meta_track_off, ideally they would be
      * merged.
      */
+    time_start = __wt_clock(session);
     if (full || !logging) {
         session->isolation = txn->isolation = WT_ISO_READ_UNCOMMITTED;
         /* Disable metadata tracking during the metadata checkpoint. */
@@ -938,6 +949,9 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     } else
         WT_WITH_DHANDLE(session, WT_SESSION_META_DHANDLE(session),
           ret = __wt_txn_checkpoint_log(session, false, WT_TXN_LOG_CKPT_SYNC, NULL));
+    time_stop = __wt_clock(session);
+    WT_STAT_CONN_LAT_HIST_INCR(
+      session, lat_checkpoint_metadata, WT_CLOCKDIFF_MS(time_stop, time_start));
 
     /*
      * Now that the metadata is stable, re-open the metadata file for regular eviction by clearing
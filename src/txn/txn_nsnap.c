@@ -300,6 +300,7 @@ __wt_txn_named_snapshot_get(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *nameval)
                 WT_TXNID_LE(txn_global->nsnap_oldest_id, txn_state->pinned_id));
             txn->snap_min = nsnap->snap_min;
             txn->snap_max = nsnap->snap_max;
+            txn->snapshot = txn->snapshot_local;
             if ((txn->snapshot_count = nsnap->snapshot_count) != 0)
                 memcpy(
                   txn->snapshot, nsnap->snapshot, nsnap->snapshot_count * sizeof(*nsnap->snapshot));
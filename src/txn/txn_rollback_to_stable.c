@@ -9,16 +9,17 @@
 #include "wt_internal.h"
 
 /*
- * __txn_rollback_to_stable_lookaside_fixup --
- *     Remove any updates that need to be rolled back from the lookaside file.
+ * __txn_rollback_to_stable_lookaside_part --
+ *     Remove any updates that need to be rolled back from a lookaside file partition.
  */
 static int
-__txn_rollback_to_stable_lookaside_fixup(WT_SESSION_IMPL *session)
+__txn_rollback_to_stable_lookaside_part(WT_SESSION_IMPL *session, u_int partition)
 {
     WT_CONNECTION_IMPL *conn;
     WT_CURSOR *cursor;
     WT_DECL_RET;
     WT_ITEM las_key, las_value;
+    WT_LAS_PARTITION *part;
     WT_TXN_GLOBAL *txn_global;
     wt_timestamp_t durable_timestamp, las_timestamp, rollback_timestamp;
     uint64_t las_counter, las_pageid, las_total, las_txnid;
@@ -27,6 +28,7 @@ __txn_rollback_to_stable_lookaside_fixup(WT_SESSION_IMPL *session)
 
     conn = S2C(session);
     cursor = NULL;
+    part = &conn->cache->las_part[partition];
     las_total = 0;
     session_flags = 0; /* [-Werror=maybe-uninitialized] */
 
@@ -38,13 +40,13 @@ __txn_rollback_to_stable_lookaside_fixup(WT_SESSION_IMPL *session)
     txn_global = &conn->txn_global;
     WT_ORDERED_READ(rollback_timestamp, txn_global->stable_timestamp);
 
-    __wt_las_cursor(session, &cursor, &session_flags);
+    __wt_las_cursor(session, partition, &cursor, &session_flags);
 
     /* Discard pages we read as soon as we're done with them. */
     F_SET(session, WT_SESSION_READ_WONT_NEED);
 
     /* Walk the file. */
-    __wt_writelock(session, &conn->cache->las_sweepwalk_lock);
+    __wt_writelock(session, &part->sweepwalk_lock);
     while ((ret = cursor->next(cursor)) == 0) {
         ++las_total;
         WT_ERR(cursor->get_key(cursor, &las_pageid, &las_id, &las_counter, &las_key));
@@ -73,10 +75,10 @@ __txn_rollback_to_stable_lookaside_fixup(WT_SESSION_IMPL *session)
     WT_ERR_NOTFOUND_OK(ret);
 err:
     if (ret == 0) {
-        conn->cache->las_insert_count = las_total;
-        conn->cache->las_remove_count = 0;
+        part->insert_count = las_total;
+        part->remove_count = 0;
     }
-    __wt_writeunlock(session, &conn->cache->las_sweepwalk_lock);
+    __wt_writeunlock(session, &part->sweepwalk_lock);
     WT_TRET(__wt_las_cursor_close(session, &cursor, session_flags));
 
     F_CLR(session, WT_SESSION_READ_WONT_NEED);
@@ -84,6 +86,20 @@ err:
     return (ret);
 }
 
+/*
+ * __txn_rollback_to_stable_lookaside_fixup --
+ *     Remove any updates that need to be rolled back from the lookaside file.
+ */
+static int
+__txn_rollback_to_stable_lookaside_fixup(WT_SESSION_IMPL *session)
+{
+    u_int i;
+
+    for (i = 0; i < WT_LAS_PARTITIONS; i++)
+        WT_RET(__txn_rollback_to_stable_lookaside_part(session, i));
+    return (0);
+}
+
 /*
  * __txn_abort_newer_update --
  *     Abort updates in an update change with timestamps newer than the rollback timestamp.
@@ -213,6 +229,35 @@ __txn_abort_newer_row_leaf(
     }
 }
 
+/*
+ * __txn_las_history_newer --
+ *     Return if lookaside history kept in memory has updates newer than the timestamp.
+ */
+static int
+__txn_las_history_newer(
+  WT_PAGE_LOOKASIDE *page_las, wt_timestamp_t rollback_timestamp, bool *newerp)
+{
+    WT_DECL_RET;
+    WT_ITEM las_key, las_value;
+    wt_timestamp_t durable_ts, start_ts;
+    uint64_t txnid;
+    uint8_t prepare_state, upd_type;
+    const uint8_t *end, *p;
+
+    *newerp = false;
+    if ((p = page_las->history) == NULL)
+        return (0);
+
+    end = p + page_las->history_size;
+    while ((ret = __wt_las_history_next(&p, end, &las_key, &txnid, &start_ts, &durable_ts,
+              &prepare_state, &upd_type, &las_value)) == 0)
+        if (durable_ts > rollback_timestamp) {
+            *newerp = true;
+            return (0);
+        }
+    return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
 /*
  * __txn_abort_newer_updates --
  *     Abort updates on this page newer than the timestamp.
@@ -223,7 +268,7 @@ __txn_abort_newer_updates(WT_SESSION_IMPL *session, WT_REF *ref, wt_timestamp_t
     WT_DECL_RET;
     WT_PAGE *page;
     uint32_t read_flags;
-    bool local_read;
+    bool local_read, newer;
 
     /*
      * If we created a page image with updates the need to be rolled back,
@@ -244,6 +289,10 @@ __txn_abort_newer_updates(WT_SESSION_IMPL *session, WT_REF *ref, wt_timestamp_t
      * allows those structures to be discarded once the rollback timestamp
      * is stable (crucially for tests, they can be discarded if the
      * connection is closed right after a rollback_to_stable call).
+     *
+     * History kept in memory with the page's lookaside information isn't
+     * in the lookaside table: if any of it is newer than the rollback
+     * timestamp, read it into cache so it's rolled back with the page.
      */
     local_read = false;
     read_flags = WT_READ_WONT_NEED;
@@ -258,6 +307,13 @@ __txn_abort_newer_updates(WT_SESSION_IMPL *session, WT_REF *ref, wt_timestamp_t
             WT_ASSERT(session,
               ref->state != WT_REF_LIMBO && ref->page != NULL && __wt_page_is_modified(ref->page));
             local_read = true;
+        } else {
+            WT_RET(__txn_las_history_newer(ref->page_las, rollback_timestamp, &newer));
+            if (newer) {
+                WT_ASSERT(session, !F_ISSET(&session->txn, WT_TXN_HAS_SNAPSHOT));
+                WT_RET(__wt_page_in(session, ref, read_flags));
+                local_read = true;
+            }
         }
         if (ref->page_las->max_timestamp > rollback_timestamp)
             ref->page_las->max_timestamp = rollback_timestamp;
@@ -432,6 +488,7 @@ __txn_rollback_to_stable_check(WT_SESSION_IMPL *session)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_TXN_GLOBAL *txn_global;
+    u_int i;
     bool txn_active;
 
     conn = S2C(session);
@@ -444,13 +501,15 @@ __txn_rollback_to_stable_check(WT_SESSION_IMPL *session)
      * against spurious conflicts with the sweep server: we exclude it from running concurrent with
      * rolling back the lookaside contents.
      */
-    __wt_writelock(session, &conn->cache->las_sweepwalk_lock);
+    for (i = 0; i < WT_LAS_PARTITIONS; i++)
+        __wt_writelock(session, &conn->cache->las_part[i].sweepwalk_lock);
     ret = __wt_txn_activity_check(session, &txn_active);
 #ifdef HAVE_DIAGNOSTIC
     if (txn_active)
         WT_TRET(__wt_verbose_dump_txn(session));
 #endif
-    __wt_writeunlock(session, &conn->cache->las_sweepwalk_lock);
+    for (i = WT_LAS_PARTITIONS; i > 0; i--)
+        __wt_writeunlock(session, &conn->cache->las_part[i - 1].sweepwalk_lock);
 
     if (ret == 0 && txn_active)
         WT_RET_MSG(session, EINVAL, "rollback_to_stable illegal with active transactions");
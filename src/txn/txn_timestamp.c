@@ -146,7 +146,9 @@ __wt_txn_get_pinned_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, uin
     WT_CONNECTION_IMPL *conn;
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
+    WT_TXN_TS_QUEUE *qp;
     wt_timestamp_t tmp_read_ts, tmp_ts;
+    u_int i;
     bool include_oldest, txn_has_write_lock;
 
     conn = S2C(session);
@@ -169,27 +171,37 @@ __wt_txn_get_pinned_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, uin
     if (!txn_has_write_lock)
         __wt_readunlock(session, &txn_global->rwlock);
 
-    /* Look for the oldest ordinary reader. */
-    __wt_readlock(session, &txn_global->read_timestamp_rwlock);
-    TAILQ_FOREACH (txn, &txn_global->read_timestamph, read_timestampq) {
-        /*
-         * Skip any transactions on the queue that are not active. Copy out value of read timestamp
-         * to prevent possible race where a transaction resets its read timestamp while we traverse
-         * the queue.
-         */
-        if (!__txn_get_read_timestamp(txn, &tmp_read_ts))
+    /*
+     * Look for the oldest ordinary reader, that's the oldest of the first active transactions on
+     * each of the read timestamp queues.
+     */
+    for (i = 0; i < WT_TXN_TS_QUEUE_SLOTS; i++) {
+        qp = &txn_global->read_timestamp_queues[i];
+        if (TAILQ_EMPTY(&qp->qh))
             continue;
-        /*
-         * A zero timestamp is possible here only when the oldest timestamp is not accounted for.
-         */
-        if (tmp_ts == 0 || tmp_read_ts < tmp_ts)
-            tmp_ts = tmp_read_ts;
-        /*
-         * We break on the first active txn on the list.
-         */
-        break;
+
+        __wt_readlock(session, &qp->rwlock);
+        TAILQ_FOREACH (txn, &qp->qh, read_timestampq) {
+            /*
+             * Skip any transactions on the queue that are not active. Copy out value of read
+             * timestamp to prevent possible race where a transaction resets its read timestamp
+             * while we traverse the queue.
+             */
+            if (!__txn_get_read_timestamp(txn, &tmp_read_ts))
+                continue;
+            /*
+             * A zero timestamp is possible here only when the oldest timestamp is not accounted
+             * for.
+             */
+            if (tmp_ts == 0 || tmp_read_ts < tmp_ts)
+                tmp_ts = tmp_read_ts;
+            /*
+             * We break on the first active txn on the list.
+             */
+            break;
+        }
+        __wt_readunlock(session, &qp->rwlock);
     }
-    __wt_readunlock(session, &txn_global->read_timestamp_rwlock);
 
     if (!include_oldest && tmp_ts == 0)
         return (WT_NOTFOUND);
@@ -245,7 +257,9 @@ __txn_global_query_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, cons
     WT_CONNECTION_IMPL *conn;
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
+    WT_TXN_TS_QUEUE *qp;
     wt_timestamp_t ts, tmpts;
+    u_int i;
 
     conn = S2C(session);
     txn_global = &conn->txn_global;
@@ -260,25 +274,26 @@ __txn_global_query_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, cons
         WT_ASSERT(session, ts != WT_TS_NONE);
 
         /*
-         * Skip straight to the commit queue if no running transactions have an explicit durable
-         * timestamp.
-         */
-        if (TAILQ_EMPTY(&txn_global->durable_timestamph))
-            goto done;
-        /*
-         * Compare with the least recently durable transaction.
+         * Compare with the least recently durable transaction on each queue, skipping queues
+         * where no running transactions have an explicit durable timestamp.
          */
-        __wt_readlock(session, &txn_global->durable_timestamp_rwlock);
-        TAILQ_FOREACH (txn, &txn_global->durable_timestamph, durable_timestampq) {
-            if (txn->clear_durable_q)
+        for (i = 0; i < WT_TXN_TS_QUEUE_SLOTS; i++) {
+            qp = &txn_global->durable_timestamp_queues[i];
+            if (TAILQ_EMPTY(&qp->qh))
                 continue;
 
-            tmpts = __txn_get_published_timestamp(session, txn) - 1;
-            if (tmpts < ts)
-                ts = tmpts;
-            break;
+            __wt_readlock(session, &qp->rwlock);
+            TAILQ_FOREACH (txn, &qp->qh, durable_timestampq) {
+                if (txn->clear_durable_q)
+                    continue;
+
+                tmpts = __txn_get_published_timestamp(session, txn) - 1;
+                if (tmpts < ts)
+                    ts = tmpts;
+                break;
+            }
+            __wt_readunlock(session, &qp->rwlock);
         }
-        __wt_readunlock(session, &txn_global->durable_timestamp_rwlock);
 
         /*
          * If a transaction is committing with a durable timestamp of 1, we could return zero here,
@@ -308,7 +323,6 @@ __txn_global_query_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, cons
     } else
         WT_RET_MSG(session, EINVAL, "unknown timestamp query %.*s", (int)cval.len, cval.str);
 
-done:
     *tsp = ts;
     return (0);
 }
@@ -597,38 +611,44 @@ __txn_assert_after_reads(
   WT_SESSION_IMPL *session, const char *op, wt_timestamp_t ts, WT_TXN **prevp)
 {
 #ifdef HAVE_DIAGNOSTIC
-    WT_TXN *prev, *txn = &session->txn;
+    WT_TXN *found, *prev, *txn = &session->txn;
     WT_TXN_GLOBAL *txn_global = &S2C(session)->txn_global;
+    WT_TXN_TS_QUEUE *qp;
     wt_timestamp_t tmp_timestamp;
+    u_int i;
     char ts_string[2][WT_TS_INT_STRING_SIZE];
 
-    __wt_readlock(session, &txn_global->read_timestamp_rwlock);
-    prev = TAILQ_LAST(&txn_global->read_timestamph, __wt_txn_rts_qh);
-    while (prev != NULL) {
-        /*
-         * Skip self and non-active transactions. Copy out value of read timestamp to prevent
-         * possible race where a transaction resets its read timestamp while we traverse the queue.
-         */
-        if (!__txn_get_read_timestamp(prev, &tmp_timestamp) || prev == txn) {
-            prev = TAILQ_PREV(prev, __wt_txn_rts_qh, read_timestampq);
-            continue;
-        }
+    /* Check the latest active reader on each of the read timestamp queues. */
+    for (found = NULL, i = 0; i < WT_TXN_TS_QUEUE_SLOTS; i++) {
+        qp = &txn_global->read_timestamp_queues[i];
+        __wt_readlock(session, &qp->rwlock);
+        for (prev = TAILQ_LAST(&qp->qh, __wt_txn_ts_qh); prev != NULL;
+             prev = TAILQ_PREV(prev, __wt_txn_ts_qh, read_timestampq)) {
+            /*
+             * Skip self and non-active transactions. Copy out value of read timestamp to prevent
+             * possible race where a transaction resets its read timestamp while we traverse the
+             * queue.
+             */
+            if (!__txn_get_read_timestamp(prev, &tmp_timestamp) || prev == txn)
+                continue;
 
-        if (tmp_timestamp >= ts) {
-            __wt_readunlock(session, &txn_global->read_timestamp_rwlock);
-            WT_RET_MSG(session, EINVAL,
-              "%s timestamp %s must be greater than the "
-              "latest active read timestamp %s ",
-              op, __wt_timestamp_to_string(ts, ts_string[0]),
-              __wt_timestamp_to_string(tmp_timestamp, ts_string[1]));
+            if (tmp_timestamp >= ts) {
+                __wt_readunlock(session, &qp->rwlock);
+                WT_RET_MSG(session, EINVAL,
+                  "%s timestamp %s must be greater than the "
+                  "latest active read timestamp %s ",
+                  op, __wt_timestamp_to_string(ts, ts_string[0]),
+                  __wt_timestamp_to_string(tmp_timestamp, ts_string[1]));
+            }
+            break;
         }
-        break;
+        __wt_readunlock(session, &qp->rwlock);
+        if (prev != NULL)
+            found = prev;
     }
 
-    __wt_readunlock(session, &txn_global->read_timestamp_rwlock);
-
     if (prevp != NULL)
-        *prevp = prev;
+        *prevp = found;
 #else
     WT_UNUSED(session);
     WT_UNUSED(op);
@@ -1023,12 +1043,12 @@ void
 __wt_txn_publish_timestamp(WT_SESSION_IMPL *session)
 {
     WT_TXN *qtxn, *txn, *txn_tmp;
-    WT_TXN_GLOBAL *txn_global;
+    WT_TXN_TS_QUEUE *qp;
     wt_timestamp_t ts;
     uint64_t walked;
 
     txn = &session->txn;
-    txn_global = &S2C(session)->txn_global;
+    qp = WT_TXN_TS_QUEUE(session, S2C(session)->txn_global.durable_timestamp_queues);
 
     if (F_ISSET(txn, WT_TXN_TS_PUBLISHED))
         return;
@@ -1048,28 +1068,28 @@ __wt_txn_publish_timestamp(WT_SESSION_IMPL *session)
     } else
         return;
 
-    __wt_writelock(session, &txn_global->durable_timestamp_rwlock);
+    __wt_writelock(session, &qp->rwlock);
     /*
      * If our transaction is on the queue remove it first. The timestamp may move earlier so we
      * otherwise might not remove ourselves before finding where to insert ourselves (which would
      * result in a list loop) and we don't want to walk more of the list than needed.
      */
     if (txn->clear_durable_q) {
-        TAILQ_REMOVE(&txn_global->durable_timestamph, txn, durable_timestampq);
+        TAILQ_REMOVE(&qp->qh, txn, durable_timestampq);
         WT_PUBLISH(txn->clear_durable_q, false);
-        --txn_global->durable_timestampq_len;
+        --qp->len;
     }
     /*
      * Walk the list to look for where to insert our own transaction and remove any transactions
      * that are not active. We stop when we get to the location where we want to insert.
      */
-    if (TAILQ_EMPTY(&txn_global->durable_timestamph)) {
-        TAILQ_INSERT_HEAD(&txn_global->durable_timestamph, txn, durable_timestampq);
+    if (TAILQ_EMPTY(&qp->qh)) {
+        TAILQ_INSERT_HEAD(&qp->qh, txn, durable_timestampq);
         WT_STAT_CONN_INCR(session, txn_durable_queue_empty);
     } else {
         /* Walk from the start, removing cleared entries. */
         walked = 0;
-        TAILQ_FOREACH_SAFE(qtxn, &txn_global->durable_timestamph, durable_timestampq, txn_tmp)
+        TAILQ_FOREACH_SAFE(qtxn, &qp->qh, durable_timestampq, txn_tmp)
         {
             ++walked;
             /*
@@ -1078,31 +1098,31 @@ __wt_txn_publish_timestamp(WT_SESSION_IMPL *session)
             if (!qtxn->clear_durable_q)
                 break;
 
-            TAILQ_REMOVE(&txn_global->durable_timestamph, qtxn, durable_timestampq);
+            TAILQ_REMOVE(&qp->qh, qtxn, durable_timestampq);
             WT_PUBLISH(qtxn->clear_durable_q, false);
-            --txn_global->durable_timestampq_len;
+            --qp->len;
         }
 
         /*
          * Now walk backwards from the end to find the correct position for the insert.
          */
-        qtxn = TAILQ_LAST(&txn_global->durable_timestamph, __wt_txn_dts_qh);
+        qtxn = TAILQ_LAST(&qp->qh, __wt_txn_ts_qh);
         while (qtxn != NULL && __txn_get_published_timestamp(session, qtxn) > ts) {
             ++walked;
-            qtxn = TAILQ_PREV(qtxn, __wt_txn_dts_qh, durable_timestampq);
+            qtxn = TAILQ_PREV(qtxn, __wt_txn_ts_qh, durable_timestampq);
         }
         if (qtxn == NULL) {
-            TAILQ_INSERT_HEAD(&txn_global->durable_timestamph, txn, durable_timestampq);
+            TAILQ_INSERT_HEAD(&qp->qh, txn, durable_timestampq);
             WT_STAT_CONN_INCR(session, txn_durable_queue_head);
         } else
-            TAILQ_INSERT_AFTER(&txn_global->durable_timestamph, qtxn, txn, durable_timestampq);
+            TAILQ_INSERT_AFTER(&qp->qh, qtxn, txn, durable_timestampq);
         WT_STAT_CONN_INCRV(session, txn_durable_queue_walked, walked);
     }
-    ++txn_global->durable_timestampq_len;
+    ++qp->len;
     WT_STAT_CONN_INCR(session, txn_durable_queue_inserts);
     txn->clear_durable_q = false;
     F_SET(txn, WT_TXN_TS_PUBLISHED);
-    __wt_writeunlock(session, &txn_global->durable_timestamp_rwlock);
+    __wt_writeunlock(session, &qp->rwlock);
 }
 
 /*
@@ -1139,76 +1159,76 @@ void
 __wt_txn_publish_read_timestamp(WT_SESSION_IMPL *session)
 {
     WT_TXN *qtxn, *txn, *txn_tmp;
-    WT_TXN_GLOBAL *txn_global;
+    WT_TXN_TS_QUEUE *qp;
     wt_timestamp_t tmp_timestamp;
     uint64_t walked;
 
     txn = &session->txn;
-    txn_global = &S2C(session)->txn_global;
+    qp = WT_TXN_TS_QUEUE(session, S2C(session)->txn_global.read_timestamp_queues);
 
     if (F_ISSET(txn, WT_TXN_PUBLIC_TS_READ))
         return;
 
-    __wt_writelock(session, &txn_global->read_timestamp_rwlock);
+    __wt_writelock(session, &qp->rwlock);
     /*
      * If our transaction is on the queue remove it first. The timestamp may move earlier so we
      * otherwise might not remove ourselves before finding where to insert ourselves (which would
      * result in a list loop) and we don't want to walk more of the list than needed.
      */
     if (txn->clear_read_q) {
-        TAILQ_REMOVE(&txn_global->read_timestamph, txn, read_timestampq);
+        TAILQ_REMOVE(&qp->qh, txn, read_timestampq);
         WT_PUBLISH(txn->clear_read_q, false);
-        --txn_global->read_timestampq_len;
+        --qp->len;
     }
     /*
      * Walk the list to look for where to insert our own transaction and remove any transactions
      * that are not active. We stop when we get to the location where we want to insert.
      */
-    if (TAILQ_EMPTY(&txn_global->read_timestamph)) {
-        TAILQ_INSERT_HEAD(&txn_global->read_timestamph, txn, read_timestampq);
+    if (TAILQ_EMPTY(&qp->qh)) {
+        TAILQ_INSERT_HEAD(&qp->qh, txn, read_timestampq);
         WT_STAT_CONN_INCR(session, txn_read_queue_empty);
     } else {
         /* Walk from the start, removing cleared entries. */
         walked = 0;
-        TAILQ_FOREACH_SAFE(qtxn, &txn_global->read_timestamph, read_timestampq, txn_tmp)
+        TAILQ_FOREACH_SAFE(qtxn, &qp->qh, read_timestampq, txn_tmp)
         {
             ++walked;
             if (!qtxn->clear_read_q)
                 break;
 
-            TAILQ_REMOVE(&txn_global->read_timestamph, qtxn, read_timestampq);
+            TAILQ_REMOVE(&qp->qh, qtxn, read_timestampq);
             WT_PUBLISH(qtxn->clear_read_q, false);
-            --txn_global->read_timestampq_len;
+            --qp->len;
         }
 
         /*
          * Now walk backwards from the end to find the correct position for the insert.
          */
-        qtxn = TAILQ_LAST(&txn_global->read_timestamph, __wt_txn_rts_qh);
+        qtxn = TAILQ_LAST(&qp->qh, __wt_txn_ts_qh);
         while (qtxn != NULL) {
             if (!__txn_get_read_timestamp(qtxn, &tmp_timestamp) ||
               tmp_timestamp > txn->read_timestamp) {
                 ++walked;
-                qtxn = TAILQ_PREV(qtxn, __wt_txn_rts_qh, read_timestampq);
+                qtxn = TAILQ_PREV(qtxn, __wt_txn_ts_qh, read_timestampq);
             } else
                 break;
         }
         if (qtxn == NULL) {
-            TAILQ_INSERT_HEAD(&txn_global->read_timestamph, txn, read_timestampq);
+            TAILQ_INSERT_HEAD(&qp->qh, txn, read_timestampq);
             WT_STAT_CONN_INCR(session, txn_read_queue_head);
         } else
-            TAILQ_INSERT_AFTER(&txn_global->read_timestamph, qtxn, txn, read_timestampq);
+            TAILQ_INSERT_AFTER(&qp->qh, qtxn, txn, read_timestampq);
         WT_STAT_CONN_INCRV(session, txn_read_queue_walked, walked);
     }
     /*
      * We do not set the read timestamp here. It has been set in the caller because special
      * processing for round to oldest.
      */
-    ++txn_global->read_timestampq_len;
+    ++qp->len;
     WT_STAT_CONN_INCR(session, txn_read_queue_inserts);
     txn->clear_read_q = false;
     F_SET(txn, WT_TXN_HAS_TS_READ | WT_TXN_PUBLIC_TS_READ);
-    __wt_writeunlock(session, &txn_global->read_timestamp_rwlock);
+    __wt_writeunlock(session, &qp->rwlock);
 }
 
 /*
@@ -1260,6 +1280,7 @@ __wt_txn_clear_timestamp_queues(WT_SESSION_IMPL *session)
 {
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
+    WT_TXN_TS_QUEUE *qp;
 
     txn = &session->txn;
     txn_global = &S2C(session)->txn_global;
@@ -1268,27 +1289,29 @@ __wt_txn_clear_timestamp_queues(WT_SESSION_IMPL *session)
         return;
 
     if (txn->clear_durable_q) {
-        __wt_writelock(session, &txn_global->durable_timestamp_rwlock);
+        qp = WT_TXN_TS_QUEUE(session, txn_global->durable_timestamp_queues);
+        __wt_writelock(session, &qp->rwlock);
         /*
          * Recheck after acquiring the lock.
          */
         if (txn->clear_durable_q) {
-            TAILQ_REMOVE(&txn_global->durable_timestamph, txn, durable_timestampq);
-            --txn_global->durable_timestampq_len;
+            TAILQ_REMOVE(&qp->qh, txn, durable_timestampq);
+            --qp->len;
             txn->clear_durable_q = false;
         }
-        __wt_writeunlock(session, &txn_global->durable_timestamp_rwlock);
+        __wt_writeunlock(session, &qp->rwlock);
     }
     if (txn->clear_read_q) {
-        __wt_writelock(session, &txn_global->read_timestamp_rwlock);
+        qp = WT_TXN_TS_QUEUE(session, txn_global->read_timestamp_queues);
+        __wt_writelock(session, &qp->rwlock);
         /*
          * Recheck after acquiring the lock.
          */
         if (txn->clear_read_q) {
-            TAILQ_REMOVE(&txn_global->read_timestamph, txn, read_timestampq);
-            --txn_global->read_timestampq_len;
+            TAILQ_REMOVE(&qp->qh, txn, read_timestampq);
+            --qp->len;
             txn->clear_read_q = false;
         }
-        __wt_writeunlock(session, &txn_global->read_timestamp_rwlock);
+        __wt_writeunlock(session, &qp->rwlock);
     }
 }
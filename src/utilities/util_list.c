@@ -143,7 +143,7 @@ list_print(WT_SESSION *session, const char *uri, bool cflag, bool vflag)
          */
         if (!vflag && WT_PREFIX_MATCH(key, WT_SYSTEM_PREFIX))
             continue;
-        if (cflag || vflag || (strcmp(key, WT_METADATA_URI) != 0 && strcmp(key, WT_LAS_URI) != 0))
+        if (cflag || vflag || (strcmp(key, WT_METADATA_URI) != 0 && !WT_IS_LAS_URI(key)))
             printf("%s\n", key);
 
         if (!cflag && !vflag)
@@ -0,0 +1,159 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Drive asynchronous operations the way an event loop would: keep a window of polled operations in
+ * flight, collect them with WT_CONNECTION::async_poll and resubmit the returned handles rather than
+ * allocating new ones. Inserts are followed by point reads of both keys that were inserted and
+ * keys that don't exist, checking each result.
+ */
+#define MAX_INFLIGHT 512
+
+static TEST_OPTS *opts, _opts;
+
+static void run_ops(WT_ASYNC_OP **, bool);
+static void submit(WT_ASYNC_OP *, bool, uint64_t);
+
+int
+main(int argc, char *argv[])
+{
+    struct timespec te, ts;
+    WT_ASYNC_OP *op, *ops[MAX_INFLIGHT];
+    WT_SESSION *session;
+    int op_ret;
+    u_int i;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->table_type = TABLE_ROW;
+    opts->nops = 100000;
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL,
+      "create,cache_size=100MB,async=(enabled=true,ops_max=1024,threads=4)", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    testutil_check(session->create(session, opts->uri, "key_format=Q,value_format=Q"));
+
+    /* Nothing has been submitted, there's nothing to poll. */
+    testutil_assert(opts->conn->async_poll(opts->conn, &op, &op_ret) == WT_NOTFOUND);
+
+    /* A polled operation can't have a callback. */
+    testutil_assert(opts->conn->async_new_op(opts->conn, opts->uri, "poll",
+                      (WT_ASYNC_CALLBACK *)opts, &op) == EINVAL);
+
+    for (i = 0; i < MAX_INFLIGHT; ++i)
+        testutil_check(opts->conn->async_new_op(opts->conn, opts->uri, "poll", NULL, &ops[i]));
+
+    __wt_epoch(NULL, &ts);
+    run_ops(ops, true);
+    __wt_epoch(NULL, &te);
+    printf("%" PRIu64 " polled inserts: %.2lf seconds\n", opts->nops,
+      WT_TIMEDIFF_MS(te, ts) / 1000.0);
+
+    __wt_epoch(NULL, &ts);
+    run_ops(ops, false);
+    __wt_epoch(NULL, &te);
+    printf("%" PRIu64 " polled searches: %.2lf seconds\n", opts->nops,
+      WT_TIMEDIFF_MS(te, ts) / 1000.0);
+
+    /* Every handle was returned to the application, none can be polled again. */
+    testutil_assert(opts->conn->async_poll(opts->conn, &op, &op_ret) == WT_NOTFOUND);
+    for (i = 0; i < MAX_INFLIGHT; ++i)
+        testutil_check(ops[i]->release(ops[i]));
+
+    /* A released handle can't be released again. */
+    testutil_assert(ops[0]->release(ops[0]) == EINVAL);
+
+    testutil_check(session->close(session, NULL));
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
+
+/*
+ * submit --
+ *     Queue the next insert or search.
+ */
+static void
+submit(WT_ASYNC_OP *op, bool insert, uint64_t n)
+{
+    /* Odd keys are inserted with a value derived from the key, and every key is searched for. */
+    if (insert) {
+        op->set_key(op, 2 * n + 1);
+        op->set_value(op, (2 * n + 1) * 3);
+        testutil_check(op->insert(op));
+    } else {
+        op->set_key(op, n + 1);
+        testutil_check(op->search(op));
+    }
+}
+
+/*
+ * run_ops --
+ *     Keep a window of operations in flight until every insert or search has completed.
+ */
+static void
+run_ops(WT_ASYNC_OP **ops, bool insert)
+{
+    WT_ASYNC_OP *op;
+    uint64_t completed, key, submitted, value;
+    int op_ret, ret;
+    u_int i;
+
+    for (completed = submitted = 0, i = 0; i < MAX_INFLIGHT && submitted < opts->nops; ++i)
+        submit(ops[i], insert, submitted++);
+
+    while (completed < opts->nops) {
+        if ((ret = opts->conn->async_poll(opts->conn, &op, &op_ret)) == WT_NOTFOUND) {
+            __wt_yield();
+            continue;
+        }
+        testutil_check(ret);
+        ++completed;
+
+        testutil_check(op->get_key(op, &key));
+        if (insert) {
+            testutil_assert(op->get_type(op) == WT_AOP_INSERT);
+            testutil_check(op_ret);
+        } else {
+            testutil_assert(op->get_type(op) == WT_AOP_SEARCH);
+            if (key % 2 == 0)
+                testutil_assert(op_ret == WT_NOTFOUND);
+            else {
+                testutil_check(op_ret);
+                testutil_check(op->get_value(op, &value));
+                testutil_assert(value == key * 3);
+            }
+        }
+
+        /* Reuse the handle for the next operation. */
+        if (submitted < opts->nops)
+            submit(op, insert, submitted++);
+    }
+}
@@ -0,0 +1,254 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Merge extent lists holding random, adjacent and overlapping ranges, in both the one extent at a
+ * time and single pass paths, and check the result against a map of the file. Then run a
+ * checkpoint workload that merges the extent lists of deleted checkpoints, and verify the file.
+ */
+#define FILE_SIZE 20000
+#define NTRIALS 500
+
+static uint8_t map[FILE_SIZE];
+
+/*
+ * handle_error --
+ *     Skip the overlapping range errors we're expecting to see.
+ */
+static int
+handle_error(WT_EVENT_HANDLER *handler, WT_SESSION *session, int error, const char *message)
+{
+    (void)handler;
+
+    if (strstr(message, "overlaps with") != NULL)
+        return (0);
+
+    (void)fprintf(stderr, "%s: %s\n", message, session->strerror(session, error));
+    return (0);
+}
+
+static WT_EVENT_HANDLER event_handler = {handle_error, NULL, NULL, NULL};
+
+/*
+ * build --
+ *     Build an extent list from the ranges of the map holding a value.
+ */
+static void
+build(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, const char *name, bool track_size,
+  uint8_t value)
+{
+    wt_off_t off, start;
+
+    testutil_check(__wt_block_extlist_init(session, el, name, "merge", track_size));
+    for (off = 0; off < FILE_SIZE;) {
+        if (map[off] != value && map[off] != 3) {
+            ++off;
+            continue;
+        }
+        for (start = off; off < FILE_SIZE && (map[off] == value || map[off] == 3); ++off)
+            ;
+        testutil_check(__wt_block_insert_ext(session, block, el, start, off - start));
+    }
+}
+
+/*
+ * check --
+ *     Check an extent list is well formed and holds exactly the ranges of the map holding any
+ *     value.
+ */
+static void
+check(WT_EXTLIST *el)
+{
+    WT_EXT *ext, *last, *prev[WT_SKIP_MAXDEPTH];
+    uint64_t bytes;
+    wt_off_t off;
+    uint32_t entries;
+    u_int i;
+
+    memset(prev, 0, sizeof(prev));
+    bytes = 0;
+    entries = 0;
+    last = NULL;
+    off = 0;
+    for (ext = el->off[0]; ext != NULL; ext = ext->next[0]) {
+        /* Ranges are sorted, coalesced and match the map. */
+        testutil_assert(ext->size > 0);
+        testutil_assert(last == NULL || last->off + last->size < ext->off);
+        for (; off < ext->off; ++off)
+            testutil_assert(map[off] == 0);
+        for (; off < ext->off + ext->size; ++off)
+            testutil_assert(map[off] != 0);
+
+        /* Every level of the skiplist links the extents at least as deep in order. */
+        for (i = 0; i < ext->depth; ++i) {
+            testutil_assert((prev[i] == NULL ? el->off[i] : prev[i]->next[i]) == ext);
+            prev[i] = ext;
+        }
+        bytes += (uint64_t)ext->size;
+        ++entries;
+        last = ext;
+    }
+    for (; off < FILE_SIZE; ++off)
+        testutil_assert(map[off] == 0);
+    for (i = 0; i < WT_SKIP_MAXDEPTH; ++i)
+        testutil_assert((prev[i] == NULL ? el->off[i] : prev[i]->next[i]) == NULL);
+    testutil_assert(el->bytes == bytes);
+    testutil_assert(el->entries == entries);
+    testutil_assert(el->last == NULL || el->last == last);
+}
+
+/*
+ * fill --
+ *     Fill the map with random ranges for each list: 1 for the first list, 2 for the second, 0 for
+ *     neither. Ranges of different lists are often adjacent. If overlap is set, add a range in both
+ *     lists.
+ */
+static void
+fill(WT_RAND_STATE *rnd, u_int nranges, bool overlap)
+{
+    wt_off_t off, size;
+    uint8_t value;
+
+    memset(map, 0, sizeof(map));
+    for (off = 0; off < FILE_SIZE; off += size) {
+        size = 1 + (wt_off_t)(__wt_random(rnd) % (FILE_SIZE / nranges));
+        size = WT_MIN(size, FILE_SIZE - off);
+        value = (uint8_t)(__wt_random(rnd) % 3);
+        memset(map + off, value, (size_t)size);
+    }
+    if (overlap) {
+        off = (wt_off_t)(__wt_random(rnd) % (FILE_SIZE - 10));
+        memset(map + off, 3, 10);
+    }
+}
+
+/*
+ * merge --
+ *     Merge the first list into the second and check the result.
+ */
+static void
+merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_RAND_STATE *rnd, u_int nranges,
+  bool track_size, bool overlap)
+{
+    WT_EXTLIST a, b;
+    int ret;
+
+    fill(rnd, nranges, overlap);
+    build(session, block, &a, "a", track_size, 1);
+    build(session, block, &b, "b", track_size, 2);
+
+    ret = __wt_block_extlist_merge(session, block, &a, &b);
+    if (overlap) {
+        testutil_assert(ret == EINVAL);
+        testutil_assert(b.bytes <= FILE_SIZE);
+    } else {
+        testutil_check(ret);
+        check(&b);
+    }
+
+    __wt_block_extlist_free(session, &a);
+    __wt_block_extlist_free(session, &b);
+}
+
+/*
+ * workload --
+ *     Update a table between named checkpoints, then drop checkpoints so their extent lists are
+ *     merged, and verify the file.
+ */
+static void
+workload(WT_SESSION *session)
+{
+    WT_CURSOR *cursor;
+    int ckpt, i;
+    char buf[64], value[200];
+
+    testutil_check(session->create(session, "file:merge.wt",
+      "key_format=i,value_format=S,allocation_size=512,leaf_page_max=512,internal_page_max=512"));
+    testutil_check(session->open_cursor(session, "file:merge.wt", NULL, NULL, &cursor));
+    for (ckpt = 0; ckpt < 10; ++ckpt) {
+        for (i = ckpt % 3; i < 5000; i += 1 + ckpt % 3) {
+            testutil_check(__wt_snprintf(value, sizeof(value), "%d.%0150d", ckpt, i));
+            cursor->set_key(cursor, i);
+            cursor->set_value(cursor, value);
+            testutil_check(cursor->insert(cursor));
+        }
+        testutil_check(__wt_snprintf(buf, sizeof(buf), "name=ckpt%d", ckpt));
+        testutil_check(session->checkpoint(session, buf));
+    }
+    testutil_check(cursor->close(cursor));
+
+    testutil_check(session->checkpoint(session, "drop=(ckpt1,ckpt2,ckpt3,ckpt5,ckpt6,ckpt8)"));
+    testutil_check(session->verify(session, "file:merge.wt", NULL));
+    testutil_check(session->checkpoint(session, "drop=(from=all)"));
+    testutil_check(session->verify(session, "file:merge.wt", NULL));
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_BLOCK block;
+    WT_RAND_STATE rnd;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    u_int i;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, &event_handler, "create", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &wt_session));
+    session = (WT_SESSION_IMPL *)wt_session;
+
+    /* Report overlapping ranges as errors, rather than panicking, as verify does. */
+    memset(&block, 0, sizeof(block));
+    block.name = "merge";
+    block.verify = true;
+
+    __wt_random_init(&rnd);
+    for (i = 0; i < NTRIALS; ++i) {
+        /* Lists of comparable size that aren't tracking sizes are merged in a single pass. */
+        merge(session, &block, &rnd, 10 + i % 500, false, false);
+        merge(session, &block, &rnd, 10 + i % 500, true, false);
+        merge(session, &block, &rnd, 10 + i % 500, false, true);
+        merge(session, &block, &rnd, 10 + i % 500, true, true);
+
+        /* A list with a single range is merged one extent at a time. */
+        merge(session, &block, &rnd, 1, false, false);
+        merge(session, &block, &rnd, 1, false, true);
+    }
+
+    workload(wt_session);
+
+    testutil_check(wt_session->close(wt_session, NULL));
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,257 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Check the hazard filter's counts stay balanced with the hazard pointers they count: while cursors
+ * hold pages, after hazard pointers are set and cleared directly, after a session's hazard pointers
+ * are cleared when it closes, and after threads read and update a table in a cache small enough to
+ * keep eviction busy.
+ */
+#define NOPS 20000
+#define NROWS 50000
+#define NSESSIONS 10
+#define NTHREADS 8
+#define URI "file:hazard_filter"
+#define VALUE_SIZE 200
+
+static TEST_OPTS *opts, _opts;
+
+/*
+ * handle_error --
+ *     Skip the hazard pointer errors we're expecting to see when a session closes.
+ */
+static int
+handle_error(WT_EVENT_HANDLER *handler, WT_SESSION *session, int error, const char *message)
+{
+    (void)handler;
+
+    if (strstr(message, "hazard pointer") != NULL)
+        return (0);
+
+    (void)fprintf(stderr, "%s: %s\n", message, session->strerror(session, error));
+    return (0);
+}
+
+static WT_EVENT_HANDLER event_handler = {handle_error, NULL, NULL, NULL};
+
+/*
+ * filter_total --
+ *     Return the sum of the hazard filter's counts.
+ */
+static uint64_t
+filter_total(WT_CONNECTION_IMPL *conn)
+{
+    uint64_t total;
+    u_int i, j;
+
+    for (total = 0, i = 0; i < WT_HAZARD_FILTER_SHARDS; ++i)
+        for (j = 0; j < WT_HAZARD_FILTER_SLOTS; ++j)
+            total += conn->hazard_filter[i].count[j];
+    return (total);
+}
+
+/*
+ * hazard_total --
+ *     Return the number of hazard pointers set by the connection's sessions.
+ */
+static uint64_t
+hazard_total(WT_CONNECTION_IMPL *conn)
+{
+    WT_SESSION_IMPL *s;
+    uint64_t total;
+    uint32_t i;
+
+    for (total = 0, s = conn->sessions, i = 0; i < conn->session_cnt; ++s, ++i)
+        if (s->active)
+            total += s->nhazard;
+    return (total);
+}
+
+/*
+ * check_balanced --
+ *     Check the filter's counts match the hazard pointers set. Internal threads can set and clear
+ *     hazard pointers between the two counts, retry for a while before failing.
+ */
+static void
+check_balanced(WT_CONNECTION_IMPL *conn)
+{
+    int i;
+
+    for (i = 0; filter_total(conn) != hazard_total(conn); ++i) {
+        testutil_assert(i < 1000);
+        __wt_sleep(0, 10 * WT_THOUSAND);
+    }
+}
+
+/*
+ * set_value --
+ *     Set a cursor's value.
+ */
+static void
+set_value(WT_CURSOR *cursor, WT_RAND_STATE *rnd)
+{
+    char value[VALUE_SIZE];
+
+    memset(value, 'a' + (int)(__wt_random(rnd) % 26), sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+    cursor->set_value(cursor, value);
+}
+
+/*
+ * thread_run --
+ *     Read and update random rows.
+ */
+static WT_THREAD_RET
+thread_run(void *arg)
+{
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *session;
+    int i;
+
+    (void)arg;
+
+    __wt_random_init_seed(NULL, &rnd);
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (i = 0; i < NOPS; ++i) {
+        cursor->set_key(cursor, (uint64_t)(__wt_random(&rnd) % NROWS) + 1);
+        if (i % 4 == 0) {
+            set_value(cursor, &rnd);
+            testutil_check(cursor->update(cursor));
+        } else
+            testutil_check(cursor->search(cursor));
+    }
+    testutil_check(session->close(session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+int
+main(int argc, char *argv[])
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_CURSOR *cursor, *cursors[NSESSIONS];
+    WT_CURSOR_BTREE *cbt;
+    WT_HAZARD *hp;
+    WT_RAND_STATE rnd;
+    WT_REF *ref;
+    WT_SESSION *sessions[NSESSIONS], *wt_session;
+    WT_SESSION_IMPL *s, *session;
+    wt_thread_t ids[NTHREADS];
+    uint64_t total;
+    int i;
+    bool busy;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(
+      wiredtiger_open(opts->home, &event_handler, "create,cache_size=100MB", &opts->conn));
+    conn = (WT_CONNECTION_IMPL *)opts->conn;
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &wt_session));
+    session = (WT_SESSION_IMPL *)wt_session;
+    testutil_check(wt_session->create(wt_session, URI, "key_format=r,value_format=S"));
+
+    __wt_random_init_seed(NULL, &rnd);
+    testutil_check(wt_session->open_cursor(wt_session, URI, NULL, "bulk", &cursor));
+    for (i = 1; i <= NROWS; ++i) {
+        cursor->set_key(cursor, (uint64_t)i);
+        set_value(cursor, &rnd);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+    check_balanced(conn);
+
+    /*
+     * Position cursors in several sessions: every page they hold is counted in the filter, and
+     * checking for a hazard pointer to the page finds it.
+     */
+    for (i = 0; i < NSESSIONS; ++i) {
+        testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &sessions[i]));
+        testutil_check(sessions[i]->open_cursor(sessions[i], URI, NULL, NULL, &cursors[i]));
+        cursors[i]->set_key(cursors[i], (uint64_t)(__wt_random(&rnd) % NROWS) + 1);
+        testutil_check(cursors[i]->search(cursors[i]));
+    }
+    testutil_assert(filter_total(conn) >= NSESSIONS);
+    check_balanced(conn);
+    for (i = 0; i < NSESSIONS; ++i) {
+        cbt = (WT_CURSOR_BTREE *)cursors[i];
+        s = (WT_SESSION_IMPL *)sessions[i];
+        WT_WITH_BTREE(s, cbt->btree, hp = __wt_hazard_check(s, cbt->ref, NULL));
+        testutil_assert(hp != NULL && hp->ref == cbt->ref);
+    }
+
+    /*
+     * Set and clear hazard pointers directly on a page another session holds, then leave some set
+     * for the session's close to clear: the counts follow the hazard pointers.
+     */
+    cbt = (WT_CURSOR_BTREE *)cursors[0];
+    ref = cbt->ref;
+    total = filter_total(conn);
+    for (i = 0; i < 3; ++i) {
+#ifdef HAVE_DIAGNOSTIC
+        WT_WITH_BTREE(session, cbt->btree,
+          testutil_check(__wt_hazard_set(session, ref, &busy, __func__, __LINE__)));
+#else
+        WT_WITH_BTREE(session, cbt->btree, testutil_check(__wt_hazard_set(session, ref, &busy)));
+#endif
+        testutil_assert(!busy);
+    }
+    testutil_assert(session->nhazard == 3);
+    testutil_assert(filter_total(conn) == total + 3);
+    WT_WITH_BTREE(session, cbt->btree, testutil_check(__wt_hazard_clear(session, ref)));
+    testutil_assert(filter_total(conn) == total + 2);
+    __wt_hazard_close(session);
+    testutil_assert(session->nhazard == 0);
+    testutil_assert(filter_total(conn) == total);
+
+    /* Release the pages: nothing is counted. */
+    for (i = 0; i < NSESSIONS; ++i)
+        testutil_check(cursors[i]->reset(cursors[i]));
+    check_balanced(conn);
+    for (i = 0; i < NSESSIONS; ++i)
+        testutil_check(sessions[i]->close(sessions[i], NULL));
+
+    /*
+     * Shrink the cache so eviction competes with the threads for pages, then check the counts once
+     * the threads are done.
+     */
+    testutil_check(opts->conn->reconfigure(opts->conn, "cache_size=5MB"));
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(__wt_thread_create(NULL, &ids[i], thread_run, NULL));
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(__wt_thread_join(NULL, &ids[i]));
+    testutil_check(opts->conn->reconfigure(opts->conn, "cache_size=100MB"));
+    check_balanced(conn);
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,168 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Round-trip values through Huffman tables built from skewed frequencies, where the common symbols
+ * have short codes and the decoder takes several symbols from each multi-symbol table lookup. The
+ * values are of every short length so the encoded input ends at every position within a table
+ * entry, and they're decoded from buffers of exactly the encoded size.
+ */
+#define MAX_VALUE 600
+#define NTRIALS 2000
+
+/* Huffman frequency tables are pairs of 4B symbol and frequency. */
+static struct {
+    uint32_t symbol;
+    uint32_t frequency;
+} freqs[256];
+
+/*
+ * gen_value --
+ *     Generate a value of the given length: mostly the common symbols, with an occasional rare one.
+ */
+static void
+gen_value(WT_RAND_STATE *rnd, uint8_t *value, size_t len, u_int ncommon)
+{
+    size_t i;
+    uint32_t r;
+    u_int sym;
+
+    for (i = 0; i < len; ++i) {
+        r = __wt_random(rnd);
+        if (r % 50 == 0) {
+            value[i] = (uint8_t)(r >> 8);
+            continue;
+        }
+
+        /* The first common symbol is the most frequent, each following one half as frequent. */
+        for (sym = 0, r >>= 8; sym < ncommon - 1 && r % 2 == 1; ++sym, r >>= 1)
+            ;
+        value[i] = (uint8_t)('a' + sym);
+    }
+}
+
+/*
+ * round_trip --
+ *     Encode a value, decode it from an exactly sized copy of the encoding and check the result.
+ */
+static void
+round_trip(WT_SESSION_IMPL *session, void *huffman, const uint8_t *value, size_t len)
+{
+    WT_ITEM decoded, encoded;
+    uint8_t *exact;
+
+    memset(&encoded, 0, sizeof(encoded));
+    memset(&decoded, 0, sizeof(decoded));
+    testutil_check(__wt_huffman_encode(session, huffman, value, len, &encoded));
+
+    exact = dmalloc(encoded.size == 0 ? 1 : encoded.size);
+    if (encoded.size != 0)
+        memcpy(exact, encoded.data, encoded.size);
+    testutil_check(__wt_huffman_decode(session, huffman, exact, encoded.size, &decoded));
+    testutil_assert(decoded.size == len);
+    testutil_assert(len == 0 || memcmp(decoded.data, value, len) == 0);
+
+    free(exact);
+    __wt_buf_free(session, &encoded);
+    __wt_buf_free(session, &decoded);
+}
+
+/*
+ * run --
+ *     Build a table where the first ncommon symbols starting at 'a' are ever less frequent, and
+ *     round-trip values through it.
+ */
+static void
+run(WT_SESSION_IMPL *session, WT_RAND_STATE *rnd, u_int ncommon)
+{
+    WT_ITEM encoded;
+    size_t len;
+    u_int i;
+    uint8_t value[MAX_VALUE];
+    void *huffman;
+
+    for (i = 0; i < 256; ++i) {
+        freqs[i].symbol = i;
+        freqs[i].frequency = 1;
+    }
+    for (i = 0; i < ncommon; ++i)
+        freqs['a' + i].frequency = 1U << (24 - i);
+    testutil_check(__wt_huffman_open(session, freqs, 256, 1, &huffman));
+
+    /*
+     * A run of the most common symbol has the shortest codes: check they're short enough that a
+     * table lookup decodes several of them.
+     */
+    memset(value, 'a', MAX_VALUE);
+    memset(&encoded, 0, sizeof(encoded));
+    testutil_check(__wt_huffman_encode(session, huffman, value, MAX_VALUE, &encoded));
+    testutil_assert(encoded.size <= MAX_VALUE / 3);
+    __wt_buf_free(session, &encoded);
+
+    /* Runs of each common symbol, of every short length. */
+    for (i = 0; i < ncommon; ++i) {
+        memset(value, 'a' + (int)i, MAX_VALUE);
+        for (len = 0; len <= 64; ++len)
+            round_trip(session, huffman, value, len);
+    }
+
+    /* Mixed values, of every short length and then random lengths. */
+    for (i = 0; i < NTRIALS; ++i) {
+        len = i <= 64 ? i : __wt_random(rnd) % (MAX_VALUE + 1);
+        gen_value(rnd, value, len, ncommon);
+        round_trip(session, huffman, value, len);
+    }
+
+    __wt_huffman_close(session, huffman);
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_RAND_STATE rnd;
+    WT_SESSION *wt_session;
+    u_int ncommon;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL, "create", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &wt_session));
+
+    __wt_random_init(&rnd);
+    for (ncommon = 1; ncommon <= 8; ++ncommon)
+        run((WT_SESSION_IMPL *)wt_session, &rnd, ncommon);
+
+    testutil_check(wt_session->close(wt_session, NULL));
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,200 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Maintain an index with a custom extractor that sets multi-field keys: each row has two names and
+ * an age, the extractor adds an index key of (name, age) for each name. The extractor's result
+ * cursor is built by the library for each call and packs the key with the format compiled for the
+ * session. Rows are inserted, updated from a second session and removed, and the index is checked
+ * against the table after each step.
+ */
+#define NROWS 2000
+#define AGE(i, gen) ((int32_t)(((i) + (gen)) % 97))
+
+static int
+extract_names(WT_EXTRACTOR *extractor, WT_SESSION *session, const WT_ITEM *key,
+  const WT_ITEM *value, WT_CURSOR *result_cursor)
+{
+    int32_t age;
+    const char *first, *last;
+
+    (void)extractor;
+    (void)key;
+    testutil_check(
+      wiredtiger_struct_unpack(session, value->data, value->size, "SSi", &first, &last, &age));
+
+    result_cursor->set_key(result_cursor, first, age);
+    WT_RET(result_cursor->insert(result_cursor));
+    result_cursor->set_key(result_cursor, last, age);
+    return (result_cursor->insert(result_cursor));
+}
+
+static WT_EXTRACTOR extractor = {extract_names, NULL, NULL};
+
+/*
+ * set_row --
+ *     Insert or update a row.
+ */
+static void
+set_row(WT_CURSOR *cursor, int i, int gen)
+{
+    char first[20], last[20];
+
+    testutil_check(__wt_snprintf(first, sizeof(first), "first%d", i % 50));
+    testutil_check(__wt_snprintf(last, sizeof(last), "last%05d", i));
+    cursor->set_key(cursor, i);
+    cursor->set_value(cursor, first, last, AGE(i, gen));
+    testutil_check(cursor->insert(cursor));
+}
+
+/*
+ * check_index --
+ *     Walk the index, checking its keys are in order, match the rows they reference and that there
+ *     are two for each row.
+ */
+static void
+check_index(WT_SESSION *session, int nrows)
+{
+    WT_CURSOR *cursor;
+    int32_t age, prev_age, row_age;
+    int count, ret;
+    char prev_name[20];
+    const char *first, *last, *name;
+
+    testutil_check(session->open_cursor(session, "index:people:names", NULL, NULL, &cursor));
+    count = 0;
+    prev_name[0] = '\0';
+    prev_age = -1;
+    while ((ret = cursor->next(cursor)) == 0) {
+        testutil_check(cursor->get_key(cursor, &name, &age));
+        testutil_check(cursor->get_value(cursor, &first, &last, &row_age));
+        testutil_assert(strcmp(name, first) == 0 || strcmp(name, last) == 0);
+        testutil_assert(age == row_age);
+
+        /* Index keys are unique here, as the last names are. */
+        ret = strcmp(prev_name, name);
+        testutil_assert(ret < 0 || (ret == 0 && prev_age < age) ||
+          (ret == 0 && prev_age == age && strncmp(name, "first", 5) == 0));
+        testutil_check(__wt_snprintf(prev_name, sizeof(prev_name), "%s", name));
+        prev_age = age;
+        ++count;
+    }
+    testutil_assert(ret == WT_NOTFOUND);
+    testutil_assert(count == 2 * nrows);
+    testutil_check(cursor->close(cursor));
+}
+
+/*
+ * search_index --
+ *     Look up a row through the index.
+ */
+static void
+search_index(WT_SESSION *session, int i, int gen, bool exists)
+{
+    WT_CURSOR *cursor;
+    int32_t age;
+    const char *first, *last;
+    char name[20];
+
+    testutil_check(session->open_cursor(session, "index:people:names", NULL, NULL, &cursor));
+    testutil_check(__wt_snprintf(name, sizeof(name), "last%05d", i));
+    cursor->set_key(cursor, name, AGE(i, gen));
+    if (!exists)
+        testutil_assert(cursor->search(cursor) == WT_NOTFOUND);
+    else {
+        testutil_check(cursor->search(cursor));
+        testutil_check(cursor->get_value(cursor, &first, &last, &age));
+        testutil_assert(strcmp(last, name) == 0);
+        testutil_assert(age == AGE(i, gen));
+    }
+    testutil_check(cursor->close(cursor));
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_CURSOR *cursor;
+    WT_SESSION *session, *session2;
+    int i, nrows;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL, "create", &opts->conn));
+    testutil_check(opts->conn->add_extractor(opts->conn, "names", &extractor, NULL));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session2));
+
+    testutil_check(session->create(session, "table:people",
+      "key_format=i,value_format=SSi,columns=(id,first,last,age)"));
+    testutil_check(
+      session->create(session, "index:people:names", "key_format=Si,extractor=names"));
+
+    /* Insert the rows. */
+    testutil_check(session->open_cursor(session, "table:people", NULL, NULL, &cursor));
+    for (i = 0; i < NROWS; ++i)
+        set_row(cursor, i, 0);
+    testutil_check(cursor->close(cursor));
+    nrows = NROWS;
+    check_index(session, nrows);
+    search_index(session, 7, 0, true);
+
+    /* Update every other row from the second session, changing the age in both index keys. */
+    testutil_check(session2->open_cursor(session2, "table:people", NULL, NULL, &cursor));
+    for (i = 0; i < NROWS; i += 2)
+        set_row(cursor, i, 1);
+    testutil_check(cursor->close(cursor));
+    check_index(session, nrows);
+    check_index(session2, nrows);
+    search_index(session, 8, 0, false);
+    search_index(session, 8, 1, true);
+    search_index(session2, 9, 0, true);
+
+    /* Remove every third row. */
+    testutil_check(session->open_cursor(session, "table:people", NULL, NULL, &cursor));
+    for (i = 0; i < NROWS; i += 3) {
+        cursor->set_key(cursor, i);
+        testutil_check(cursor->remove(cursor));
+        --nrows;
+    }
+    testutil_check(cursor->close(cursor));
+    check_index(session, nrows);
+    check_index(session2, nrows);
+    search_index(session, 3, 0, false);
+    search_index(session, 4, 1, true);
+
+    testutil_check(session2->close(session2, NULL));
+    testutil_check(session->close(session, NULL));
+    testutil_cleanup(opts);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,217 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Check the latency histograms: every value up to well past the last bucket's lower bound is
+ * counted in the bucket whose statistic description names a range including it, percentiles fall
+ * in the bucket holding the value of their rank, and cursor operations are counted.
+ */
+#define MAX_VALUE 400000
+#define NROWS 1000
+#define NVALUES 10000
+
+static int64_t low[WT_LAT_HIST_BUCKETS], high[WT_LAT_HIST_BUCKETS];
+
+/*
+ * get_stat --
+ *     Return a statistic.
+ */
+static int64_t
+get_stat(WT_CURSOR *cursor, int key)
+{
+    int64_t value;
+    const char *desc, *pvalue;
+
+    cursor->set_key(cursor, key);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+    return (value);
+}
+
+/*
+ * load_bounds --
+ *     Read each bucket's bounds from its statistic description.
+ */
+static void
+load_bounds(WT_SESSION *session)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+    u_int i;
+    int n;
+    const char *desc, *p, *pvalue;
+    char buf[20];
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    for (i = 0; i < WT_LAT_HIST_BUCKETS; ++i) {
+        cursor->set_key(cursor, WT_STAT_CONN_LAT_CURSOR_INSERT_HIST_00 + (int)i);
+        testutil_check(cursor->search(cursor));
+        testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+        testutil_assert((p = strstr(desc, "(bucket ")) != NULL);
+        testutil_check(__wt_snprintf(buf, sizeof(buf), "(bucket %02u) - ", i));
+        testutil_assert(strncmp(p, buf, strlen(buf)) == 0);
+        p += strlen(buf);
+        if (i == WT_LAT_HIST_BUCKETS - 1) {
+            testutil_assert(sscanf(p, "%" SCNd64 "us+%n", &low[i], &n) == 1);
+            high[i] = INT64_MAX;
+        } else
+            testutil_assert(sscanf(p, "%" SCNd64 "-%" SCNd64 "us%n", &low[i], &high[i], &n) == 2);
+        testutil_assert(p[n] == '\0');
+        testutil_assert(low[i] <= high[i]);
+        testutil_assert(i == 0 ? low[i] == 0 : low[i] == high[i - 1] + 1);
+    }
+    testutil_check(cursor->close(cursor));
+}
+
+/*
+ * cmp_value --
+ *     Sort values.
+ */
+static int
+cmp_value(const void *a, const void *b)
+{
+    uint64_t x, y;
+
+    x = *(const uint64_t *)a;
+    y = *(const uint64_t *)b;
+    return (x < y ? -1 : (x > y ? 1 : 0));
+}
+
+/*
+ * check_percentiles --
+ *     Count a set of values and check each percentile is in the bucket holding the value of its
+ *     rank.
+ */
+static void
+check_percentiles(uint64_t *values, u_int n)
+{
+    int64_t hist[WT_LAT_HIST_BUCKETS], p;
+    u_int b, i, permille;
+
+    memset(hist, 0, sizeof(hist));
+    for (i = 0; i < n; ++i)
+        ++hist[__wt_stat_lat_hist_bucket(values[i])];
+    qsort(values, n, sizeof(values[0]), cmp_value);
+
+    for (permille = 1; permille <= 1000; ++permille) {
+        p = __wt_stat_lat_hist_percentile(hist, permille);
+        b = __wt_stat_lat_hist_bucket(values[(n * permille + 999) / 1000 - 1]);
+        testutil_assert(p >= low[b] && p <= high[b]);
+        if (b == WT_LAT_HIST_BUCKETS - 1)
+            testutil_assert(p == low[b]);
+    }
+}
+
+/*
+ * check_inserts --
+ *     Check the cursor insert histogram counted every insert and its percentiles match its buckets.
+ */
+static void
+check_inserts(WT_SESSION *session)
+{
+    WT_CURSOR *cursor;
+    int64_t hist[WT_LAT_HIST_BUCKETS], total;
+    u_int i;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    for (total = 0, i = 0; i < WT_LAT_HIST_BUCKETS; ++i)
+        total += hist[i] = get_stat(cursor, WT_STAT_CONN_LAT_CURSOR_INSERT_HIST_00 + (int)i);
+    testutil_assert(total == NROWS);
+    testutil_assert(get_stat(cursor, WT_STAT_CONN_LAT_CURSOR_INSERT_P99) ==
+      __wt_stat_lat_hist_percentile(hist, 990));
+    testutil_assert(get_stat(cursor, WT_STAT_CONN_LAT_CURSOR_INSERT_P999) ==
+      __wt_stat_lat_hist_percentile(hist, 999));
+    testutil_check(cursor->close(cursor));
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *session;
+    uint64_t v, *values;
+    u_int b, i;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL, "create,statistics=(all)", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    load_bounds(session);
+
+    /* Every value lands in the bucket its description names. */
+    for (v = 0; v <= MAX_VALUE; ++v) {
+        b = __wt_stat_lat_hist_bucket(v);
+        testutil_assert(b < WT_LAT_HIST_BUCKETS);
+        testutil_assert((int64_t)v >= low[b] && (int64_t)v <= high[b]);
+    }
+    testutil_assert(__wt_stat_lat_hist_bucket(UINT64_MAX) == WT_LAT_HIST_BUCKETS - 1);
+
+    /*
+     * Percentiles of a few distributions: uniform over the buckets' range, skewed towards small
+     * values, and all in one bucket.
+     */
+    values = dcalloc(NVALUES, sizeof(uint64_t));
+    __wt_random_init(&rnd);
+    for (i = 0; i < NVALUES; ++i)
+        values[i] = __wt_random(&rnd) % MAX_VALUE;
+    check_percentiles(values, NVALUES);
+    for (i = 0; i < NVALUES; ++i)
+        values[i] = (uint64_t)1 << (__wt_random(&rnd) % 18);
+    check_percentiles(values, NVALUES);
+    for (i = 0; i < NVALUES; ++i)
+        values[i] = 100 + __wt_random(&rnd) % 20;
+    check_percentiles(values, NVALUES);
+    for (i = 0; i < 7; ++i)
+        values[i] = 1;
+    check_percentiles(values, 7);
+    free(values);
+
+    /* Cursor inserts are counted, clear the statistics after the table's creation. */
+    testutil_check(session->create(session, "table:t", "key_format=i,value_format=S"));
+    testutil_check(
+      session->open_cursor(session, "statistics:", NULL, "statistics=(all,clear)", &cursor));
+    testutil_check(cursor->close(cursor));
+    testutil_check(session->open_cursor(session, "table:t", NULL, NULL, &cursor));
+    for (i = 0; i < NROWS; ++i) {
+        cursor->set_key(cursor, (int)i);
+        cursor->set_value(cursor, "value");
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+    check_inserts(session);
+
+    testutil_check(session->close(session, NULL));
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,260 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Contend for the connection's checkpoint spinlock and table read/write lock and check each tracked
+ * acquisition lands in the lock's wait time histogram: waiters held off by a long critical section
+ * are counted in the slowest bucket. Then hammer the spinlock with short critical sections,
+ * checking mutual exclusion holds while the lock adjusts its spinning.
+ */
+#define NTHREADS 8
+#define NOPS 20000
+#define HOLD_USECS (100 * WT_THOUSAND)
+
+static const int checkpoint_hist[] = {WT_STAT_CONN_LOCK_CHECKPOINT_HIST_LT10,
+  WT_STAT_CONN_LOCK_CHECKPOINT_HIST_LT100, WT_STAT_CONN_LOCK_CHECKPOINT_HIST_LT1000,
+  WT_STAT_CONN_LOCK_CHECKPOINT_HIST_LT10000, WT_STAT_CONN_LOCK_CHECKPOINT_HIST_GT10000};
+static const int table_hist[] = {WT_STAT_CONN_LOCK_TABLE_HIST_LT10,
+  WT_STAT_CONN_LOCK_TABLE_HIST_LT100, WT_STAT_CONN_LOCK_TABLE_HIST_LT1000,
+  WT_STAT_CONN_LOCK_TABLE_HIST_LT10000, WT_STAT_CONN_LOCK_TABLE_HIST_GT10000};
+
+static WT_CONNECTION *conn;
+static WT_SESSION_IMPL *main_session;
+static volatile uint32_t started;
+static uint64_t counter;
+static int nops;
+
+/*
+ * get_stat --
+ *     Return a connection statistic.
+ */
+static int64_t
+get_stat(WT_SESSION *session, int key)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+    const char *desc, *pvalue;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, key);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, &desc, &pvalue, &value));
+    testutil_check(cursor->close(cursor));
+    return (value);
+}
+
+/*
+ * get_hist --
+ *     Read a lock's wait time histogram.
+ */
+static void
+get_hist(WT_SESSION *session, const int *keys, int64_t *hist)
+{
+    int i;
+
+    for (i = 0; i < WT_LOCK_HIST_BUCKETS; ++i)
+        hist[i] = get_stat(session, keys[i]);
+}
+
+/*
+ * thread_spin --
+ *     Acquire the checkpoint spinlock, bumping the shared counter each time.
+ */
+static WT_THREAD_RET
+thread_spin(void *arg)
+{
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    int i;
+
+    (void)arg;
+    testutil_check(conn->open_session(conn, NULL, NULL, &wt_session));
+    session = (WT_SESSION_IMPL *)wt_session;
+
+    (void)__wt_atomic_addv32(&started, 1);
+    for (i = 0; i < nops; ++i) {
+        __wt_spin_lock_track(session, &S2C(session)->checkpoint_lock);
+        ++counter;
+        __wt_spin_unlock(session, &S2C(session)->checkpoint_lock);
+    }
+
+    testutil_check(wt_session->close(wt_session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * thread_write --
+ *     Acquire the table lock for writing.
+ */
+static WT_THREAD_RET
+thread_write(void *arg)
+{
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+
+    (void)arg;
+    testutil_check(conn->open_session(conn, NULL, NULL, &wt_session));
+    session = (WT_SESSION_IMPL *)wt_session;
+
+    (void)__wt_atomic_addv32(&started, 1);
+    __wt_writelock(session, &S2C(session)->table_lock);
+    __wt_writeunlock(session, &S2C(session)->table_lock);
+
+    testutil_check(wt_session->close(wt_session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * run_threads --
+ *     Start the threads, wait for them to start, hold off for the configured time and then wait for
+ *     them to finish.
+ */
+static void
+run_threads(WT_THREAD_CALLBACK (*func)(void *), uint64_t hold_usecs, void (*unlock)(void))
+{
+    wt_thread_t id[NTHREADS];
+    int i;
+
+    started = 0;
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(__wt_thread_create(NULL, &id[i], func, NULL));
+    while (started != NTHREADS)
+        __wt_yield();
+    if (hold_usecs != 0)
+        __wt_sleep(0, hold_usecs);
+    if (unlock != NULL)
+        unlock();
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(__wt_thread_join(NULL, &id[i]));
+}
+
+/*
+ * checkpoint_unlock --
+ *     Release the checkpoint spinlock held by the main thread.
+ */
+static void
+checkpoint_unlock(void)
+{
+    __wt_spin_unlock(main_session, &S2C(main_session)->checkpoint_lock);
+}
+
+/*
+ * table_unlock --
+ *     Release the table lock held by the main thread.
+ */
+static void
+table_unlock(void)
+{
+    __wt_writeunlock(main_session, &S2C(main_session)->table_lock);
+}
+
+/*
+ * hist_total --
+ *     Return how many acquisitions a histogram recorded since a previous copy.
+ */
+static int64_t
+hist_total(const int64_t *before, const int64_t *after)
+{
+    int64_t total;
+    int i;
+
+    total = 0;
+    for (i = 0; i < WT_LOCK_HIST_BUCKETS; ++i) {
+        testutil_assert(after[i] >= before[i]);
+        total += after[i] - before[i];
+    }
+    return (total);
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_SESSION *session;
+    int64_t after[WT_LOCK_HIST_BUCKETS], before[WT_LOCK_HIST_BUCKETS];
+    int64_t count;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL, "create,statistics=(fast)", &opts->conn));
+    conn = opts->conn;
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    main_session = (WT_SESSION_IMPL *)session;
+
+    /*
+     * Hold the checkpoint spinlock while the threads try to get it: each waits longer than the
+     * slowest bucket's lower bound.
+     */
+    get_hist(session, checkpoint_hist, before);
+    count = get_stat(session, WT_STAT_CONN_LOCK_CHECKPOINT_COUNT);
+    __wt_spin_lock_track(main_session, &S2C(main_session)->checkpoint_lock);
+    nops = 1;
+    counter = 0;
+    run_threads(thread_spin, HOLD_USECS, checkpoint_unlock);
+    testutil_assert(counter == NTHREADS);
+    get_hist(session, checkpoint_hist, after);
+    testutil_assert(hist_total(before, after) == NTHREADS + 1);
+    testutil_assert(
+      get_stat(session, WT_STAT_CONN_LOCK_CHECKPOINT_COUNT) - count == hist_total(before, after));
+    testutil_assert(after[WT_LOCK_HIST_BUCKETS - 1] - before[WT_LOCK_HIST_BUCKETS - 1] > 0);
+
+    /*
+     * The same for the table lock. Readers blocked by a writer can wait without taking a ticket and
+     * aren't tracked, use writers: each takes a ticket and waits its turn.
+     */
+    get_hist(session, table_hist, before);
+    __wt_writelock(main_session, &S2C(main_session)->table_lock);
+    run_threads(thread_write, HOLD_USECS, table_unlock);
+    get_hist(session, table_hist, after);
+    testutil_assert(hist_total(before, after) == NTHREADS + 1);
+    testutil_assert(after[WT_LOCK_HIST_BUCKETS - 1] - before[WT_LOCK_HIST_BUCKETS - 1] > 0);
+
+    /*
+     * Short critical sections: the counter shows the threads excluded each other, the histogram
+     * recorded every acquisition.
+     */
+    get_hist(session, checkpoint_hist, before);
+    nops = NOPS;
+    counter = 0;
+    run_threads(thread_spin, 0, NULL);
+    testutil_assert(counter == NTHREADS * NOPS);
+    get_hist(session, checkpoint_hist, after);
+    testutil_assert(hist_total(before, after) == NTHREADS * NOPS);
+#if SPINLOCK_TYPE == SPINLOCK_GCC
+    testutil_assert(S2C(main_session)->checkpoint_lock.spins >= 0);
+    testutil_assert(S2C(main_session)->checkpoint_lock.spins <= WT_SPIN_COUNT);
+#endif
+
+    testutil_check(session->close(session, NULL));
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -32,6 +32,7 @@
  */
 #define MAX_THREADS 1000
 #define READS_PER_WRITE 10000
+#define WRITE_HEAVY_READS_PER_WRITE 10
 //#define	READS_PER_WRITE	1000000
 //#define	READS_PER_WRITE	100
 
@@ -42,31 +43,30 @@ static WT_RWLOCK rwlock;
 static pthread_rwlock_t p_rwlock;
 static bool running;
 static uint64_t shared_counter;
+static uint64_t reads_per_write;
 
 void *thread_rwlock(void *);
 void *thread_dump(void *);
 
-int
-main(int argc, char *argv[])
+/*
+ * run --
+ *     Run the threads against the lock, optionally configured for reader bias, and report the
+ *     elapsed time.
+ */
+static void
+run(TEST_OPTS *opts, bool read_bias, uint64_t rpw)
 {
     struct timespec te, ts;
-    TEST_OPTS *opts, _opts;
     pthread_t dump_id, id[MAX_THREADS];
     int i;
 
-    opts = &_opts;
-    memset(opts, 0, sizeof(*opts));
-    opts->nthreads = 100;
-    opts->nops = 1000000; /* per thread */
-    testutil_check(testutil_parse_opts(argc, argv, opts));
     running = true;
-
-    testutil_make_work_dir(opts->home);
-    testutil_check(
-      wiredtiger_open(opts->home, NULL, "create,session_max=1000,statistics=(fast)", &opts->conn));
+    reads_per_write = rpw;
+    shared_counter = 0;
 
     testutil_check(__wt_rwlock_init(NULL, &rwlock));
-    testutil_check(pthread_rwlock_init(&p_rwlock, NULL));
+    if (read_bias)
+        __wt_rwlock_read_bias(&rwlock);
 
     testutil_check(pthread_create(&dump_id, NULL, thread_dump, opts));
 
@@ -77,11 +77,51 @@ main(int argc, char *argv[])
     while (--i >= 0)
         testutil_check(pthread_join(id[i], NULL));
     __wt_epoch(NULL, &te);
-    printf("%.2lf\n", WT_TIMEDIFF_MS(te, ts) / 1000.0);
+    printf("%s, %" PRIu64 " reads per write: %.2lf\n", read_bias ? "reader-biased" : "ticket", rpw,
+      WT_TIMEDIFF_MS(te, ts) / 1000.0);
 
     running = false;
     testutil_check(pthread_join(dump_id, NULL));
 
+#ifdef CHECK_CORRECTNESS
+    testutil_assert(shared_counter == opts->nthreads * (opts->nops / rpw));
+#endif
+    __wt_rwlock_destroy(NULL, &rwlock);
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    bool timing;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->nthreads = 100;
+    opts->nops = 1000000; /* per thread */
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+
+    testutil_make_work_dir(opts->home);
+    testutil_check(
+      wiredtiger_open(opts->home, NULL, "create,session_max=1000,statistics=(fast)", &opts->conn));
+
+    testutil_check(pthread_rwlock_init(&p_rwlock, NULL));
+
+    /*
+     * Compare the ticket lock with the reader-biased lock: a read-mostly mix, where reader bias
+     * should win, and a write-heavy mix, where writers keep clearing the bias. The comparison takes
+     * minutes, only run it if timing tests are enabled. Otherwise, check the reader-biased lock with
+     * a fraction of the operations.
+     */
+    timing = testutil_is_flag_set("TESTUTIL_ENABLE_TIMING_TESTS");
+    run(opts, false, READS_PER_WRITE);
+    if (!timing)
+        opts->nops /= 100;
+    run(opts, true, READS_PER_WRITE);
+    if (timing)
+        run(opts, false, WRITE_HEAVY_READS_PER_WRITE);
+    run(opts, true, WRITE_HEAVY_READS_PER_WRITE);
+
     testutil_check(pthread_rwlock_destroy(&p_rwlock));
     testutil_cleanup(opts);
     return (EXIT_SUCCESS);
@@ -106,7 +146,7 @@ thread_rwlock(void *arg)
     if (opts->verbose)
         printf("Running rwlock thread\n");
     for (i = 1; i <= opts->nops; ++i) {
-        writelock = (i % READS_PER_WRITE == 0);
+        writelock = (i % reads_per_write == 0);
 
 #ifdef USE_POSIX
         if (writelock)
@@ -0,0 +1,161 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Stash memory in a session while another session holds an older split generation, and check the
+ * stash is drained as soon as nothing can still be using the memory: when the reader leaves its
+ * generation, when the generation moves on and after waiting for the generation to drain.
+ */
+#define NOBJECTS 100
+#define OBJECT_SIZE 64
+
+static WT_SESSION_IMPL *reader;
+
+/*
+ * stash --
+ *     Stash a batch of objects in the current split generation.
+ */
+static void
+stash(WT_SESSION_IMPL *session)
+{
+    void *p;
+    int i;
+
+    for (i = 0; i < NOBJECTS; ++i) {
+        testutil_check(__wt_malloc(session, OBJECT_SIZE, &p));
+        testutil_check(
+          __wt_stash_add(session, WT_GEN_SPLIT, __wt_gen(session, WT_GEN_SPLIT), p, OBJECT_SIZE));
+    }
+}
+
+/*
+ * stashed --
+ *     Return the number of objects in the session's split stash.
+ */
+static size_t
+stashed(WT_SESSION_IMPL *session)
+{
+    WT_SESSION_STASH *session_stash;
+    size_t cnt, i;
+
+    session_stash = &session->stash[WT_GEN_SPLIT];
+    for (cnt = i = 0; i < session_stash->cnt; ++i)
+        if (session_stash->list[i].p != NULL)
+            ++cnt;
+    return (cnt);
+}
+
+/*
+ * thread_reader --
+ *     Hold the split generation for a while.
+ */
+static WT_THREAD_RET
+thread_reader(void *arg)
+{
+    (void)arg;
+
+    __wt_sleep(0, 100 * WT_THOUSAND);
+    __wt_session_gen_leave(reader, WT_GEN_SPLIT);
+    return (WT_THREAD_RET_VALUE);
+}
+
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    WT_SESSION *wt_reader, *wt_session;
+    WT_SESSION_IMPL *session;
+    wt_thread_t id;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL, "create", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &wt_session));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &wt_reader));
+    session = (WT_SESSION_IMPL *)wt_session;
+    reader = (WT_SESSION_IMPL *)wt_reader;
+    testutil_assert(stashed(session) == 0);
+
+    /*
+     * Stash in the reader's generation and move the generation on, as a split does: nothing can be
+     * freed while the reader is there, everything as soon as it leaves.
+     */
+    __wt_session_gen_enter(reader, WT_GEN_SPLIT);
+    stash(session);
+    WT_IGNORE_RET(__wt_gen_next(session, WT_GEN_SPLIT));
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == NOBJECTS);
+    __wt_session_gen_leave(reader, WT_GEN_SPLIT);
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == 0);
+
+    /*
+     * Stash in the current generation with the reader in it: the first discard can't free anything,
+     * once the generation has moved on and the reader has left, the next discard frees everything.
+     */
+    __wt_session_gen_enter(reader, WT_GEN_SPLIT);
+    stash(session);
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == NOBJECTS);
+    WT_IGNORE_RET(__wt_gen_next(session, WT_GEN_SPLIT));
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == NOBJECTS);
+    __wt_session_gen_leave(reader, WT_GEN_SPLIT);
+    __wt_session_gen_enter(reader, WT_GEN_SPLIT);
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == 0);
+    __wt_session_gen_leave(reader, WT_GEN_SPLIT);
+
+    /*
+     * Wait for the generation to drain while another thread holds it: once the drain returns,
+     * discarding frees everything stashed before it.
+     */
+    __wt_session_gen_enter(reader, WT_GEN_SPLIT);
+    stash(session);
+    testutil_check(__wt_thread_create(NULL, &id, thread_reader, NULL));
+    __wt_gen_next_drain(session, WT_GEN_SPLIT);
+    testutil_assert(!__wt_gen_active(session, WT_GEN_SPLIT, __wt_gen(session, WT_GEN_SPLIT) - 1));
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == 0);
+    testutil_check(__wt_thread_join(NULL, &id));
+
+    /* Leave some memory stashed for the connection to free when it closes. */
+    __wt_session_gen_enter(reader, WT_GEN_SPLIT);
+    stash(session);
+    WT_IGNORE_RET(__wt_gen_next(session, WT_GEN_SPLIT));
+    __wt_stash_discard(session);
+    testutil_assert(stashed(session) == NOBJECTS);
+    __wt_session_gen_leave(reader, WT_GEN_SPLIT);
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
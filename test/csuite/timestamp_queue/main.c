@@ -0,0 +1,199 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Model the way MongoDB drives timestamps: every writer begins a transaction reading at a lagging
+ * read timestamp, reserves a commit timestamp from a shared counter, publishes it and commits. A
+ * separate thread repeatedly queries the all_durable timestamp and uses it to move the stable and
+ * oldest timestamps forward. Every transaction therefore goes through both the read and durable
+ * timestamp queues, which is the hot path this test measures.
+ */
+#define MAX_THREADS 128
+
+static TEST_OPTS *opts, _opts;
+static volatile bool running;
+
+/* The largest commit timestamp handed out so far. */
+static uint64_t commit_ts;
+
+/* The current stable timestamp, used as the read timestamp by new transactions. */
+static volatile uint64_t stable_ts;
+
+/*
+ * Commit timestamps are reserved before they are published to WiredTiger, track them per thread so
+ * the stable timestamp never moves past a reserved but unpublished timestamp.
+ */
+static volatile uint64_t reserved_ts[MAX_THREADS];
+
+static void *thread_commit(void *);
+static void *thread_stable(void *);
+
+int
+main(int argc, char *argv[])
+{
+    struct timespec te, ts;
+    WT_SESSION *session;
+    pthread_t id[MAX_THREADS], stable_id;
+    uint64_t i, thread_id[MAX_THREADS];
+    char tscfg[64];
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->table_type = TABLE_ROW;
+    opts->nthreads = 8;
+    opts->nops = 20000; /* per thread */
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_assert(opts->nthreads <= MAX_THREADS);
+    testutil_make_work_dir(opts->home);
+
+    testutil_check(wiredtiger_open(opts->home, NULL, "create,cache_size=100MB", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    testutil_check(session->create(session, opts->uri, "key_format=Q,value_format=Q"));
+    testutil_check(session->close(session, NULL));
+
+    commit_ts = stable_ts = 1;
+    testutil_check(__wt_snprintf(tscfg, sizeof(tscfg),
+      "oldest_timestamp=%" PRIx64 ",stable_timestamp=%" PRIx64, stable_ts, stable_ts));
+    testutil_check(opts->conn->set_timestamp(opts->conn, tscfg));
+
+    running = true;
+    testutil_check(pthread_create(&stable_id, NULL, thread_stable, NULL));
+
+    __wt_epoch(NULL, &ts);
+    for (i = 0; i < opts->nthreads; ++i) {
+        thread_id[i] = i;
+        testutil_check(pthread_create(&id[i], NULL, thread_commit, &thread_id[i]));
+    }
+    for (i = 0; i < opts->nthreads; ++i)
+        testutil_check(pthread_join(id[i], NULL));
+    __wt_epoch(NULL, &te);
+
+    running = false;
+    testutil_check(pthread_join(stable_id, NULL));
+
+    printf("%" PRIu64 " threads, %" PRIu64 " timestamped commits: %.2lf seconds\n", opts->nthreads,
+      opts->nthreads * opts->nops, WT_TIMEDIFF_MS(te, ts) / 1000.0);
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
+
+/*
+ * thread_commit --
+ *     Run timestamped write transactions.
+ */
+static void *
+thread_commit(void *arg)
+{
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t i, id, ts;
+    char tscfg[64];
+
+    id = *(uint64_t *)arg;
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+
+    for (i = 0; i < opts->nops; ++i) {
+        testutil_check(__wt_snprintf(tscfg, sizeof(tscfg),
+          "read_timestamp=%" PRIx64 ",roundup_timestamps=(read=true)", stable_ts));
+        testutil_check(session->begin_transaction(session, tscfg));
+
+        /*
+         * Reserve a commit timestamp: announce a lower bound before allocating so the stable thread
+         * can't move past it.
+         */
+        WT_PUBLISH(reserved_ts[id], commit_ts);
+        ts = __wt_atomic_add64(&commit_ts, 1);
+        testutil_check(__wt_snprintf(tscfg, sizeof(tscfg), "commit_timestamp=%" PRIx64, ts));
+        testutil_check(session->timestamp_transaction(session, tscfg));
+        WT_PUBLISH(reserved_ts[id], 0);
+
+        cursor->set_key(cursor, id * opts->nops + i + 1);
+        cursor->set_value(cursor, ts);
+        testutil_check(cursor->insert(cursor));
+        testutil_check(session->commit_transaction(session, NULL));
+    }
+
+    testutil_check(session->close(session, NULL));
+    return (NULL);
+}
+
+/*
+ * thread_stable --
+ *     Move the stable and oldest timestamps forward, checking the all_durable timestamp is sane.
+ */
+static void *
+thread_stable(void *arg)
+{
+    uint64_t all_durable, i, pinned, reserved, stable;
+    int ret;
+    char buf[64], tscfg[128];
+
+    WT_UNUSED(arg);
+
+    while (running) {
+        /* There's nothing to do until the first timestamped commit. */
+        ret = opts->conn->query_timestamp(opts->conn, buf, "get=all_durable");
+        if (ret == WT_NOTFOUND) {
+            __wt_yield();
+            continue;
+        }
+        testutil_check(ret);
+        all_durable = strtoull(buf, NULL, 16);
+
+        /* Nothing may become durable behind the stable timestamp. */
+        testutil_assert(all_durable >= stable_ts);
+
+        /*
+         * Check reserved timestamps after querying all_durable: a timestamp reserved after the
+         * query is larger than anything the query could have returned.
+         */
+        stable = all_durable;
+        for (i = 0; i < opts->nthreads; ++i) {
+            WT_ORDERED_READ(reserved, reserved_ts[i]);
+            if (reserved != 0 && reserved < stable)
+                stable = reserved;
+        }
+        if (stable <= stable_ts) {
+            __wt_yield();
+            continue;
+        }
+
+        testutil_check(__wt_snprintf(tscfg, sizeof(tscfg),
+          "oldest_timestamp=%" PRIx64 ",stable_timestamp=%" PRIx64, stable_ts, stable));
+        testutil_check(opts->conn->set_timestamp(opts->conn, tscfg));
+        WT_PUBLISH(stable_ts, stable);
+
+        testutil_check(opts->conn->query_timestamp(opts->conn, buf, "get=pinned"));
+        pinned = strtoull(buf, NULL, 16);
+        testutil_assert(pinned <= stable);
+    }
+    return (NULL);
+}
@@ -0,0 +1,243 @@
+/*-
+ * Public Domain 2014-2019 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Round-trip integers at the boundaries of every encoded length, decoding each from a buffer that
+ * ends exactly at the end of the encoding, a buffer with room for a full-word load past it and with
+ * no limit, and check a limit one byte short is rejected. Then decode runs of integers of mixed
+ * lengths with __wt_vunpack_uint_n the same way.
+ */
+#define NVALUES 2000
+#define RUN_MAX 64
+
+static uint64_t values[NVALUES];
+static u_int nvalues;
+
+void add_value(uint64_t);
+void test_uint(uint64_t, bool *);
+void test_int(int64_t, bool *);
+void test_uint_n(const uint64_t *, u_int);
+
+/*
+ * add_value --
+ *     Add a value and its neighbours to the list of values to test.
+ */
+void
+add_value(uint64_t v)
+{
+    testutil_assert(nvalues + 5 <= NVALUES);
+    values[nvalues++] = v - 2;
+    values[nvalues++] = v - 1;
+    values[nvalues++] = v;
+    values[nvalues++] = v + 1;
+    values[nvalues++] = v + 2;
+}
+
+/*
+ * test_uint --
+ *     Round-trip an unsigned integer, noting its encoded length.
+ */
+void
+test_uint(uint64_t v, bool *lengths)
+{
+    uint64_t r;
+    size_t len;
+    uint8_t buf[WT_INTPACK64_MAXSIZE + 16], *exact, *p;
+    const uint8_t *cp;
+
+    memset(buf, 0xff, sizeof(buf));
+    p = buf;
+    testutil_check(__wt_vpack_uint(&p, sizeof(buf), v));
+    len = WT_PTRDIFF(p, buf);
+    testutil_assert(len >= 1 && len <= WT_INTPACK64_MAXSIZE);
+    testutil_assert(len == __wt_vsize_uint(v));
+    lengths[len] = true;
+
+    /* A buffer with room for a full-word load past the encoding. */
+    cp = buf;
+    testutil_check(__wt_vunpack_uint(&cp, sizeof(buf), &r));
+    testutil_assert(r == v && cp == p);
+
+    /* No limit. */
+    cp = buf;
+    testutil_check(__wt_vunpack_uint(&cp, 0, &r));
+    testutil_assert(r == v && cp == p);
+
+    /* A buffer ending exactly at the end of the encoding, allocated so overreads are caught. */
+    exact = dmalloc(len);
+    memcpy(exact, buf, len);
+    cp = exact;
+    testutil_check(__wt_vunpack_uint(&cp, len, &r));
+    testutil_assert(r == v && cp == exact + len);
+    cp = exact;
+    testutil_check(__wt_vunpack_uint_n(&cp, len, &r, 1));
+    testutil_assert(r == v && cp == exact + len);
+
+    /* A limit one byte short. */
+    if (len > 1) {
+        cp = exact;
+        testutil_assert(__wt_vunpack_uint(&cp, len - 1, &r) == EINVAL);
+        cp = exact;
+        testutil_assert(__wt_vunpack_uint_n(&cp, len - 1, &r, 1) == EINVAL);
+    }
+    free(exact);
+}
+
+/*
+ * test_int --
+ *     Round-trip a signed integer, noting its encoded length.
+ */
+void
+test_int(int64_t v, bool *lengths)
+{
+    int64_t r;
+    size_t len;
+    uint8_t buf[WT_INTPACK64_MAXSIZE + 16], *exact, *p;
+    const uint8_t *cp;
+
+    memset(buf, 0xff, sizeof(buf));
+    p = buf;
+    testutil_check(__wt_vpack_int(&p, sizeof(buf), v));
+    len = WT_PTRDIFF(p, buf);
+    testutil_assert(len >= 1 && len <= WT_INTPACK64_MAXSIZE);
+    testutil_assert(len == __wt_vsize_int(v));
+    lengths[len] = true;
+
+    cp = buf;
+    testutil_check(__wt_vunpack_int(&cp, sizeof(buf), &r));
+    testutil_assert(r == v && cp == p);
+
+    cp = buf;
+    testutil_check(__wt_vunpack_int(&cp, 0, &r));
+    testutil_assert(r == v && cp == p);
+
+    exact = dmalloc(len);
+    memcpy(exact, buf, len);
+    cp = exact;
+    testutil_check(__wt_vunpack_int(&cp, len, &r));
+    testutil_assert(r == v && cp == exact + len);
+
+    if (len > 1) {
+        cp = exact;
+        testutil_assert(__wt_vunpack_int(&cp, len - 1, &r) == EINVAL);
+    }
+    free(exact);
+}
+
+/*
+ * test_uint_n --
+ *     Round-trip a run of unsigned integers.
+ */
+void
+test_uint_n(const uint64_t *run, u_int n)
+{
+    uint64_t r[RUN_MAX];
+    size_t len;
+    u_int i;
+    uint8_t buf[RUN_MAX * WT_INTPACK64_MAXSIZE + 16], *exact, *p;
+    const uint8_t *cp;
+
+    memset(buf, 0xff, sizeof(buf));
+    p = buf;
+    for (i = 0; i < n; ++i)
+        testutil_check(__wt_vpack_uint(&p, sizeof(buf) - WT_PTRDIFF(p, buf), run[i]));
+    len = WT_PTRDIFF(p, buf);
+
+    cp = buf;
+    testutil_check(__wt_vunpack_uint_n(&cp, sizeof(buf), r, n));
+    testutil_assert(cp == p && memcmp(r, run, n * sizeof(r[0])) == 0);
+
+    cp = buf;
+    testutil_check(__wt_vunpack_uint_n(&cp, 0, r, n));
+    testutil_assert(cp == p && memcmp(r, run, n * sizeof(r[0])) == 0);
+
+    exact = dmalloc(len);
+    memcpy(exact, buf, len);
+    cp = exact;
+    testutil_check(__wt_vunpack_uint_n(&cp, len, r, n));
+    testutil_assert(cp == exact + len && memcmp(r, run, n * sizeof(r[0])) == 0);
+
+    /* A limit one byte short, falling in the last integer. A limit of 0 means no limit. */
+    if (len > 1) {
+        cp = exact;
+        testutil_assert(__wt_vunpack_uint_n(&cp, len - 1, r, n) == EINVAL);
+    }
+    free(exact);
+}
+
+int
+main(void)
+{
+    WT_RAND_STATE rnd;
+    uint64_t run[RUN_MAX];
+    u_int i, j, n, shift;
+    bool int_lengths[WT_INTPACK64_MAXSIZE + 1], uint_lengths[WT_INTPACK64_MAXSIZE + 1];
+
+    /*
+     * Required on some systems to pull in parts of the library for which we have data references.
+     */
+    testutil_check(__wt_library_init());
+
+    /* The boundaries of the one and two byte encodings, and of each multi-byte length. */
+    add_value(0);
+    add_value(POS_1BYTE_MAX);
+    add_value(POS_2BYTE_MAX);
+    add_value((uint64_t)NEG_1BYTE_MIN);
+    add_value((uint64_t)NEG_2BYTE_MIN);
+    for (shift = 8; shift < 64; shift += 8) {
+        add_value((uint64_t)1 << shift);
+        add_value(((uint64_t)1 << shift) + POS_2BYTE_MAX);
+        add_value(-((uint64_t)1 << shift));
+        add_value(-((uint64_t)1 << shift) + (uint64_t)NEG_2BYTE_MIN);
+    }
+    add_value(INT64_MAX);
+    add_value(UINT64_MAX);
+
+    memset(int_lengths, 0, sizeof(int_lengths));
+    memset(uint_lengths, 0, sizeof(uint_lengths));
+    for (i = 0; i < nvalues; ++i) {
+        test_uint(values[i], uint_lengths);
+        test_int((int64_t)values[i], int_lengths);
+    }
+
+    /* Every encoded length was tested. */
+    for (i = 1; i <= WT_INTPACK64_MAXSIZE; ++i)
+        testutil_assert(uint_lengths[i] && int_lengths[i]);
+
+    /* Runs of integers with mixed lengths. */
+    __wt_random_init(&rnd);
+    for (i = 0; i < 10000; ++i) {
+        n = 1 + __wt_random(&rnd) % RUN_MAX;
+        for (j = 0; j < n; ++j)
+            run[j] = values[__wt_random(&rnd) % nvalues];
+        test_uint_n(run, n);
+    }
+
+    return (0);
+}
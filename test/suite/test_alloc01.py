@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_alloc01.py
+#   Test that the file size levels off when a tree is repeatedly rewritten
+#   and checkpointed.
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+class test_alloc01(wttest.WiredTigerTestCase):
+    uri = 'table:test_alloc01'
+    # Evict dirty pages aggressively, so pages are written both by eviction
+    # and by checkpoints.
+    conn_config = 'statistics=(all),' + \
+        'eviction_dirty_target=2,eviction_dirty_trigger=5'
+    nentries = 20000
+    checkpoints = 12
+
+    # Each checkpoint rewrites the whole tree, so the blocks of the previous
+    # checkpoint are free once it completes. The first few checkpoints grow
+    # the file, after that the freed blocks should be enough to write into.
+    scenarios = make_scenarios([
+        ('best', dict(alloc='best')),
+        ('first', dict(alloc='first')),
+        ('sequential', dict(alloc='sequential')),
+    ])
+
+    def getSize(self):
+        cstat = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        sz = cstat[stat.dsrc.block_size][2]
+        cstat.close()
+        return sz
+
+    def test_alloc(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,block_allocation=' + self.alloc)
+
+        sizes = []
+        for i in range(0, self.checkpoints):
+            c = self.session.open_cursor(self.uri, None)
+            value = str(i % 10) * 500
+            for k in range(0, self.nentries):
+                c[k] = value
+            c.close()
+            self.session.checkpoint()
+            sizes.append(self.getSize())
+        self.pr('file sizes: ' + str(sizes))
+
+        # Once the file has grown to hold a couple of copies of the tree, it
+        # shouldn't grow any further.
+        half = self.checkpoints // 2
+        self.assertLessEqual(sizes[-1], max(sizes[:half]))
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_cache02.py
+# Structures that live as long as a page are allocated individually, or from
+# chunks shared by the page if the cache_page_arena setting is configured.
+# Update every page of a tree read from disk, check the memory charged to the
+# cache is about the same either way, then switch the setting and insert into
+# the pages allocated the other way, and check the data.
+class test_cache02(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=100MB,statistics=(all)'
+    nrows = 20000
+
+    # Small pages, so the per-page cost of the arena shows.
+    create_config = 'key_format=i,value_format=S,leaf_page_max=4KB'
+
+    def uri(self, arena):
+        return 'table:test_cache02_' + arena
+
+    # Rows are loaded with even keys, every 20th is updated, and odd keys are
+    # inserted after it.
+    def value(self, k):
+        if k % 2 == 1:
+            gen = 2
+        elif k % 40 == 0:
+            gen = 1
+        else:
+            gen = 0
+        return str(gen) + '%08d' % k
+
+    def get_stat(self, uri, stat_key):
+        cstat = self.session.open_cursor('statistics:' + uri, None, None)
+        val = cstat[stat_key][2]
+        cstat.close()
+        return val
+
+    # Read the tree into memory, update every 20th row and return the bytes
+    # the updates added to the tree's memory.
+    def update_tree(self, uri):
+        cursor = self.session.open_cursor(uri)
+        for k, v in cursor:
+            pass
+        before = self.get_stat(uri, stat.dsrc.cache_bytes_inuse)
+        for k in range(0, 2 * self.nrows, 40):
+            cursor[k] = self.value(k)
+        cursor.close()
+        return self.get_stat(uri, stat.dsrc.cache_bytes_inuse) - before
+
+    def insert_tree(self, uri):
+        cursor = self.session.open_cursor(uri)
+        for k in range(1, 2 * self.nrows, 40):
+            cursor[k] = self.value(k)
+        cursor.close()
+
+    def check_tree(self, uri):
+        cursor = self.session.open_cursor(uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k))
+            count += 1
+        self.assertEqual(count, self.nrows + self.nrows // 20)
+        cursor.close()
+
+    def test_page_arena(self):
+        for arena in ('off', 'on'):
+            self.session.create(self.uri(arena), self.create_config)
+            cursor = self.session.open_cursor(self.uri(arena))
+            for k in range(0, 2 * self.nrows, 2):
+                cursor[k] = '0%08d' % k
+            cursor.close()
+
+        # Start with clean pages read from disk.
+        self.reopen_conn()
+        off = self.update_tree(self.uri('off'))
+        self.conn.reconfigure('cache_page_arena=true')
+        on = self.update_tree(self.uri('on'))
+        self.pr('bytes added: off ' + str(off) + ', on ' + str(on))
+        self.assertLess(on, off * 1.2)
+
+        # Both should be about the memory the updates need: a 64B update per
+        # row updated, an update array with a slot for every row of the page,
+        # and some per-page overhead, but not a full arena chunk per page.
+        pages = self.get_stat(self.uri('on'), stat.dsrc.btree_row_leaf)
+        self.assertLess(
+            on, (self.nrows // 20) * 64 + self.nrows * 8 + pages * 1024)
+
+        # Insert into each tree's pages with the setting switched.
+        self.insert_tree(self.uri('off'))
+        self.conn.reconfigure('cache_page_arena=false')
+        self.insert_tree(self.uri('on'))
+        self.check_tree(self.uri('off'))
+        self.check_tree(self.uri('on'))
+
+if __name__ == '__main__':
+    wttest.run()
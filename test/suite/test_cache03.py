@@ -0,0 +1,162 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_cache03.py
+# A page grown past memory_page_max by long update chains on a few hot keys,
+# or by keys instantiated by searches, is shrunk in memory, not evicted: once
+# the updates are obsolete, reading the page discards them and keys searches
+# rarely use, credits their memory back to the cache and the page stays in
+# cache.
+class test_cache03(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=100MB,statistics=(all)'
+    uri = 'table:test_cache03'
+    nkeys = 10
+    nupdates = 100
+    value_size = 1000
+
+    def get_stat(self, stat_key):
+        cstat = self.session.open_cursor('statistics:', None, None)
+        val = cstat[stat_key][2]
+        cstat.close()
+        return val
+
+    def value(self, k, gen):
+        return ('%d.%d.' % (k, gen)).ljust(self.value_size, '.')
+
+    def test_page_shrink(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,memory_page_max=100KB')
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(0, self.nkeys):
+            cursor[k] = self.value(k, 0)
+        cursor.close()
+
+        # Start from the page on disk, so the updates are made to existing
+        # keys.
+        self.session.checkpoint()
+        self.reopen_conn()
+
+        # Update the keys repeatedly in a single transaction: the updates
+        # can't be discarded until it commits, the chains grow and the page
+        # is far larger than memory_page_max.
+        self.session.begin_transaction()
+        cursor = self.session.open_cursor(self.uri)
+        for gen in range(1, self.nupdates + 1):
+            for k in range(0, self.nkeys):
+                cursor[k] = self.value(k, gen)
+        cursor.close()
+        self.session.commit_transaction()
+
+        chains = self.nkeys * self.nupdates * self.value_size
+        inuse = self.get_stat(stat.conn.cache_bytes_inuse)
+        self.assertGreater(inuse, chains)
+        reads = self.get_stat(stat.conn.cache_read)
+        shrunk = self.get_stat(stat.conn.cache_eviction_force_shrink)
+
+        # All but the newest updates are now obsolete: reading the page
+        # shrinks it, and it stays in memory.
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(0, self.nkeys):
+            self.assertEqual(cursor[k], self.value(k, self.nupdates))
+        cursor.close()
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_eviction_force_shrink), shrunk)
+        self.assertLess(self.get_stat(stat.conn.cache_bytes_inuse),
+            inuse - chains * 9 // 10)
+        self.assertEqual(self.get_stat(stat.conn.cache_read), reads)
+
+        # The page is still usable.
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(0, self.nkeys):
+            cursor[k] = self.value(k, 0)
+        for k in range(0, self.nkeys):
+            self.assertEqual(cursor[k], self.value(k, 0))
+        cursor.close()
+
+    # Keys differ in their last few bytes, after a prefix short enough to be
+    # compressed.
+    key_size = 250
+    nsearch_keys = 2000
+
+    def key(self, k):
+        return 'k' * self.key_size + '%06d' % k
+
+    def test_page_shrink_keys(self):
+        # Long keys with a common prefix are prefix-compressed on the page and
+        # instantiated in memory when searched for.
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,memory_page_max=200KB,'
+            'prefix_compression=true')
+
+        # Bulk-load the keys so they're written to a single page rather than
+        # being split in memory.
+        cursor = self.session.open_cursor(self.uri, None, 'bulk')
+        for k in range(0, self.nsearch_keys):
+            cursor[self.key(k)] = str(k)
+        cursor.close()
+        self.session.checkpoint()
+        self.reopen_conn()
+
+        # Search for every key: the clean page grows far past memory_page_max
+        # with instantiated keys.
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(0, self.nsearch_keys):
+            self.assertEqual(cursor[self.key(k)], str(k))
+        cursor.close()
+
+        keys = self.nsearch_keys * self.key_size
+        inuse = self.get_stat(stat.conn.cache_bytes_inuse)
+        self.assertGreater(inuse, keys)
+        reads = self.get_stat(stat.conn.cache_read)
+        shrunk = self.get_stat(stat.conn.cache_eviction_force_shrink)
+
+        # Once the page is dirty, reading it discards the keys searches rarely
+        # use, and it stays in memory.
+        cursor = self.session.open_cursor(self.uri)
+        cursor[self.key(0)] = 'updated'
+        self.assertEqual(cursor[self.key(1)], '1')
+        cursor.close()
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_eviction_force_shrink), shrunk)
+        self.assertLess(self.get_stat(stat.conn.cache_bytes_inuse),
+            inuse - keys // 2)
+        self.assertEqual(self.get_stat(stat.conn.cache_read), reads)
+
+        # The page is still correct.
+        cursor = self.session.open_cursor(self.uri)
+        self.assertEqual(cursor[self.key(0)], 'updated')
+        for k in range(1, self.nsearch_keys):
+            self.assertEqual(cursor[self.key(k)], str(k))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_compact03.py
+#   Test that the background compaction server reduces the file size
+#   without the application calling compact.
+#
+
+import os, time, wttest
+from wtdataset import SimpleDataSet
+
+class test_compact03(wttest.WiredTigerTestCase):
+    name = 'test_compact03'
+    uri = 'file:' + name
+    config = 'allocation_size=512,leaf_page_max=512,key_format=S'
+    nentries = 50000
+
+    def test_compact03(self):
+        ds = SimpleDataSet(self, self.uri, self.nentries, config=self.config)
+        ds.populate()
+        self.session.checkpoint()
+
+        # Remove most of the object and checkpoint, leaving free space at
+        # the start of the file.
+        c1 = self.session.open_cursor(self.uri, None)
+        c1.set_key(ds.key(5))
+        c2 = self.session.open_cursor(self.uri, None)
+        c2.set_key(ds.key(self.nentries - 5))
+        self.session.truncate(None, c1, c2, None)
+        c1.close()
+        c2.close()
+        self.session.checkpoint()
+        size = os.path.getsize(self.name)
+
+        # Start the server and wait for it to shrink the file.
+        self.conn.reconfigure('background_compact=(wait=1)')
+        for i in range(60):
+            if os.path.getsize(self.name) < size:
+                break
+            time.sleep(1)
+        self.assertLess(os.path.getsize(self.name), size)
+
+        # Stop the server, the file must verify.
+        self.conn.reconfigure('background_compact=(wait=0)')
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,133 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_cursor17.py
+#   Test that cached cursors outlive their session when the cursor pool is
+#   configured, and that the pool can be warmed when the connection opens.
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_cursor17(wttest.WiredTigerTestCase):
+    uri = 'table:test_cursor17'
+    conn_config = 'statistics=(fast),cursor_pool=(enabled=true)'
+
+    def get_stat(self, stat_key):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[stat_key][2]
+        stat_cursor.close()
+        return val
+
+    def reopened(self):
+        return self.get_stat(stat.conn.cursor_reopen)
+
+    def lookup(self, session, uri=None):
+        if uri == None:
+            uri = self.uri
+        c = session.open_cursor(uri, None)
+        c.set_key('key')
+        self.assertEqual(c.search(), 0)
+        self.assertEqual(c.get_value(), 'value')
+        c.close()
+
+    def populate(self, uri=None):
+        if uri == None:
+            uri = self.uri
+        self.session.create(uri, 'key_format=S,value_format=S')
+        c = self.session.open_cursor(uri, None)
+        c['key'] = 'value'
+        c.close()
+
+    # Sessions opened one after the other reuse each other's cursors.
+    def test_cursor_pool(self):
+        self.populate()
+        before = self.reopened()
+        for i in range(10):
+            session = self.conn.open_session()
+            self.lookup(session)
+            session.close()
+        # The first session opens the cursor, the rest reuse it.
+        self.assertEqual(self.reopened() - before, 9)
+
+    # Cursors left behind survive the object being dropped and recreated.
+    def test_cursor_pool_drop(self):
+        self.populate()
+        session = self.conn.open_session()
+        self.lookup(session)
+        session.close()
+        self.session.drop(self.uri, None)
+        self.populate()
+        session = self.conn.open_session()
+        self.lookup(session)
+        session.close()
+
+    # Dropping an object closes the cursors left behind on it, and only those.
+    def test_cursor_pool_drop_parked(self):
+        other = self.uri + '_other'
+        self.populate()
+        self.populate(other)
+        session = self.conn.open_session()
+        self.lookup(session)
+        self.lookup(session, other)
+        session.close()
+
+        cached = self.get_stat(stat.conn.cursor_cached_count)
+        self.assertGreaterEqual(cached, 2)
+        self.session.drop(self.uri, None)
+        self.assertEqual(self.get_stat(stat.conn.cursor_cached_count), cached - 1)
+
+        # The cursor on the other object is still there to be reused.
+        before = self.reopened()
+        session = self.conn.open_session()
+        self.lookup(session, other)
+        session.close()
+        self.assertEqual(self.reopened() - before, 1)
+
+    # The pool can be warmed when the connection is opened.
+    def test_cursor_pool_prewarm(self):
+        self.populate()
+        self.reopen_conn(config=self.conn_config +
+            ',cursor_pool=(prewarm=["' + self.uri + '"])')
+        before = self.reopened()
+        self.lookup(self.session)
+        self.assertEqual(self.reopened() - before, 1)
+
+    # Warming the pool requires the pool. The pool is enabled in the base
+    # configuration file written when the database was created, disable it.
+    def test_cursor_pool_prewarm_disabled(self):
+        self.populate()
+        self.close_conn()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open('.',
+            'cursor_pool=(enabled=false,prewarm=["' + self.uri + '"])'),
+            '/requires cursor_pool.enabled/')
+
+if __name__ == '__main__':
+    wttest.run()
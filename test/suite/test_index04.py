@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_index04.py
+#    Updates that leave index keys unchanged skip index maintenance
+class test_index04(wttest.WiredTigerTestCase):
+    '''Test table updates only touch indices whose keys change'''
+
+    conn_config = 'statistics=(all)'
+    nentries = 100
+
+    scenarios = make_scenarios([
+        ('update', dict(op='update', txn=False)),
+        ('update-txn', dict(op='update', txn=True)),
+        ('insert-overwrite', dict(op='insert', txn=False)),
+    ])
+
+    basename = 'test_index04'
+    tablename = 'table:' + basename
+
+    def get_stat(self, stat):
+        statcur = self.session.open_cursor('statistics:', None, None)
+        val = statcur[stat][2]
+        statcur.close()
+        return val
+
+    def check_index(self, name, expect):
+        cur = self.session.open_cursor(
+            'index:' + self.basename + ':' + name + '(k,a,b,c)', None, None)
+        got = sorted([list(cur.get_values()) for _ in cur])
+        cur.close()
+        self.assertEqual(sorted(expect), got)
+
+    def test_update_index_unchanged(self):
+        self.session.create(self.tablename,
+            'key_format=i,value_format=iiS,columns=(k,a,b,c)')
+        for col in ['a', 'b', 'c']:
+            self.session.create(
+                'index:' + self.basename + ':' + col, 'columns=(' + col + ')')
+
+        rows = {}
+        cur = self.session.open_cursor(self.tablename, None, None)
+        for k in range(self.nentries):
+            rows[k] = [k % 10, k % 7, str(k)]
+            cur[k] = tuple(rows[k])
+
+        # Change only column c: the indices on a and b are left alone.
+        before = self.get_stat(stat.conn.cursor_update_index_unchanged)
+        if self.txn:
+            self.session.begin_transaction()
+        for k in range(self.nentries):
+            rows[k][2] = 'new' + str(k)
+            cur.set_key(k)
+            cur.set_value(*rows[k])
+            if self.op == 'update':
+                self.assertEqual(cur.update(), 0)
+            else:
+                self.assertEqual(cur.insert(), 0)
+        if self.txn:
+            self.session.commit_transaction()
+        after = self.get_stat(stat.conn.cursor_update_index_unchanged)
+        self.assertEqual(after - before, 2 * self.nentries)
+        cur.close()
+
+        expect = [[k] + v for k, v in rows.items()]
+        for col in ['a', 'b', 'c']:
+            self.check_index(col, expect)
+
+if __name__ == '__main__':
+    wttest.run()
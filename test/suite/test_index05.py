@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_index05.py
+#    Indices with included columns answer projections without the table
+class test_index05(wttest.WiredTigerTestCase):
+    '''Test index-only reads using index key and included columns'''
+
+    conn_config = 'statistics=(all)'
+    nentries = 100
+
+    scenarios = make_scenarios([
+        ('fill', dict(fill=True)),
+        ('maintain', dict(fill=False)),
+    ])
+
+    basename = 'test_index05'
+    tablename = 'table:' + basename
+    indexname = 'index:' + basename + ':a'
+
+    def get_stat(self, stat):
+        statcur = self.session.open_cursor('statistics:', None, None)
+        val = statcur[stat][2]
+        statcur.close()
+        return val
+
+    def populate(self, rows):
+        cur = self.session.open_cursor(self.tablename, None, None)
+        for k in range(self.nentries):
+            rows[k] = [k % 10, 'b' + str(k), 'c' + str(k)]
+            cur[k] = tuple(rows[k])
+        cur.close()
+
+    def check(self, projection, cols, rows, index_only):
+        before = self.get_stat(stat.conn.cursor_index_only)
+        cur = self.session.open_cursor(
+            self.indexname + projection, None, None)
+        got = sorted([list(cur.get_values()) for _ in cur])
+        cur.close()
+        after = self.get_stat(stat.conn.cursor_index_only)
+        expect = sorted([[([k] + v)[c] for c in cols] for k, v in rows.items()])
+        self.assertEqual(expect, got)
+        self.assertEqual(after - before, self.nentries if index_only else 0)
+
+    def test_index_include(self):
+        self.session.create(self.tablename,
+            'key_format=i,value_format=iSS,columns=(k,a,b,c)')
+        rows = {}
+        if self.fill:
+            self.populate(rows)
+        self.session.create(self.indexname, 'columns=(a),include=(b)')
+        if not self.fill:
+            self.populate(rows)
+
+        # Updates to included columns are reflected in the index.
+        cur = self.session.open_cursor(self.tablename, None, None)
+        for k in range(0, self.nentries, 3):
+            rows[k][1] = 'new' + str(k)
+            cur[k] = tuple(rows[k])
+        cur.close()
+
+        # Columns 0..3 are k, a, b, c.
+        self.check('(k,a,b)', [0, 1, 2], rows, True)
+        self.check('(b,b,k)', [2, 2, 0], rows, True)
+        self.check('(a)', [1], rows, True)
+        self.check('(b,c)', [2, 3], rows, False)
+        self.check('', [1, 2, 3], rows, False)
+
+    def test_index_include_invalid(self):
+        self.session.create(self.tablename,
+            'key_format=i,value_format=iSS,columns=(k,a,b,c)')
+        msg = '/Invalid argument/'
+        for config in ['columns=(a),include=(k)',
+                       'columns=(a),include=(a)',
+                       'columns=(a),include=(b),immutable=true',
+                       'columns=(a),include=(d)']:
+            self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+                lambda: self.session.create(self.indexname, config), msg)
+
+if __name__ == '__main__':
+    wttest.run()
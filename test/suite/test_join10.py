@@ -0,0 +1,210 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os
+import wiredtiger, wttest, run
+from wtscenario import make_scenarios
+
+# test_join10.py
+#    Join equality entries checked with primary key hash sets
+class test_join10(wttest.WiredTigerTestCase):
+    nentries = 2000
+
+    # We need statistics for these tests.
+    conn_config = 'statistics=(all)'
+
+    isoscen = [
+        ('snapshot', dict(isolation='snapshot', hashed=True)),
+        ('read-committed', dict(isolation='read-committed', hashed=False)),
+        ('read-uncommitted', dict(isolation='read-uncommitted', hashed=False)),
+    ]
+
+    nestscen = [
+        ('flat', dict(nested=False)),
+        ('nested', dict(nested=True)),
+    ]
+
+    scenarios = make_scenarios(isoscen, nestscen)
+
+    def gen_values(self, i):
+        return [i % 10, i % 7, i % 100]
+
+    def populate(self):
+        c = self.session.open_cursor('table:join10', None, None)
+        for i in range(0, self.nentries):
+            c.set_key(i)
+            c.set_value(*self.gen_values(i))
+            c.insert()
+        c.close()
+
+    def index_cursor(self, name, val):
+        c = self.session.open_cursor('index:join10:' + name, None, None)
+        c.set_key(val)
+        self.assertEquals(0, c.search())
+        return c
+
+    def join_stats(self, jc):
+        stats = {}
+        statcur = self.session.open_cursor('statistics:join', jc, None)
+        while statcur.next() == 0:
+            [desc, pvalue, value] = statcur.get_values()
+            stats[desc] = value
+        statcur.close()
+        return stats
+
+    def create(self):
+        self.session.create('table:join10',
+                            'columns=(k,v0,v1,v2),key_format=i,value_format=iii')
+        self.session.create('index:join10:index0', 'columns=(v0)')
+        self.session.create('index:join10:index1', 'columns=(v1)')
+        self.session.create('index:join10:index2', 'columns=(v2)')
+        self.populate()
+
+    # Join order matters: the equality entries are joined after the range
+    # entries, the join is expected to check them first.
+    def open_join(self):
+        self.cursors = []
+        self.sub = None
+        jc = self.session.open_cursor('join:table:join10', None, None)
+        self.cursors.append(self.index_cursor('index2', 10))
+        self.session.join(jc, self.cursors[-1], 'compare=ge')
+        self.cursors.append(self.index_cursor('index2', 50))
+        self.session.join(jc, self.cursors[-1], 'compare=le')
+        self.cursors.append(self.index_cursor('index0', 3))
+        self.session.join(jc, self.cursors[-1], 'compare=eq')
+        if self.nested:
+            self.sub = self.session.open_cursor(
+                'join:table:join10', None, None)
+            self.cursors.append(self.index_cursor('index1', 1))
+            self.session.join(
+                self.sub, self.cursors[-1], 'compare=eq,operation=or')
+            self.cursors.append(self.index_cursor('index1', 4))
+            self.session.join(
+                self.sub, self.cursors[-1], 'compare=eq,operation=or')
+            self.session.join(jc, self.sub, None)
+            self.v1s = [1, 4]
+        else:
+            self.cursors.append(self.index_cursor('index1', 2))
+            self.session.join(jc, self.cursors[-1], 'compare=eq')
+            self.v1s = [2]
+        return jc
+
+    # The join cursor must be closed before the cursors joined to it.
+    def close_join(self, jc):
+        jc.close()
+        if self.sub != None:
+            self.sub.close()
+        for c in reversed(self.cursors):
+            c.close()
+
+    def matches(self, i, v0):
+        return 10 <= i % 100 <= 50 and v0 == 3 and i % 7 in self.v1s
+
+    def test_join(self):
+        self.create()
+        self.session.begin_transaction('isolation=' + self.isolation)
+        jc = self.open_join()
+        expect = [i for i in range(0, self.nentries) if self.matches(i, i % 10)]
+
+        # Iterate twice, the second time after a reset.
+        for iteration in range(0, 2):
+            got = []
+            while jc.next() == 0:
+                [k] = jc.get_keys()
+                self.assertEquals(self.gen_values(k), jc.get_values())
+                got.append(k)
+            self.assertEquals(expect, sorted(got))
+            jc.reset()
+
+        stats = self.join_stats(jc)
+        prefix = 'join: index:join10:index0: '
+        inserted = stats[prefix + 'items inserted into a hash set']
+        main_access = stats[prefix + 'accesses to the main table']
+        if self.hashed:
+            self.assertEquals(self.nentries // 10, inserted)
+            self.assertEquals(0, main_access)
+        else:
+            self.assertEquals(0, inserted)
+            self.assertGreater(main_access, 0)
+
+        self.session.commit_transaction()
+        self.close_join(jc)
+        self.session.drop('table:join10')
+
+    def update(self, session, k, v0):
+        c = session.open_cursor('table:join10', None, None)
+        c.set_key(k)
+        c.set_value(v0, k % 7, k % 100)
+        self.assertEquals(0, c.update())
+        c.close()
+
+    def check_join(self, jc, expect):
+        jc.reset()
+        got = []
+        while jc.next() == 0:
+            [k] = jc.get_keys()
+            got.append(k)
+        self.assertEquals(sorted(expect), sorted(got))
+
+    # Change rows after the join cursor is positioned: once the change is
+    # visible to the join, a row that stops satisfying the equality entry
+    # must not be returned and a row that starts satisfying it must be.
+    def test_join_update(self):
+        self.create()
+        self.session.begin_transaction('isolation=' + self.isolation)
+        jc = self.open_join()
+        self.assertEquals(0, jc.next())
+
+        keys = range(0, self.nentries)
+        expect = [i for i in keys if self.matches(i, i % 10)]
+        dropped = expect[-1]
+        added = [i for i in keys
+                 if self.matches(i, 3) and not self.matches(i, i % 10)][-1]
+
+        # The transaction's own update is visible at every isolation level.
+        self.update(self.session, dropped, 4)
+        expect.remove(dropped)
+        self.check_join(jc, expect)
+
+        # Another session's update is visible once it commits, but only to a
+        # later snapshot: the join cursor's reference cursors stay positioned
+        # and keep the snapshot pinned until the transaction resolves.
+        session = self.conn.open_session()
+        self.update(session, added, 3)
+        session.close()
+        self.session.commit_transaction()
+        self.session.begin_transaction('isolation=' + self.isolation)
+        expect.append(added)
+        self.check_join(jc, expect)
+
+        self.session.commit_transaction()
+        self.close_join(jc)
+        self.session.drop('table:join10')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -88,6 +88,15 @@ class test_jsondump02(wttest.WiredTigerTestCase, suite_subprocess):
         self.assertEqual(pos, len(expect))
         cursor.close()
 
+    # Search for each key using a JSON cursor on the URI.
+    def search_json(self, uri, expect):
+        cursor = self.session.open_cursor(uri, None, 'dump=json')
+        for k,v in expect:
+            cursor.set_key(k)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), v)
+        cursor.close()
+
     # Check the result of using a JSON cursor on the URI.
     def load_json(self, uri, inserts):
         cursor = self.session.open_cursor(uri, None, 'dump=json')
@@ -424,6 +433,10 @@ class test_jsondump02(wttest.WiredTigerTestCase, suite_subprocess):
         self.check_json(self.table_uri5, table5_json)
         self.check_json(self.table_uri6, table6_json)
 
+        # Escaped JSON keys must pack to the keys inserted by ordinary cursors.
+        self.search_json(self.table_uri5, table5_json)
+        self.search_json(self.table_uri6, table6_json)
+
         self.session.truncate(self.table_uri5, None, None, None)
         self.session.truncate(self.table_uri6, None, None, None)
         self.load_json(self.table_uri5, table5_json)
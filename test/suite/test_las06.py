@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_las06.py
+# Evict the history of several trees into the lookaside table: each tree's
+# entries go to the lookaside partition chosen by its btree ID, check every
+# partition is written and the history read back from each is correct.
+class test_las06(wttest.WiredTigerTestCase):
+    # Force a small cache.
+    conn_config = 'cache_size=50MB,statistics=(fast)'
+    session_config = 'isolation=snapshot'
+    ntables = 4
+    nrows = 10000
+
+    def uri(self, t):
+        return 'table:test_las06_' + str(t)
+
+    def las_uri(self, p):
+        if p == 0:
+            return 'file:WiredTigerLAS.wt'
+        return 'file:WiredTigerLAS.' + str(p) + '.wt'
+
+    # Lookaside records are written with overwrite cursors, they count as
+    # updates.
+    def las_inserts(self, p):
+        cstat = self.session.open_cursor(
+            'statistics:' + self.las_uri(p), None, None)
+        val = cstat[stat.dsrc.cursor_update][2]
+        cstat.close()
+        return val
+
+    def get_stat(self, stat_key):
+        cstat = self.session.open_cursor('statistics:', None, None)
+        val = cstat[stat_key][2]
+        cstat.close()
+        return val
+
+    def update_all(self, value):
+        for t in range(0, self.ntables):
+            cursor = self.session.open_cursor(self.uri(t))
+            for i in range(1, self.nrows + 1):
+                self.session.begin_transaction()
+                cursor[i] = value
+                self.session.commit_transaction()
+            cursor.close()
+
+    def check_all(self, session, value):
+        for t in range(0, self.ntables):
+            cursor = session.open_cursor(self.uri(t))
+            count = 0
+            for k, v in cursor:
+                self.assertEqual(v, value)
+                count += 1
+            self.assertEqual(count, self.nrows)
+            cursor.close()
+
+    def test_las_partitions(self):
+        # Consecutively created tables have consecutive btree IDs, so they use
+        # every partition.
+        for t in range(0, self.ntables):
+            self.session.create(self.uri(t), 'key_format=i,value_format=S')
+        value1 = 'a' * 500
+        self.update_all(value1)
+        self.session.checkpoint()
+
+        # Pin the first values with an old reader, then replace them: the
+        # cache can't hold both, the first values have to be evicted to the
+        # lookaside table.
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        self.check_all(session2, value1)
+
+        value2 = 'b' * 500
+        self.update_all(value2)
+        self.assertGreater(self.get_stat(stat.conn.cache_lookaside_insert), 0)
+        for p in range(0, self.ntables):
+            self.assertGreater(self.las_inserts(p), 0)
+
+        # The old reader reads the history back from each partition.
+        self.check_all(session2, value1)
+        self.check_all(self.session, value2)
+        session2.rollback_transaction()
+        session2.close()
+
+if __name__ == '__main__':
+    wttest.run()
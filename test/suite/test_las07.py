@@ -0,0 +1,124 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_las07.py
+# Small blocks of lookaside history are kept in memory with the evicted page,
+# up to 1% of the cache. Evict enough pages with a little history each to
+# reach the cap, check the rest is written to the lookaside table and the
+# history read back from both is correct.
+class test_las07(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=10MB,statistics=(all)'
+    session_config = 'isolation=snapshot'
+    uri = 'table:test_las07'
+    nrows = 150000
+
+    # Small pages, with a couple of updated rows each.
+    create_config = 'key_format=i,value_format=S,leaf_page_max=4KB'
+    update_every = 4
+
+    def get_stat(self, stat_key):
+        cstat = self.session.open_cursor('statistics:', None, None)
+        val = cstat[stat_key][2]
+        cstat.close()
+        return val
+
+    def las_writes(self):
+        total = 0
+        for p in range(0, 4):
+            las = 'file:WiredTigerLAS.wt' if p == 0 else \
+                'file:WiredTigerLAS.' + str(p) + '.wt'
+            cstat = self.session.open_cursor('statistics:' + las, None, None)
+            total += cstat[stat.dsrc.cursor_update][2]
+            cstat.close()
+        return total
+
+    def value(self, k, gen):
+        return str(gen) * 10 + '%08d' % k + '.' * 80
+
+    def check(self, session, gen):
+        cursor = session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            if k % self.update_every == 0:
+                self.assertEqual(v, self.value(k, gen))
+            else:
+                self.assertEqual(v, self.value(k, 0))
+            count += 1
+        self.assertEqual(count, self.nrows)
+        cursor.close()
+
+    def test_las_history_cap(self):
+        self.session.create(self.uri, self.create_config)
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(0, self.nrows):
+            cursor[k] = self.value(k, 0)
+        cursor.close()
+        self.session.checkpoint()
+
+        # Pin the original values with an old reader, then update a few rows
+        # on each page: the pages can only be evicted with their history.
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        cursor2 = session2.open_cursor(self.uri)
+        self.assertEqual(cursor2[0], self.value(0, 0))
+        cursor2.close()
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(0, self.nrows, self.update_every):
+            self.session.begin_transaction()
+            cursor[k] = self.value(k, 1)
+            self.session.commit_transaction()
+        cursor.close()
+
+        # Reading the tree evicts the updated pages. The history kept in
+        # memory reaches the cap, the rest goes to the lookaside table.
+        self.check(self.session, 1)
+        history = self.get_stat(stat.conn.cache_bytes_lookaside_history)
+        cap = 10 * 1024 * 1024 // 100
+        self.pr('history blocks ' +
+            str(self.get_stat(stat.conn.cache_lookaside_history_inmem)) +
+            ', bytes ' + str(history) + ', lookaside writes ' +
+            str(self.las_writes()))
+        self.assertGreater(history, cap // 2)
+        self.assertLess(history, 2 * cap)
+        self.assertGreater(self.las_writes(), 0)
+
+        # The history is part of the cache's memory.
+        self.assertGreaterEqual(
+            self.get_stat(stat.conn.cache_bytes_inuse), history)
+
+        # The old reader reads the history back from memory and the table.
+        self.check(session2, 0)
+        session2.rollback_transaction()
+        session2.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import re
+import wiredtiger, wttest
+
+# test_stat10.py
+#    Latency histogram statistics
+class test_stat10(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat10'
+    conn_config = 'statistics=(all)'
+    nentries = 1000
+
+    # Return the latency histograms in a statistics cursor, as a dictionary
+    # mapping each histogram's description to its buckets and percentiles.
+    def get_histograms(self, uri):
+        hists = {}
+        c = self.session.open_cursor(uri, None, None)
+        for id, desc, valstr, val in c:
+            m = re.match(r'latency: (.*) histogram \(bucket (\d\d)\) - ' +
+                r'(\d+)(?:-(\d+))?[mu]s\+?$', desc)
+            if m:
+                h = hists.setdefault(m.group(1), {'buckets' : []})
+                self.assertEqual(int(m.group(2)), len(h['buckets']))
+                h['buckets'].append((int(m.group(3)), val))
+                continue
+            m = re.match(r'latency: (.*) (99|99.9)th percentile', desc)
+            if m:
+                h = hists.setdefault(m.group(1), {'buckets' : []})
+                h[m.group(2)] = val
+        c.close()
+        return hists
+
+    # Calculate a percentile from a histogram's buckets, interpolating within
+    # the bucket holding it.
+    def percentile(self, buckets, permille):
+        total = sum(count for low, count in buckets)
+        if total == 0:
+            return 0
+        rank = (total * permille + 999) // 1000
+        count = 0
+        for i, (low, n) in enumerate(buckets):
+            if count + n >= rank:
+                break
+            count += n
+        if i == len(buckets) - 1:
+            return low
+        width = buckets[i + 1][0] - low
+        return low + (width * (rank - count) - 1) // n
+
+    def check_histograms(self, hists):
+        for desc, h in hists.items():
+            buckets = h['buckets']
+            self.assertEqual(len(buckets), 30)
+            self.assertEqual(buckets[0][0], 0)
+            self.assertEqual(buckets[-1][0], 1 << 17)
+            self.assertEqual(h['99'], self.percentile(buckets, 990))
+            self.assertEqual(h['99.9'], self.percentile(buckets, 999))
+            self.assertLessEqual(h['99'], h['99.9'])
+
+    def count(self, hists, desc):
+        return sum(count for low, count in hists[desc]['buckets'])
+
+    def test_latency_histograms(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1):
+            self.session.begin_transaction()
+            c[i] = 'value' + str(i)
+            self.session.commit_transaction()
+        for i in range(1, self.nentries + 1):
+            c.set_key(i)
+            self.assertEqual(c.search(), 0)
+        c.reset()
+        for i in range(1, self.nentries // 2 + 1):
+            c.set_key(i)
+            c.set_value('updated' + str(i))
+            self.assertEqual(c.update(), 0)
+        for i in range(1, self.nentries // 4 + 1):
+            c.set_key(i)
+            self.assertEqual(c.remove(), 0)
+        c.close()
+        self.session.checkpoint()
+
+        # Latency histograms are only kept for the database, not for each
+        # data source.
+        self.assertEqual(self.get_histograms('statistics:' + self.uri), {})
+
+        # The database's histograms include other objects' operations, and
+        # also count commits and checkpoint phases.
+        hists = self.get_histograms('statistics:')
+        self.check_histograms(hists)
+        self.assertGreaterEqual(
+            self.count(hists, 'cursor insert'), self.nentries)
+        self.assertGreaterEqual(
+            self.count(hists, 'cursor search'), self.nentries)
+        self.assertGreaterEqual(
+            self.count(hists, 'cursor update'), self.nentries // 2)
+        self.assertGreaterEqual(
+            self.count(hists, 'cursor remove'), self.nentries // 4)
+        self.assertGreaterEqual(
+            self.count(hists, 'transaction commit'), self.nentries)
+        for phase in ['metadata', 'prepare', 'sync', 'tree write']:
+            self.assertGreaterEqual(
+                self.count(hists, 'checkpoint ' + phase), 1)
+
+        # Clearing the statistics clears the histograms.
+        self.session.open_cursor(
+            'statistics:', None, 'statistics=(all,clear)').close()
+        hists = self.get_histograms('statistics:')
+        self.assertEqual(self.count(hists, 'cursor remove'), 0)
+        self.assertEqual(hists['cursor remove']['99'], 0)
+
+if __name__ == '__main__':
+    wttest.run()
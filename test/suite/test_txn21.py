@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2019 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn21.py
+#   Transactions: read-only transactions sharing a cached snapshot
+#
+
+import wttest
+from wiredtiger import stat
+
+class test_txn21(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'table:test_txn21'
+    key = 'key'
+    old_value = 'value: old'
+    new_value = 'value: new'
+
+    def get_stat(self, stat_key):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        value = stat_cursor[stat_key][2]
+        stat_cursor.close()
+        return value
+
+    def reader(self):
+        s = self.conn.open_session()
+        s.begin_transaction('isolation=snapshot')
+        cursor = s.open_cursor(self.uri, None)
+        return s, cursor
+
+    def test_snapshot_cache(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor[self.key] = self.old_value
+
+        # Leave an update uncommitted so readers have to build non-empty
+        # snapshots.
+        writer = self.conn.open_session()
+        wcursor = writer.open_cursor(self.uri, None)
+        writer.begin_transaction()
+        wcursor[self.key] = self.new_value
+
+        # Back-to-back readers with no commit in between share a snapshot.
+        hits = self.get_stat(stat.conn.txn_snapshot_cache_hit)
+        s1, c1 = self.reader()
+        self.assertEqual(c1[self.key], self.old_value)
+        s2, c2 = self.reader()
+        self.assertEqual(c2[self.key], self.old_value)
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_snapshot_cache_hit), hits)
+
+        # Once the writer commits, the cached snapshot is stale: new readers
+        # see the update, existing readers don't.
+        writer.commit_transaction()
+        s3, c3 = self.reader()
+        self.assertEqual(c3[self.key], self.new_value)
+        self.assertEqual(c1[self.key], self.old_value)
+        self.assertEqual(c2[self.key], self.old_value)
+
+        for s in [s1, s2, s3]:
+            s.rollback_transaction()
+            s.close()
+        writer.close()
+
+if __name__ == '__main__':
+    wttest.run()